@@ -89,6 +89,14 @@ class DirectoryStructure {
   /// \brief Return master config_list.json file path
   fs::path config_list() const;
 
+  /// \brief Return superlattice_cache.json file path, which stores candidate
+  /// supercell lattices for structure mapping
+  fs::path superlattice_cache() const;
+
+  /// \brief Return property cache directory path, which stores calculated
+  /// property values, such as correlations, for configurations
+  fs::path property_cache_dir() const;
+
   /// \brief Return enumerators plugin dir
   fs::path enumerator_plugins() const;
 
@@ -295,12 +295,20 @@ class ProjectSettings {
 
   // ** Database **
 
-  /// Set default database type name (for future)
+  /// Set default database type name ("jsonDB" or "binaryDB")
   void set_default_database_name(std::string _default_database_name);
 
   /// Get default database type name
   std::string default_database_name() const;
 
+  /// Set maximum number of unmodified Configuration held in memory by
+  /// databases that read Configuration on demand ("binaryDB")
+  void set_database_cache_size(Index _database_cache_size);
+
+  /// Get maximum number of unmodified Configuration held in memory by
+  /// databases that read Configuration on demand ("binaryDB")
+  Index database_cache_size() const;
+
   // ** Querie aliases **
 
   typedef std::string QueryAliasName;
@@ -483,6 +491,7 @@ class ProjectSettings {
 
   // Database
   std::string m_default_database_name;
+  Index m_database_cache_size;
 };
 
 /// Add directories for all cluster expansions
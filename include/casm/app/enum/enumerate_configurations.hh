@@ -43,6 +43,10 @@ struct ConfigEnumOptions {
   /// Printing verbosity level
   int verbosity = 10;
 
+  /// Maximum number of threads used to make enumerated configurations
+  /// primitive and canonical before database insertion
+  Index n_threads = 1;
+
   /// Use while transitioning Supercell to no longer need a `PrimClex const *`
   PrimClex const *primclex_ptr = nullptr;
 
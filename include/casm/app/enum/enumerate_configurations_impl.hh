@@ -74,6 +74,13 @@ namespace CASM {
 ///
 /// Note:
 /// - Uses CASM::log() for logging progress
+/// - If `options.n_threads > 1`, the enumerator output is not guaranteed for
+///   database insertion, and enumerated configurations are not being output,
+///   then enumerated configurations are collected in batches and made
+///   primitive and canonical using up to `options.n_threads` threads. The
+///   enumerator, filter, and database insertion remain on the calling thread,
+///   and configurations are inserted in the order enumerated, so the results
+///   are the same as with one thread.
 ///
 template <typename MakeEnumeratorFunction, typename InputNameValuePairIterator,
           typename ConfigEnumDataType>
@@ -119,14 +126,19 @@ void enumerate_configurations(
         make_enumerator_f(initial_state_index, input_name_value_pair.first,
                           input_name_value_pair.second);
 
-    for (Configuration const &configuration : enumerator) {
-      ConfigEnumDataType data{primclex,
-                              initial_state_index,
-                              input_name_value_pair.first,
-                              input_name_value_pair.second,
-                              enumerator,
-                              configuration};
+    // pipelined insertion: configurations are collected in batches, made
+    // primitive and canonical in parallel, and inserted in order
+    bool pipelined = options.n_threads > 1 && !data_out_ptr &&
+                     !is_guaranteed_for_database_insert(enumerator);
+    Index batch_size = 100 * options.n_threads;
+    std::vector<Configuration> batch;
+    auto insert_batch = [&]() {
+      DB::make_canonical_and_insert(batch, supercell_db, configuration_db,
+                                    options.primitive_only, options.n_threads);
+      batch.clear();
+    };
 
+    for (Configuration const &configuration : enumerator) {
       /// Use while transitioning Supercell to no longer need a `PrimClex const
       /// *`
       if (!configuration.supercell().has_primclex()) {
@@ -134,6 +146,25 @@ void enumerate_configurations(
       }
 
       ++count;
+      if (pipelined) {
+        if (options.filter && !options.filter(configuration)) {
+          ++count_filtered;
+        } else {
+          batch.push_back(configuration);
+          if (batch.size() == batch_size) {
+            insert_batch();
+          }
+        }
+        continue;
+      }
+
+      ConfigEnumDataType data{primclex,
+                              initial_state_index,
+                              input_name_value_pair.first,
+                              input_name_value_pair.second,
+                              enumerator,
+                              configuration};
+
       if (options.filter && !options.filter(configuration)) {
         data.is_excluded_by_filter = true;
         ++count_filtered;
@@ -151,6 +182,9 @@ void enumerate_configurations(
         (*data_out_ptr)(formatter, data);
       }
     }
+    if (batch.size()) {
+      insert_batch();
+    }
 
     Index num_after = configuration_db.size();
     log << dry_run_msg << count << " configurations"
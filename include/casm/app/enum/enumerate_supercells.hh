@@ -38,6 +38,10 @@ struct EnumerateSupercellsOptions {
   /// Printing verbosity level
   int verbosity = 10;
 
+  /// Maximum number of threads used to enumerate superlattices and make them
+  /// canonical
+  Index n_threads = 1;
+
   /// Use while transitioning Supercell to no longer need a `PrimClex const *`
   PrimClex const *primclex_ptr = nullptr;
 
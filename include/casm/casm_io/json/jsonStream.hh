@@ -0,0 +1,235 @@
+#ifndef CASM_jsonStream
+#define CASM_jsonStream
+
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "casm/casm_io/json/jsonParser.hh"
+#include "casm/global/definitions.hh"
+
+namespace CASM {
+
+/// \brief Receives events from parse_json
+///
+/// Implement jsonEventHandler to process JSON data as it is read, without
+/// first constructing a jsonParser for the entire document. For each value,
+/// parse_json calls exactly one of the scalar methods (on_null, on_bool,
+/// on_int, on_uint, on_real, on_string), or a matching on_begin_object /
+/// on_end_object or on_begin_array / on_end_array pair with the contained
+/// values in between. Object members are preceded by on_key.
+///
+/// The std::string passed to on_string and on_key may be moved from.
+class jsonEventHandler {
+ public:
+  virtual ~jsonEventHandler() {}
+
+  virtual void on_null() = 0;
+
+  virtual void on_bool(bool value) = 0;
+
+  virtual void on_int(boost::int64_t value) = 0;
+
+  /// \brief Called for integers too large for boost::int64_t
+  virtual void on_uint(boost::uint64_t value) = 0;
+
+  virtual void on_real(double value) = 0;
+
+  virtual void on_string(std::string &value) = 0;
+
+  virtual void on_begin_object() = 0;
+
+  /// \brief Called with the name of each object member, before its value
+  virtual void on_key(std::string &name) = 0;
+
+  virtual void on_end_object() = 0;
+
+  virtual void on_begin_array() = 0;
+
+  virtual void on_end_array() = 0;
+};
+
+/// \brief Read one JSON value from a stream, passing events to a handler
+void parse_json(std::istream &stream, jsonEventHandler &handler);
+
+/// \brief Construct a jsonParser from parse_json events
+///
+/// Values are constructed in place, without intermediate copies.
+///
+/// \code
+/// jsonParser json;
+/// jsonBuilder builder{json};
+/// parse_json(stream, builder);
+/// \endcode
+class jsonBuilder : public jsonEventHandler {
+ public:
+  explicit jsonBuilder(jsonParser &json);
+
+  void on_null() override;
+  void on_bool(bool value) override;
+  void on_int(boost::int64_t value) override;
+  void on_uint(boost::uint64_t value) override;
+  void on_real(double value) override;
+  void on_string(std::string &value) override;
+  void on_begin_object() override;
+  void on_key(std::string &name) override;
+  void on_end_object() override;
+  void on_begin_array() override;
+  void on_end_array() override;
+
+  /// \brief True if a complete value has been constructed
+  bool complete() const { return m_started && m_stack.empty(); }
+
+ private:
+  /// \brief Return the value to be set by the next event
+  json_spirit::mValue &_next_value();
+
+  jsonParser &m_json;
+
+  // open objects and arrays
+  std::vector<json_spirit::mValue *> m_stack;
+
+  // name of the next object member
+  std::string m_key;
+
+  bool m_started;
+};
+
+/// \brief Read selected values from a JSON document one at a time
+///
+/// The path to a value is the list of object member names and array indices
+/// (as strings) leading to it from the document root. For each value, in
+/// document order, `select(path)` is called. If it returns true, a jsonParser
+/// is constructed for just that value and passed to `f(path, json)`, which
+/// may modify it. Otherwise, the value is skipped, or, if it is an object or
+/// array, its contents are checked.
+///
+/// This allows processing large documents, such as the configuration list,
+/// while holding only one selected value in memory at a time.
+class jsonSelectiveReader : public jsonEventHandler {
+ public:
+  typedef std::vector<std::string> Path;
+  typedef std::function<bool(Path const &)> SelectFunction;
+  typedef std::function<void(Path const &, jsonParser &)> ValueFunction;
+
+  jsonSelectiveReader(SelectFunction select, ValueFunction f);
+
+  void on_null() override;
+  void on_bool(bool value) override;
+  void on_int(boost::int64_t value) override;
+  void on_uint(boost::uint64_t value) override;
+  void on_real(double value) override;
+  void on_string(std::string &value) override;
+  void on_begin_object() override;
+  void on_key(std::string &name) override;
+  void on_end_object() override;
+  void on_begin_array() override;
+  void on_end_array() override;
+
+ private:
+  /// \brief Update the path for a new value, and return true if the value
+  /// begins a selected value
+  bool _begin_value();
+
+  /// \brief Pass a completed selected value to m_f
+  void _finish_value();
+
+  SelectFunction m_select;
+  ValueFunction m_f;
+
+  // path to the current value, outside of selected values
+  Path m_path;
+
+  // for each open array or object outside of selected values, the number of
+  // values read if an array, or -1 if an object
+  std::vector<Index> m_count;
+
+  // the current selected value, and its depth of open objects and arrays
+  jsonParser m_json;
+  std::unique_ptr<jsonBuilder> m_builder;
+  Index m_depth;
+};
+
+/// \brief Write JSON to a stream incrementally
+///
+/// Output is formatted the same as `json_spirit::write_stream` with the same
+/// `indent`, `prec`, and `options` arguments, so `jsonParser::print` output
+/// is reproduced by `jsonStreamWriter(stream, indent, prec,
+/// json_spirit::pretty_print | json_spirit::raw_utf8 |
+/// json_spirit::single_line_arrays)`. Objects and arrays opened with
+/// begin_object and begin_array are written in column format, as
+/// json_spirit writes objects and arrays with object or array elements.
+///
+/// Output is buffered, and written to the stream when the buffer is full,
+/// when flush() is called, or on destruction.
+///
+/// \code
+/// jsonStreamWriter writer{stream, 0, 12};
+/// writer.begin_object();
+/// for (auto const &value : values) {
+///   writer.key(value.name());
+///   writer.value(jsonParser{value});
+/// }
+/// writer.end_object();
+/// writer.flush();
+/// \endcode
+class jsonStreamWriter {
+ public:
+  jsonStreamWriter(std::ostream &stream, unsigned int indent = 2,
+                   unsigned int prec = 12, unsigned int options = 0);
+
+  ~jsonStreamWriter();
+
+  void begin_object();
+
+  /// \brief Write an object member name, to be followed by its value
+  void key(std::string const &name);
+
+  void end_object();
+
+  void begin_array();
+
+  void end_array();
+
+  /// \brief Write a complete value
+  void value(json_spirit::mValue const &json);
+
+  /// \brief Write buffered output to the stream
+  void flush();
+
+ private:
+  void _begin_item();
+  void _end_container(char end_char);
+  void _write_value(json_spirit::mValue const &json);
+  void _write_string(std::string const &str);
+  void _write_real(json_spirit::mValue const &json, double d);
+  void _new_line();
+  void _indent();
+  void _space();
+  void _put(char c);
+  void _put(char const *str, std::size_t size);
+  void _put(char const *str) { _put(str, std::strlen(str)); }
+  void _put(std::string const &str) { _put(str.data(), str.size()); }
+
+  std::ostream &m_stream;
+  std::string m_buffer;
+  unsigned int m_indent;
+  unsigned int m_prec;
+  bool m_pretty;
+  bool m_raw_utf8;
+  bool m_esc_nonascii;
+  bool m_remove_trailing_zeros;
+
+  // for each open object or array: true if it has no items yet
+  std::vector<bool> m_empty;
+
+  // true if the next value follows an object member name
+  bool m_after_key;
+};
+
+}  // namespace CASM
+
+#endif
@@ -0,0 +1,102 @@
+#ifndef CASM_CanonicalOccupationGenerator
+#define CASM_CanonicalOccupationGenerator
+
+#include <utility>
+#include <vector>
+
+#include "casm/global/definitions.hh"
+#include "casm/global/eigen.hh"
+
+namespace CASM {
+
+class PermuteIterator;
+
+/** \ingroup ConfigEnumGroup
+ *  @{
+ */
+
+/// \brief Generate canonical occupations by orderly generation
+///
+/// Generates, in lexicographic order, each occupation vector `occ` which is
+/// canonical with respect to a group of site permutations, meaning that for
+/// every permutation `A` in the group `occ` is not lexicographically less
+/// than `A*occ`, where `(A*occ)[i] = occ[A.permute_ind(i)]`. This is the same
+/// comparison used by `Configuration::is_canonical` for configurations whose
+/// only non-zero DoF is isotropic occupation.
+///
+/// Site occupations are assigned in order of site index. After assigning
+/// sites `[0, k)`, each permutation `A` is compared with the partial
+/// assignment on the leading sites `i` for which both `i` and
+/// `A.permute_ind(i)` are assigned:
+/// - If `occ[i] < (A*occ)[i]` at the first difference, no completion of the
+///   partial assignment is canonical and the branch is pruned.
+/// - If `occ[i] > (A*occ)[i]` at the first difference, `A` can not make any
+///   completion non-canonical and is not checked again in the branch.
+///
+/// Only canonical occupations and the partial assignments leading to them
+/// are visited, so the work is roughly proportional to the number of
+/// canonical occupations rather than the number of all occupations.
+///
+/// Usage:
+/// \code
+/// CanonicalOccupationGenerator generator{min_allowed, max_allowed, begin,
+///                                        end};
+/// while (generator.valid()) {
+///   use(generator.occupation());
+///   generator.next();
+/// }
+/// \endcode
+class CanonicalOccupationGenerator {
+ public:
+  /// \brief Construct an invalid generator
+  CanonicalOccupationGenerator();
+
+  /// \brief Constructor
+  CanonicalOccupationGenerator(Eigen::VectorXi const &min_allowed,
+                               Eigen::VectorXi const &max_allowed,
+                               PermuteIterator begin, PermuteIterator end);
+
+  /// \brief True if occupation() is a canonical occupation
+  bool valid() const { return m_valid; }
+
+  /// \brief Current canonical occupation
+  std::vector<int> const &occupation() const { return m_occ; }
+
+  /// \brief Advance to the next canonical occupation
+  bool next();
+
+ private:
+  /// \brief Find the next canonical occupation, beginning by trying the
+  /// current value of m_occ[k] on site k
+  bool _search(Index k);
+
+  /// \brief Check permutations with site k assigned
+  bool _extend(Index k);
+
+  /// Number of sites
+  Index m_n_sites;
+
+  /// Minimum allowed occupation value, by site
+  std::vector<int> m_min_allowed;
+
+  /// Maximum allowed occupation value, by site
+  std::vector<int> m_max_allowed;
+
+  /// Site permutations, excluding the identity, as
+  /// `m_permute_ind[op * m_n_sites + i] = A.permute_ind(i)`
+  std::vector<Index> m_permute_ind;
+
+  /// Current occupation
+  std::vector<int> m_occ;
+
+  /// m_active[k]: (op index, first undetermined site index) for permutations
+  /// that have not been decided by the assignment of sites [0, k)
+  std::vector<std::vector<std::pair<Index, Index> > > m_active;
+
+  bool m_valid;
+};
+
+/** @} */
+}  // namespace CASM
+
+#endif
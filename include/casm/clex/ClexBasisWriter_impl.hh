@@ -202,6 +202,10 @@ void ClexBasisWriter::print_clexulator(std::string class_name,
       << "extern \"C\" CASM::clexulator::BaseClexulator *make_" + class_name
       << "();\n\n"
 
+      << "/// \\brief Returns the CASM_CLEXULATOR_ABI_VERSION this library "
+         "was compiled with\n"
+      << "extern \"C\" int clexulator_abi_version_" + class_name << "();\n\n"
+
       << "namespace CASM {\n"
       << "namespace clexulator {\n\n"
 
@@ -242,6 +246,12 @@ void ClexBasisWriter::print_clexulator(std::string class_name,
       << "() {\n"
       << indent << "  return new CASM::clexulator::" + class_name + "();\n"
       << indent << "}\n\n"
+      << indent
+      << "/// \\brief Returns the CASM_CLEXULATOR_ABI_VERSION this library "
+         "was compiled with\n"
+      << indent << "int clexulator_abi_version_" + class_name << "() {\n"
+      << indent << "  return CASM_CLEXULATOR_ABI_VERSION;\n"
+      << indent << "}\n\n"
       << "}\n"
 
       << "\n";
@@ -285,11 +295,12 @@ std::tuple<std::string, std::string> clexulator_orbit_function_strings(
 
     method_name = method_namer(0, nf);
     bfunc_def_stream << indent << "  template<typename Scalar>\n"
-                     << indent << "  Scalar " << method_name << "() const;\n";
+                     << indent << "  Scalar " << method_name
+                     << "(EvaluationContext &_context) const;\n";
 
     bfunc_imp_stream << indent << "template<typename Scalar>\n"
                      << indent << "Scalar " << class_name << "::" << method_name
-                     << "() const {\n"
+                     << "(EvaluationContext &_context) const {\n"
                      << indent << "  return " << formulae[nf] << ";\n"
                      << indent << "}\n";
   }
@@ -332,11 +343,13 @@ std::tuple<std::string, std::string> clexulator_flower_function_strings(
 
       method_name = method_namer(nbor_ind, nf);
       bfunc_def_stream << indent << "  template<typename Scalar>\n"
-                       << indent << "  Scalar " << method_name << "() const;\n";
+                       << indent << "  Scalar " << method_name
+                       << "(EvaluationContext &_context) const;\n";
 
       bfunc_imp_stream << indent << "template<typename Scalar>\n"
                        << indent << "Scalar " << class_name
-                       << "::" << method_name << "() const {\n"
+                       << "::" << method_name
+                       << "(EvaluationContext &_context) const {\n"
                        << indent << "  return " << formulae[nf] << ";\n"
                        << indent << "}\n";
     }
@@ -414,12 +427,14 @@ std::tuple<std::string, std::string> clexulator_dflower_function_strings(
 
       bfunc_def_stream << indent << "  template<typename Scalar>\n"
                        << indent << "  Scalar " << method_name
-                       << "(int occ_i, int occ_f) const;\n";
+                       << "(EvaluationContext &_context, int occ_i, int occ_f) "
+                          "const;\n";
 
       bfunc_imp_stream << indent << "  template<typename Scalar>\n"
                        << indent << "Scalar " << class_name
                        << "::" << method_name
-                       << "(int occ_i, int occ_f) const {\n"
+                       << "(EvaluationContext &_context, int occ_i, int occ_f) "
+                          "const {\n"
                        << indent << "  return " << formulae[nf] << ";\n"
                        << indent << "}\n";
     }
@@ -934,7 +949,9 @@ std::string clexulator_point_prepare_definition(
     std::map<xtal::UnitCellCoord, std::set<xtal::UnitCellCoord> > const &_nhood,
     PrimNeighborList &_nlist, std::string const &indent) {
   std::string result(indent + "template<typename Scalar>\n" + indent + "void " +
-                     class_name + "::_point_prepare(int nlist_ind) const {\n");
+                     class_name +
+                     "::_point_prepare(EvaluationContext &_context, int "
+                     "nlist_ind) const {\n");
 
   // Use known clexbasis dependencies to construct point_prepare routine
   for (auto const &doftype : clex.site_bases()) {
@@ -967,7 +984,9 @@ std::string clexulator_global_prepare_definition(
     std::map<xtal::UnitCellCoord, std::set<xtal::UnitCellCoord> > const &_nhood,
     PrimNeighborList &_nlist, std::string const &indent) {
   std::string result(indent + "template<typename Scalar>\n" + indent + "void " +
-                     class_name + "::_global_prepare() const {\n");
+                     class_name +
+                     "::_global_prepare(EvaluationContext &_context) const "
+                     "{\n");
 
   // Use known clexbasis dependencies to construct point_prepare routine
   for (auto const &doftype : clex.site_bases()) {
@@ -23,7 +23,9 @@ class RuntimeLibrary;
 ///
 /// CASM generates code for very efficient calculation of basis functions via
 /// the print_clexulator function. This source code may be compiled, linked,
-/// and used at runtime via Clexulator.
+/// and used at runtime via Clexulator. Alternatively, occupation basis
+/// functions may be evaluated from tables, without compilation (see
+/// make_table_clexulator).
 ///
 /// \ingroup Clexulator
 ///
@@ -37,6 +39,12 @@ class Clexulator {
   Clexulator(std::string name, fs::path dirpath, PrimNeighborList &nlist,
              std::string compile_options, std::string so_options);
 
+  /// \brief Construct a Clexulator from a BaseClexulator that does not
+  /// require a runtime library
+  Clexulator(std::string name,
+             std::unique_ptr<clexulator::BaseClexulator> clex,
+             PrimNeighborList &nlist);
+
   /// \brief Copy constructor
   Clexulator(const Clexulator &B);
 
@@ -57,8 +65,8 @@ class Clexulator {
     swap(first.m_lib, second.m_lib);
   }
 
-  /// \brief Is runtime library loaded?
-  bool initialized() const { return m_lib.get() != nullptr; }
+  /// \brief Is the BaseClexulator constructed (i.e. runtime library loaded)?
+  bool initialized() const { return m_clex.get() != nullptr; }
 
   /// \brief Name
   std::string name() const { return m_name; }
@@ -87,6 +95,17 @@ class Clexulator {
   clexulator::ClexParamKey const &param_key(
       std::string const &_param_name) const;
 
+  /// \brief Construct an EvaluationContext, for evaluating correlations on
+  /// one thread while other threads use this Clexulator
+  ///
+  /// Each of the `calc_X` methods has an overload taking an EvaluationContext
+  /// as the first argument. Those without an EvaluationContext use a default
+  /// context, and so must not be called by more than one thread at once. The
+  /// EvaluationContext may only be used with this Clexulator (not copies).
+  clexulator::EvaluationContext make_context() const {
+    return clexulator::EvaluationContext{*m_clex};
+  }
+
   /// \brief The UnitCellCoord involved in calculating the basis functions,
   /// relative origin UnitCell
   const std::set<xtal::UnitCell> &neighborhood() const {
@@ -161,6 +180,18 @@ class Clexulator {
     m_clex->calc_global_corr_contribution(_corr_begin);
   }
 
+  /// \brief Same as above, using an EvaluationContext
+  void calc_global_corr_contribution(clexulator::EvaluationContext &_context,
+                                     ConfigDoF const &_input_configdof,
+                                     long int const *_nlist_begin,
+                                     long int const *_nlist_end,
+                                     double *_corr_begin,
+                                     double *_corr_end) const {
+    m_clex->set_configdofvalues(_context, _input_configdof.values());
+    m_clex->set_nlist(_context, _nlist_begin);
+    m_clex->calc_global_corr_contribution(_context, _corr_begin);
+  }
+
   /// \brief Calculate contribution to global correlations from one unit cell
   ///
   /// \param _corr_begin Pointer to beginning of data structure where
@@ -184,6 +215,16 @@ class Clexulator {
     m_clex->calc_global_corr_contribution();
   }
 
+  /// \brief Same as above, using an EvaluationContext
+  void calc_global_corr_contribution(clexulator::EvaluationContext &_context,
+                                     ConfigDoF const &_input_configdof,
+                                     long int const *_nlist_begin,
+                                     long int const *_nlist_end) const {
+    m_clex->set_configdofvalues(_context, _input_configdof.values());
+    m_clex->set_nlist(_context, _nlist_begin);
+    m_clex->calc_global_corr_contribution(_context);
+  }
+
   /// \brief Calculate contribution to select global correlations from one unit
   /// cell
   ///
@@ -214,6 +255,18 @@ class Clexulator {
         _corr_begin, _corr_ind_begin, _corr_ind_end);
   }
 
+  /// \brief Same as above, using an EvaluationContext
+  void calc_restricted_global_corr_contribution(
+      clexulator::EvaluationContext &_context,
+      ConfigDoF const &_input_configdof, long int const *_nlist_begin,
+      long int const *_nlist_end, double *_corr_begin, double *_corr_end,
+      size_type const *_corr_ind_begin, size_type const *_corr_ind_end) const {
+    m_clex->set_configdofvalues(_context, _input_configdof.values());
+    m_clex->set_nlist(_context, _nlist_begin);
+    m_clex->calc_restricted_global_corr_contribution(
+        _context, _corr_begin, _corr_ind_begin, _corr_ind_end);
+  }
+
   /// \brief Calculate point correlations about basis site 'neighbor_ind'
   ///
   /// \brief neighbor_ind Basis site index about which to calculate correlations
@@ -237,6 +290,17 @@ class Clexulator {
     m_clex->calc_point_corr(neighbor_ind, _corr_begin);
   }
 
+  /// \brief Same as above, using an EvaluationContext
+  void calc_point_corr(clexulator::EvaluationContext &_context,
+                       ConfigDoF const &_input_configdof,
+                       long int const *_nlist_begin, long int const *_nlist_end,
+                       int neighbor_ind, double *_corr_begin,
+                       double *_corr_end) const {
+    m_clex->set_configdofvalues(_context, _input_configdof.values());
+    m_clex->set_nlist(_context, _nlist_begin);
+    m_clex->calc_point_corr(_context, neighbor_ind, _corr_begin);
+  }
+
   /// \brief Calculate select point correlations about basis site 'neighbor_ind'
   ///
   /// \brief neighbor_ind Basis site index about which to calculate correlations
@@ -266,6 +330,20 @@ class Clexulator {
                                        _corr_ind_begin, _corr_ind_end);
   }
 
+  /// \brief Same as above, using an EvaluationContext
+  void calc_restricted_point_corr(clexulator::EvaluationContext &_context,
+                                  ConfigDoF const &_input_configdof,
+                                  long int const *_nlist_begin,
+                                  long int const *_nlist_end, int neighbor_ind,
+                                  double *_corr_begin, double *_corr_end,
+                                  size_type const *_corr_ind_begin,
+                                  size_type const *_corr_ind_end) const {
+    m_clex->set_configdofvalues(_context, _input_configdof.values());
+    m_clex->set_nlist(_context, _nlist_begin);
+    m_clex->calc_restricted_point_corr(_context, neighbor_ind, _corr_begin,
+                                       _corr_ind_begin, _corr_ind_end);
+  }
+
   /// \brief Calculate the change in point correlations due to changing an
   /// occupant
   ///
@@ -293,6 +371,19 @@ class Clexulator {
     m_clex->calc_delta_point_corr(neighbor_ind, occ_i, occ_f, _corr_begin);
   }
 
+  /// \brief Same as above, using an EvaluationContext
+  void calc_delta_point_corr(clexulator::EvaluationContext &_context,
+                             ConfigDoF const &_input_configdof,
+                             long int const *_nlist_begin,
+                             long int const *_nlist_end, int neighbor_ind,
+                             int occ_i, int occ_f, double *_corr_begin,
+                             double *_corr_end) const {
+    m_clex->set_configdofvalues(_context, _input_configdof.values());
+    m_clex->set_nlist(_context, _nlist_begin);
+    m_clex->calc_delta_point_corr(_context, neighbor_ind, occ_i, occ_f,
+                                  _corr_begin);
+  }
+
   /// \brief Calculate the change in select point correlations due to changing
   /// an occupant
   ///
@@ -334,6 +425,79 @@ class Clexulator {
                                              _corr_ind_end);
   }
 
+  /// \brief Same as above, using an EvaluationContext
+  void calc_restricted_delta_point_corr(
+      clexulator::EvaluationContext &_context,
+      ConfigDoF const &_input_configdof, long int const *_nlist_begin,
+      long int const *_nlist_end, int neighbor_ind, int occ_i, int occ_f,
+      double *_corr_begin, double *_corr_end, size_type const *_corr_ind_begin,
+      size_type const *_corr_ind_end) const {
+    m_clex->set_configdofvalues(_context, _input_configdof.values());
+    m_clex->set_nlist(_context, _nlist_begin);
+    m_clex->calc_restricted_delta_point_corr(_context, neighbor_ind, occ_i,
+                                             occ_f, _corr_begin,
+                                             _corr_ind_begin, _corr_ind_end);
+  }
+
+  /// \brief Calculate the change in select point correlations due to a
+  /// sequence of occupant changes
+  ///
+  /// \brief _delta_begin,_delta_end Range of OccDelta, specifying the neighbor
+  /// list, neighbor index, and initial and final occupant of each change
+  /// \brief _corr_begin Pointer to beginning of data structure where the total
+  /// difference in correlations is written
+  /// \param _corr_ind_begin,_corr_ind_end Pointers to range indicating which
+  /// correlations should be calculated
+  ///
+  /// Call using:
+  /// \code
+  /// // swap occupants on sites l_a and l_b
+  /// clexulator::OccDelta delta[2];
+  /// delta[0].nlist_begin =
+  ///     nlist.sites(nlist.unitcell_index(l_a)).data();
+  /// delta[0].neighbor_ind = nlist.neighbor_index(l_a);
+  /// delta[0].occ_i = occ_a;
+  /// delta[0].occ_f = occ_b;
+  /// ... // same for delta[1]
+  /// myclexulator.calc_restricted_delta_point_corr(my_configdof,
+  ///                                               delta,
+  ///                                               delta + 2,
+  ///                                               correlation_array.begin(),
+  ///                                               correlation_array.end(),
+  ///                                               _corr_ind.begin(),
+  ///                                               _corr_ind.end());
+  /// \endcode
+  ///
+  void calc_restricted_delta_point_corr(
+      ConfigDoF const &_input_configdof,
+      clexulator::OccDelta const *_delta_begin,
+      clexulator::OccDelta const *_delta_end, double *_corr_begin,
+      double *_corr_end, size_type const *_corr_ind_begin,
+      size_type const *_corr_ind_end) const {
+    m_clex->set_configdofvalues(_input_configdof.values());
+    m_clex->calc_restricted_delta_point_corr(_delta_begin, _delta_end,
+                                             _corr_begin, _corr_ind_begin,
+                                             _corr_ind_end);
+  }
+
+  /// \brief Same as above, using an EvaluationContext
+  ///
+  /// Notes:
+  /// - The occupation values are temporarily modified during evaluation, so
+  ///   they must not be read by other threads at the same time
+  void calc_restricted_delta_point_corr(
+      clexulator::EvaluationContext &_context,
+      ConfigDoF const &_input_configdof,
+      clexulator::OccDelta const *_delta_begin,
+      clexulator::OccDelta const *_delta_end, double *_corr_begin,
+      double *_corr_end, size_type const *_corr_ind_begin,
+      size_type const *_corr_ind_end) const {
+    m_clex->set_configdofvalues(_context, _input_configdof.values());
+    m_clex->calc_restricted_delta_point_corr(_context, _delta_begin,
+                                             _delta_end, _corr_begin,
+                                             _corr_ind_begin, _corr_ind_end);
+  }
+
  private:
   std::string m_name;
   std::unique_ptr<clexulator::BaseClexulator> m_clex;
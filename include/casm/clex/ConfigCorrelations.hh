@@ -14,8 +14,9 @@ class UnitCellCoord;
 }  // namespace xtal
 
 namespace clexulator {
+class EvaluationContext;
 class SuperNeighborList;
-}
+}  // namespace clexulator
 using clexulator::SuperNeighborList;
 
 class Clexulator;
@@ -31,13 +32,13 @@ class SupercellSymInfo;
 
 /// \brief Returns correlations using 'clexulator'.
 Eigen::VectorXd correlations(Configuration const &config,
-                             Clexulator const &clexulator);
+                             Clexulator const &clexulator, Index n_threads = 1);
 
 /// \brief Sets correlations using 'clexulator'. Mean of the contribution from
 /// every unit cell.
 void correlations(Eigen::VectorXd &corr, ConfigDoF const &configdof,
                   SuperNeighborList const &supercell_neighbor_list,
-                  Clexulator const &clexulator);
+                  Clexulator const &clexulator, Index n_threads = 1);
 
 /// \brief Sets correlations using 'clexulator', restricted to specified
 /// correlation indices. Mean of the contribution from every unit cell.
@@ -45,13 +46,14 @@ void restricted_correlations(Eigen::VectorXd &corr, ConfigDoF const &configdof,
                              SuperNeighborList const &supercell_neighbor_list,
                              Clexulator const &clexulator,
                              unsigned int const *corr_indices_begin,
-                             unsigned int const *corr_indices_end);
+                             unsigned int const *corr_indices_end,
+                             Index n_threads = 1);
 
 /// \brief Sets correlations using 'clexulator'. Sum of the contribution from
 /// every unit cell.
 void extensive_correlations(Eigen::VectorXd &corr, ConfigDoF const &configdof,
                             SuperNeighborList const &supercell_neighbor_list,
-                            Clexulator const &clexulator);
+                            Clexulator const &clexulator, Index n_threads = 1);
 
 /// \brief Sets correlations using 'clexulator', restricted to specified
 /// correlation indices. Sum of the contribution from every unit cell.
@@ -59,7 +61,7 @@ void restricted_extensive_correlations(
     Eigen::VectorXd &corr, ConfigDoF const &configdof,
     SuperNeighborList const &supercell_neighbor_list,
     Clexulator const &clexulator, unsigned int const *corr_indices_begin,
-    unsigned int const *corr_indices_end);
+    unsigned int const *corr_indices_end, Index n_threads = 1);
 
 // --- Correlations, contribution of a particular unit cell ---
 
@@ -76,7 +78,8 @@ void corr_contribution(Eigen::VectorXd &corr, Index linear_unitcell_index,
 
 /// Returns correlation contributions from all unit cells, not normalized.
 Eigen::MatrixXd all_corr_contribution(Configuration const &config,
-                                      Clexulator const &clexulator);
+                                      Clexulator const &clexulator,
+                                      Index n_threads = 1);
 
 // --- Point correlations ---
 
@@ -104,7 +107,8 @@ void restricted_point_corr(Eigen::VectorXd &corr, Index linear_unitcell_index,
 /// \brief Returns point correlations from all sites, normalized by cluster
 /// orbit size
 Eigen::MatrixXd all_point_corr(Configuration const &config,
-                               Clexulator const &clexulator);
+                               Clexulator const &clexulator,
+                               Index n_threads = 1);
 
 /// \brief Returns point correlations from all sites, normalized by cluster
 /// orbit size, restricted to specified correlations
@@ -112,7 +116,7 @@ Eigen::MatrixXd all_restricted_point_corr(
     ConfigDoF const &configdof,
     SuperNeighborList const &supercell_neighbor_list,
     Clexulator const &clexulator, unsigned int const *corr_indices_begin,
-    unsigned int const *corr_indices_end);
+    unsigned int const *corr_indices_end, Index n_threads = 1);
 
 // --- Occupation ---
 
@@ -125,6 +129,16 @@ void restricted_delta_corr(Eigen::VectorXd &dcorr, Index linear_site_index,
                            unsigned int const *corr_indices_begin,
                            unsigned int const *corr_indices_end);
 
+/// \brief Sets change in (extensive) correlations due to an occupation
+/// change, restricted to specified correlations, using an EvaluationContext
+void restricted_delta_corr(clexulator::EvaluationContext &context,
+                           Eigen::VectorXd &dcorr, Index linear_site_index,
+                           int new_occ, ConfigDoF const &configdof,
+                           SuperNeighborList const &supercell_neighbor_list,
+                           Clexulator const &clexulator,
+                           unsigned int const *corr_indices_begin,
+                           unsigned int const *corr_indices_end);
+
 // --- Local continuous ---
 
 /// \brief Sets change in (extensive) correlations due to a local continuous
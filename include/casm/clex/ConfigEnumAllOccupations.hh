@@ -1,6 +1,9 @@
 #ifndef CASM_ConfigEnumAllOccupations
 #define CASM_ConfigEnumAllOccupations
 
+#include <deque>
+
+#include "casm/clex/CanonicalOccupationGenerator.hh"
 #include "casm/clex/Configuration.hh"
 #include "casm/container/Counter.hh"
 #include "casm/enumerator/InputEnumerator.hh"
@@ -37,7 +40,8 @@ class ConfigEnumAllOccupations : public InputEnumeratorBase<Configuration> {
   /// \brief Constructor allowing direct control of whether
   ///     non-primitive and non-canonical Configuration are enumerated
   ConfigEnumAllOccupations(ConfigEnumInput const &config_enum_input,
-                           bool primitive_only, bool canonical_only);
+                           bool primitive_only, bool canonical_only,
+                           Index n_threads = 1, bool orderly = false);
 
   std::string name() const override;
 
@@ -45,6 +49,10 @@ class ConfigEnumAllOccupations : public InputEnumeratorBase<Configuration> {
   ///     primitive & canonical configurations only
   bool primitive_canonical_guarantee() const;
 
+  /// \brief Returns true if canonical occupations are generated directly,
+  ///     by orderly generation
+  bool is_orderly() const;
+
   static const std::string enumerator_name;
 
  private:
@@ -62,6 +70,16 @@ class ConfigEnumAllOccupations : public InputEnumeratorBase<Configuration> {
   ///
   bool _current_is_valid_for_output() const;
 
+  /// Implements increment, checking candidate occupations in parallel
+  void _increment_with_lookahead();
+
+  /// Implements increment, generating canonical occupations directly
+  void _increment_orderly();
+
+  /// Check the next candidate occupations in parallel and store those valid
+  /// for output in m_lookahead
+  void _lookahead();
+
   /// Site index to enumerate on
   std::set<Index> m_site_index_selection;
 
@@ -79,6 +97,19 @@ class ConfigEnumAllOccupations : public InputEnumeratorBase<Configuration> {
 
   /// True if only enumerating canonical configurations
   bool m_canonical_only;
+
+  /// Maximum number of threads used to check candidate occupations
+  Index m_n_threads;
+
+  /// Occupation counter values, after the current one, that are valid for
+  /// output
+  std::deque<std::vector<int>> m_lookahead;
+
+  /// True if canonical occupations are generated directly
+  bool m_orderly;
+
+  /// Generates canonical occupations, if m_orderly
+  CanonicalOccupationGenerator m_generator;
 };
 
 /** @}*/
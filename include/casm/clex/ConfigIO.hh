@@ -1,6 +1,8 @@
 #ifndef CONFIGIO_HH
 #define CONFIGIO_HH
 
+#include <memory>
+
 #include "casm/casm_io/dataformatter/DataFormatter.hh"
 #include "casm/casm_io/dataformatter/DataFormatterTools.hh"
 #include "casm/clex/Clexulator.hh"
@@ -22,6 +24,10 @@ template <typename DataObject>
 class Norm;
 class jsonParser;
 
+namespace DB {
+class PropertyCache;
+}
+
 /**  \addtogroup ConfigIO
      @{
  */
@@ -235,6 +241,9 @@ class Corr : public VectorXdAttribute<Configuration> {
 
   /// Which correlations to calculate
   mutable std::vector<Clexulator::size_type> m_correlation_indices;
+
+  /// Cached correlations, if using a project basis set
+  mutable std::shared_ptr<DB::PropertyCache> m_corr_cache;
 };
 
 /// \brief Returns correlation values
@@ -590,6 +599,11 @@ class Clex : public ScalarAttribute<Configuration> {
   mutable Clexulator m_clexulator;
   mutable ECIContainer m_eci;
   mutable notstd::cloneable_ptr<Norm<Configuration> > m_norm;
+
+  /// Cached correlations and property values (per unit cell), if using a
+  /// project cluster expansion
+  mutable std::shared_ptr<DB::PropertyCache> m_corr_cache;
+  mutable std::shared_ptr<DB::PropertyCache> m_clex_cache;
 };
 }  // namespace ConfigIO
 
@@ -242,6 +242,9 @@ struct ConfigMapperResult {
 /// information about supercell lattices so that batch imports are more
 /// efficient
 ///
+/// Note: Like StrucMapper, a ConfigMapper must not be used by multiple threads
+/// at once. Use a copy per thread instead.
+///
 /// \ingroup Configuration
 class ConfigMapper {
  public:
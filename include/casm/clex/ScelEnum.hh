@@ -29,12 +29,15 @@ bool is_guaranteed_for_database_insert(ScelEnumByProps const &enumerator);
 /// - Enumerated Supercell are canonical
 /// - Enumerated Supercell do not have a `PrimClex const *`
 /// - References are invalidated after incrementing an iterator
+/// - With n_threads > 1, all superlattices are enumerated and made canonical
+///   on construction, in parallel. Supercells are enumerated in the same order
+///   for any number of threads.
 ///
 class ScelEnumByProps : public InputEnumeratorBase<Supercell> {
  public:
   /// \brief Construct with shared prim Structure and ScelEnumProps settings
   ScelEnumByProps(std::shared_ptr<const Structure> const &shared_prim,
-                  const xtal::ScelEnumProps &enum_props);
+                  const xtal::ScelEnumProps &enum_props, Index n_threads = 1);
 
   ScelEnumByProps(const ScelEnumByProps &) = delete;
   ScelEnumByProps &operator=(const ScelEnumByProps &) = delete;
@@ -48,12 +51,27 @@ class ScelEnumByProps : public InputEnumeratorBase<Supercell> {
   /// Implements increment over supercells
   void increment() override;
 
+  /// Enumerate all canonical superlattices in parallel
+  void _make_canonical_lattices();
+
+  /// True if all superlattices have been enumerated
+  bool _finished() const;
+
+  /// Canonical form of the current superlattice
+  Lattice _canonical_lattice() const;
+
   std::shared_ptr<Structure const> m_shared_prim;
   notstd::cloneable_ptr<Supercell> m_current;
 
   std::unique_ptr<xtal::SuperlatticeEnumerator> m_lattice_enum;
   xtal::SuperlatticeEnumerator::const_iterator m_lat_it;
   xtal::SuperlatticeEnumerator::const_iterator m_lat_end;
+
+  /// Number of threads used to enumerate superlattices. If > 1, all canonical
+  /// superlattices are stored in m_canonical_lattices on construction.
+  Index m_n_threads;
+  std::vector<Lattice> m_canonical_lattices;
+  Index m_lattice_index;
 };
 
 }  // namespace CASM
@@ -0,0 +1,74 @@
+#ifndef CASM_clex_TableClexulator
+#define CASM_clex_TableClexulator
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "casm/clex/Clexulator.hh"
+#include "casm/clexulator/OccTableClexulator.hh"
+
+namespace CASM {
+
+class ClexBasis;
+class ClexBasisSpecs;
+class Function;
+class Structure;
+
+/** \ingroup Clexulator
+ *  @{
+ */
+
+/// \brief Construct tables for evaluating occupation basis functions
+///
+/// \param clex Occupation cluster expansion basis, generated for `orbits`
+/// \param orbits Cluster orbits used to generate `clex`
+/// \param nlist PrimNeighborList, expanded as necessary to include the
+///     neighborhood of the basis functions
+///
+/// The tables describe the same functions, with the same neighbor list
+/// indices, as the source code written by ClexBasisWriter::print_clexulator.
+///
+/// Throws if `clex` has basis functions for DoF other than occupation.
+template <typename OrbitType>
+clexulator::OccTableClexulatorData make_occ_table_clexulator_data(
+    ClexBasis const &clex, std::vector<OrbitType> const &orbits,
+    PrimNeighborList &nlist);
+
+/// \brief Construct a Clexulator which evaluates occupation basis functions
+/// from tables, without generating and compiling source code
+Clexulator make_table_clexulator(
+    std::string name, std::shared_ptr<Structure const> const &shared_prim,
+    ClexBasisSpecs const &basis_set_specs, PrimNeighborList &nlist);
+
+namespace TableClexulator_impl {
+
+/// \brief A term of a cluster function, before flattening into OccTermTable
+struct OccTerm {
+  double coeff;
+  int pivot_site_func;
+  std::vector<int> factor_nlist_ind;
+  std::vector<int> factor_site_func;
+};
+
+/// \brief Offset into OccTableClexulatorData::site_func_values, by
+/// (sublattice index, site function index)
+typedef std::map<std::pair<Index, Index>, int> SiteFuncOffsetMap;
+
+/// \brief Append the terms of an occupation cluster function
+void append_occ_terms(std::vector<OccTerm> &terms, Function const *func,
+                      double prefactor, int pivot_nlist_ind,
+                      SiteFuncOffsetMap const &site_func_offset);
+
+/// \brief Flatten terms, by function, into an OccTermTable
+clexulator::OccTermTable make_occ_term_table(
+    std::vector<std::vector<OccTerm> > const &terms, bool with_pivot);
+
+}  // namespace TableClexulator_impl
+
+/** @} */
+}  // namespace CASM
+
+#endif
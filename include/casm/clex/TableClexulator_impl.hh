@@ -0,0 +1,197 @@
+#ifndef CASM_clex_TableClexulator_impl
+#define CASM_clex_TableClexulator_impl
+
+#include "casm/basis_set/FunctionVisitor.hh"
+#include "casm/clex/ClexBasis.hh"
+#include "casm/clex/ClexBasisWriter_impl.hh"
+#include "casm/clex/TableClexulator.hh"
+#include "casm/clusterography/ClusterOrbits_impl.hh"
+#include "casm/crystallography/Structure.hh"
+
+namespace CASM {
+
+/// \brief Construct tables for evaluating occupation basis functions
+///
+/// \param clex Occupation cluster expansion basis, generated for `_tree`
+/// \param _tree Cluster orbits used to generate `clex`
+/// \param _nlist PrimNeighborList, expanded as necessary to include the
+///     neighborhood of the basis functions
+///
+/// The global, point, and delta point functions are the same as those
+/// written by ClexBasisWriter::print_clexulator:
+/// - Global functions are the sum over clusters in the orbit of the cluster
+///   functions, divided by the orbit size.
+/// - Point functions about a neighbor are the sum over clusters in the orbit,
+///   translated so that one of their sites is the neighbor, of the cluster
+///   functions, divided by the orbit size.
+/// - Delta point functions are evaluated from the point function terms, by
+///   replacing the value of the site function on the neighbor with its
+///   change.
+template <typename OrbitType>
+clexulator::OccTableClexulatorData make_occ_table_clexulator_data(
+    ClexBasis const &clex, std::vector<OrbitType> const &_tree,
+    PrimNeighborList &_nlist) {
+  using namespace TableClexulator_impl;
+
+  auto const &prim = clex.prim();
+  clexulator::OccTableClexulatorData data;
+
+  if (clex.global_bases().size()) {
+    throw std::runtime_error(
+        "Error in make_occ_table_clexulator_data: global DoF are not "
+        "supported");
+  }
+  for (auto const &dof : clex.site_bases()) {
+    if (dof.first != "occ") {
+      throw std::runtime_error(
+          "Error in make_occ_table_clexulator_data: DoF '" + dof.first +
+          "' is not supported, only occupation DoF are supported");
+    }
+  }
+
+  // Site function value table; the first block is the constant function 1.0
+  Index max_occupants = 0;
+  for (auto const &site : prim.basis()) {
+    max_occupants = max(max_occupants, Index(site.occupant_dof().size()));
+  }
+  data.site_func_values.resize(max_occupants, 1.0);
+
+  SiteFuncOffsetMap site_func_offset;
+  auto site_bases_it = clex.site_bases().find("occ");
+  if (site_bases_it != clex.site_bases().end()) {
+    std::vector<BasisSet> const &site_bases = site_bases_it->second;
+    for (Index b = 0; b < site_bases.size(); ++b) {
+      for (Index f = 0; f < site_bases[b].size(); ++f) {
+        site_func_offset[std::make_pair(b, f)] = data.site_func_values.size();
+        for (Index s = 0; s < prim.basis()[b].occupant_dof().size(); ++s) {
+          OccFuncEvaluator t_eval(s);
+          site_bases[b][f]->accept(t_eval);
+          data.site_func_values.push_back(t_eval.value());
+        }
+      }
+    }
+  }
+
+  // Neighborhood sizes
+  std::map<xtal::UnitCellCoord, std::set<xtal::UnitCellCoord> > nhood =
+      ClexBasisWriter_impl::dependency_neighborhood(_tree.begin(), _tree.end());
+
+  Index N_corr = clex.n_functions();
+  Index N_flower = nhood.size();
+  Index N_hood = 0;
+  for (auto const &nbor : nhood) {
+    N_flower = max(_nlist.neighbor_index(nbor.first) + 1, N_flower);
+    for (xtal::UnitCellCoord const &ucc : nbor.second) {
+      N_hood = max(_nlist.neighbor_index(ucc) + 1, N_hood);
+    }
+  }
+  data.nlist_size = N_hood;
+  data.corr_size = N_corr;
+  data.n_point_corr = N_flower;
+
+  std::vector<std::vector<OccTerm> > global_terms(N_corr);
+  std::vector<std::vector<OccTerm> > point_terms(N_flower * N_corr);
+
+  // linear function index
+  Index lf = 0;
+  for (Index no = 0; no < _tree.size(); no++) {
+    OrbitType const &orbit = _tree[no];
+    ClexBasis::BSetOrbit bset_orbit = clex.bset_orbit(no);
+    double prefactor = 1.0 / orbit.size();
+
+    // global functions
+    for (Index ne = 0; ne < bset_orbit.size(); ne++) {
+      std::vector<PrimNeighborList::Scalar> nbor_IDs = _nlist.neighbor_indices(
+          orbit[ne].elements().begin(), orbit[ne].elements().end());
+      bset_orbit[ne].set_dof_IDs(
+          std::vector<Index>(nbor_IDs.begin(), nbor_IDs.end()));
+      for (Index nf = 0; nf < bset_orbit[ne].size(); nf++) {
+        append_occ_terms(global_terms[lf + nf], bset_orbit[ne][nf], prefactor,
+                         -1, site_func_offset);
+      }
+    }
+
+    // point functions
+    for (auto const &nbor : nhood) {
+      Index nbor_ind = _nlist.neighbor_index(nbor.first);
+
+      std::set<xtal::UnitCellCoord> trans_set;
+      for (auto const &equiv : orbit) {
+        for (xtal::UnitCellCoord const &site : equiv.elements()) {
+          if (site.sublattice() == nbor.first.sublattice()) {
+            trans_set.insert(site);
+          }
+        }
+      }
+      std::set<xtal::UnitCellCoord> equiv_ucc =
+          ClexBasisWriter_impl::equiv_ucc(trans_set.begin(), trans_set.end(),
+                                          nbor.first, orbit.prototype().prim(),
+                                          orbit.sym_compare());
+
+      for (Index ne = 0; ne < orbit.size(); ne++) {
+        for (xtal::UnitCellCoord const &trans : equiv_ucc) {
+          if (!contains(orbit[ne].elements(), trans)) continue;
+
+          typename OrbitType::Element trans_clust =
+              orbit[ne] - (trans.unitcell() - nbor.first.unitcell());
+
+          std::vector<PrimNeighborList::Scalar> nbor_IDs =
+              _nlist.neighbor_indices(trans_clust.elements().begin(),
+                                      trans_clust.elements().end());
+          bset_orbit[ne].set_dof_IDs(
+              std::vector<Index>(nbor_IDs.begin(), nbor_IDs.end()));
+
+          for (Index nf = 0; nf < bset_orbit[ne].size(); nf++) {
+            append_occ_terms(point_terms[nbor_ind * N_corr + lf + nf],
+                             bset_orbit[ne][nf], prefactor, nbor_ind,
+                             site_func_offset);
+          }
+        }
+      }
+    }
+
+    lf += clex.bset_orbit(no)[0].size();
+  }
+
+  data.global_terms = make_occ_term_table(global_terms, false);
+  data.point_terms = make_occ_term_table(point_terms, true);
+
+  // Neighborhoods, weight matrix, and sublattices
+  data.weight_matrix = _nlist.weight_matrix();
+  data.sublat_indices = _nlist.sublat_indices();
+  data.n_sublattices = _nlist.n_sublattices();
+
+  {
+    std::set<xtal::UnitCellCoord> nbors;
+    flower_neighborhood(_tree.begin(), _tree.end(),
+                        std::inserter(nbors, nbors.begin()));
+    for (xtal::UnitCellCoord const &ucc : nbors) {
+      data.neighborhood.insert(ucc.unitcell());
+    }
+  }
+
+  data.orbit_neighborhood.resize(N_corr);
+  data.orbit_site_neighborhood.resize(N_corr);
+  lf = 0;
+  for (Index no = 0; no < _tree.size(); ++no) {
+    if (clex.bset_orbit(no).size() == 0 || clex.bset_orbit(no)[0].size() == 0) {
+      continue;
+    }
+    std::set<xtal::UnitCellCoord> nbors;
+    flower_neighborhood(_tree[no], std::inserter(nbors, nbors.begin()));
+
+    std::set<xtal::UnitCell> ucnbors;
+    for (xtal::UnitCellCoord const &ucc : nbors) ucnbors.insert(ucc.unitcell());
+
+    for (Index nf = 0; nf < clex.bset_orbit(no)[0].size(); ++nf, ++lf) {
+      data.orbit_neighborhood[lf] = ucnbors;
+      data.orbit_site_neighborhood[lf] = nbors;
+    }
+  }
+
+  return data;
+}
+
+}  // namespace CASM
+
+#endif
@@ -2,18 +2,142 @@
 #define CASM_clexulator_BaseClexulator
 #include <algorithm>
 #include <cstddef>
+#include <memory>
 #include <sstream>
 
 #include "casm/clexulator/ConfigDoFValues.hh"
 #include "casm/clexulator/NeighborList.hh"
 #include "casm/crystallography/UnitCellCoord.hh"
 
+/// \brief Version of the interface between CASM and compiled Clexulator
+/// libraries
+///
+/// Compiled Clexulator libraries depend on the layout of BaseClexulator and
+/// EvaluationContext. Generated Clexulator source code defines an extern "C"
+/// function `clexulator_abi_version_<class_name>` returning the value of this
+/// macro when compiled, and libraries with a different value are recompiled
+/// when loaded. Increment it whenever a change to BaseClexulator,
+/// EvaluationContext, or ClexParamPack requires recompiling Clexulator
+/// libraries.
+#define CASM_CLEXULATOR_ABI_VERSION 2
+
 namespace CASM {
 namespace clexulator {
 
+class BaseClexulator;
 class ClexParamPack;
 class ClexParamKey;
 
+/// \brief Specifies one occupant change for batched delta correlation
+/// calculations
+///
+/// Notes:
+/// - The linear index of the site being changed is
+///   `*(nlist_begin + neighbor_ind)`
+struct OccDelta {
+  /// Pointer to beginning of the neighbor list of the unit cell relative to
+  /// which `neighbor_ind` is specified
+  long int const *nlist_begin;
+
+  /// Neighbor index, in range [0, n_point_corr()), of the changing site
+  int neighbor_ind;
+
+  /// Initial occupant index
+  int occ_i;
+
+  /// Final occupant index
+  int occ_f;
+};
+
+/// \brief State for evaluating correlations with a BaseClexulator
+///
+/// A BaseClexulator is not modified by evaluating correlations. Instead, the
+/// pointers to the DoF values and neighbor list being evaluated, the
+/// ClexParamPack values written during evaluation, and scratch buffers are
+/// held by an EvaluationContext. One BaseClexulator may be used by many
+/// threads at once, as long as each thread uses its own EvaluationContext:
+///
+/// \code
+/// std::vector<clexulator::EvaluationContext> contexts(
+///     n_threads, clexulator::EvaluationContext{clexulator});
+/// parallel_for_each_thread(size, n_threads, [&](Index i, Index t) {
+///   clexulator.set_configdofvalues(contexts[t], configdofvalues);
+///   clexulator.set_nlist(contexts[t], nlist.sites(i).data());
+///   clexulator.calc_global_corr_contribution(contexts[t], corr[i].data());
+/// });
+/// \endcode
+///
+/// Notes:
+/// - BaseClexulator member functions that do not take an EvaluationContext
+///   use a default context owned by the BaseClexulator, which uses the
+///   BaseClexulator's own ClexParamPack. They must not be called by more than
+///   one thread at once.
+/// - An EvaluationContext holds a copy of the BaseClexulator's ClexParamPack,
+///   made on construction. Evaluation modes and parameter values used by a
+///   context can be set via EvaluationContext::param_pack.
+/// - An EvaluationContext may only be used with the BaseClexulator it was
+///   constructed from.
+class EvaluationContext {
+ public:
+  /// \brief Construct an empty EvaluationContext, which can not be used for
+  /// evaluation
+  EvaluationContext();
+
+  /// \brief Construct an EvaluationContext for evaluating `_clexulator`
+  explicit EvaluationContext(BaseClexulator const &_clexulator);
+
+  EvaluationContext(EvaluationContext const &other);
+
+  EvaluationContext(EvaluationContext &&other) = default;
+
+  EvaluationContext &operator=(EvaluationContext const &other);
+
+  EvaluationContext &operator=(EvaluationContext &&other) = default;
+
+  ~EvaluationContext();
+
+  /// \brief The BaseClexulator this context may be used with
+  BaseClexulator const *clexulator() const { return m_clexulator; }
+
+  /// \brief ClexParamPack used for evaluations with this context
+  ClexParamPack const &param_pack() const { return *m_params; }
+
+  /// \brief ClexParamPack used for evaluations with this context
+  ClexParamPack &param_pack() { return *m_params; }
+
+ private:
+  friend class BaseClexulator;
+
+  /// \brief The BaseClexulator this context may be used with
+  BaseClexulator const *m_clexulator;
+
+  /// \brief Pointer to ConfigDoFValues for which evaluation is occuring
+  ConfigDoFValues const *m_configdofvalues_ptr;
+
+  /// \brief Pointer to neighbor list
+  long int const *m_nlist_ptr;
+
+  /// \brief Pointer to occupation list
+  int const *m_occ_ptr;
+
+  /// \brief Pointers to local DoF values, by registered DoF index
+  std::vector<Eigen::MatrixXd const *> m_local_dof_ptrs;
+
+  /// \brief Pointers to global DoF values, by registered DoF index
+  std::vector<Eigen::VectorXd const *> m_global_dof_ptrs;
+
+  /// \brief Temporary storage for delta correlations of a single OccDelta
+  std::vector<double> m_delta_corr_tmp;
+
+  /// \brief ClexParamPack owned by this context (null for the default context
+  /// of a BaseClexulator)
+  std::unique_ptr<ClexParamPack> m_owned_params;
+
+  /// \brief ClexParamPack used for evaluation (either m_owned_params, or the
+  /// BaseClexulator's own ClexParamPack)
+  ClexParamPack *m_params;
+};
+
 /// \brief Abstract base class for cluster expansion correlation calculations
 class BaseClexulator {
  public:
@@ -94,6 +218,11 @@ class BaseClexulator {
   // auto nlist_begin =
   //     supercell_neighbor_list.sites(linear_unitcell_index).data();
   // myclexulatorbase.set_nlist(nlist_begin);
+  //
+  // Each has an overload taking an EvaluationContext as the first argument,
+  // for evaluating correlations with one BaseClexulator on multiple threads
+  // at once. The overloads without an EvaluationContext use the
+  // BaseClexulator's default context.
 
   /// \brief Set internal pointers to correct DoF values
   ///
@@ -105,32 +234,16 @@ class BaseClexulator {
   /// - In the vast majority of cases this is handled by the `calc_X` method
   void set_configdofvalues(ConfigDoFValues const &_configdofvalues,
                            bool _force = false) const {
-    if (m_configdofvalues_ptr != &_configdofvalues || _force) {
-      m_configdofvalues_ptr = &_configdofvalues;
-      m_occ_ptr = _configdofvalues.occupation.data();
-      for (auto const &dof : m_local_dof_registry) {
-        auto it = _configdofvalues.local_dof_values.find(dof.first);
-        if (it == _configdofvalues.local_dof_values.end()) {
-          std::stringstream msg;
-          msg << "Clexulator error: ConfigDoFValues missing required local DoF "
-                 "type '"
-              << dof.first << "'";
-          throw std::runtime_error(msg.str());
-        }
-        m_local_dof_ptrs[dof.second] = &it->second;
-      }
-
-      for (auto const &dof : m_global_dof_registry) {
-        auto it = _configdofvalues.global_dof_values.find(dof.first);
-        if (it == _configdofvalues.global_dof_values.end()) {
-          std::stringstream msg;
-          msg << "Clexulator error: ConfigDoFValues missing required global "
-                 "DoF type '"
-              << dof.first << "'";
-          throw std::runtime_error(msg.str());
-        }
-        m_global_dof_ptrs[dof.second] = &it->second;
-      }
+    set_configdofvalues(_default_context(), _configdofvalues, _force);
+  }
+
+  /// \brief Set pointers to correct DoF values in an EvaluationContext
+  void set_configdofvalues(EvaluationContext &_context,
+                           ConfigDoFValues const &_configdofvalues,
+                           bool _force = false) const {
+    _check_context(_context);
+    if (_context.m_configdofvalues_ptr != &_configdofvalues || _force) {
+      _set_configdofvalues(_context, _configdofvalues);
     }
   }
 
@@ -154,17 +267,31 @@ class BaseClexulator {
   /// \endcode
   ///
   void set_nlist(const long int *_nlist_begin) const {
-    m_nlist_ptr = _nlist_begin;
+    _default_context().m_nlist_ptr = _nlist_begin;
     return;
   }
 
+  /// \brief Set pointer to neighbor list in an EvaluationContext
+  void set_nlist(EvaluationContext &_context,
+                 const long int *_nlist_begin) const {
+    _check_context(_context);
+    _context.m_nlist_ptr = _nlist_begin;
+  }
+
   /// \brief Calculate contribution to global correlations from one unit cell
   ///
   /// \param _corr_begin Pointer to beginning of data structure where
   /// correlations are written
   ///
   void calc_global_corr_contribution(double *_corr_begin) const {
-    _calc_global_corr_contribution(_corr_begin);
+    calc_global_corr_contribution(_default_context(), _corr_begin);
+  }
+
+  /// \brief Calculate contribution to global correlations from one unit cell
+  void calc_global_corr_contribution(EvaluationContext &_context,
+                                     double *_corr_begin) const {
+    _check_context(_context);
+    _calc_global_corr_contribution(_context, _corr_begin);
   }
 
   /// \brief Calculate contribution to global correlations from one unit cell
@@ -174,7 +301,18 @@ class BaseClexulator {
   ///   vector
   ///
   void calc_global_corr_contribution() const {
-    _calc_global_corr_contribution();
+    calc_global_corr_contribution(_default_context());
+  }
+
+  /// \brief Calculate contribution to global correlations from one unit cell
+  ///
+  /// Notes:
+  /// - This overload writes values to the context's ParamPack, but not to a
+  ///   correlations vector
+  ///
+  void calc_global_corr_contribution(EvaluationContext &_context) const {
+    _check_context(_context);
+    _calc_global_corr_contribution(_context);
   }
 
   /// \brief Calculate contribution to select global correlations from one unit
@@ -188,8 +326,18 @@ class BaseClexulator {
   void calc_restricted_global_corr_contribution(
       double *_corr_begin, size_type const *_corr_ind_begin,
       size_type const *_corr_ind_end) const {
-    _calc_restricted_global_corr_contribution(_corr_begin, _corr_ind_begin,
-                                              _corr_ind_end);
+    calc_restricted_global_corr_contribution(
+        _default_context(), _corr_begin, _corr_ind_begin, _corr_ind_end);
+  }
+
+  /// \brief Calculate contribution to select global correlations from one unit
+  /// cell
+  void calc_restricted_global_corr_contribution(
+      EvaluationContext &_context, double *_corr_begin,
+      size_type const *_corr_ind_begin, size_type const *_corr_ind_end) const {
+    _check_context(_context);
+    _calc_restricted_global_corr_contribution(_context, _corr_begin,
+                                              _corr_ind_begin, _corr_ind_end);
   }
 
   /// \brief Calculate point correlations about basis site 'neighbor_ind'
@@ -199,7 +347,14 @@ class BaseClexulator {
   /// correlations are written
   ///
   void calc_point_corr(int neighbor_ind, double *_corr_begin) const {
-    _calc_point_corr(neighbor_ind, _corr_begin);
+    calc_point_corr(_default_context(), neighbor_ind, _corr_begin);
+  }
+
+  /// \brief Calculate point correlations about basis site 'neighbor_ind'
+  void calc_point_corr(EvaluationContext &_context, int neighbor_ind,
+                       double *_corr_begin) const {
+    _check_context(_context);
+    _calc_point_corr(_context, neighbor_ind, _corr_begin);
   }
 
   /// \brief Calculate select point correlations about basis site 'neighbor_ind'
@@ -214,8 +369,18 @@ class BaseClexulator {
   void calc_restricted_point_corr(int neighbor_ind, double *_corr_begin,
                                   size_type const *_corr_ind_begin,
                                   size_type const *_corr_ind_end) const {
-    _calc_restricted_point_corr(neighbor_ind, _corr_begin, _corr_ind_begin,
-                                _corr_ind_end);
+    calc_restricted_point_corr(_default_context(), neighbor_ind, _corr_begin,
+                               _corr_ind_begin, _corr_ind_end);
+  }
+
+  /// \brief Calculate select point correlations about basis site 'neighbor_ind'
+  void calc_restricted_point_corr(EvaluationContext &_context,
+                                  int neighbor_ind, double *_corr_begin,
+                                  size_type const *_corr_ind_begin,
+                                  size_type const *_corr_ind_end) const {
+    _check_context(_context);
+    _calc_restricted_point_corr(_context, neighbor_ind, _corr_begin,
+                                _corr_ind_begin, _corr_ind_end);
   }
 
   /// \brief Calculate the change in point correlations due to changing an
@@ -228,7 +393,16 @@ class BaseClexulator {
   ///
   void calc_delta_point_corr(int neighbor_ind, int occ_i, int occ_f,
                              double *_corr_begin) const {
-    _calc_delta_point_corr(neighbor_ind, occ_i, occ_f, _corr_begin);
+    calc_delta_point_corr(_default_context(), neighbor_ind, occ_i, occ_f,
+                          _corr_begin);
+  }
+
+  /// \brief Calculate the change in point correlations due to changing an
+  /// occupant
+  void calc_delta_point_corr(EvaluationContext &_context, int neighbor_ind,
+                             int occ_i, int occ_f, double *_corr_begin) const {
+    _check_context(_context);
+    _calc_delta_point_corr(_context, neighbor_ind, occ_i, occ_f, _corr_begin);
   }
 
   /// \brief Calculate the change in select point correlations due to changing
@@ -244,14 +418,102 @@ class BaseClexulator {
                                         double *_corr_begin,
                                         size_type const *_corr_ind_begin,
                                         size_type const *_corr_ind_end) const {
-    _calc_restricted_delta_point_corr(neighbor_ind, occ_i, occ_f, _corr_begin,
-                                      _corr_ind_begin, _corr_ind_end);
+    calc_restricted_delta_point_corr(_default_context(), neighbor_ind, occ_i,
+                                     occ_f, _corr_begin, _corr_ind_begin,
+                                     _corr_ind_end);
+  }
+
+  /// \brief Calculate the change in select point correlations due to changing
+  /// an occupant
+  void calc_restricted_delta_point_corr(EvaluationContext &_context,
+                                        int neighbor_ind, int occ_i, int occ_f,
+                                        double *_corr_begin,
+                                        size_type const *_corr_ind_begin,
+                                        size_type const *_corr_ind_end) const {
+    _check_context(_context);
+    _calc_restricted_delta_point_corr(_context, neighbor_ind, occ_i, occ_f,
+                                      _corr_begin, _corr_ind_begin,
+                                      _corr_ind_end);
+  }
+
+  /// \brief Calculate the change in select point correlations due to a
+  /// sequence of occupant changes
+  ///
+  /// \param _delta_begin,_delta_end Pointers to range of OccDelta specifying
+  /// the sequence of occupant changes
+  /// \param _corr_begin Pointer to beginning of data structure where the total
+  /// difference in correlations is written
+  /// \param _corr_ind_begin,_corr_ind_end Pointers to range indicating which
+  /// correlations should be calculated
+  ///
+  /// Notes:
+  /// - Changes are evaluated in order, each one as if all preceding changes
+  ///   had already been applied, so the result is the change in correlations
+  ///   due to the entire sequence (i.e. a swap, or a multi-site event)
+  /// - Only the neighbor list pointer differs between changes, so the
+  ///   DoF values need to be set only once (via `set_configdofvalues`)
+  /// - The occupation values are temporarily modified during evaluation,
+  ///   and are restored to their initial values before returning, so the
+  ///   occupation values must not be read by other threads at the same time
+  /// - Results are not correct if the periodic images of the neighborhood
+  ///   overlap (see SuperNeighborList::overlaps)
+  ///
+  void calc_restricted_delta_point_corr(OccDelta const *_delta_begin,
+                                        OccDelta const *_delta_end,
+                                        double *_corr_begin,
+                                        size_type const *_corr_ind_begin,
+                                        size_type const *_corr_ind_end) const {
+    calc_restricted_delta_point_corr(_default_context(), _delta_begin,
+                                     _delta_end, _corr_begin, _corr_ind_begin,
+                                     _corr_ind_end);
+  }
+
+  /// \brief Calculate the change in select point correlations due to a
+  /// sequence of occupant changes
+  void calc_restricted_delta_point_corr(EvaluationContext &_context,
+                                        OccDelta const *_delta_begin,
+                                        OccDelta const *_delta_end,
+                                        double *_corr_begin,
+                                        size_type const *_corr_ind_begin,
+                                        size_type const *_corr_ind_end) const {
+    _check_context(_context);
+    _calc_restricted_delta_point_corr(_context, _delta_begin, _delta_end,
+                                      _corr_begin, _corr_ind_begin,
+                                      _corr_ind_end);
   }
 
  private:
+  friend class EvaluationContext;
+
   /// \brief Clone the Clexulator
   virtual BaseClexulator *_clone() const = 0;
 
+  /// \brief Check that `_context` was constructed for this BaseClexulator
+  void _check_context(EvaluationContext const &_context) const {
+    if (_context.m_clexulator != this) {
+      _throw_context_error();
+    }
+  }
+
+  [[noreturn]] void _throw_context_error() const;
+
+  /// \brief Default evaluation context, used by member functions that do not
+  /// take an EvaluationContext
+  EvaluationContext &_default_context() const {
+    if (m_default_context.m_clexulator != this) {
+      _reset_default_context();
+    }
+    return m_default_context;
+  }
+
+  /// \brief Reset the default context to use this BaseClexulator and its
+  /// ClexParamPack
+  void _reset_default_context() const;
+
+  /// \brief Set pointers to DoF values in an EvaluationContext
+  void _set_configdofvalues(EvaluationContext &_context,
+                            ConfigDoFValues const &_configdofvalues) const;
+
   /// \brief The neighbor list size
   size_type m_nlist_size;
 
@@ -265,72 +527,144 @@ class BaseClexulator {
 
   std::map<std::string, Index> m_global_dof_registry;
 
+  /// \brief Size of EvaluationContext local and global DoF pointer arrays
+  Index m_dof_ptrs_size;
+
+  /// \brief Default evaluation context
+  mutable EvaluationContext m_default_context;
+
  protected:
-  virtual void _calc_global_corr_contribution() const = 0;
+  // The `_calc_X` methods receive the EvaluationContext in use as their first
+  // argument, and generated Clexulator pass it on to every basis function and
+  // DoF accessor, so that evaluation state is read directly from the context.
+
+  virtual void _calc_global_corr_contribution(
+      EvaluationContext &_context) const = 0;
 
-  virtual void _calc_global_corr_contribution(double *_corr_begin) const = 0;
+  virtual void _calc_global_corr_contribution(EvaluationContext &_context,
+                                              double *_corr_begin) const = 0;
 
   virtual void _calc_restricted_global_corr_contribution(
-      size_type const *_corr_ind_begin,
+      EvaluationContext &_context, size_type const *_corr_ind_begin,
       size_type const *_corr_ind_end) const = 0;
 
   virtual void _calc_restricted_global_corr_contribution(
-      double *_corr_begin, size_type const *_corr_ind_begin,
+      EvaluationContext &_context, double *_corr_begin,
+      size_type const *_corr_ind_begin,
       size_type const *_corr_ind_end) const = 0;
 
-  virtual void _calc_point_corr(int neighbor_ind) const = 0;
+  virtual void _calc_point_corr(EvaluationContext &_context,
+                                int neighbor_ind) const = 0;
 
-  virtual void _calc_point_corr(int neighbor_ind,
+  virtual void _calc_point_corr(EvaluationContext &_context, int neighbor_ind,
                                 double *_corr_begin) const = 0;
 
   virtual void _calc_restricted_point_corr(
-      int neighbor_ind, size_type const *_corr_ind_begin,
+      EvaluationContext &_context, int neighbor_ind,
+      size_type const *_corr_ind_begin,
       size_type const *_corr_ind_end) const = 0;
 
   virtual void _calc_restricted_point_corr(
-      int neighbor_ind, double *_corr_begin, size_type const *_corr_ind_begin,
+      EvaluationContext &_context, int neighbor_ind, double *_corr_begin,
+      size_type const *_corr_ind_begin,
       size_type const *_corr_ind_end) const = 0;
 
-  virtual void _calc_delta_point_corr(int neighbor_ind, int occ_i,
+  virtual void _calc_delta_point_corr(EvaluationContext &_context,
+                                      int neighbor_ind, int occ_i,
                                       int occ_f) const = 0;
 
-  virtual void _calc_delta_point_corr(int neighbor_ind, int occ_i, int occ_f,
+  virtual void _calc_delta_point_corr(EvaluationContext &_context,
+                                      int neighbor_ind, int occ_i, int occ_f,
                                       double *_corr_begin) const = 0;
 
   virtual void _calc_restricted_delta_point_corr(
-      int neighbor_ind, int occ_i, int occ_f, size_type const *_corr_ind_begin,
+      EvaluationContext &_context, int neighbor_ind, int occ_i, int occ_f,
+      size_type const *_corr_ind_begin,
       size_type const *_corr_ind_end) const = 0;
 
   virtual void _calc_restricted_delta_point_corr(
-      int neighbor_ind, int occ_i, int occ_f, double *_corr_begin,
-      size_type const *_corr_ind_begin,
+      EvaluationContext &_context, int neighbor_ind, int occ_i, int occ_f,
+      double *_corr_begin, size_type const *_corr_ind_begin,
       size_type const *_corr_ind_end) const = 0;
 
+  /// \brief Calculate the change in select point correlations due to a
+  /// sequence of occupant changes
+  ///
+  /// Notes:
+  /// - The default implementation calls the single site
+  ///   `_calc_restricted_delta_point_corr` once per change. Generated
+  ///   Clexulator override this to evaluate the entire sequence in one call.
+  virtual void _calc_restricted_delta_point_corr(
+      EvaluationContext &_context, OccDelta const *_delta_begin,
+      OccDelta const *_delta_end, double *_corr_begin,
+      size_type const *_corr_ind_begin, size_type const *_corr_ind_end) const;
+
   void _register_local_dof(std::string const &_type_name, Index _ind) {
-    Index new_size = std::max(Index(_ind), Index(m_local_dof_ptrs.size())) + 1;
-    m_local_dof_ptrs.resize(new_size, nullptr);
-    m_global_dof_ptrs.resize(new_size, nullptr);
+    m_dof_ptrs_size = std::max(Index(_ind) + 1, m_dof_ptrs_size);
     m_local_dof_registry[_type_name] = _ind;
   }
 
   void _register_global_dof(std::string const &_type_name, Index _ind) {
-    Index new_size = std::max(Index(_ind), Index(m_local_dof_ptrs.size())) + 1;
-    m_local_dof_ptrs.resize(new_size, nullptr);
-    m_global_dof_ptrs.resize(new_size, nullptr);
+    m_dof_ptrs_size = std::max(Index(_ind) + 1, m_dof_ptrs_size);
     m_global_dof_registry[_type_name] = _ind;
   }
 
+  // The following access the EvaluationContext passed to the `_calc_X`
+  // methods, for use by derived classes which can not access its members
+
   /// \brief access reference to internally pointed ConfigDoF
-  ConfigDoFValues const &_configdofvalues() const {
-    return *m_configdofvalues_ptr;
+  ConfigDoFValues const &_configdofvalues(
+      EvaluationContext const &_context) const {
+    return *_context.m_configdofvalues_ptr;
   }
 
   /// \brief access reference to internally pointed ConfigDoF
-  Index const &_l(Index nlist_ind) const { return *(m_nlist_ptr + nlist_ind); }
+  Index const &_l(EvaluationContext const &_context, Index nlist_ind) const {
+    return *(_context.m_nlist_ptr + nlist_ind);
+  }
 
   /// \brief access reference to internally pointed occupation list
-  int const &_occ(Index nlist_ind) const {
-    return *(m_occ_ptr + *(m_nlist_ptr + nlist_ind));
+  int const &_occ(EvaluationContext const &_context, Index nlist_ind) const {
+    return *(_context.m_occ_ptr + *(_context.m_nlist_ptr + nlist_ind));
+  }
+
+  /// \brief Set the occupation value of a site in the internally pointed
+  /// occupation list
+  ///
+  /// Notes:
+  /// - Used to temporarily apply occupant changes while evaluating a
+  ///   sequence of OccDelta. Callers must restore the original value.
+  void _set_occ(EvaluationContext &_context, Index linear_site_index,
+                int occ_value) const {
+    *(const_cast<int *>(_context.m_occ_ptr) + linear_site_index) = occ_value;
+  }
+
+  /// \brief Set pointer to neighbor list, while evaluating
+  void _set_nlist(EvaluationContext &_context,
+                  const long int *_nlist_begin) const {
+    _context.m_nlist_ptr = _nlist_begin;
+  }
+
+  /// \brief Pointers to local DoF values, by registered DoF index
+  std::vector<Eigen::MatrixXd const *> const &_local_dof_ptrs(
+      EvaluationContext const &_context) const {
+    return _context.m_local_dof_ptrs;
+  }
+
+  /// \brief Pointers to global DoF values, by registered DoF index
+  std::vector<Eigen::VectorXd const *> const &_global_dof_ptrs(
+      EvaluationContext const &_context) const {
+    return _context.m_global_dof_ptrs;
+  }
+
+  /// \brief ClexParamPack used for evaluation
+  ClexParamPack &_context_params(EvaluationContext &_context) const {
+    return *_context.m_params;
+  }
+
+  /// \brief Temporary storage for delta correlations of a single OccDelta
+  std::vector<double> &_delta_corr_tmp(EvaluationContext &_context) const {
+    return _context.m_delta_corr_tmp;
   }
 
   /// \brief The UnitCell involved in calculating the basis functions,
@@ -353,20 +687,6 @@ class BaseClexulator {
 
   /// \brief The total number of sublattices in the prim
   size_type m_n_sublattices;
-
-  mutable std::vector<Eigen::MatrixXd const *> m_local_dof_ptrs;
-
-  mutable std::vector<Eigen::VectorXd const *> m_global_dof_ptrs;
-
- private:
-  /// \brief Pointer to ConfigDoFValues for which evaluation is occuring
-  mutable ConfigDoFValues const *m_configdofvalues_ptr;
-
-  /// \brief Pointer to neighbor list
-  mutable long int const *m_nlist_ptr;
-
-  /// \brief Pointer to occupation list
-  mutable int const *m_occ_ptr;
 };
 
 }  // namespace clexulator
@@ -153,6 +153,11 @@ class BasicClexParamPack : public ClexParamPack {
   }
 
  private:
+  /// \brief Clone the BasicClexParamPack
+  BasicClexParamPack *_clone() const override {
+    return new BasicClexParamPack(*this);
+  }
+
   std::vector<Eigen::MatrixXd> m_data;
   std::vector<EvalMode> m_eval;
 };
@@ -245,6 +245,12 @@ class ClexParamPack {
   /// \brief Abstract class must define virtual destructor
   virtual ~ClexParamPack() {}
 
+  /// \brief Clone the ClexParamPack, including parameter values and evaluation
+  /// modes
+  std::unique_ptr<ClexParamPack> clone() const {
+    return std::unique_ptr<ClexParamPack>(_clone());
+  }
+
   /// \brief Obtain registry of all keys for data blocks managed by this
   /// ClexParamPack
   std::map<std::string, ClexParamKey> const &keys() const { return m_keys; }
@@ -336,6 +342,9 @@ class ClexParamPack {
   std::map<std::string, ClexParamKey> m_keys;
 
  private:
+  /// \brief Clone the ClexParamPack
+  virtual ClexParamPack *_clone() const = 0;
+
   // possible implementation:
   // std::vector<Eigen::MatrixXd> m_data;
 };
@@ -384,6 +384,11 @@ class DiffClexParamPack : public ClexParamPack {
   }
 
  private:
+  /// \brief Clone the DiffClexParamPack
+  DiffClexParamPack *_clone() const override {
+    return new DiffClexParamPack(*this);
+  }
+
   std::vector<DiffScalarContainer> m_data;
   std::vector<EvalMode> m_eval;
   EvalMode m_tot_eval_mode;
@@ -0,0 +1,225 @@
+#ifndef CASM_clexulator_OccTableClexulator
+#define CASM_clexulator_OccTableClexulator
+#include <memory>
+#include <set>
+#include <vector>
+
+#include "casm/clexulator/BaseClexulator.hh"
+#include "casm/clexulator/ClexParamPack.hh"
+
+namespace CASM {
+namespace clexulator {
+
+class BasicClexParamPack;
+
+/// \brief Flat table of cluster function terms
+///
+/// Each function is a sum of terms, and each term is a coefficient multiplied
+/// by a product of site basis functions:
+///
+///     value[i] = sum_t coeff[t] * pivot(t) * prod_k phi_k(occ(nlist_ind[k]))
+///
+/// where:
+/// - t is in the range [term_begin[i], term_begin[i+1])
+/// - k is in the range [factor_begin[t], factor_begin[t+1])
+/// - phi_k(occ) is `site_func_values[factor_site_func[k] + occ]`, with
+///   `site_func_values` stored by OccTableClexulatorData
+/// - pivot(t) is the value of the site function `pivot_site_func[t]` on the
+///   site about which point functions are evaluated. It is 1.0 (and
+///   `pivot_site_func` is empty) for global functions.
+struct OccTermTable {
+  /// Index of first term for each function, plus one past the last term
+  std::vector<Index> term_begin;
+
+  /// Coefficient of each term
+  std::vector<double> coeff;
+
+  /// Offset into `site_func_values` of the pivot site function of each term
+  std::vector<int> pivot_site_func;
+
+  /// Index of first factor for each term, plus one past the last factor
+  std::vector<Index> factor_begin;
+
+  /// Neighbor list index of the site of each factor
+  std::vector<int> factor_nlist_ind;
+
+  /// Offset into `site_func_values` of the site function of each factor
+  std::vector<int> factor_site_func;
+};
+
+/// \brief Data used to construct an OccTableClexulator
+///
+/// This is typically constructed from a ClexBasis with
+/// `make_occ_table_clexulator_data` (see casm/clex/TableClexulator.hh).
+struct OccTableClexulatorData {
+  /// \brief Neighbor list size
+  BaseClexulator::size_type nlist_size = 0;
+
+  /// \brief Number of correlations
+  BaseClexulator::size_type corr_size = 0;
+
+  /// \brief Valid range for `neighbor_ind` argument to calc_point_corr
+  BaseClexulator::size_type n_point_corr = 0;
+
+  /// \brief Site basis function values, for all site basis functions and
+  /// occupants, in one array
+  ///
+  /// The first block is the constant function 1.0, for every occupant, used
+  /// by point function terms that do not depend on the pivot site.
+  std::vector<double> site_func_values;
+
+  /// \brief Terms of the global (orbit) functions
+  ///
+  /// The terms of correlation `j` are function `j` of this table.
+  OccTermTable global_terms;
+
+  /// \brief Terms of the point (flower) functions
+  ///
+  /// The terms of correlation `j` about neighbor `n` are function
+  /// `n * corr_size + j` of this table.
+  OccTermTable point_terms;
+
+  /// \brief The UnitCell involved in calculating the basis functions,
+  /// relative origin UnitCell
+  std::set<xtal::UnitCell> neighborhood;
+
+  /// \brief The UnitCell involved in calculating the basis functions
+  /// for a particular orbit, relative origin UnitCell
+  std::vector<std::set<xtal::UnitCell> > orbit_neighborhood;
+
+  /// \brief The UnitCellCoord involved in calculating the basis functions
+  /// for a particular orbit, relative origin UnitCell
+  std::vector<std::set<xtal::UnitCellCoord> > orbit_site_neighborhood;
+
+  /// \brief The weight matrix used for ordering the neighbor list
+  PrimNeighborList::Matrix3Type weight_matrix;
+
+  /// \brief The sublattice indices included in the neighbor list
+  std::set<int> sublat_indices;
+
+  /// \brief The total number of sublattices in the prim
+  BaseClexulator::size_type n_sublattices = 0;
+};
+
+/// \brief Evaluates occupation cluster basis functions from tables
+///
+/// OccTableClexulator is a BaseClexulator implementation that does not
+/// require generating and compiling source code. The basis functions are
+/// read from flat tables of neighbor list indices, site basis function
+/// values, and coefficients (OccTableClexulatorData), and evaluated with
+/// simple loops.
+///
+/// Notes:
+/// - Only occupation DoF are supported
+/// - Correlations are written to the "corr" ClexParamPack parameter by the
+///   calc_X methods which do not take a `_corr_begin` argument.
+class OccTableClexulator : public BaseClexulator {
+ public:
+  OccTableClexulator(OccTableClexulatorData _data);
+
+  OccTableClexulator(OccTableClexulator const &other);
+
+  ~OccTableClexulator();
+
+  /// \brief Clone the OccTableClexulator
+  std::unique_ptr<OccTableClexulator> clone() const {
+    return std::unique_ptr<OccTableClexulator>(_clone());
+  }
+
+  /// \brief Obtain const reference to abstract ClexParamPack object
+  ClexParamPack const &param_pack() const override;
+
+  /// \brief Obtain reference to abstract ClexParamPack object
+  ClexParamPack &param_pack() override;
+
+  /// \brief Access the basis function tables
+  OccTableClexulatorData const &data() const { return m_data; }
+
+ private:
+  /// \brief Clone the Clexulator
+  OccTableClexulator *_clone() const override {
+    return new OccTableClexulator(*this);
+  }
+
+  void _calc_global_corr_contribution(
+      EvaluationContext &_context) const override;
+
+  void _calc_global_corr_contribution(EvaluationContext &_context,
+                                      double *_corr_begin) const override;
+
+  void _calc_restricted_global_corr_contribution(
+      EvaluationContext &_context, size_type const *_corr_ind_begin,
+      size_type const *_corr_ind_end) const override;
+
+  void _calc_restricted_global_corr_contribution(
+      EvaluationContext &_context, double *_corr_begin,
+      size_type const *_corr_ind_begin,
+      size_type const *_corr_ind_end) const override;
+
+  void _calc_point_corr(EvaluationContext &_context,
+                        int neighbor_ind) const override;
+
+  void _calc_point_corr(EvaluationContext &_context, int neighbor_ind,
+                        double *_corr_begin) const override;
+
+  void _calc_restricted_point_corr(
+      EvaluationContext &_context, int neighbor_ind,
+      size_type const *_corr_ind_begin,
+      size_type const *_corr_ind_end) const override;
+
+  void _calc_restricted_point_corr(
+      EvaluationContext &_context, int neighbor_ind, double *_corr_begin,
+      size_type const *_corr_ind_begin,
+      size_type const *_corr_ind_end) const override;
+
+  void _calc_delta_point_corr(EvaluationContext &_context, int neighbor_ind,
+                              int occ_i, int occ_f) const override;
+
+  void _calc_delta_point_corr(EvaluationContext &_context, int neighbor_ind,
+                              int occ_i, int occ_f,
+                              double *_corr_begin) const override;
+
+  void _calc_restricted_delta_point_corr(
+      EvaluationContext &_context, int neighbor_ind, int occ_i, int occ_f,
+      size_type const *_corr_ind_begin,
+      size_type const *_corr_ind_end) const override;
+
+  void _calc_restricted_delta_point_corr(
+      EvaluationContext &_context, int neighbor_ind, int occ_i, int occ_f,
+      double *_corr_begin, size_type const *_corr_ind_begin,
+      size_type const *_corr_ind_end) const override;
+
+  void _calc_restricted_delta_point_corr(
+      EvaluationContext &_context, OccDelta const *_delta_begin,
+      OccDelta const *_delta_end, double *_corr_begin,
+      size_type const *_corr_ind_begin,
+      size_type const *_corr_ind_end) const override;
+
+  /// \brief Evaluate global function `i`
+  double _eval_global(EvaluationContext const &_context, Index i) const;
+
+  /// \brief Evaluate point function `i` about neighbor `neighbor_ind`
+  double _eval_point(EvaluationContext const &_context, int neighbor_ind,
+                     Index i) const;
+
+  /// \brief Evaluate change in point function `i` about neighbor
+  /// `neighbor_ind`, due to changing its occupant from `occ_i` to `occ_f`
+  double _eval_delta_point(EvaluationContext const &_context, int neighbor_ind,
+                           int occ_i, int occ_f, Index i) const;
+
+  /// \brief Evaluate the product of factors of term `t`
+  double _eval_factors(EvaluationContext const &_context,
+                       OccTermTable const &table, Index t) const;
+
+  OccTableClexulatorData m_data;
+
+  /// Holds "corr" parameters
+  std::unique_ptr<BasicClexParamPack> m_params;
+
+  ClexParamKey m_corr_param_key;
+};
+
+}  // namespace clexulator
+}  // namespace CASM
+
+#endif
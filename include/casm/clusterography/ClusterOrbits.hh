@@ -203,14 +203,14 @@ template <typename OrbitType, typename OrbitInputIterator,
 OrbitOutputIterator make_next_orbitbranch(
     OrbitInputIterator begin, OrbitInputIterator end,
     const OrbitBranchSpecs<OrbitType> &specs, OrbitOutputIterator result,
-    std::ostream &status);
+    std::ostream &status, Index n_threads = 1);
 
 /// \brief Generate orbits of IntegralCluster using OrbitBranchSpecs
 template <typename OrbitBranchSpecsIterator, typename OrbitOutputIterator>
 OrbitOutputIterator make_orbits(
     OrbitBranchSpecsIterator begin, OrbitBranchSpecsIterator end,
     const std::vector<IntegralClusterOrbitGenerator> &custom_generators,
-    OrbitOutputIterator result, std::ostream &status);
+    OrbitOutputIterator result, std::ostream &status, Index n_threads = 1);
 
 /* -- SymCompareType-Specific IntegralCluster Orbit functions --- */
 
@@ -11,6 +11,7 @@
 #include "casm/container/Counter.hh"
 #include "casm/crystallography/LinearIndexConverter.hh"
 #include "casm/crystallography/Structure.hh"
+#include "casm/misc/parallel.hh"
 #include "casm/symmetry/OrbitGeneration_impl.hh"
 #include "casm/symmetry/Orbit_impl.hh"
 
@@ -419,17 +420,33 @@ OrbitGenerators<OrbitType> &_insert_asymmetric_unit_generators(
 /// \param generators An OrbitGeneratorSet<OrbitType> >& to store
 ///        generating elements for orbits of size n+1
 /// \param stutus Stream for status messages
+/// \param n_threads Number of threads used to find canonical generating
+///        elements
 ///
 /// Uses SymCompareType::compare to find unique generating elements
 ///
+/// Input generating clusters are expanded by candidate sites and the resulting
+/// clusters are put in canonical form in parallel, using a copy of
+/// SymCompareType for each thread. Canonical clusters found by expanding a
+/// single input generating cluster are sorted and made unique using
+/// invariants calculated once per cluster, so that duplicates are rejected
+/// by comparing invariants before the full symmetry comparison. They are then
+/// inserted into `generators` in the order of the input generating clusters,
+/// so the result does not depend on `n_threads`. The specs filter is called
+/// from multiple threads if n_threads > 1.
+///
 /// \ingroup IntegralCluster
 ///
 template <typename OrbitType, typename OrbitGeneratorIterator>
 OrbitGenerators<OrbitType> &_insert_next_orbitbranch_generators(
     OrbitGeneratorIterator begin, OrbitGeneratorIterator end,
     const OrbitBranchSpecs<OrbitType> &specs,
-    OrbitGenerators<OrbitType> &generators, std::ostream &status) {
+    OrbitGenerators<OrbitType> &generators, std::ostream &status,
+    Index n_threads = 1) {
   typedef typename OrbitType::Element cluster_type;
+  typedef typename OrbitType::SymCompareType symcompare_type;
+  typedef typename symcompare_type::InvariantsType invariants_type;
+  typedef std::pair<cluster_type, invariants_type> candidate_type;
 
   const auto &filter = specs.filter();
 
@@ -439,28 +456,35 @@ OrbitGenerators<OrbitType> &_insert_next_orbitbranch_generators(
   // contains a pair of iterators over candidate UnitCellCoord
   auto candidate_sites = specs.candidate_sites();
 
-  // for each orbit generator of size n
-  for (auto orbit_generator_it = begin; orbit_generator_it != end;
-       ++orbit_generator_it) {
-    Index orig_size = generators.elements.size();
+  // SymCompareType and CanonicalGenerator are not thread-safe, so each thread
+  // uses its own copies
+  n_threads = std::max(n_threads, Index(1));
+  std::vector<symcompare_type> thread_sym_compare(n_threads,
+                                                  generators.sym_compare);
+  std::vector<CanonicalGenerator<OrbitType>> thread_generate_canonical;
+  thread_generate_canonical.reserve(n_threads);
+  for (auto const &sym_compare : thread_sym_compare) {
+    thread_generate_canonical.emplace_back(generators.group, sym_compare);
+  }
+
+  // expand `prototype` by each candidate site and return the unique canonical
+  // clusters, ordered as in OrbitGeneratorSet
+  auto expand = [&](cluster_type const &prototype, Index thread_index) {
+    auto const &sym_compare = thread_sym_compare[thread_index];
+    auto const &generate_canonical = thread_generate_canonical[thread_index];
 
-    // print status messages
-    status << clean << '\r' << "  Calculating orbit branch "
-           << orbit_generator_it->size() + 1 << ":  Expanding orbit "
-           << std::distance(begin, orbit_generator_it) << " / "
-           << std::distance(begin, end) << "  of branch "
-           << orbit_generator_it->size() << "." << std::flush;
+    std::vector<candidate_type> candidates;
 
     // by looping over each site in the grid,
     for (auto site_it = candidate_sites.first;
          site_it != candidate_sites.second; ++site_it) {
       // don't duplicate sites in cluster
-      if (contains(*orbit_generator_it, *site_it)) {
+      if (contains(prototype, *site_it)) {
         continue;
       }
 
       // create a test cluster from prototype
-      cluster_type test(*orbit_generator_it);
+      cluster_type test(prototype);
 
       // add the new site
       test.elements().push_back(*site_it);
@@ -469,12 +493,69 @@ OrbitGenerators<OrbitType> &_insert_next_orbitbranch_generators(
         continue;
       }
 
-      // try inserting test (only uniques will be kept)
-      generators.insert(test);
+      cluster_type canonical = generate_canonical(test);
+      invariants_type invariants = sym_compare.make_invariants(canonical);
+      candidates.emplace_back(std::move(canonical), std::move(invariants));
     }
 
-    status << "  New orbits: " << generators.elements.size() - orig_size
-           << std::endl;
+    // stable sort and unique keep the first of equivalent clusters, as
+    // inserting one by one would
+    auto less = [&](candidate_type const &A, candidate_type const &B) {
+      return sym_compare.inter_orbit_compare(A.first, A.second, B.first,
+                                             B.second);
+    };
+    std::stable_sort(candidates.begin(), candidates.end(), less);
+    auto unique_end =
+        std::unique(candidates.begin(), candidates.end(),
+                    [&](candidate_type const &A, candidate_type const &B) {
+                      return !less(A, B);
+                    });
+
+    std::vector<cluster_type> result;
+    result.reserve(std::distance(candidates.begin(), unique_end));
+    for (auto it = candidates.begin(); it != unique_end; ++it) {
+      result.push_back(std::move(it->first));
+    }
+    return result;
+  };
+
+  std::vector<cluster_type> prototypes(begin, end);
+
+  // expand prototypes in chunks, so status messages are printed as they are
+  // inserted
+  Index chunk_size = 16 * n_threads;
+  for (Index chunk_begin = 0; chunk_begin < prototypes.size();
+       chunk_begin += chunk_size) {
+    Index chunk_end =
+        std::min(chunk_begin + chunk_size, Index(prototypes.size()));
+
+    std::vector<std::vector<cluster_type>> canonical_clusters(chunk_end -
+                                                              chunk_begin);
+    parallel_for_each_thread(
+        canonical_clusters.size(), n_threads,
+        [&](Index i, Index thread_index) {
+          canonical_clusters[i] =
+              expand(prototypes[chunk_begin + i], thread_index);
+        });
+
+    // insert in order of the input generating clusters
+    for (Index i = chunk_begin; i < chunk_end; ++i) {
+      Index orig_size = generators.elements.size();
+
+      // print status messages
+      status << clean << '\r' << "  Calculating orbit branch "
+             << prototypes[i].size() + 1 << ":  Expanding orbit " << i
+             << " / " << prototypes.size() << "  of branch "
+             << prototypes[i].size() << "." << std::flush;
+
+      for (auto const &canonical : canonical_clusters[i - chunk_begin]) {
+        // try inserting (only uniques will be kept)
+        generators.insert_canonical(canonical);
+      }
+
+      status << "  New orbits: " << generators.elements.size() - orig_size
+             << std::endl;
+    }
   }
 
   return generators;
@@ -512,6 +593,8 @@ OrbitOutputIterator make_asymmetric_unit(
 /// \param specs OrbitBranchSpecs for orbits of size n+1
 /// \param result An output iterator for orbits of IntegralCluster
 /// \param stutus Stream for status messages
+/// \param n_threads Number of threads used to find canonical generating
+///        elements. The result does not depend on n_threads.
 ///
 /// \ingroup IntegralCluster
 ///
@@ -520,7 +603,7 @@ template <typename OrbitType, typename OrbitInputIterator,
 OrbitOutputIterator make_next_orbitbranch(
     OrbitInputIterator begin, OrbitInputIterator end,
     const OrbitBranchSpecs<OrbitType> &specs, OrbitOutputIterator result,
-    std::ostream &status) {
+    std::ostream &status, Index n_threads) {
   /// Construct an OrbitGenerators object to collect orbit generating elements
   OrbitGenerators<OrbitType> generators(specs.generating_group(),
                                         specs.sym_compare());
@@ -529,7 +612,7 @@ OrbitOutputIterator make_next_orbitbranch(
   /// orbitbranch
   _insert_next_orbitbranch_generators(prototype_iterator(begin),
                                       prototype_iterator(end), specs,
-                                      generators, status);
+                                      generators, status, n_threads);
 
   /// Generate orbits from the orbit generating elements
   return generators.make_orbits(result);
@@ -541,12 +624,14 @@ OrbitOutputIterator make_next_orbitbranch(
 /// \param custom_generators A vector of custom orbit generating clusters
 /// \param result An output iterator for Orbit
 /// \param status Stream for status messages
+/// \param n_threads Number of threads used to find canonical generating
+///        elements. The result does not depend on n_threads.
 ///
 template <typename OrbitBranchSpecsIterator, typename OrbitOutputIterator>
 OrbitOutputIterator make_orbits(
     OrbitBranchSpecsIterator begin, OrbitBranchSpecsIterator end,
     const std::vector<IntegralClusterOrbitGenerator> &custom_generators,
-    OrbitOutputIterator result, std::ostream &status) {
+    OrbitOutputIterator result, std::ostream &status, Index n_threads) {
   if (begin == end) {
     throw libcasm_runtime_error(
         "Error in make_orbits: No OrbitBranchSpecs (begin==end)");
@@ -594,7 +679,7 @@ OrbitOutputIterator make_orbits(
                             specs_it->sym_compare());
     _insert_next_orbitbranch_generators(prev_gen->elements.begin(),
                                         prev_gen->elements.end(), *specs_it,
-                                        generators.back(), status);
+                                        generators.back(), status, n_threads);
     ++specs_it;
     ++prev_gen;
     insert_branch(all_generators, generators.back());
@@ -152,6 +152,10 @@ class PeriodicMaxLengthClusterSpecs : public ClusterSpecs {
   /// Specifies particular clusters that should be used to generate orbits.
   std::vector<IntegralClusterOrbitGenerator> custom_generators;
 
+  /// Number of threads used to generate orbits. The orbits do not depend on
+  /// n_threads.
+  Index n_threads = 1;
+
  private:
   std::string _name() const override;
   CLUSTER_PERIODICITY_TYPE _periodicity_type() const override;
@@ -223,6 +227,10 @@ class LocalMaxLengthClusterSpecs : public ClusterSpecs {
   /// Specifies particular clusters that should be used to generate orbits.
   std::vector<IntegralClusterOrbitGenerator> custom_generators;
 
+  /// Number of threads used to generate orbits. The orbits do not depend on
+  /// n_threads.
+  Index n_threads = 1;
+
  private:
   std::string _name() const override;
   CLUSTER_PERIODICITY_TYPE _periodicity_type() const override;
@@ -1,6 +1,7 @@
 #ifndef CASM_StrucMapping
 #define CASM_StrucMapping
 
+#include <memory>
 #include <unordered_set>
 #include <vector>
 
@@ -8,6 +9,7 @@
 #include "casm/crystallography/SimpleStructureTools.hh"
 #include "casm/crystallography/StrucMapCalculatorInterface.hh"
 #include "casm/crystallography/Superlattice.hh"
+#include "casm/crystallography/SuperlatticeCache.hh"
 #include "casm/crystallography/SymType.hh"
 #include "casm/external/Eigen/Core"
 #include "casm/global/definitions.hh"
@@ -401,6 +403,11 @@ inline bool get_time_reversal(MappingNode const &_node) {
 /// supercell lattices to improve speed of mapping multiple children crystals
 /// onto a single parent structure
 ///
+/// Note: Copies of a StrucMapper share one supercell lattice cache (see
+/// `superlattice_cache`), which is thread-safe, so supercell lattices are only
+/// enumerated once when a copy is used per thread. A StrucMapper should not be
+/// used by multiple threads at once.
+///
 class StrucMapper {
  public:
   using LatMapType = std::map<Index, std::vector<Lattice>>;
@@ -577,15 +584,28 @@ class StrucMapper {
       std::function<bool(Lattice const &, Lattice const &)> _filter_f) {
     m_filtered = true;
     m_filter_f = _filter_f;
-    m_superlat_map.clear();
   }
 
   ///\brief specify not to use filtered lattice for mapping
-  void unset_filter() {
-    m_filtered = false;
-    m_superlat_map.clear();
+  void unset_filter() { m_filtered = false; }
+
+  ///\brief cache of candidate supercell lattices, by volume
+  ///
+  /// Lattices are enumerated as needed. The cache does not depend on the
+  /// filter or allowed lattices, which are applied to its results.
+  std::shared_ptr<SuperlatticeCache> const &superlattice_cache() const {
+    return m_superlat_cache;
   }
 
+  ///\brief use a shared (possibly pre-populated) cache of candidate supercell
+  /// lattices
+  ///
+  /// Throws if `_superlat_cache->key()` does not match
+  /// `superlattice_cache()->key()`, i.e. if the cache was made for a different
+  /// parent lattice, point group, or tolerance.
+  void set_superlattice_cache(
+      std::shared_ptr<SuperlatticeCache> _superlat_cache);
+
   ///\brief k-best mappings of ideal child structure onto parent structure
   /// Assumes that child_struc and parent_struc have lattices related by an
   /// integer transformation so that search over lattices can be replaced with
@@ -796,8 +816,9 @@ class StrucMapper {
   bool m_filtered;
   std::function<bool(Lattice const &, Lattice const &)> m_filter_f;
 
-  /// Maps the supercell volume to a vector of Lattices with that volume
-  mutable LatMapType m_superlat_map;
+  /// Maps the supercell volume to a vector of Lattices with that volume,
+  /// shared by copies
+  std::shared_ptr<SuperlatticeCache> m_superlat_cache;
   mutable LatMapType m_allowed_superlat_map;
 
   std::vector<Lattice> _lattices_of_vol(Index prim_vol) const;
@@ -0,0 +1,94 @@
+#ifndef XTAL_SUPERLATTICECACHE_HH
+#define XTAL_SUPERLATTICECACHE_HH
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "casm/crystallography/Lattice.hh"
+#include "casm/crystallography/SymType.hh"
+#include "casm/global/definitions.hh"
+#include "casm/global/eigen.hh"
+
+namespace CASM {
+namespace xtal {
+
+/// \brief Cache of the canonical superlattices of a parent lattice, by volume
+///
+/// Superlattices of a given volume are enumerated once, the first time they
+/// are requested, and then stored. A SuperlatticeCache may be shared (i.e. via
+/// std::shared_ptr) by StrucMapper copies used on different threads.
+///
+/// Superlattices are stored as integer transformation matrices, T, such that
+/// superlattice.lat_column_mat() == parent_lattice.lat_column_mat() * T, so
+/// the cache can be saved and read back exactly (see
+/// casm/crystallography/io/SuperlatticeCacheIO.hh).
+///
+/// The result of the enumeration depends only on the parent lattice, the point
+/// group, and the tolerance, which are summarized by `key()`. Saved
+/// superlattices should only be inserted into a cache with the same key.
+///
+/// Member functions are thread-safe.
+class SuperlatticeCache {
+ public:
+  typedef std::map<Index, std::vector<Eigen::Matrix3l> > TransfMatMapType;
+
+  /// \brief Constructor
+  ///
+  /// \param _parent_lattice Superlattices are enumerated for this lattice,
+  ///     using its tolerance
+  /// \param _point_group Superlattices are canonical with respect to this
+  ///     group of operations
+  SuperlatticeCache(Lattice const &_parent_lattice,
+                    SymOpVector const &_point_group);
+
+  /// Parent lattice
+  Lattice const &parent_lattice() const { return m_parent_lattice; }
+
+  /// Point group used to enumerate unique, canonical superlattices
+  SymOpVector const &point_group() const { return m_point_group; }
+
+  /// \brief String identifying the parent lattice, point group, and tolerance
+  std::string const &key() const { return m_key; }
+
+  /// \brief Return canonical superlattices of the parent lattice with the given
+  /// volume (as a multiple of the parent lattice volume)
+  std::vector<Lattice> lattices_of_vol(Index prim_vol) const;
+
+  /// \brief Insert superlattices of the given volume, as transformation
+  /// matrices, if not yet in the cache
+  void insert(Index prim_vol,
+              std::vector<Eigen::Matrix3l> const &transformation_matrices);
+
+  /// \brief Copy of all cached transformation matrices
+  TransfMatMapType transformation_matrices() const;
+
+  /// \brief True if superlattices were enumerated since construction or the
+  /// last call to `set_saved`
+  bool modified() const;
+
+  /// \brief Indicate the cache contents have been saved
+  void set_saved();
+
+ private:
+  /// Enumerate canonical superlattices of the parent lattice with given volume
+  std::vector<Eigen::Matrix3l> _enumerate(Index prim_vol) const;
+
+  Lattice m_parent_lattice;
+
+  SymOpVector m_point_group;
+
+  std::string m_key;
+
+  mutable std::mutex m_mutex;
+
+  mutable TransfMatMapType m_transf_mat;
+
+  mutable bool m_modified;
+};
+
+}  // namespace xtal
+}  // namespace CASM
+
+#endif
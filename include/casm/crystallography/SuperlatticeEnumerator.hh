@@ -1,6 +1,9 @@
 #ifndef SuperlatticeEnumerator_HH
 #define SuperlatticeEnumerator_HH
 
+#include <unordered_set>
+#include <vector>
+
 #include "casm/crystallography/HermiteCounter.hh"
 #include "casm/crystallography/Lattice.hh"
 #include "casm/crystallography/SymType.hh"
@@ -123,6 +126,11 @@ class ScelEnumProps {
 
 //******************************************************************************************************************//
 
+/// \brief Hash of an integer 3x3 matrix, for sets of HNF matrices
+struct Matrix3iHash {
+  std::size_t operator()(const Eigen::Matrix3i &value) const;
+};
+
 class SuperlatticeEnumerator;
 
 /// \brief Iterators used with SuperlatticeEnumerator
@@ -209,8 +217,9 @@ class SuperlatticeIterator {
   /// Only used when requested.
   mutable Lattice m_super;
 
-  /// \brief Keep track of the HNF matrices for the current determinant value
-  std::vector<Eigen::Matrix3i> m_canon_hist;
+  /// \brief Keep track of the canonical HNF matrices for the current
+  /// determinant value
+  std::unordered_set<Eigen::Matrix3i, Matrix3iHash> m_canon_hist;
 
   /// \brief Indicates if m_matrix reflects the current m_current matrix
   mutable bool m_matrix_updated;
@@ -304,6 +313,10 @@ class SuperlatticeEnumerator {
   /// \brief A const iterator to a specified volume
   const_iterator citerator(size_type volume) const;
 
+  /// \brief Transformation matrices of all unique superlattices, in iteration
+  /// order, enumerating volumes in parallel
+  std::vector<Eigen::Matrix3i> matrices(Index n_threads = 1) const;
+
  private:
   /// \brief The unit cell of the supercells
   const Lattice m_unit;
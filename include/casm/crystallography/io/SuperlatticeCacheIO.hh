@@ -0,0 +1,29 @@
+#ifndef SUPERLATTICECACHEIO_HH
+#define SUPERLATTICECACHEIO_HH
+
+#include <boost/filesystem/path.hpp>
+
+namespace CASM {
+namespace xtal {
+class SuperlatticeCache;
+}
+
+class jsonParser;
+
+/// Write cached superlattices as transformation matrices, by volume
+jsonParser &to_json(const xtal::SuperlatticeCache &cache, jsonParser &json);
+
+/// Insert cached superlattices, as written by to_json, into a cache
+void from_json(xtal::SuperlatticeCache &cache, const jsonParser &json);
+
+/// Read superlattices from a cache file into a cache, if the file contains
+/// superlattices with a matching key
+bool read_superlattice_cache(xtal::SuperlatticeCache &cache,
+                             const boost::filesystem::path &cache_path);
+
+/// Save cached superlattices in a cache file, if the cache was modified
+void write_superlattice_cache(xtal::SuperlatticeCache &cache,
+                              const boost::filesystem::path &cache_path);
+}  // namespace CASM
+
+#endif
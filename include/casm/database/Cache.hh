@@ -49,6 +49,11 @@ class Cache {
   /// Check if cache updated
   bool cache_updated() const { return m_cache_updated; }
 
+  /// Mark the cache as saved in the database
+  /// - Modeled as const, like 'cache_insert'
+  /// - Sets 'cache_updated()' to false
+  void set_cache_saved() const { m_cache_updated = false; }
+
   /// Clear the cache
   /// - Clearing cache is modeled as const, but a flag is set so the updated
   ///   data can be obtained
@@ -1,6 +1,8 @@
 #ifndef CASM_ConfigDatabaseTools
 #define CASM_ConfigDatabaseTools
 
+#include <vector>
+
 #include "casm/database/ConfigDatabase.hh"
 #include "casm/database/ScelDatabase.hh"
 
@@ -40,6 +42,13 @@ ConfigInsertResult make_canonical_and_insert(
     Configuration const &configuration, Database<Supercell> &supercell_db,
     Database<Configuration> &configuration_db, bool primitive_only);
 
+/// Insert configurations (in primitive & canonical form) in the database
+std::vector<ConfigInsertResult> make_canonical_and_insert(
+    std::vector<Configuration> const &configurations,
+    Database<Supercell> &supercell_db,
+    Database<Configuration> &configuration_db, bool primitive_only,
+    Index n_threads);
+
 /// Insert this configuration (in primitive & canonical form) in the database
 ///
 /// - This version checks `is_guaranteed_for_database_insert(enumerator)` and
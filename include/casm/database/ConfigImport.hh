@@ -22,6 +22,7 @@ struct Settings;
 }
 
 class ConfigMapper;
+struct ConfigMapperResult;
 class Configuration;
 class PrimClex;
 class jsonParser;
@@ -61,15 +62,59 @@ class StructureMap<Configuration> {
                           std::unique_ptr<Configuration> const &hint_config,
                           map_result_inserter result) const;
 
+  /// \brief Map structures, using up to n_threads threads
+  ///
+  /// \param paths Paths to structure or properties.calc.json files
+  /// \param req_properties List of names of properties that are required for
+  /// mapped data to be considered 'complete'
+  /// \param hint_configs Either empty, or the 'from' config (or nullptr if
+  /// unknown) for each path
+  /// \param n_threads Maximum number of threads used for mapping
+  ///
+  /// \returns Mapping results for each path, in the same order as `paths`
+  ///
+  /// - Equivalent to calling the single path `map` for each path, in order.
+  ///   Structures are read and mapped in parallel, with a ConfigMapper copy
+  ///   for each thread, then mapped configurations are inserted in the
+  ///   database on the calling thread, in order, so names and ids do not
+  ///   depend on `n_threads`.
+  std::vector<std::vector<ConfigIO::Result> > map(
+      std::vector<fs::path> const &paths,
+      std::vector<std::string> const &req_properties,
+      std::vector<std::unique_ptr<Configuration> > const &hint_configs,
+      Index n_threads) const;
+
   /// Returns settings used for mapping
   const ConfigMapping::Settings &settings() const;
 
+  /// \brief Save candidate supercell lattices enumerated while mapping, so
+  /// that they are reused by later imports and updates
+  void commit() const;
+
  private:
   /// \brief Read SimpleStructure to be imported
   SimpleStructure _make_structure(const fs::path &p) const;
 
+  /// \brief Read and map a structure, without modifying the database
+  ConfigMapperResult _map_structure(fs::path const &p,
+                                    Configuration const *hint_config,
+                                    ConfigMapper const &configmapper,
+                                    ConfigIO::Result &res) const;
+
+  /// \brief Insert mapped configurations in the database and output results
+  map_result_inserter _insert(fs::path const &p,
+                              std::vector<std::string> const &req_properties,
+                              Configuration const *hint_config,
+                              ConfigIO::Result res,
+                              ConfigMapperResult const &map_result,
+                              map_result_inserter result) const;
+
   PrimClex const *m_primclex_ptr;
   std::unique_ptr<ConfigMapper> m_configmapper;
+
+  // copies of m_configmapper used by additional threads, kept so that their
+  // supercell lattice caches are reused
+  mutable std::vector<std::unique_ptr<ConfigMapper> > m_thread_configmappers;
 };
 
 /// Configuration-specialized Import
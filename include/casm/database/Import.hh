@@ -57,6 +57,10 @@ struct ImportSettings {
 
   /// Output reports as JSON instead of columns
   bool output_as_json = true;
+
+  /// Maximum number of threads used to map structures. Results are the same
+  /// for any number of threads.
+  Index n_threads = 1;
 };
 
 jsonParser &to_json(ImportSettings const &_set, jsonParser &_json);
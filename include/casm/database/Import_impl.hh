@@ -109,66 +109,78 @@ void ImportT<_ConfigType>::import(PathIterator begin, PathIterator end) {
   auto required_properties =
       project_settings.required_properties(traits<ConfigType>::name, calctype);
 
+  // structures are mapped in batches, in parallel if n_threads > 1, and then
+  // results are handled in order
+  Index n_threads = std::max(Index(1), settings().n_threads);
+  Index batch_size = (n_threads == 1) ? 1 : 16 * n_threads;
+  std::vector<fs::path> batch;
+
   Log &log = CASM::log();
   auto it = begin;
-  for (; it != end; ++it) {
-    log << "Importing " << it->string() << std::endl;
-
-    std::vector<ConfigIO::Result> tvec;
+  while (it != end) {
+    batch.clear();
+    for (; it != end && Index(batch.size()) < batch_size; ++it) {
+      batch.push_back(it->string());
+    }
 
-    // Outputs one or more mapping results from the structure located at specied
-    // path
+    // Outputs one or more mapping results from the structure located at each
+    // specified path
     //   See _import documentation for more.
-    m_structure_mapper.map(it->string(), required_properties, nullptr,
-                           std::back_inserter(tvec));
-
-    // if successfully mapped:
-    // - check for preexisting properties and files
-    for (auto &res : tvec) {
-      if (!res.properties.to.empty()) {
-        // note if preexisting properties before this batch
-        auto p_it = preexisting.find(res.properties.to);
-        if (p_it == preexisting.end()) {
-          p_it = preexisting
-                     .emplace(res.properties.to,
-                              has_existing_data(res.properties.to))
-                     .first;
+    auto batch_results =
+        m_structure_mapper.map(batch, required_properties, {}, n_threads);
+
+    for (Index i = 0; i < Index(batch.size()); ++i) {
+      log << "Importing " << batch[i].string() << std::endl;
+      std::vector<ConfigIO::Result> &tvec = batch_results[i];
+
+      // if successfully mapped:
+      // - check for preexisting properties and files
+      for (auto &res : tvec) {
+        if (!res.properties.to.empty()) {
+          // note if preexisting properties before this batch
+          auto p_it = preexisting.find(res.properties.to);
+          if (p_it == preexisting.end()) {
+            p_it = preexisting
+                       .emplace(res.properties.to,
+                                has_existing_data(res.properties.to))
+                       .first;
+          }
+          res.import_data.preexisting = p_it->second;
         }
-        res.import_data.preexisting = p_it->second;
-      }
 
-      if (!res.properties.to.empty()) {
-        // note if preexisting files before this batch
-        auto p_it = preexisting_files.find(res.properties.to);
-        if (p_it == preexisting_files.end()) {
-          p_it = preexisting_files
-                     .emplace(res.properties.to,
-                              has_existing_files(res.properties.to))
-                     .first;
+        if (!res.properties.to.empty()) {
+          // note if preexisting files before this batch
+          auto p_it = preexisting_files.find(res.properties.to);
+          if (p_it == preexisting_files.end()) {
+            p_it = preexisting_files
+                       .emplace(res.properties.to,
+                                has_existing_files(res.properties.to))
+                       .first;
+          }
+          res.import_data.preexisting_files = p_it->second;
         }
-        res.import_data.preexisting_files = p_it->second;
       }
-    }
 
-    // import properties if:
-    // - could map structure
-    // - import_properties == true
-    // - there are any global or site properties
-    for (auto &res : tvec) {
-      if (!res.properties.to.empty() && settings().import_properties &&
-          (res.properties.global.size() || res.properties.site.size())) {
-        // we will try to import data
-        // insert properties
-        // - first erase in case properties from structure already inserted
-        // - assume no "force" necessary
-        db_props().erase_via_origin(res.properties.origin);
-        db_props().insert(res.properties);
+      // import properties if:
+      // - could map structure
+      // - import_properties == true
+      // - there are any global or site properties
+      for (auto &res : tvec) {
+        if (!res.properties.to.empty() && settings().import_properties &&
+            (res.properties.global.size() || res.properties.site.size())) {
+          // we will try to import data
+          // insert properties
+          // - first erase in case properties from structure already inserted
+          // - assume no "force" necessary
+          db_props().erase_via_origin(res.properties.origin);
+          db_props().insert(res.properties);
+        }
       }
-    }
 
-    // add individual structure mapping results to batch results map
-    for (auto &res : tvec) {
-      results.push_back(res);
+      // add individual structure mapping results to batch results map
+      for (auto &res : tvec) {
+        results.push_back(res);
+      }
     }
   }
 
@@ -223,6 +235,7 @@ void ImportT<_ConfigType>::import(PathIterator begin, PathIterator end) {
   db_supercell().commit();
   db_config<ConfigType>().commit();
   db_props().commit();
+  m_structure_mapper.commit();
 }
 
 // *********************************************************************************
@@ -0,0 +1,121 @@
+#ifndef CASM_PropertyCache
+#define CASM_PropertyCache
+
+#include <boost/filesystem/path.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "casm/global/definitions.hh"
+
+namespace CASM {
+
+namespace clexulator {
+struct ConfigDoFValues;
+}
+
+namespace DB {
+
+/// \brief Binary cache of property values calculated for configurations
+///
+/// A PropertyCache stores `size()` values per configuration, for example
+/// correlations or a predicted property, in one contiguous array. Each row is
+/// stored with the configuration name and a hash of the DoF values it was
+/// calculated for, so a row is only found if the configuration is unchanged.
+///
+/// The cache is identified by a key, such as a hash of the basis set and ECI
+/// files the values are calculated from. When a cache file is opened with a
+/// different key or size its contents are discarded, so changing the basis
+/// set or ECI invalidates the cache automatically.
+///
+/// Cache file layout (native byte order):
+/// - "CASMPCAC", uint32_t version
+/// - key: uint32_t length, characters
+/// - uint64_t size, uint64_t number of rows
+/// - names: for each row, uint32_t length, characters
+/// - uint64_t DoF hash, for each row
+/// - double values, `size()` per row
+///
+/// Use `open_property_cache` to share one PropertyCache between the objects
+/// using a cache file.
+class PropertyCache {
+ public:
+  /// \brief Open a cache file
+  PropertyCache(fs::path _path, std::string _key, Index _size);
+
+  /// \brief Writes the cache file if modified, ignoring errors
+  ~PropertyCache();
+
+  PropertyCache(PropertyCache const &) = delete;
+  PropertyCache &operator=(PropertyCache const &) = delete;
+
+  /// \brief Path to the cache file
+  fs::path const &path() const { return m_path; }
+
+  /// \brief Identifies the data the cached values are calculated from
+  std::string const &key() const { return m_key; }
+
+  /// \brief Number of values stored per configuration
+  Index size() const { return m_size; }
+
+  /// \brief Number of configurations with cached values
+  Index n_configurations() const { return m_names.size(); }
+
+  /// \brief True if values were inserted since the cache file was read or
+  /// written
+  bool modified() const { return m_modified; }
+
+  /// \brief Return pointer to the cached values for a configuration, or
+  /// nullptr if not cached for the given DoF hash
+  double const *find(std::string const &configname,
+                     std::uint64_t dof_hash) const;
+
+  /// \brief Insert or replace the cached values for a configuration
+  void insert(std::string const &configname, std::uint64_t dof_hash,
+              double const *values);
+
+  /// \brief Remove all cached values
+  void clear();
+
+  /// \brief Write the cache file
+  void commit();
+
+ private:
+  /// \brief Read the cache file, if it exists and matches key and size
+  void _read();
+
+  fs::path m_path;
+  std::string m_key;
+  Index m_size;
+
+  std::vector<std::string> m_names;
+  std::vector<std::uint64_t> m_dof_hash;
+  std::vector<double> m_values;
+
+  // configuration name -> row
+  std::unordered_map<std::string, Index> m_row;
+
+  bool m_modified;
+};
+
+/// \brief Return the PropertyCache for a cache file, sharing it with other
+/// users of the same file in this process
+std::shared_ptr<PropertyCache> open_property_cache(fs::path const &path,
+                                                   std::string const &key,
+                                                   Index size);
+
+/// \brief Hash of configuration DoF values, for checking cached values
+std::uint64_t dof_hash(clexulator::ConfigDoFValues const &dof_values);
+
+/// \brief Make a PropertyCache key from the contents of files
+///
+/// \returns A hash of the contents of all files, or an empty string if any
+///     file does not exist
+std::string make_property_cache_key(std::vector<fs::path> const &files);
+
+}  // namespace DB
+}  // namespace CASM
+
+#endif
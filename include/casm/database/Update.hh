@@ -33,6 +33,10 @@ struct UpdateSettings {
 
   // Output reports as JSON instead of columns
   bool output_as_json;
+
+  /// Maximum number of threads used to map structures. Results are the same
+  /// for any number of threads.
+  Index n_threads = 1;
 };
 
 /// Generic ConfigType-dependent part of Import
@@ -34,8 +34,35 @@ void UpdateT<_ConfigType>::update(const DB::Selection<ConfigType> &selection,
   auto required_properties =
       project_settings.required_properties(traits<ConfigType>::name, calctype);
 
+  // structures are mapped in batches, in parallel if n_threads > 1, and then
+  // results are handled in order
+  Index n_threads = std::max(Index(1), settings().n_threads);
+  Index batch_size = (n_threads == 1) ? 1 : 16 * n_threads;
+  std::vector<std::string> names;
+  std::vector<fs::path> paths;
+  std::vector<std::unique_ptr<ConfigType> > hint_configs;
+
   // vector of Mapping results
   std::vector<ConfigIO::Result> results;
+  auto update_batch = [&]() {
+    auto batch_results = m_structure_mapper.map(paths, required_properties,
+                                                hint_configs, n_threads);
+    for (Index i = 0; i < Index(names.size()); ++i) {
+      log << "Updating data records for " << names[i] << std::endl;
+      for (auto &res : batch_results[i]) {
+        results.push_back(res);
+        // if mapped && has data, insert
+        if (!res.properties.to.empty() && res.has_data) {
+          // insert data:
+          db_props().insert(res.properties);
+        }
+      }
+    }
+    names.clear();
+    paths.clear();
+    hint_configs.clear();
+  };
+
   for (const auto &val : selection.data()) {
     // if not selected, skip
     if (!val.second) {
@@ -70,32 +97,25 @@ void UpdateT<_ConfigType>::update(const DB::Selection<ConfigType> &selection,
 
     if (!fs::exists(pos)) continue;
 
-    log << "Updating data records for " << name << std::endl;
-    std::vector<ConfigIO::Result> tvec;
+    names.push_back(name);
+    paths.push_back(resolve_struc_path(pos, primclex()));
     auto config_it = db_config<ConfigType>().find(name);
-    if (config_it == db_config<ConfigType>().end())
-      m_structure_mapper.map(resolve_struc_path(pos, primclex()),
-                             required_properties, nullptr,
-                             std::back_inserter(tvec));
-    else
-      m_structure_mapper.map(resolve_struc_path(pos, primclex()),
-                             required_properties,
-                             notstd::make_unique<ConfigType>(*config_it),
-                             std::back_inserter(tvec));
-    for (auto &res : tvec) {
-      results.push_back(res);
-      // if mapped && has data, insert
-      if (!res.properties.to.empty() && res.has_data) {
-        // insert data:
-        db_props().insert(res.properties);
-      }
+    if (config_it == db_config<ConfigType>().end()) {
+      hint_configs.push_back(nullptr);
+    } else {
+      hint_configs.push_back(notstd::make_unique<ConfigType>(*config_it));
+    }
+    if (Index(names.size()) == batch_size) {
+      update_batch();
     }
   }
+  update_batch();
   _update_report(results, selection);
 
   db_supercell().commit();
   db_config<ConfigType>().commit();
   db_props().commit();
+  m_structure_mapper.commit();
 }
 
 template <typename _ConfigType>
@@ -0,0 +1,258 @@
+#ifndef CASM_binaryDatabase
+#define CASM_binaryDatabase
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+#include <boost/filesystem/fstream.hpp>
+
+#include "casm/app/DirectoryStructure.hh"
+#include "casm/database/ConfigDatabase.hh"
+#include "casm/database/Database.hh"
+#include "casm/database/ScelDatabase.hh"
+
+namespace CASM {
+
+template <typename T>
+struct traits;
+
+namespace DB {
+template <typename DataObject>
+class binaryDatabase;
+class DatabaseHandler;
+
+struct binaryDB;
+}  // namespace DB
+
+template <>
+struct traits<DB::binaryDB> {
+  static const std::string name;
+
+  /// Database format version, incremented separately from casm --version
+  static const std::string version;
+
+  static void insert(DB::DatabaseHandler &db_handler);
+};
+
+namespace DB {
+
+/// binaryDB stores Configuration in a binary, append-only log
+///
+/// - Select with project settings: "database": "binaryDB"
+/// - Supercell and properties databases use the jsonDB files
+struct binaryDB {
+  static void insert(DatabaseHandler &);
+
+  class DirectoryStructure {
+   public:
+    DirectoryStructure(const fs::path _root);
+
+    /// Location of the binaryDB 'config_list.log', the record log for each
+    /// ConfigType
+    template <typename DataObject>
+    fs::path obj_log() const;
+
+    /// Location of the binaryDB 'config_list.index', the name index into the
+    /// record log for each ConfigType
+    template <typename DataObject>
+    fs::path obj_index() const;
+
+   private:
+    CASM::DirectoryStructure m_dir;
+  };
+};
+
+/// Orders Configuration names by supercell name, then by numeric id
+struct ConfigNameCompare {
+  bool operator()(std::string const &A, std::string const &B) const;
+};
+
+/// Binary Configuration database
+///
+/// The database consists of two files:
+/// - A record log, "config_list.log". Records are only appended. Each record
+///   either stores a Configuration (name, DoF values in the prim DoF basis,
+///   source, and cache) or marks a Configuration as erased. The most recent
+///   record with a given name is current.
+/// - A name index, "config_list.index", which stores the log offset of the
+///   current record for each Configuration and the next id to assign for each
+///   supercell. The index records the log size it describes, and if it is
+///   missing or out of date it is rebuilt by scanning the log.
+///
+/// Notes:
+/// - Only a lightweight record (name, log location, and a search key) is kept
+///   for each Configuration. Configurations are read from the log when an
+///   iterator is dereferenced and kept in a least-recently-used cache of
+///   bounded size (see `cache_capacity`, and the project setting
+///   "database_cache_size").
+/// - A dereferenced iterator keeps its Configuration alive, but references
+///   obtained from temporary iterators may be invalidated by later accesses.
+/// - Configurations inserted or updated since the last commit, and
+///   Configurations with an updated cache, are kept in memory until commit.
+/// - Iteration is ordered by supercell name, then by Configuration id.
+/// - commit() appends records only for Configurations that were inserted,
+///   updated, or erased, or have an updated cache, since the last commit, and
+///   then rewrites the index. When less than half of the log is current, the
+///   log is rewritten with only current records.
+///
+template <>
+class binaryDatabase<Configuration> : public Database<Configuration> {
+ public:
+  /// Statistics for the in-memory Configuration cache
+  struct CacheStats {
+    /// Number of Configuration held in memory
+    Index size = 0;
+
+    /// Maximum number of unmodified Configuration held in memory
+    Index capacity = 0;
+
+    /// Number of accesses to Configuration already in memory
+    Index hits = 0;
+
+    /// Number of accesses requiring a Configuration be read from the log
+    Index misses = 0;
+
+    /// Number of Configuration removed from memory to stay within capacity
+    Index evictions = 0;
+  };
+
+  binaryDatabase<Configuration>(const PrimClex &_primclex,
+                                Index _cache_capacity = 10000);
+
+  binaryDatabase<Configuration> &open() override;
+
+  void commit() override;
+
+  void close() override;
+
+  iterator begin() const override;
+
+  iterator end() const override;
+
+  size_type size() const override;
+
+  std::pair<iterator, bool> insert(const Configuration &config) override;
+
+  iterator update(const Configuration &config) override;
+
+  iterator erase(iterator pos) override;
+
+  iterator find(const std::string &name_or_alias) const override;
+
+  /// Range of Configuration in a particular supecell
+  ///
+  /// - Should return range {end(), end()} if no Configuration in specified
+  /// Supercell
+  /// - Note: boost::iterator_range<iterator>::size is not valid for
+  ///   DatabaseIterator.  Use boost::distance instead.
+  boost::iterator_range<iterator> scel_range(
+      const std::string &scelname) const override;
+
+  /// Find canonical Configuration in database by comparing DoF
+  iterator search(const Configuration &config) const override;
+
+  /// Maximum number of unmodified Configuration held in memory
+  Index cache_capacity() const { return m_cache_stats.capacity; }
+
+  /// Set maximum number of unmodified Configuration held in memory
+  void set_cache_capacity(Index _cache_capacity);
+
+  /// Statistics for the in-memory Configuration cache
+  CacheStats const &cache_stats() const { return m_cache_stats; }
+
+ private:
+  class RecordIterator;
+
+  struct Record;
+  typedef std::pair<const std::string, Record> record_value;
+
+  /// Record for a Configuration in the database
+  struct Record {
+    /// Location of the current record in the log, or 0 if not yet written
+    uint64_t offset = 0;
+
+    /// Size of the current record in the log
+    uint64_t size = 0;
+
+    /// Hash of supercell name and occupation, used by search
+    uint64_t key = 0;
+
+    /// Configuration, if in memory
+    std::shared_ptr<Configuration> config;
+
+    /// True if inserted or updated since the last commit
+    bool is_modified = false;
+
+    /// True if in m_lru, and may be evicted
+    bool in_lru = false;
+
+    /// Position in m_lru
+    std::list<record_value *>::iterator lru_it;
+  };
+
+  typedef std::map<std::string, Record, ConfigNameCompare> record_map;
+
+  /// Read the index, or rebuild it from the log
+  void _read_index();
+
+  /// Rebuild the index by scanning the log
+  void _scan_log();
+
+  /// Return Configuration, reading it from the log if not in memory
+  std::shared_ptr<Configuration const> _config(
+      record_map::iterator record_it) const;
+
+  /// Add a record to m_lru as most recently used
+  void _touch(record_value *value) const;
+
+  /// Remove least recently used Configuration from memory until within
+  /// capacity
+  void _evict() const;
+
+  /// Remove a record from m_search_index
+  void _erase_search_key(record_map::iterator record_it);
+
+  /// Rewrite the log with only current records
+  void _compact();
+
+  /// Write the index
+  void _write_index() const;
+
+  iterator _iterator(record_map::iterator record_it) const;
+
+  bool m_is_open;
+
+  // open for reading Configuration from the log
+  mutable std::unique_ptr<fs::ifstream> m_log_in;
+
+  // map name -> record, for all Configuration in the database
+  mutable record_map m_records;
+
+  // Configuration key -> name, for search
+  std::unordered_multimap<uint64_t, std::string const *> m_search_index;
+
+  // records with Configuration in memory that may be evicted, most recently
+  // used first
+  mutable std::list<record_value *> m_lru;
+
+  mutable CacheStats m_cache_stats;
+
+  // size of the log, in bytes
+  uint64_t m_log_size;
+
+  // total size of current records in the log, in bytes
+  uint64_t m_live_size;
+
+  // name -> log record size, for Configuration erased since the last commit
+  std::map<std::string, uint64_t> m_erased;
+
+  // map of scelname -> next id to assign to a new Configuration
+  std::map<std::string, Index> m_config_id;
+};
+
+}  // namespace DB
+}  // namespace CASM
+
+#endif
@@ -76,7 +76,38 @@ class Hull {
   /// above the hull along the energy axis
   double dist_to_hull(Eigen::VectorXd _reduced_point) const;
 
+  /// \brief The distance each selected Configuration is above the hull along
+  /// the energy axis
+  std::vector<double> dist_to_hull(
+      const DB::Selection<Configuration> &selection) const;
+
+  /// \brief The distance each column of a matrix of points in the reduced
+  /// composition/energy space is above the hull along the energy axis
+  Eigen::VectorXd dist_to_hull_batch(
+      const Eigen::MatrixXd &reduced_points) const;
+
  private:
+  /// \brief Build the point location data used by dist_to_hull
+  void _build_facet_index();
+
+  /// \brief Distance along the energy axis from a reduced point to the
+  /// hyperplane of the i-th bottom facet
+  double _facet_dist(Index i, const Eigen::VectorXd &_reduced_point) const;
+
+  /// \brief True if the projection of the i-th bottom facet onto composition
+  /// space contains the composition of a reduced point
+  bool _facet_contains(Index i, const Eigen::VectorXd &_reduced_point) const;
+
+  /// \brief Index of the point location grid cell containing the composition
+  /// of a reduced point
+  Index _grid_cell(const Eigen::VectorXd &_reduced_point) const;
+
+  /// \brief Index of the bottom facet to begin the point location walk from
+  Index _start_facet(const Eigen::VectorXd &_reduced_point) const;
+
+  /// \brief Minimum distance over all bottom facets
+  double _scan_dist_to_hull(const Eigen::VectorXd &_reduced_point) const;
+
   struct CompareVertex {
     CompareVertex() {}
 
@@ -107,6 +138,39 @@ class Hull {
 
   // the vertices on the bottom hull
   std::set<orgQhull::QhullVertex, CompareVertex> m_bottom_vertices;
+
+  /// \brief Point location data for the bottom facets
+  ///
+  /// The bottom facets, projected onto composition space, tile the range of
+  /// compositions spanned by the hull. The facet below a point is found by
+  /// walking from a nearby facet to neighboring bottom facets that are
+  /// closer to the point along the energy axis.
+  struct BottomFacetIndex {
+    // columns are the outward unit normal of each bottom facet
+    Eigen::MatrixXd normal;
+
+    // hyperplane offset of each bottom facet
+    Eigen::VectorXd offset;
+
+    // indices of the neighboring bottom facets of each bottom facet
+    std::vector<std::vector<Index> > neighbors;
+
+    // true if a bottom facet has a neighbor that is not a bottom facet
+    std::vector<bool> is_boundary;
+
+    // for simplicial bottom facets, the matrix which gives the barycentric
+    // coordinates of [composition; 1] in the projected facet, else empty
+    std::vector<Eigen::MatrixXd> barycentric;
+
+    // uniform grid over composition space, storing for each cell the index
+    // of a bottom facet near the cell to begin point location walks from
+    Eigen::VectorXd grid_min;
+    Eigen::VectorXd grid_cell_width;
+    Index grid_n;
+    std::vector<Index> grid_start;
+  };
+
+  BottomFacetIndex m_index;
 };
 
 }  // namespace CASM
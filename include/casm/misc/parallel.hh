@@ -0,0 +1,81 @@
+#ifndef CASM_parallel
+#define CASM_parallel
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#include "casm/global/definitions.hh"
+
+namespace CASM {
+
+/// \brief Call f(i, thread_index) for each i in [0, size), using up to
+/// n_threads threads
+///
+/// - thread_index, in [0, min(n_threads, size)), identifies the thread making
+///   the call, so that f may use per-thread resources. Calls with
+///   thread_index == 0 are made on the calling thread.
+/// - Indices are handed out to threads in increasing order as threads become
+///   available, so the order in which f is called is unspecified. Calls must
+///   not depend on each other.
+/// - If n_threads <= 1 or size <= 1, f is called on the calling thread
+/// - If f throws, remaining indices are skipped and the first exception is
+///   rethrown on the calling thread after all threads finish
+template <typename FunctionType>
+void parallel_for_each_thread(Index size, Index n_threads, FunctionType f) {
+  n_threads = std::min(n_threads, size);
+  if (n_threads <= 1) {
+    for (Index i = 0; i < size; ++i) {
+      f(i, Index(0));
+    }
+    return;
+  }
+
+  std::atomic<Index> next{0};
+  std::vector<std::exception_ptr> errors(n_threads);
+  auto work = [&](Index thread_index) {
+    try {
+      Index i;
+      while ((i = next++) < size) {
+        f(i, thread_index);
+      }
+    } catch (...) {
+      errors[thread_index] = std::current_exception();
+      next = size;
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (Index t = 1; t < n_threads; ++t) {
+    threads.emplace_back(work, t);
+  }
+  work(0);
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  for (auto const &error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
+/// \brief Call f(i) for each i in [0, size), using up to n_threads threads
+///
+/// - Indices are handed out to threads in increasing order as threads become
+///   available, so the order in which f is called is unspecified. Calls must
+///   not depend on each other.
+/// - If n_threads <= 1 or size <= 1, f is called on the calling thread
+/// - If f throws, remaining indices are skipped and the first exception is
+///   rethrown on the calling thread after all threads finish
+template <typename FunctionType>
+void parallel_for(Index size, Index n_threads, FunctionType f) {
+  parallel_for_each_thread(size, n_threads,
+                           [&](Index i, Index thread_index) { f(i); });
+}
+
+}  // namespace CASM
+
+#endif
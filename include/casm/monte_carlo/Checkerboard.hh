@@ -0,0 +1,108 @@
+#ifndef CASM_Monte_Checkerboard_HH
+#define CASM_Monte_Checkerboard_HH
+
+#include <set>
+#include <vector>
+
+#include "casm/clex/Clexulator.hh"
+#include "casm/external/MersenneTwister/MersenneTwister.h"
+#include "casm/global/definitions.hh"
+#include "casm/global/eigen.hh"
+
+namespace CASM {
+
+namespace xtal {
+class UnitCellCoord;
+}
+
+namespace Monte {
+
+class Conversions;
+
+/// \brief Partition of the variable sites of a supercell into colors, such
+/// that no cluster includes two sites of the same color
+///
+/// Sites are colored by sublattice and by unit cell coordinates (i, j, k)
+/// modulo a period (m_i, m_j, m_k):
+/// \code
+/// color ~ (b, i % m_i, j % m_j, k % m_k)
+/// \endcode
+/// Each period is the smallest integer that is larger than the extent of the
+/// site neighborhood along that prim lattice vector, and that divides the
+/// corresponding row of the supercell transformation matrix, so that the
+/// coloring is consistent across periodic images of the supercell.
+///
+/// Changing the occupation of one site only changes the contribution of
+/// clusters that include it, and so does not change the dEpot of changing any
+/// other site of the same color. Changes to all sites of one color can
+/// therefore be evaluated concurrently, and the result is the same as
+/// evaluating them one after another.
+///
+class Checkerboard {
+ public:
+  /// \brief Constructor
+  Checkerboard(Conversions const &convert,
+               std::set<xtal::UnitCellCoord> const &site_neighborhood);
+
+  /// \brief Coloring period along each prim lattice vector
+  Eigen::Vector3l const &period() const { return m_period; }
+
+  /// \brief Number of colors
+  Index n_colors() const { return m_sites.size(); }
+
+  /// \brief Linear site index of the variable sites of one color
+  std::vector<Index> const &sites(Index color_index) const {
+    return m_sites[color_index];
+  }
+
+  /// \brief Color of a site, or -1 if the site does not have variable
+  /// occupation
+  Index color(Index linear_site_index) const {
+    return m_color[linear_site_index];
+  }
+
+ private:
+  Eigen::Vector3l m_period;
+
+  /// m_sites[color_index]: linear site index of variable sites
+  std::vector<std::vector<Index>> m_sites;
+
+  /// m_color[linear_site_index]: color index, or -1
+  std::vector<Index> m_color;
+};
+
+/// \brief Resources of one thread for evaluating checkerboard steps, and the
+/// changes it accepted
+///
+/// Each thread has its own random number generator, so that results depend
+/// only on the initial seed and the number of threads.
+struct CheckerboardThread {
+  CheckerboardThread(Clexulator const &clexulator, Index n_species,
+                     MTRand::uint32 seed);
+
+  /// \brief Clear accepted changes and sums of property changes
+  void reset();
+
+  MTRand mtrand;
+
+  clexulator::EvaluationContext context;
+
+  /// Change in (extensive) correlations, for evaluating proposals
+  Eigen::VectorXd dcorr;
+  Eigen::VectorXd tmp_dcorr;
+
+  /// Accepted changes: the occupant index of site[i] becomes new_occ[i]
+  std::vector<Index> site;
+  std::vector<int> new_occ;
+
+  /// Sums of (extensive) property changes of accepted changes
+  Eigen::VectorXd sum_dcorr;
+  double sum_dEf;
+  double sum_dEpot;
+  Eigen::VectorXl sum_dN;
+};
+
+}  // namespace Monte
+}  // namespace CASM
+
+#endif
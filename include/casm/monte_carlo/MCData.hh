@@ -1,6 +1,10 @@
 #ifndef MCData_HH
 #define MCData_HH
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 #include "casm/global/definitions.hh"
 #include "casm/global/eigen.hh"
 #include "casm/monte_carlo/MonteDefinitions.hh"
@@ -9,25 +13,68 @@ namespace CASM {
 namespace Monte {
 
 /// \brief MCData stores observations of properties
+///
+/// - Also accumulates, as observations are added, the partial sums needed to
+///   calculate the mean, variance, and lag covariances of any range of
+///   observations in O(1) (or O(lag_block_size) for lag covariances, up to
+///   max_tracked_lag), so that convergence checks do not need to re-scan all
+///   observations
+/// - Partial sums are of observations shifted by the first observation, to
+///   limit loss of precision
 class MCData {
  public:
   typedef Monte::size_type size_type;
 
+  /// \brief Number of observations between stored lag product partial sums
+  static const size_type lag_block_size = 256;
+
+  /// \brief Max lag for which lag product partial sums are accumulated
+  static const size_type max_tracked_lag = 256;
+
   /// \brief Default constructor
   MCData() : MCData(1) {}
 
   /// \brief Constructor with initial buffer size 'count'
   MCData(size_type count)
-      : m_observation(Eigen::VectorXd::Zero(count)), m_size(0) {}
+      : m_observation(Eigen::VectorXd::Zero(count)),
+        m_size(0),
+        m_shift(0.0),
+        m_partial_sum(1, 0.0),
+        m_partial_sum_sq(1, 0.0),
+        m_max_deviation(0.0) {}
 
   /// \brief Forget all the observed values (does not resize reserved space)
-  void clear() { m_size = 0; }
+  void clear() {
+    m_size = 0;
+    m_shift = 0.0;
+    m_partial_sum.assign(1, 0.0);
+    m_partial_sum_sq.assign(1, 0.0);
+    m_max_deviation = 0.0;
+    m_lag_sum.clear();
+    m_lag_checkpoint.clear();
+  }
 
   /// \brief Add an observation
   void push_back(double value) {
+    if (m_size == 0) {
+      m_shift = value;
+    }
+    double y = value - m_shift;
     m_observation(m_size) = value;
+    m_partial_sum.push_back(m_partial_sum.back() + y);
+    m_partial_sum_sq.push_back(m_partial_sum_sq.back() + y * y);
+    m_max_deviation = std::max(m_max_deviation, std::abs(y));
+    for (size_type l = 1; l <= m_lag_sum.size() && l <= m_size; ++l) {
+      m_lag_sum[l - 1] += (m_observation(m_size - l) - m_shift) * y;
+    }
     ++m_size;
 
+    if (m_size % lag_block_size == 0) {
+      for (size_type l = 1; l <= m_lag_sum.size(); ++l) {
+        m_lag_checkpoint[l - 1].push_back(m_lag_sum[l - 1]);
+      }
+    }
+
     // re-size as necessary by doubling reserved space
     if (m_size == m_observation.size()) {
       Eigen::VectorXd tmp = Eigen::VectorXd::Zero(m_observation.size() * 2);
@@ -44,13 +91,67 @@ class MCData {
   /// \brief Number of observations
   size_type size() const { return m_size; }
 
+  /// \brief Sum of observations in range [begin, end)
+  double sum(size_type begin, size_type end) const {
+    return m_partial_sum[end] - m_partial_sum[begin] + (end - begin) * m_shift;
+  }
+
+  /// \brief Sum of squared observations in range [begin, end)
+  double squared_norm(size_type begin, size_type end) const {
+    double sum_y = m_partial_sum[end] - m_partial_sum[begin];
+    double sum_y2 = m_partial_sum_sq[end] - m_partial_sum_sq[begin];
+    return sum_y2 + 2.0 * m_shift * sum_y + (end - begin) * m_shift * m_shift;
+  }
+
+  /// \brief Sum of squared deviations from 'mean' of observations in range
+  /// [begin, end)
+  double squared_deviation(size_type begin, size_type end, double mean) const {
+    return lag_covariance_sum(begin, end, 0, mean);
+  }
+
+  /// \brief Sum of (X(j) - mean)*(X(j+lag) - mean), for j in range
+  /// [begin, end - lag)
+  double lag_covariance_sum(size_type begin, size_type end, size_type lag,
+                            double mean) const;
+
+  /// \brief Maximum absolute difference between any observation and the first
+  /// observation
+  double max_deviation() const { return m_max_deviation; }
+
  private:
+  /// \brief Sum of Y(j)*Y(j+lag), for j+lag < k, where Y = X - m_shift
+  double _lag_partial_sum(size_type lag, size_type k) const;
+
+  /// \brief Begin accumulating lag products for all lags <= 'lag'
+  void _track_lag(size_type lag) const;
+
   /// \brief vector of all observations (includes m_size observations, and the
   /// rest is reserved space)
   Eigen::VectorXd m_observation;
 
   /// \brief The number of observations
   size_type m_size;
+
+  /// \brief The first observation, which is subtracted before accumulating
+  double m_shift;
+
+  /// \brief m_partial_sum[k]: Sum of Y(j), for j < k
+  std::vector<double> m_partial_sum;
+
+  /// \brief m_partial_sum_sq[k]: Sum of Y(j)*Y(j), for j < k
+  std::vector<double> m_partial_sum_sq;
+
+  /// \brief Max of abs(Y(j))
+  double m_max_deviation;
+
+  /// \brief m_lag_sum[lag-1]: Sum of Y(j)*Y(j+lag), for j+lag < m_size
+  ///
+  /// - Lags are only tracked once they have been used, by _track_lag
+  mutable std::vector<double> m_lag_sum;
+
+  /// \brief m_lag_checkpoint[lag-1][c]: Sum of Y(j)*Y(j+lag), for
+  /// j+lag < c*lag_block_size
+  mutable std::vector<std::vector<double>> m_lag_checkpoint;
 };
 
 /// \brief Checks if a range of observations have equilibrated
@@ -65,6 +166,9 @@ class MCDataEquilibration {
   /// \brief Check if a range of observations have equilibrated
   MCDataEquilibration(const Eigen::VectorXd &observations, double prec);
 
+  /// \brief Check if all observations in 'data' have equilibrated
+  MCDataEquilibration(const MCData &data, double prec);
+
   bool is_equilibrated() const { return m_is_equilibrated; }
 
   size_type equilibration_samples() const { return m_equil_samples; }
@@ -86,6 +190,10 @@ class MCDataConvergence {
   /// \brief Construct a MCDataConvergence object
   MCDataConvergence(const Eigen::VectorXd &observations, double conf);
 
+  /// \brief Construct a MCDataConvergence object for observations in range
+  /// [begin, data.size())
+  MCDataConvergence(const MCData &data, size_type begin, double conf);
+
   /// \brief Returns true if converged to the requested level
   ///
   /// \param prec Desired absolute precision (<X> +/- prec)
@@ -116,8 +224,8 @@ class MCDataConvergence {
  private:
   /// \brief Try to find rho = pow(2.0, -1.0/i), using min i such that
   /// CoVar[i]/CoVar[0] <= 0.5
-  std::tuple<bool, double, double> _calc_rho(
-      const Eigen::VectorXd &observations);
+  std::tuple<bool, double, double> _calc_rho(const MCData &data,
+                                             size_type begin);
 
   bool m_is_converged;
   double m_mean;
@@ -11,6 +11,7 @@
 #include "casm/global/definitions.hh"
 #include "casm/misc/cloneable_ptr.hh"
 #include "casm/monte_carlo/MonteDefinitions.hh"
+#include "casm/monte_carlo/OccTrajectory.hh"
 
 namespace CASM {
 
@@ -92,6 +93,9 @@ class MonteCarlo {
     clear_samples();
   }
 
+  /// \brief Seed the random number generator
+  void seed(MTRand::uint32 _seed) { m_twister.seed(_seed); }
+
   // ---- Properties ----------------
 
   /// \brief const Access scalar properties map
@@ -150,6 +154,13 @@ class MonteCarlo {
   /// sample_times for pass and step information.
   const std::vector<ConfigDoF> &trajectory() const { return m_trajectory; }
 
+  /// \brief Stream snapshots to 'file_path', as they are taken, instead of
+  /// storing them in trajectory()
+  void begin_trajectory_stream(const fs::path &file_path);
+
+  /// \brief Finish streaming snapshots and close the file
+  void end_trajectory_stream();
+
   /// \brief return true if running in debug mode
   bool debug() const { return m_debug; }
 
@@ -237,6 +248,10 @@ class MonteCarlo {
   /// m_write_trajectory is true
   std::vector<ConfigDoF> m_trajectory;
 
+  /// \brief If not null, snapshots are streamed to this instead of stored in
+  /// m_trajectory
+  std::unique_ptr<OccTrajectoryWriter> m_trajectory_writer;
+
   /// \brief True if any MonteSampler must converge
   bool m_must_converge;
 
@@ -60,6 +60,13 @@ class MonteCounter {
   /// \brief Postfix increment step and updates pass
   MonteCounter operator++(int);
 
+  /// \brief Increment by n_steps steps and update pass, as for steps skipped
+  /// by rejection-free Monte Carlo
+  void increment(size_type n_steps);
+
+  /// \brief Number of steps until it is time to take the next sample
+  size_type steps_until_sample() const;
+
   /// \brief Check if requested number of pass, step, or samples has been met
   bool is_complete() const;
 
@@ -17,7 +17,7 @@ ENUM_IO_DECL(CASM::Monte::ENSEMBLE)
 ENUM_JSON_IO_DECL(CASM::Monte::ENSEMBLE)
 
 /// \brief Monte Carlo method type
-enum class METHOD { Metropolis, LTE1 };
+enum class METHOD { Metropolis, LTE1, Kinetic };
 
 ENUM_IO_DECL(CASM::Monte::METHOD)
 ENUM_JSON_IO_DECL(CASM::Monte::METHOD)
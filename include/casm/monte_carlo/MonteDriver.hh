@@ -14,6 +14,7 @@ class Log;
 
 namespace Monte {
 class MonteCarloEnum;
+class MonteCounter;
 
 /**
  * MonteDriver consists of a specialized MonteCarlo object and a list of
@@ -21,6 +22,11 @@ class MonteCarloEnum;
  * starting configuration (read from the setting), while subsequent conditions
  * are calculated using the final state of the previous condition.
  *
+ * If runs are not dependent ("dependent_runs": false), conditions may be run
+ * concurrently ("n_threads" > 1). Then each condition is run by a separate
+ * MonteCarlo object, and results are merged into the results summary in
+ * conditions order.
+ *
  * The different kinds of drive modes the user can specify are:
  * INCREMENTAL:   Given a delta in condition values, increment the conditions by
  * the delta after each point CUSTOM:        Calculate for a list of condition
@@ -52,6 +58,16 @@ class MonteDriver {
   /// Converge the MonteCarlo for conditions 'cond_index'
   void single_run(Index cond_index);
 
+  /// Converge 'mc' for conditions 'cond_index', without writing results
+  void _single_run(RunType &mc, Log &log, MonteCarloEnum *mc_enum,
+                   Index cond_index);
+
+  /// Run independent conditions [start_i, end) concurrently
+  void _parallel_run(Index start_i);
+
+  /// If "driver"/"seed" is given, seed 'mc' for conditions 'cond_index'
+  void _seed(RunType &mc, Index cond_index) const;
+
   /// Check for existing calculations to find starting conditions
   Index _find_starting_conditions() const;
 
@@ -104,6 +120,26 @@ class MonteDriver {
 template <typename RunType>
 bool monte_carlo_step(RunType &monte_run);
 
+/// Perform a checkerboard step of at most `max_steps` steps if using
+/// checkerboard steps, else a single monte carlo step, and return the number
+/// of steps performed
+template <typename RunType>
+Index monte_carlo_steps(RunType &monte_run, Index max_steps);
+
+/// Perform equilibration passes until `equil_counter` reaches `equil_passes`
+/// passes, and if using checkerboard steps, measure their speedup during the
+/// first pass
+template <typename RunType>
+void equilibrate(RunType &monte_run, MonteCounter &equil_counter,
+                 size_type equil_passes, Log &log);
+
+/// Measure the speedup of checkerboard steps relative to single monte carlo
+/// steps over the rest of the current pass of `counter`, count the steps with
+/// `counter`, and write the speedup to the log
+template <typename RunType>
+void log_checkerboard_speedup(RunType &monte_run, MonteCounter &counter,
+                              Log &log);
+
 }  // namespace Monte
 }  // namespace CASM
 
@@ -1,9 +1,14 @@
 #ifndef CASM_MonteDriver_impl
 #define CASM_MonteDriver_impl
 
+#include <algorithm>
 #include <boost/filesystem.hpp>
 #include <boost/filesystem/fstream.hpp>
+#include <chrono>
+#include <exception>
+#include <mutex>
 #include <string>
+#include <thread>
 
 #include "casm/casm_io/container/json_io.hh"
 #include "casm/casm_io/dataformatter/DataFormatter_impl.hh"
@@ -12,7 +17,7 @@
 #include "casm/monte_carlo/MonteCarlo.hh"
 #include "casm/monte_carlo/MonteCarloEnum.hh"
 #include "casm/monte_carlo/MonteDriver.hh"
-#include "casm/monte_carlo/MonteIO.hh"
+#include "casm/monte_carlo/MonteIO_impl.hh"
 #include "casm/monte_carlo/MonteSettings.hh"
 
 namespace CASM {
@@ -94,6 +99,9 @@ void MonteDriver<RunType>::run() {
   m_log << std::endl;
 
   if (m_settings.dependent_runs()) {
+    // dependent runs continue with one random number generator
+    _seed(m_mc, start_i);
+
     // if starting from initial condition
     if (start_i == 0) {
       // set intial state
@@ -117,10 +125,7 @@ void MonteDriver<RunType>::run() {
         m_log << equil_passes << " equilibration passes\n" << std::endl;
 
         MonteCounter equil_counter(m_settings, m_mc.steps_per_pass());
-        while (equil_counter.pass() != equil_passes) {
-          monte_carlo_step(m_mc);
-          equil_counter++;
-        }
+        equilibrate(m_mc, equil_counter, equil_passes, m_log);
       }
     } else {
       // read end state of previous condition
@@ -134,9 +139,22 @@ void MonteDriver<RunType>::run() {
     }
   }
 
+  if (!m_settings.dependent_runs() && m_settings.n_threads() > 1) {
+    if (m_enum) {
+      m_log.warning("Parallel conditions");
+      m_log << "\"n_threads\" > 1 is not supported with enumeration. "
+               "Conditions will be run sequentially.\n"
+            << std::endl;
+    } else {
+      _parallel_run(start_i);
+      return;
+    }
+  }
+
   // Run for all conditions, outputting data as you finish each one
   for (Index i = start_i; i < m_conditions_list.size(); i++) {
     if (!m_settings.dependent_runs()) {
+      _seed(m_mc, i);
       m_mc.set_state(m_conditions_list[i], m_settings);
     } else {
       m_mc.set_conditions(m_conditions_list[i]);
@@ -237,57 +255,76 @@ Index MonteDriver<RunType>::_find_starting_conditions() const {
 
 template <typename RunType>
 void MonteDriver<RunType>::single_run(Index cond_index) {
+  _single_run(m_mc, m_log, m_enum.unique().get(), cond_index);
+
+  m_log.write("Output files");
+  m_mc.write_results(cond_index);
+  m_log << std::endl;
+
+  if (m_enum) {
+    write_enum_output(cond_index);
+  }
+
+  return;
+}
+
+template <typename RunType>
+void MonteDriver<RunType>::_single_run(RunType &mc, Log &log,
+                                       MonteCarloEnum *mc_enum,
+                                       Index cond_index) {
   fs::create_directories(m_dir.conditions_dir(cond_index));
 
   // perform any requested explicit equilibration passes
   if (m_settings.is_equilibration_passes_each_run()) {
-    m_log.write("DoF");
-    m_log << "write: " << m_dir.initial_state_runeq_json(cond_index) << "\n"
-          << std::endl;
+    log.write("DoF");
+    log << "write: " << m_dir.initial_state_runeq_json(cond_index) << "\n"
+        << std::endl;
 
     jsonParser json;
-    to_json(m_mc.configdof(), json)
+    to_json(mc.configdof(), json)
         .write(m_dir.initial_state_runeq_json(cond_index));
     auto equil_passes = m_settings.equilibration_passes_each_run();
 
-    m_log.begin("Equilibration passes");
-    m_log << equil_passes << " equilibration passes\n" << std::endl;
+    log.begin("Equilibration passes");
+    log << equil_passes << " equilibration passes\n" << std::endl;
 
-    MonteCounter equil_counter(m_settings, m_mc.steps_per_pass());
-    while (equil_counter.pass() != equil_passes) {
-      monte_carlo_step(m_mc);
-      equil_counter++;
-    }
+    MonteCounter equil_counter(m_settings, mc.steps_per_pass());
+    equilibrate(mc, equil_counter, equil_passes, log);
   }
 
   // initial state (after any equilibriation passes)
-  m_log.write("DoF");
-  m_log << "write: " << m_dir.initial_state_json(cond_index) << "\n"
-        << std::endl;
+  log.write("DoF");
+  log << "write: " << m_dir.initial_state_json(cond_index) << "\n"
+      << std::endl;
   jsonParser json;
-  to_json(m_mc.configdof(), json).write(m_dir.initial_state_json(cond_index));
+  to_json(mc.configdof(), json).write(m_dir.initial_state_json(cond_index));
+
+  if (m_settings.write_trajectory() && m_settings.stream_trajectory()) {
+    log << "stream: " << m_dir.trajectory_occ(cond_index) << "\n" << std::endl;
+    mc.begin_trajectory_stream(m_dir.trajectory_occ(cond_index));
+  }
 
   std::stringstream ss;
   ss << "Conditions " << cond_index;
-  m_log.begin(ss.str());
-  m_log << std::endl;
-  m_log.begin_lap();
+  log.begin(ss.str());
+  log << std::endl;
+  log.begin_lap();
 
-  MonteCounter run_counter(m_settings, m_mc.steps_per_pass());
-  if (m_enum) {
-    m_enum->reset();
+  MonteCounter run_counter(m_settings, mc.steps_per_pass());
+  if (mc_enum) {
+    mc_enum->reset();
   };
 
   while (true) {
     if (debug()) {
-      m_log.custom<Log::debug>("Counter info");
-      m_log << "pass: " << run_counter.pass() << "  "
-            << "step: " << run_counter.step() << "  "
-            << "samples: " << run_counter.samples() << "\n"
-            << std::endl;
+      log.custom<Log::debug>("Counter info");
+      log << "pass: " << run_counter.pass() << "  "
+          << "step: " << run_counter.step() << "  "
+          << "samples: " << run_counter.samples() << "\n"
+          << std::endl;
     }
 
-    if (m_mc.must_converge()) {
+    if (mc.must_converge()) {
       if (!run_counter.minimums_met()) {
         // keep going, but check for conflicts with maximums
         if (run_counter.maximums_met()) {
@@ -298,13 +335,13 @@ void MonteDriver<RunType>::single_run(Index cond_index) {
               "  but maximum number of passes, steps, or samples are met.");
         }
       } else {
-        if (m_mc.check_convergence_time()) {
-          m_log.require<Log::verbose>() << "\n";
-          m_log.custom<Log::verbose>("Begin convergence checks");
-          m_log << "samples: " << m_mc.sample_times().size() << std::endl;
-          m_log << std::endl;
+        if (mc.check_convergence_time()) {
+          log.require<Log::verbose>() << "\n";
+          log.custom<Log::verbose>("Begin convergence checks");
+          log << "samples: " << mc.sample_times().size() << std::endl;
+          log << std::endl;
 
-          if (m_mc.is_converged()) {
+          if (mc.is_converged()) {
             break;
           }
         }
@@ -318,10 +355,30 @@ void MonteDriver<RunType>::single_run(Index cond_index) {
       break;
     }
 
-    bool res = monte_carlo_step(m_mc);
+    if (mc.rejection_free()) {
+      // skip steps that do not change the state, up to the next sample or the
+      // end of the pass, so that samples and completion checks are unchanged
+      Index n_skip = std::min({mc.nfold_residence_steps(),
+                               run_counter.steps_until_sample() - 1,
+                               run_counter.steps_per_pass() -
+                                   run_counter.step() - 1});
+      if (n_skip > 0) {
+        mc.nfold_skip(n_skip);
+        run_counter.increment(n_skip);
+      }
+    }
+
+    // checkerboard steps make many proposals, so stop at the next sample
+    bool res = true;
+    Index n_steps = 1;
+    if (mc.checkerboard()) {
+      n_steps = mc.checkerboard_step(run_counter.steps_until_sample());
+    } else {
+      res = monte_carlo_step(mc);
+    }
 
-    if (res && m_enum && m_enum->on_accept()) {
-      m_enum->insert(m_mc.config());
+    if (res && mc_enum && mc_enum->on_accept()) {
+      mc_enum->insert(mc.config());
 
       if (run_counter.step() != 0 &&
           run_counter.step() % m_enum_output_period == 0) {
@@ -329,58 +386,172 @@ void MonteDriver<RunType>::single_run(Index cond_index) {
       }
     }
 
-    run_counter++;
+    run_counter.increment(n_steps);
 
     if (run_counter.sample_time()) {
-      m_log.custom<Log::debug>("Sample data");
-      m_log << "pass: " << run_counter.pass() << "  "
-            << "step: " << run_counter.step() << "  "
-            << "take sample " << m_mc.sample_times().size() << "\n"
-            << std::endl;
+      log.custom<Log::debug>("Sample data");
+      log << "pass: " << run_counter.pass() << "  "
+          << "step: " << run_counter.step() << "  "
+          << "take sample " << mc.sample_times().size() << "\n"
+          << std::endl;
 
-      m_mc.sample_data(run_counter);
+      mc.sample_data(run_counter);
       run_counter.increment_samples();
-      if (m_enum && m_enum->on_sample()) {
-        m_enum->insert(m_mc.config());
+      if (mc_enum && mc_enum->on_sample()) {
+        mc_enum->insert(mc.config());
 
         if (run_counter.samples() != 0 &&
-                m_log << "samples: " << run_counter.samples()
-                      << " / output_period: " << m_enum_output_period
-                      << std::endl;
+                log << "samples: " << run_counter.samples()
+                    << " / output_period: " << m_enum_output_period
+                    << std::endl;
             run_counter.samples() % m_enum_output_period == 0) {
           write_enum_output(cond_index);
         } else {
-          m_log << "samples: " << run_counter.samples()
-                << " / output_period: " << m_enum_output_period << std::endl;
+          log << "samples: " << run_counter.samples()
+              << " / output_period: " << m_enum_output_period << std::endl;
         }
       }
     }
   }
-  m_log << std::endl;
+  log << std::endl;
 
   // timing info:
-  double s = m_log.lap_time();
-  m_log.end(ss.str());
-  m_log << "run time: " << s << " (s),  " << s / run_counter.pass()
-        << " (s/pass),  "
-        << s / (run_counter.pass() * run_counter.steps_per_pass() +
-                run_counter.step())
-        << "(s/step)\n"
+  double s = log.lap_time();
+  log.end(ss.str());
+  log << "run time: " << s << " (s),  " << s / run_counter.pass()
+      << " (s/pass),  "
+      << s / (run_counter.pass() * run_counter.steps_per_pass() +
+              run_counter.step())
+      << "(s/step)\n"
+      << std::endl;
+
+  log.write("DoF");
+  log << "write: " << m_dir.final_state_json(cond_index) << "\n" << std::endl;
+  to_json(mc.configdof(), json).write(m_dir.final_state_json(cond_index));
+
+  mc.end_trajectory_stream();
+
+  return;
+}
+
+/// \brief Run independent conditions [start_i, end) concurrently
+///
+/// - Each condition is run by its own RunType object, with its own random
+///   number generator, on one of `m_settings.n_threads()` threads. If
+///   "driver"/"seed" is given, each is seeded as when run sequentially.
+/// - Output for each condition is written to its "conditions.i" directory by
+///   the thread running it. Log messages are buffered and written to the main
+///   log when the condition is finished.
+/// - The results summary ("results.json" / "results.csv") is written in
+///   conditions order, as soon as all preceding conditions are finished, so
+///   that restarts behave as for sequential runs
+template <typename RunType>
+void MonteDriver<RunType>::_parallel_run(Index start_i) {
+  Index n_conditions = m_conditions_list.size();
+  Index n_threads = std::min(m_settings.n_threads(), n_conditions - start_i);
+
+  // Holds a RunType and its log while it is running, and after it is
+  // finished until its results are written to the results summary
+  struct ConditionsRun {
+    ConditionsRun(int verbosity) : log(log_stream, verbosity) {}
+    std::stringstream log_stream;
+    Log log;
+    std::unique_ptr<RunType> mc;
+    bool finished = false;
+  };
+  std::vector<std::unique_ptr<ConditionsRun>> runs(n_conditions);
+
+  Index next_start = start_i;
+  Index next_result = start_i;
+  std::exception_ptr error;
+  std::mutex mutex;
+
+  m_log.begin("Parallel conditions");
+  m_log << "conditions: " << start_i << " to " << n_conditions - 1 << "\n"
+        << "threads: " << n_threads << "\n"
         << std::endl;
 
-  m_log.write("DoF");
-  m_log << "write: " << m_dir.final_state_json(cond_index) << "\n" << std::endl;
-  to_json(m_mc.configdof(), json).write(m_dir.final_state_json(cond_index));
+  auto worker = [&]() {
+    while (true) {
+      ConditionsRun *run = nullptr;
+      Index i;
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (error || next_start == n_conditions) {
+          return;
+        }
+        i = next_start++;
+        runs[i] = notstd::make_unique<ConditionsRun>(m_log.verbosity());
+        run = runs[i].get();
+
+        // construction and setting the initial state may use shared PrimClex
+        // data, so these are done one at a time
+        try {
+          run->mc = notstd::make_unique<RunType>(m_mc.primclex(), m_settings,
+                                                 run->log);
+          _seed(*run->mc, i);
+          run->mc->set_state(m_conditions_list[i], m_settings);
+        } catch (...) {
+          error = std::current_exception();
+          return;
+        }
+      }
 
-  m_log.write("Output files");
-  m_mc.write_results(cond_index);
-  m_log << std::endl;
+      try {
+        _single_run(*run->mc, run->log, nullptr, i);
+        run->log.write("Output files");
+        write_conditions_json(m_settings, *run->mc, i, run->log);
+        write_observations(m_settings, *run->mc, i, run->log);
+        write_trajectory(m_settings, *run->mc, i, run->log);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex);
+        error = std::current_exception();
+        return;
+      }
 
-  if (m_enum) {
-    write_enum_output(cond_index);
+      std::lock_guard<std::mutex> lock(mutex);
+      run->finished = true;
+      try {
+        while (next_result < n_conditions && runs[next_result] &&
+               runs[next_result]->finished) {
+          ConditionsRun &done = *runs[next_result];
+          m_log << done.log_stream.str();
+          CASM::Monte::write_results(m_settings, *done.mc, m_log);
+          m_log << std::endl;
+          runs[next_result].reset();
+          ++next_result;
+        }
+      } catch (...) {
+        error = std::current_exception();
+        return;
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (Index t = 0; t < n_threads; ++t) {
+    threads.emplace_back(worker);
+  }
+  for (auto &thread : threads) {
+    thread.join();
   }
 
-  return;
+  if (error) {
+    std::rethrow_exception(error);
+  }
+  m_log.end("Parallel conditions");
+  m_log << std::endl;
+}
+
+/// \brief If "driver"/"seed" is given, seed 'mc' for conditions 'cond_index'
+///
+/// - Independent conditions are seeded with seed + cond_index, so results do
+///   not depend on whether conditions are run sequentially or concurrently
+template <typename RunType>
+void MonteDriver<RunType>::_seed(RunType &mc, Index cond_index) const {
+  if (m_settings.is_seed()) {
+    mc.seed(m_settings.seed() + cond_index);
+  }
 }
 
 /// Save & write enumerated configurations
@@ -536,6 +707,10 @@ template <typename RunType>
 bool monte_carlo_step(RunType &monte_run) {
   typedef typename RunType::EventType EventType;
 
+  if (monte_run.rejection_free()) {
+    return monte_run.nfold_step();
+  }
+
   const EventType &event = monte_run.propose();
 
   if (monte_run.check(event)) {
@@ -549,6 +724,79 @@ bool monte_carlo_step(RunType &monte_run) {
   }
 }
 
+template <typename RunType>
+Index monte_carlo_steps(RunType &monte_run, Index max_steps) {
+  if (monte_run.checkerboard()) {
+    return monte_run.checkerboard_step(max_steps);
+  }
+  monte_carlo_step(monte_run);
+  return 1;
+}
+
+/// The speedup is only measured if there are equilibration passes, so that
+/// it never adds steps to a calculation. Equilibration and sampling otherwise
+/// proceed as without measuring it.
+template <typename RunType>
+void equilibrate(RunType &monte_run, MonteCounter &equil_counter,
+                 size_type equil_passes, Log &log) {
+  if (monte_run.checkerboard() && equil_counter.pass() != equil_passes) {
+    log_checkerboard_speedup(monte_run, equil_counter, log);
+  }
+  while (equil_counter.pass() != equil_passes) {
+    if (monte_run.rejection_free()) {
+      // skip steps that do not change the state, up to the end of the pass
+      Index n_skip = std::min(
+          monte_run.nfold_residence_steps(),
+          equil_counter.steps_per_pass() - equil_counter.step() - 1);
+      monte_run.nfold_skip(n_skip);
+      equil_counter.increment(n_skip);
+    }
+    equil_counter.increment(monte_carlo_steps(
+        monte_run, equil_counter.steps_per_pass() - equil_counter.step()));
+  }
+}
+
+/// Single monte carlo steps are timed over half of the rest of the pass, up to
+/// 10000 steps, and checkerboard steps over as many steps, which are counted
+/// as part of the pass.
+template <typename RunType>
+void log_checkerboard_speedup(RunType &monte_run, MonteCounter &counter,
+                              Log &log) {
+  typedef std::chrono::steady_clock clock;
+  typedef std::chrono::duration<double> seconds;
+  Index n_steps = std::min((counter.steps_per_pass() - counter.step()) / 2,
+                           Index(10000));
+  if (n_steps == 0) {
+    return;
+  }
+
+  auto begin = clock::now();
+  for (Index i = 0; i < n_steps; ++i) {
+    monte_carlo_step(monte_run);
+  }
+  double single_time =
+      std::chrono::duration_cast<seconds>(clock::now() - begin).count() /
+      n_steps;
+  counter.increment(n_steps);
+
+  Index n_checkerboard_steps = 0;
+  begin = clock::now();
+  while (n_checkerboard_steps < n_steps) {
+    n_checkerboard_steps +=
+        monte_run.checkerboard_step(n_steps - n_checkerboard_steps);
+  }
+  counter.increment(n_checkerboard_steps);
+  double checkerboard_time =
+      std::chrono::duration_cast<seconds>(clock::now() - begin).count() /
+      n_checkerboard_steps;
+
+  log.custom("Checkerboard speedup");
+  log << "single steps: " << single_time << " (s/step)\n"
+      << "checkerboard steps: " << checkerboard_time << " (s/step)\n"
+      << "speedup: " << single_time / checkerboard_time << "\n"
+      << std::endl;
+}
+
 }  // namespace Monte
 }  // namespace CASM
 
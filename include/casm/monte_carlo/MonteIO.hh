@@ -34,6 +34,11 @@ class MonteCarloDirectoryStructure {
   /// \brief Results summary: "output_dir/results.json"
   fs::path results_json() const { return m_output_dir / "results.json"; }
 
+  /// \brief Replica exchange statistics: "output_dir/replica_exchange.json"
+  fs::path replica_exchange_json() const {
+    return m_output_dir / "replica_exchange.json";
+  }
+
   /// \brief "output_dir/conditions.cond_index/"
   fs::path conditions_dir(int cond_index) const {
     return m_output_dir /
@@ -65,6 +70,13 @@ class MonteCarloDirectoryStructure {
     return conditions_dir(cond_index) / "trajectory.json";
   }
 
+  /// \brief "output_dir/conditions.cond_index/trajectory.occ.gz"
+  ///
+  /// - Occupation trajectory streamed by OccTrajectoryWriter
+  fs::path trajectory_occ(int cond_index) const {
+    return conditions_dir(cond_index) / "trajectory.occ.gz";
+  }
+
   /// \brief "output_dir/conditions.cond_index/trajectory"
   fs::path trajectory_dir(int cond_index) const {
     return conditions_dir(cond_index) / "trajectory";
@@ -52,8 +52,8 @@ class MonteSampler {
       return std::make_pair(false, m_data.size());
     }
 
-    if (!m_convergence_uptodate) {
-      m_equilibration = MCDataEquilibration(m_data.observations(), m_prec);
+    if (!m_equilibration_uptodate) {
+      m_equilibration = MCDataEquilibration(m_data, m_prec);
       m_equilibration_uptodate = true;
     }
 
@@ -148,10 +148,7 @@ class MonteSampler {
 
   void _check_convergence(size_type equil_samples) const {
     m_convergence_start_sample = equil_samples;
-    m_convergence = MCDataConvergence(
-        m_data.observations().segment(
-            equil_samples, m_data.observations().size() - equil_samples),
-        m_conf);
+    m_convergence = MCDataConvergence(m_data, equil_samples, m_conf);
     m_convergence_uptodate = true;
   }
 
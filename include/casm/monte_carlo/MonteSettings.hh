@@ -114,6 +114,38 @@ class MonteSettings : protected CASM::jsonParser {
   ///        of the previous calculation. Default true.
   bool dependent_runs() const;
 
+  /// \brief Number of threads to use for running independent conditions
+  ///        concurrently. Default 1.
+  Index n_threads() const;
+
+  /// \brief Number of threads to use for calculating the correlations of the
+  ///        entire supercell. Default 1.
+  Index correlations_n_threads() const;
+
+  /// \brief If true, use rejection-free (n-fold way) steps. Default false.
+  bool rejection_free() const;
+
+  /// \brief If true, use checkerboard steps. Default false.
+  bool checkerboard() const;
+
+  /// \brief Number of threads to use for checkerboard steps. Default 1.
+  Index checkerboard_n_threads() const;
+
+  /// \brief Returns true if a random number generator seed is given
+  ///        ("driver"/"seed" exists)
+  bool is_seed() const;
+
+  /// \brief Random number generator seed. Calculation i, in conditions list
+  ///        order, is seeded with seed() + i.
+  Index seed() const;
+
+  /// \brief Returns true if the conditions should be run as replicas, with
+  ///        replica exchange ("driver"/"replica_exchange" exists)
+  bool is_replica_exchange() const;
+
+  /// \brief Number of passes between replica exchange attempts. Default 1.
+  Index replica_exchange_swap_period() const;
+
   // --- Sampling -------------------
 
   /// \brief Given a settings jsonParser figure out the global tolerance
@@ -126,6 +158,10 @@ class MonteSettings : protected CASM::jsonParser {
   /// \brief Returns true if snapshots are requested
   bool write_trajectory() const;
 
+  /// \brief Returns true if snapshots should be streamed to a compressed file
+  /// of occupation changes as they are taken. Requires write_trajectory.
+  bool stream_trajectory() const;
+
   /// \brief Returns true if POSCARs of snapshots are requsted. Requires
   /// write_trajectory.
   bool write_POSCAR_snapshots() const;
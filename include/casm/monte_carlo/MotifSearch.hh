@@ -0,0 +1,92 @@
+#ifndef CASM_Monte_MotifSearch_HH
+#define CASM_Monte_MotifSearch_HH
+
+#include <string>
+#include <vector>
+
+#include "casm/global/definitions.hh"
+#include "casm/global/eigen.hh"
+
+namespace CASM {
+
+class Clexulator;
+class Configuration;
+class ECIContainer;
+
+namespace DB {
+template <typename T>
+class Database;
+}
+
+namespace Monte {
+
+/// \brief Search database configurations for the minimum potential energy
+/// motif
+///
+/// The correlations and parametric composition of each configuration are
+/// stored once, so that the potential energy per primitive cell,
+/// \code
+/// Epot = eci * corr - param_chem_pot * comp_x,
+/// \endcode
+/// can be evaluated for all configurations, and for any number of sets of
+/// parametric chemical potential, as matrix products.
+///
+class MotifSearch {
+ public:
+  /// \brief Constructor
+  MotifSearch(std::vector<std::string> _configname, Eigen::MatrixXd _corr,
+              Eigen::MatrixXd _comp_x, Eigen::VectorXd const &_eci);
+
+  /// \brief Number of configurations
+  Index size() const { return m_configname.size(); }
+
+  /// \brief Configuration names
+  std::vector<std::string> const &configname() const { return m_configname; }
+
+  /// \brief Correlations with non-zero ECI, normalized per primitive cell
+  /// (rows: configurations)
+  Eigen::MatrixXd const &corr() const { return m_corr; }
+
+  /// \brief Parametric composition (rows: configurations)
+  Eigen::MatrixXd const &comp_x() const { return m_comp_x; }
+
+  /// \brief Formation energy, normalized per primitive cell, of each
+  /// configuration
+  Eigen::VectorXd const &formation_energy() const {
+    return m_formation_energy;
+  }
+
+  /// \brief Potential energy, normalized per primitive cell, of each
+  /// configuration (rows) for each set of parametric chemical potential
+  /// (columns)
+  Eigen::MatrixXd potential_energy(Eigen::MatrixXd const &param_chem_pot) const;
+
+  /// \brief Minimum potential energy configurations for each set of
+  /// parametric chemical potential
+  std::vector<std::vector<Index>> ground_states(
+      Eigen::MatrixXd const &param_chem_pot, double tol,
+      std::vector<bool> const &allowed = std::vector<bool>()) const;
+
+ private:
+  std::vector<std::string> m_configname;
+
+  /// m_corr(i, j): correlation j of configuration i, for non-zero ECI only
+  Eigen::MatrixXd m_corr;
+
+  /// m_comp_x(i, j): parametric composition j of configuration i
+  Eigen::MatrixXd m_comp_x;
+
+  /// m_formation_energy(i) = m_corr.row(i) * eci
+  Eigen::VectorXd m_formation_energy;
+};
+
+/// \brief Calculate the correlations and parametric composition of all
+/// configurations in a database
+MotifSearch make_motif_search(DB::Database<Configuration> const &db,
+                              Clexulator const &clexulator,
+                              ECIContainer const &eci);
+
+}  // namespace Monte
+}  // namespace CASM
+
+#endif
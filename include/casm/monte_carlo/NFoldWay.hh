@@ -0,0 +1,159 @@
+#ifndef CASM_Monte_NFoldWay_HH
+#define CASM_Monte_NFoldWay_HH
+
+#include <functional>
+#include <vector>
+
+#include "casm/global/definitions.hh"
+#include "casm/monte_carlo/RateTree.hh"
+
+class MTRand;
+
+namespace CASM {
+
+class ConfigDoF;
+
+namespace clexulator {
+class SuperNeighborList;
+}
+using clexulator::SuperNeighborList;
+
+namespace Monte {
+
+class Conversions;
+
+/// \brief Event probabilities for rejection-free (n-fold way) Metropolis Monte
+/// Carlo
+///
+/// For every possible event i, stores the probability that one Metropolis step
+/// proposes and accepts it:
+/// \code
+/// p_i = q_i * min(1, exp(-beta * dEpot_i))
+/// \endcode
+/// where q_i is the probability that event i is proposed. Events are
+/// single-site changes of occupation (grand canonical), proposed by choosing a
+/// variable site uniformly and then one of its other allowed occupants
+/// uniformly.
+///
+/// The number of Metropolis steps in which the current state would reject
+/// every proposal, the residence time, is sampled from a geometric
+/// distribution with success probability P = sum_i p_i, and the event that
+/// ends it is selected with probability p_i / P. This generates the same
+/// sequence of states, each lasting the same distribution of steps, as
+/// Metropolis Monte Carlo, without evaluating rejected proposals. Observations
+/// sampled at regular step or pass intervals are therefore weighted by the
+/// residence time of each state.
+///
+/// The change in potential energy of each event must only depend on the
+/// occupation of sites in the neighborhood of the site it changes, so that
+/// after an event only the events of sites whose neighborhood includes the
+/// changed site need to be updated.
+///
+/// Exchange events (canonical) are not supported: there is one for every pair
+/// of variable sites, so memory and initialization time would scale with the
+/// square of the number of variable sites, and every event would update a
+/// number of exchanges proportional to the number of variable sites.
+class NFoldWay {
+ public:
+  /// \brief Returns the change in potential energy if the occupant index on
+  /// site `l` were changed to `new_occ`
+  typedef std::function<double(Index l, int new_occ)> SiteChangeFunction;
+
+  /// \brief Constructor
+  NFoldWay(Conversions const &_convert, SuperNeighborList const &_nlist,
+           SiteChangeFunction _site_change_f);
+
+  /// \brief Number of possible events
+  Index n_events() const { return m_tree.size(); }
+
+  /// \brief True if initialized since construction or the last `invalidate`
+  bool is_initialized() const { return m_is_initialized; }
+
+  /// \brief Require initialization before the next use, as after the state or
+  /// conditions change
+  void invalidate() { m_is_initialized = false; }
+
+  /// \brief Calculate all event probabilities and sample the residence time
+  void initialize(ConfigDoF const &configdof, double beta, MTRand &mtrand);
+
+  /// \brief Probability that one Metropolis step leaves the current state
+  double escape_probability() const;
+
+  /// \brief Remaining number of Metropolis steps that reject every proposal
+  /// before the current state is left
+  ///
+  /// - Equal to the maximum Index value if no event is possible
+  Index residence_steps() const { return m_residence_steps; }
+
+  /// \brief Consume `n_steps` steps of the residence time
+  void skip(Index n_steps);
+
+  /// \brief Select an event, with probability proportional to the
+  /// probability per step that it occurs
+  void select(MTRand &mtrand, std::vector<Index> &linear_site_index,
+              std::vector<int> &new_occ) const;
+
+  /// \brief Update event probabilities after the occupation of sites
+  /// changed, and sample the next residence time
+  void update(ConfigDoF const &configdof,
+              std::vector<Index> const &linear_site_index, MTRand &mtrand);
+
+ private:
+  /// \brief Construct site and neighborhood tables
+  void _make_tables();
+
+  /// \brief Calculate single-site change dEpot of variable site v
+  void _update_site_changes(Index v);
+
+  /// \brief Probability per step of single-site change events on variable
+  /// site v, relative to the uniform proposal of a variable site
+  void _update_site_change_events(Index v);
+
+  /// \brief Metropolis acceptance probability
+  double _acceptance(double dEpot) const;
+
+  /// \brief Sample the residence time of the current state
+  void _sample_residence_steps(MTRand &mtrand);
+
+  Conversions const *m_convert;
+  SuperNeighborList const *m_nlist;
+  SiteChangeFunction m_site_change_f;
+
+  bool m_is_initialized;
+  double m_beta;
+
+  /// Linear site index of variable sites
+  std::vector<Index> m_variable_site;
+
+  /// Variable site index, or -1, for each linear site index
+  std::vector<Index> m_l_to_variable;
+
+  /// Asymmetric unit index of each variable site
+  std::vector<Index> m_asym;
+
+  /// m_dependent[l]: variable sites whose neighborhood includes site l
+  std::vector<std::vector<Index>> m_dependent;
+
+  /// m_site_change[m_offset[v] + occ]: dEpot of changing variable site v to
+  /// occupant index occ (0.0 for the current occupant)
+  std::vector<double> m_site_change;
+  std::vector<Index> m_offset;
+
+  /// Current occupant index of each variable site
+  std::vector<int> m_occ;
+
+  /// Unnormalized event probabilities: acceptance probability / (number of
+  /// other occupants)
+  RateTree m_tree;
+
+  Index m_residence_steps;
+
+  /// Marks variable sites already updated
+  std::vector<Index> m_updated_mark;
+  Index m_mark;
+};
+
+}  // namespace Monte
+}  // namespace CASM
+
+#endif
@@ -85,7 +85,15 @@ class OccLocation {
  public:
   typedef Index size_type;
 
-  OccLocation(const Conversions &_convert, const OccCandidateList &_cand);
+  /// \brief Constructor
+  ///
+  /// \param _convert Conversions for the Monte Carlo supercell
+  /// \param _cand List of occupant candidates
+  /// \param _update_species If true, track the location of each Species as
+  ///     events are applied, as for kinetic Monte Carlo. Events must include
+  ///     `species_traj` (see `make_exchange`).
+  OccLocation(const Conversions &_convert, const OccCandidateList &_cand,
+              bool _update_species = false);
 
   /// Fill tables with occupation info
   void initialize(const Configuration &config);
@@ -112,6 +120,18 @@ class OccLocation {
   /// Convert from config index to variable site index
   Index l_to_mol_id(Index l) const;
 
+  /// Total number of tracked Species (0 if not updating species)
+  size_type species_size() const;
+
+  /// Access a tracked Species, by Species.id
+  const Species &species(Index species_id) const;
+
+  /// True if the location of each Species is tracked
+  bool update_species() const;
+
+  /// Make OccEvent exchanging the occupants of two variable sites
+  OccEvent &make_exchange(OccEvent &e, Index l_a, Index l_b) const;
+
   /// Propose canonical OccEvent
   OccEvent &propose_canonical(OccEvent &e,
                               const std::vector<OccSwap> &canonical_swap,
@@ -0,0 +1,121 @@
+#ifndef CASM_Monte_OccTrajectory_HH
+#define CASM_Monte_OccTrajectory_HH
+
+#include <boost/filesystem/path.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "casm/external/gzstream/gzstream.h"
+#include "casm/global/definitions.hh"
+#include "casm/global/eigen.hh"
+#include "casm/monte_carlo/MonteDefinitions.hh"
+
+namespace CASM {
+namespace Monte {
+
+/// \brief Streams a Monte Carlo occupation trajectory to a compressed file
+///
+/// Instead of storing a ConfigDoF for every sample, only the occupation
+/// changes since the previous sample are written, and the file is written as
+/// samples are taken. Use OccTrajectoryReader to read the file.
+///
+/// File format (binary, gzip compressed):
+/// - header: "CASMOCCT", uint32 version, uint64 number of sites
+/// - each frame: uint64 pass, uint64 step, uint64 number of changed sites,
+///   and then for each changed site: uint64 site index, int32 occupation
+/// - the first frame includes all sites
+///
+class OccTrajectoryWriter {
+ public:
+  /// \brief Open 'file_path' and write header
+  ///
+  /// \param file_path Path to output file (overwritten)
+  /// \param n_sites Number of sites in each frame
+  /// \param flush_period Number of frames between flushes to the file
+  OccTrajectoryWriter(const fs::path &file_path, Index n_sites,
+                      Index flush_period = 100);
+
+  ~OccTrajectoryWriter();
+
+  OccTrajectoryWriter(const OccTrajectoryWriter &) = delete;
+  OccTrajectoryWriter &operator=(const OccTrajectoryWriter &) = delete;
+
+  /// \brief Write a frame
+  void write(size_type pass, size_type step,
+             const Eigen::VectorXi &occupation);
+
+  /// \brief Flush and close the file
+  void close();
+
+  /// \brief Path to output file
+  const fs::path &file_path() const { return m_file_path; }
+
+  /// \brief Number of frames written
+  Index size() const { return m_size; }
+
+ private:
+  fs::path m_file_path;
+  gz::ogzstream m_stream;
+  Index m_flush_period;
+  Index m_size;
+
+  /// Occupation of the previous frame
+  Eigen::VectorXi m_last;
+
+  /// Buffer of changed sites
+  std::vector<std::pair<uint64_t, int32_t>> m_changes;
+};
+
+/// \brief Reads an occupation trajectory written by OccTrajectoryWriter
+///
+/// - Frames are read sequentially by applying occupation changes. Reading a
+///   frame before the current frame re-opens the file.
+///
+class OccTrajectoryReader {
+ public:
+  /// \brief Open 'file_path' and read header
+  OccTrajectoryReader(const fs::path &file_path);
+
+  OccTrajectoryReader(const OccTrajectoryReader &) = delete;
+  OccTrajectoryReader &operator=(const OccTrajectoryReader &) = delete;
+
+  /// \brief Number of sites in each frame
+  Index n_sites() const { return m_occupation.size(); }
+
+  /// \brief Read the next frame, return false if there are no more frames
+  bool next();
+
+  /// \brief Read frame 'index'
+  ///
+  /// - Throws if there are fewer than 'index' + 1 frames
+  const Eigen::VectorXi &frame(Index index);
+
+  /// \brief Index of the current frame, or -1 if no frame has been read
+  Index frame_index() const { return m_frame_index; }
+
+  /// \brief Pass of the current frame
+  size_type pass() const { return m_pass; }
+
+  /// \brief Step of the current frame
+  size_type step() const { return m_step; }
+
+  /// \brief Occupation of the current frame
+  const Eigen::VectorXi &occupation() const { return m_occupation; }
+
+ private:
+  /// \brief (Re-)open the file and read the header
+  void _open();
+
+  fs::path m_file_path;
+  std::unique_ptr<gz::igzstream> m_stream;
+  Index m_frame_index;
+  size_type m_pass;
+  size_type m_step;
+  Eigen::VectorXi m_occupation;
+};
+
+}  // namespace Monte
+}  // namespace CASM
+
+#endif
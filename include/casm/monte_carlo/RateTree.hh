@@ -0,0 +1,77 @@
+#ifndef CASM_Monte_RateTree_HH
+#define CASM_Monte_RateTree_HH
+
+#include <vector>
+
+#include "casm/global/definitions.hh"
+
+namespace CASM {
+namespace Monte {
+
+/// \brief Stores event rates for O(log N) rate updates and event selection
+///
+/// A Fenwick (binary indexed) tree of partial sums of event rates. Used to
+/// select events with probability proportional to their rate, as in kinetic
+/// Monte Carlo and rejection-free Monte Carlo methods:
+/// \code
+/// Index event_index = tree.find(mtrand.randExc(tree.total_rate()));
+/// \endcode
+///
+/// Updating a rate adds the change in rate to the partial sums, so rounding
+/// errors accumulate. To prevent this, the partial sums are recalculated from
+/// the rates after `size()` updates.
+class RateTree {
+ public:
+  /// \brief Construct with all rates equal to zero
+  explicit RateTree(Index _size = 0);
+
+  /// \brief Construct from rates
+  explicit RateTree(std::vector<double> const &_rate);
+
+  /// \brief Number of events
+  Index size() const { return m_rate.size(); }
+
+  /// \brief Rate of event `event_index`
+  double rate(Index event_index) const { return m_rate[event_index]; }
+
+  /// \brief All rates
+  std::vector<double> const &rates() const { return m_rate; }
+
+  /// \brief Set the rate of event `event_index`, in O(log N)
+  void set_rate(Index event_index, double rate);
+
+  /// \brief Set all rates, in O(N)
+  void set_rates(std::vector<double> const &_rate);
+
+  /// \brief Sum of rates of events [0, end), in O(log N)
+  double partial_sum(Index end) const;
+
+  /// \brief Sum of all rates, in O(log N)
+  double total_rate() const { return partial_sum(size()); }
+
+  /// \brief Find the event selected by `value`, in [0, total_rate()), in
+  /// O(log N)
+  Index find(double value) const;
+
+ private:
+  /// \brief Recalculate partial sums from m_rate
+  void _rebuild();
+
+  /// Event rates
+  std::vector<double> m_rate;
+
+  /// Fenwick tree of partial sums, m_tree[i] is the sum of m_rate over
+  /// [i - (i & -i), i), and m_tree[0] is unused
+  std::vector<double> m_tree;
+
+  /// Largest power of 2 <= size()
+  Index m_top_step;
+
+  /// Number of set_rate calls since partial sums were recalculated
+  Index m_n_updates;
+};
+
+}  // namespace Monte
+}  // namespace CASM
+
+#endif
@@ -0,0 +1,183 @@
+#ifndef CASM_ReplicaExchangeDriver_HH
+#define CASM_ReplicaExchangeDriver_HH
+
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "casm/casm_io/Log.hh"
+#include "casm/external/MersenneTwister/MersenneTwister.h"
+#include "casm/global/definitions.hh"
+#include "casm/monte_carlo/MonteCounter.hh"
+#include "casm/monte_carlo/MonteDefinitions.hh"
+#include "casm/monte_carlo/MonteIO.hh"
+
+namespace CASM {
+class PrimClex;
+
+namespace Monte {
+
+/**
+ * ReplicaExchangeDriver runs all conditions in the conditions list at the same
+ * time (parallel tempering). Each condition is run by its own MonteCarlo
+ * object, a "replica", and the replicas are run concurrently using up to
+ * "n_threads" threads.
+ *
+ * Every "swap_period" passes, exchanges of the DoF of replicas at neighboring
+ * conditions in the conditions list are attempted, alternating between
+ * (0,1), (2,3), ... and (1,2), (3,4), ... pairs. The exchange of DoF x_a and
+ * x_b between replicas at conditions a and b is accepted with probability
+ *
+ *     min(1, exp(-beta_a*(E_a(x_b) - E_a(x_a))
+ *                - beta_b*(E_b(x_a) - E_b(x_b)))),
+ *
+ * where E_a is the extensive potential energy at conditions a. For a ladder of
+ * temperatures at the same chemical potential this is the usual
+ * min(1, exp((beta_a - beta_b)*(E(x_a) - E(x_b)))).
+ *
+ * Samples are collected for each set of conditions, not for each DoF
+ * trajectory, and the usual results are written for each condition. In
+ * addition, the acceptance rate of exchanges between each pair of neighboring
+ * conditions, and the round trip times of each "walker" (the DoF that began at
+ * a particular condition) between the first and last conditions, are written
+ * to "replica_exchange.json".
+ *
+ * Settings are read from:
+ * - "driver"/"replica_exchange"/"swap_period": passes between exchange
+ *   attempts (default 1)
+ * - "driver"/"n_threads": maximum number of threads (default 1)
+ */
+template <typename RunType>
+class ReplicaExchangeDriver {
+ public:
+  typedef typename RunType::CondType CondType;
+  typedef typename RunType::SettingsType SettingsType;
+
+  /// \brief Constructor via MonteSettings
+  ReplicaExchangeDriver(const PrimClex &primclex, const SettingsType &settings,
+                        Log &_log, Log &_err_log);
+
+  /// \brief Run all conditions, with replica exchange, until all are complete
+  void run();
+
+  /// \brief Number of replicas (equal to number of conditions)
+  Index n_replicas() const { return m_conditions_list.size(); }
+
+  /// \brief Number of exchanges attempted between replicas i and i+1
+  Index swap_attempts(Index i) const { return m_swap_attempts[i]; }
+
+  /// \brief Number of exchanges accepted between replicas i and i+1
+  Index swap_accepts(Index i) const { return m_swap_accepts[i]; }
+
+  /// \brief Round trip times, in passes, of the walker that began at
+  /// conditions i
+  const std::vector<Index> &round_trips(Index i) const {
+    return m_round_trips[i];
+  }
+
+ private:
+  /// Holds a replica, its log, and its sampling state
+  struct Replica {
+    Replica(int verbosity) : log(log_stream, verbosity) {}
+    std::stringstream log_stream;
+    Log log;
+    std::unique_ptr<RunType> mc;
+    std::unique_ptr<MonteCounter> counter;
+    bool finished = false;
+  };
+
+  /// Return the std::vector of conditions to visit based from settings
+  std::vector<CondType> make_conditions_list(const SettingsType &settings);
+
+  /// Construct replicas and set their initial states
+  void _initialize_replicas();
+
+  /// Call f(i) for each replica i, using up to n_threads threads
+  void _for_each_replica(std::function<void(Index)> f);
+
+  /// Run 'n_passes' passes of replica i, sampling until it is complete
+  void _run_passes(Index i, Index n_passes);
+
+  /// Attempt exchanges between replicas (i, i+1), for i = parity, parity+2,...
+  void _attempt_exchanges(Index parity);
+
+  /// Attempt an exchange between replicas i and i+1, return true if accepted
+  bool _attempt_exchange(Index i);
+
+  /// Update walker round trip statistics after exchanges
+  void _update_walkers();
+
+  /// Write final states, output files, and the results summary
+  void _write_output();
+
+  /// Write swap acceptance and round trip statistics
+  void _write_replica_exchange_json() const;
+
+  /// target for log messages
+  Log &m_log;
+
+  /// target for error messages
+  Log &m_err_log;
+
+  /// Copy of initial settings given at construction
+  SettingsType m_settings;
+
+  /// describes where to write output
+  MonteCarloDirectoryStructure m_dir;
+
+  /// Specifies how to build the conditions list from the settings
+  const Monte::DRIVE_MODE m_drive_mode;
+
+  /// Reference to the PrimClex
+  const PrimClex &m_primclex;
+
+  /// List of conditions, one for each replica. Neighboring conditions are
+  /// exchange partners.
+  const std::vector<CondType> m_conditions_list;
+
+  /// Number of passes between exchange attempts
+  Index m_swap_period;
+
+  /// Maximum number of threads
+  Index m_n_threads;
+
+  /// Number of passes completed by all replicas
+  Index m_pass;
+
+  /// One replica per conditions
+  std::vector<std::unique_ptr<Replica>> m_replica;
+
+  /// Exchanges attempted / accepted between replicas (i, i+1)
+  std::vector<Index> m_swap_attempts;
+  std::vector<Index> m_swap_accepts;
+
+  /// m_walker[i]: walker currently at replica i
+  std::vector<Index> m_walker;
+
+  /// m_walker_direction[w]: +1 if walker w last visited the first replica, -1
+  /// if it last visited the last replica, 0 if it has visited neither
+  std::vector<int> m_walker_direction;
+
+  /// m_walker_start[w]: pass at which walker w last arrived at the first
+  /// replica, after visiting the last replica
+  std::vector<Index> m_walker_start;
+
+  /// m_round_trips[w]: round trip times, in passes, of walker w
+  std::vector<std::vector<Index>> m_round_trips;
+
+  /// Random number generator used to accept or reject exchanges
+  MTRand m_twister;
+};
+
+/// \brief Probability of accepting the exchange of DoF x_a and x_b between
+/// replicas at conditions a and b, given extensive potential energies
+double replica_exchange_probability(double beta_a, double beta_b,
+                                    double E_a_xa, double E_a_xb,
+                                    double E_b_xa, double E_b_xb);
+
+}  // namespace Monte
+}  // namespace CASM
+
+#endif
@@ -0,0 +1,501 @@
+#ifndef CASM_ReplicaExchangeDriver_impl
+#define CASM_ReplicaExchangeDriver_impl
+
+#include <boost/filesystem.hpp>
+#include <cmath>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "casm/casm_io/container/json_io.hh"
+#include "casm/clex/io/json/ConfigDoF_json_io.hh"
+#include "casm/misc/CASM_Eigen_math.hh"
+#include "casm/monte_carlo/MonteCarlo.hh"
+#include "casm/monte_carlo/MonteDriver_impl.hh"
+#include "casm/monte_carlo/MonteIO_impl.hh"
+#include "casm/monte_carlo/MonteSettings.hh"
+#include "casm/monte_carlo/ReplicaExchangeDriver.hh"
+
+namespace CASM {
+namespace Monte {
+
+template <typename RunType>
+ReplicaExchangeDriver<RunType>::ReplicaExchangeDriver(
+    const PrimClex &primclex, const SettingsType &settings, Log &_log,
+    Log &_err_log)
+    : m_log(_log),
+      m_err_log(_err_log),
+      m_settings(settings),
+      m_dir(m_settings.output_directory()),
+      m_drive_mode(m_settings.drive_mode()),
+      m_primclex(primclex),
+      m_conditions_list(make_conditions_list(m_settings)),
+      m_swap_period(m_settings.replica_exchange_swap_period()),
+      m_n_threads(m_settings.n_threads()),
+      m_pass(0) {}
+
+/// \brief Run all conditions, with replica exchange, until all are complete
+///
+/// - Replica exchange runs are not restarted. Existing results summary files
+///   are overwritten.
+template <typename RunType>
+void ReplicaExchangeDriver<RunType>::run() {
+  if (!m_settings.write_json() && !m_settings.write_csv()) {
+    throw std::runtime_error(
+        std::string("No valid monte carlo output format.\n") +
+        "  Expected [\"data\"][\"storage\"][\"output_format\"] to contain a "
+        "string or array of strings.\n" +
+        "  Valid options are 'csv' or 'json'.");
+  }
+  if (m_settings.is_enumeration()) {
+    throw std::runtime_error(
+        "Error in ReplicaExchangeDriver: enumeration is not supported with "
+        "replica exchange");
+  }
+
+  // replica exchange results are all written at the end, so remove any
+  // existing results summary
+  if (fs::exists(m_dir.results_json()) || fs::exists(m_dir.results_csv())) {
+    m_log << "will overwrite existing results\n" << std::endl;
+    fs::remove(m_dir.results_json());
+    fs::remove(m_dir.results_csv());
+  }
+
+  _initialize_replicas();
+
+  // perform any requested explicit equilibration passes, without exchanges
+  if (m_settings.is_equilibration_passes_each_run()) {
+    auto equil_passes = m_settings.equilibration_passes_each_run();
+    m_log.begin("Equilibration passes");
+    m_log << equil_passes << " equilibration passes\n" << std::endl;
+
+    _for_each_replica([&](Index i) {
+      RunType &mc = *m_replica[i]->mc;
+      jsonParser json;
+      to_json(mc.configdof(), json).write(m_dir.initial_state_runeq_json(i));
+
+      MonteCounter equil_counter(m_settings, mc.steps_per_pass());
+      equilibrate(mc, equil_counter, equil_passes, m_replica[i]->log);
+    });
+  }
+
+  // initial state (after any equilibriation passes)
+  for (Index i = 0; i < n_replicas(); ++i) {
+    jsonParser json;
+    to_json(m_replica[i]->mc->configdof(), json)
+        .write(m_dir.initial_state_json(i));
+
+    if (m_settings.write_trajectory() && m_settings.stream_trajectory()) {
+      m_replica[i]->mc->begin_trajectory_stream(m_dir.trajectory_occ(i));
+    }
+  }
+
+  m_log.begin("Replica exchange");
+  m_log << "replicas: " << n_replicas() << "\n"
+        << "threads: " << std::min(m_n_threads, n_replicas()) << "\n"
+        << "swap_period: " << m_swap_period << "\n"
+        << std::endl;
+  m_log.begin_lap();
+
+  _update_walkers();
+  Index parity = 0;
+  while (true) {
+    bool all_finished = true;
+    for (const auto &replica : m_replica) {
+      all_finished = all_finished && replica->finished;
+    }
+    if (all_finished) {
+      break;
+    }
+
+    _for_each_replica([&](Index i) { _run_passes(i, m_swap_period); });
+    m_pass += m_swap_period;
+
+    _attempt_exchanges(parity);
+    parity = 1 - parity;
+    _update_walkers();
+  }
+
+  double s = m_log.lap_time();
+  m_log.end("Replica exchange");
+  m_log << "run time: " << s << " (s),  " << s / m_pass << " (s/pass)\n";
+  for (Index i = 0; i + 1 < n_replicas(); ++i) {
+    m_log << "swap acceptance (" << i << ", " << i + 1 << "): "
+          << (m_swap_attempts[i]
+                  ? double(m_swap_accepts[i]) / m_swap_attempts[i]
+                  : 0.0)
+          << "\n";
+  }
+  m_log << std::endl;
+
+  _write_output();
+}
+
+/// \brief Construct replicas and set their initial states
+///
+/// - Construction and setting the initial state may use shared PrimClex data,
+///   so replicas are constructed one at a time
+/// - If "driver"/"seed" is given, replica i is seeded with seed + i, and
+///   exchange attempts with seed + n_replicas()
+template <typename RunType>
+void ReplicaExchangeDriver<RunType>::_initialize_replicas() {
+  if (n_replicas() == 0) {
+    throw std::runtime_error(
+        "Error in ReplicaExchangeDriver: empty conditions list");
+  }
+
+  m_replica.clear();
+  for (Index i = 0; i < n_replicas(); ++i) {
+    m_replica.push_back(notstd::make_unique<Replica>(m_log.verbosity()));
+    Replica &replica = *m_replica.back();
+    replica.mc =
+        notstd::make_unique<RunType>(m_primclex, m_settings, replica.log);
+    if (m_settings.is_seed()) {
+      replica.mc->seed(m_settings.seed() + i);
+    }
+    replica.mc->set_state(m_conditions_list[i], m_settings);
+    replica.counter = notstd::make_unique<MonteCounter>(
+        m_settings, replica.mc->steps_per_pass());
+    fs::create_directories(m_dir.conditions_dir(i));
+  }
+
+  // the canonical ensemble can only exchange DoF with the same composition
+  if (RunType::ensemble == ENSEMBLE::Canonical) {
+    for (Index i = 1; i < n_replicas(); ++i) {
+      if (!almost_equal(m_replica[i]->mc->comp_n(),
+                        m_replica[0]->mc->comp_n())) {
+        throw std::runtime_error(
+            "Error in ReplicaExchangeDriver: canonical replica exchange "
+            "requires all conditions to have the same composition");
+      }
+    }
+  }
+
+  if (m_settings.is_seed()) {
+    m_twister.seed(m_settings.seed() + n_replicas());
+  }
+
+  m_swap_attempts = std::vector<Index>(n_replicas() - 1, 0);
+  m_swap_accepts = std::vector<Index>(n_replicas() - 1, 0);
+  m_walker.resize(n_replicas());
+  for (Index i = 0; i < n_replicas(); ++i) {
+    m_walker[i] = i;
+  }
+  m_walker_direction = std::vector<int>(n_replicas(), 0);
+  m_walker_start = std::vector<Index>(n_replicas(), 0);
+  m_round_trips = std::vector<std::vector<Index>>(n_replicas());
+  m_pass = 0;
+}
+
+/// \brief Call f(i) for each replica i, using up to n_threads threads
+///
+/// - Rethrows the first exception thrown by f, after all threads finish
+template <typename RunType>
+void ReplicaExchangeDriver<RunType>::_for_each_replica(
+    std::function<void(Index)> f) {
+  Index n_threads = std::min(m_n_threads, n_replicas());
+  if (n_threads <= 1) {
+    for (Index i = 0; i < n_replicas(); ++i) {
+      f(i);
+    }
+    return;
+  }
+
+  std::exception_ptr error;
+  std::mutex mutex;
+  auto worker = [&](Index t) {
+    for (Index i = t; i < n_replicas(); i += n_threads) {
+      try {
+        f(i);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!error) {
+          error = std::current_exception();
+        }
+        return;
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (Index t = 0; t < n_threads; ++t) {
+    threads.emplace_back(worker, t);
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+/// \brief Run 'n_passes' passes of replica i, sampling until it is complete
+///
+/// - Once a replica is complete (converged, or maximums met), it stops
+///   sampling but continues to run so that it can participate in exchanges
+template <typename RunType>
+void ReplicaExchangeDriver<RunType>::_run_passes(Index i, Index n_passes) {
+  Replica &replica = *m_replica[i];
+  RunType &mc = *replica.mc;
+  MonteCounter &run_counter = *replica.counter;
+  Log &log = replica.log;
+
+  Index n_steps = n_passes * mc.steps_per_pass();
+  Index step = 0;
+  while (step < n_steps) {
+    if (!replica.finished) {
+      if (mc.must_converge()) {
+        if (!run_counter.minimums_met()) {
+          // keep going, but check for conflicts with maximums
+          if (run_counter.maximums_met()) {
+            throw std::runtime_error(
+                std::string("Error in 'ReplicaExchangeDriver<RunType>::run()'"
+                            "\n") +
+                "  Conflicting input: Minimum number of passes, steps, or "
+                "samples not met,\n" +
+                "  but maximum number of passes, steps, or samples are met.");
+          }
+        } else {
+          if (mc.check_convergence_time()) {
+            log.require<Log::verbose>() << "\n";
+            log.custom<Log::verbose>("Begin convergence checks");
+            log << "samples: " << mc.sample_times().size() << std::endl;
+            log << std::endl;
+
+            if (mc.is_converged()) {
+              replica.finished = true;
+            }
+          }
+
+          if (run_counter.maximums_met()) {
+            replica.finished = true;
+          }
+        }
+      } else if (run_counter.is_complete()) {
+        replica.finished = true;
+      }
+    }
+
+    // checkerboard steps make many proposals, so stop at the end of the
+    // passes, and at the next sample
+    Index max_steps = n_steps - step;
+    if (!replica.finished) {
+      max_steps = std::min(max_steps, run_counter.steps_until_sample());
+    }
+    Index n_performed = monte_carlo_steps(mc, max_steps);
+    step += n_performed;
+
+    if (replica.finished) {
+      continue;
+    }
+
+    run_counter.increment(n_performed);
+
+    if (run_counter.sample_time()) {
+      log.custom<Log::debug>("Sample data");
+      log << "pass: " << run_counter.pass() << "  "
+          << "step: " << run_counter.step() << "  "
+          << "take sample " << mc.sample_times().size() << "\n"
+          << std::endl;
+
+      mc.sample_data(run_counter);
+      run_counter.increment_samples();
+    }
+  }
+}
+
+/// \brief Attempt exchanges between replicas (i, i+1), for i = parity,
+/// parity+2, ...
+template <typename RunType>
+void ReplicaExchangeDriver<RunType>::_attempt_exchanges(Index parity) {
+  for (Index i = parity; i + 1 < n_replicas(); i += 2) {
+    ++m_swap_attempts[i];
+    if (_attempt_exchange(i)) {
+      ++m_swap_accepts[i];
+      std::swap(m_walker[i], m_walker[i + 1]);
+    }
+  }
+}
+
+/// \brief Attempt an exchange between replicas i and i+1, return true if
+/// accepted
+///
+/// - Potential energies are per primitive cell, so they are scaled by the
+///   supercell volume to get the extensive potential energies
+/// - All four potential energies are calculated from the configurations, by
+///   `RunType::potential_energy(const Configuration &)`, so that they include
+///   the same potentials
+template <typename RunType>
+bool ReplicaExchangeDriver<RunType>::_attempt_exchange(Index i) {
+  RunType &mc_a = *m_replica[i]->mc;
+  RunType &mc_b = *m_replica[i + 1]->mc;
+  double volume = mc_a.supercell().volume();
+
+  Configuration const &config_a = mc_a.config();
+  Configuration const &config_b = mc_b.config();
+  double p = replica_exchange_probability(
+      mc_a.conditions().beta(), mc_b.conditions().beta(),
+      volume * mc_a.potential_energy(config_a),
+      volume * mc_a.potential_energy(config_b),
+      volume * mc_b.potential_energy(config_a),
+      volume * mc_b.potential_energy(config_b));
+
+  if (m_twister.rand53() >= p) {
+    return false;
+  }
+
+  ConfigDoF configdof_a = mc_a.configdof();
+  mc_a.exchange_configdof(mc_b.configdof());
+  mc_b.exchange_configdof(configdof_a);
+  return true;
+}
+
+/// \brief Update walker round trip statistics after exchanges
+///
+/// - A round trip is complete when a walker returns to the first replica after
+///   visiting the last replica
+template <typename RunType>
+void ReplicaExchangeDriver<RunType>::_update_walkers() {
+  if (n_replicas() < 2) {
+    return;
+  }
+
+  Index w_first = m_walker.front();
+  if (m_walker_direction[w_first] == -1) {
+    m_round_trips[w_first].push_back(m_pass - m_walker_start[w_first]);
+  }
+  if (m_walker_direction[w_first] != 1) {
+    m_walker_start[w_first] = m_pass;
+    m_walker_direction[w_first] = 1;
+  }
+
+  Index w_last = m_walker.back();
+  if (m_walker_direction[w_last] == 1) {
+    m_walker_direction[w_last] = -1;
+  }
+}
+
+/// \brief Write final states, output files, and the results summary
+template <typename RunType>
+void ReplicaExchangeDriver<RunType>::_write_output() {
+  for (Index i = 0; i < n_replicas(); ++i) {
+    Replica &replica = *m_replica[i];
+    m_log << replica.log_stream.str();
+
+    std::stringstream ss;
+    ss << "Conditions " << i;
+    m_log.write(ss.str());
+    m_log << "passes: " << replica.counter->pass() << "  "
+          << "samples: " << replica.counter->samples() << "\n";
+
+    m_log << "write: " << m_dir.final_state_json(i) << "\n";
+    jsonParser json;
+    to_json(replica.mc->configdof(), json).write(m_dir.final_state_json(i));
+    replica.mc->end_trajectory_stream();
+
+    write_conditions_json(m_settings, *replica.mc, i, m_log);
+    write_observations(m_settings, *replica.mc, i, m_log);
+    write_trajectory(m_settings, *replica.mc, i, m_log);
+    CASM::Monte::write_results(m_settings, *replica.mc, m_log);
+    m_log << std::endl;
+  }
+
+  m_log.write("Replica exchange statistics");
+  m_log << "write: " << m_dir.replica_exchange_json() << "\n" << std::endl;
+  _write_replica_exchange_json();
+}
+
+/// \brief Write swap acceptance and round trip statistics
+///
+/// Format:
+/// \code
+/// {
+///   "swap_period": <passes between exchange attempts>,
+///   "passes": <total passes>,
+///   "swap_attempts": [<attempts between replicas (i, i+1)>, ...],
+///   "swap_accepts": [<accepts between replicas (i, i+1)>, ...],
+///   "swap_acceptance": [<accepts / attempts>, ...],
+///   "round_trips": [[<round trip times of walker w, in passes>, ...], ...],
+///   "mean_round_trip": [<mean round trip time of walker w, or null>, ...],
+///   "walker": [<walker at replica i at end of run>, ...]
+/// }
+/// \endcode
+template <typename RunType>
+void ReplicaExchangeDriver<RunType>::_write_replica_exchange_json() const {
+  jsonParser json = jsonParser::object();
+  json["swap_period"] = m_swap_period;
+  json["passes"] = m_pass;
+  to_json(m_swap_attempts, json["swap_attempts"]);
+  to_json(m_swap_accepts, json["swap_accepts"]);
+  json["swap_acceptance"].put_array();
+  for (Index i = 0; i < m_swap_attempts.size(); ++i) {
+    json["swap_acceptance"].push_back(
+        m_swap_attempts[i] ? double(m_swap_accepts[i]) / m_swap_attempts[i]
+                           : 0.0);
+  }
+  json["round_trips"].put_array();
+  json["mean_round_trip"].put_array();
+  for (const auto &trips : m_round_trips) {
+    jsonParser tjson;
+    json["round_trips"].push_back(to_json(trips, tjson));
+    if (trips.empty()) {
+      json["mean_round_trip"].push_back(jsonParser::null());
+    } else {
+      double sum = 0.0;
+      for (Index t : trips) {
+        sum += t;
+      }
+      json["mean_round_trip"].push_back(sum / trips.size());
+    }
+  }
+  to_json(m_walker, json["walker"]);
+  json.write(m_dir.replica_exchange_json());
+}
+
+/// \brief Construct the list of conditions, one for each replica
+///
+/// - As for MonteDriver, "incremental" or "custom" drive modes may be used
+template <typename RunType>
+std::vector<typename ReplicaExchangeDriver<RunType>::CondType>
+ReplicaExchangeDriver<RunType>::make_conditions_list(
+    const SettingsType &settings) {
+  m_log.read("Conditions list");
+
+  // used to read conditions
+  RunType mc(m_primclex, settings, m_log);
+
+  switch (m_drive_mode) {
+    case Monte::DRIVE_MODE::CUSTOM: {
+      m_log << "Found: custom conditions" << std::endl << std::endl;
+      return settings.custom_conditions(mc);
+    }
+
+    case Monte::DRIVE_MODE::INCREMENTAL: {
+      m_log << "Found: incremental conditions" << std::endl;
+      CondType init_cond(settings.initial_conditions(mc));
+      CondType final_cond(settings.final_conditions(mc));
+      CondType cond_increment(settings.incremental_conditions(mc));
+
+      std::vector<CondType> conditions_list;
+      CondType incrementing_cond = init_cond;
+      int num_increments = 1 + (final_cond - init_cond) / cond_increment;
+      for (int i = 0; i < num_increments; i++) {
+        conditions_list.push_back(incrementing_cond);
+        incrementing_cond += cond_increment;
+      }
+      m_log << "Constructed " << num_increments << " conditions" << std::endl
+            << std::endl;
+      return conditions_list;
+    }
+
+    default: {
+      throw std::runtime_error("ERROR: An invalid drive mode was given.");
+    }
+  }
+}
+
+}  // namespace Monte
+}  // namespace CASM
+
+#endif
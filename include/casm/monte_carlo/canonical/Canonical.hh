@@ -3,6 +3,7 @@
 
 #include "casm/clex/Clex.hh"
 #include "casm/enumerator/OrderParameter.hh"
+#include "casm/monte_carlo/Checkerboard.hh"
 #include "casm/monte_carlo/Conversions.hh"
 #include "casm/monte_carlo/MonteCarlo.hh"
 #include "casm/monte_carlo/MonteDefinitions.hh"
@@ -54,6 +55,10 @@ class Canonical : public MonteCarlo {
   /// \brief Set configdof and clear previously collected data
   void set_configdof(const ConfigDoF &configdof, const std::string &msg = "");
 
+  /// \brief Set configdof without clearing previously collected data, as for
+  /// replica exchange
+  void exchange_configdof(const ConfigDoF &configdof);
+
   /// \brief Set configdof and conditions and clear previously collected data
   std::pair<ConfigDoF, std::string> set_state(
       const CanonicalConditions &new_conditions,
@@ -78,6 +83,40 @@ class Canonical : public MonteCarlo {
   /// \brief Nothing needs to be done to reject a CanonicalEvent
   void reject(const EventType &event);
 
+  /// \brief False: rejection-free (n-fold way) steps are only supported for
+  /// grand canonical calculations, and construction with
+  /// "driver"/"rejection_free" throws
+  bool rejection_free() const { return false; }
+
+  /// \brief Not supported, throws
+  size_type nfold_residence_steps();
+
+  /// \brief Not supported, throws
+  void nfold_skip(size_type n_steps);
+
+  /// \brief Not supported, throws
+  bool nfold_step();
+
+  /// \brief True if using checkerboard steps
+  bool checkerboard() const { return m_checkerboard != nullptr; }
+
+  /// \brief Checkerboard partition of the variable sites, or nullptr if not
+  /// using checkerboard steps
+  Checkerboard const *checkerboard_colors() const {
+    return m_checkerboard.get();
+  }
+
+  /// \brief Perform a checkerboard step of at most `max_steps` proposals, and
+  /// return the number of proposals
+  size_type checkerboard_step(size_type max_steps);
+
+  /// \brief Seed the random number generator. The checkerboard step threads'
+  /// random number generators are then seeded from it when next used.
+  void seed(MTRand::uint32 _seed) {
+    MonteCarlo::seed(_seed);
+    m_checkerboard_thread.clear();
+  }
+
   /// \brief Write results to files
   void write_results(size_type cond_index) const;
 
@@ -152,6 +191,15 @@ class Canonical : public MonteCarlo {
   /// \brief Calculate properties given current conditions
   void _update_properties();
 
+  /// \brief Throw, because rejection-free steps are not supported
+  [[noreturn]] static void _throw_rejection_free();
+
+  /// \brief Construct m_checkerboard, if using checkerboard steps
+  void _make_checkerboard(const SettingsType &settings);
+
+  /// \brief Throw if the conditions are not supported by checkerboard steps
+  void _check_checkerboard_conditions() const;
+
   /// \brief Generate supercell filling ConfigDoF from default configuration
   ConfigDoF _default_motif() const;
 
@@ -203,6 +251,22 @@ class Canonical : public MonteCarlo {
   /// Event to propose, check, accept/reject:
   CanonicalEvent m_event;
 
+  /// Checkerboard partition of the variable sites, or nullptr if not used
+  std::unique_ptr<Checkerboard> m_checkerboard;
+
+  /// Number of threads used for checkerboard steps
+  Index m_checkerboard_n_threads;
+
+  /// Resources of each thread used for checkerboard steps
+  std::vector<CheckerboardThread> m_checkerboard_thread;
+
+  /// Number of proposals made one at a time by the steps that exchange
+  /// occupants between sites of different colors
+  Index m_checkerboard_n_serial;
+
+  /// Sites of the chosen color, in random order
+  std::vector<Index> m_checkerboard_sites;
+
   // ---- Pointers to properties for faster access
 
   /// \brief Formation energy, normalized per primitive cell
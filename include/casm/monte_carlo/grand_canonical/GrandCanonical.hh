@@ -3,10 +3,13 @@
 
 #include "casm/clex/Clex.hh"
 #include "casm/enumerator/OrderParameter.hh"
+#include "casm/monte_carlo/Checkerboard.hh"
 #include "casm/monte_carlo/Conversions.hh"
 #include "casm/monte_carlo/MonteCarlo.hh"
 #include "casm/monte_carlo/MonteCarloEnum.hh"
 #include "casm/monte_carlo/MonteDefinitions.hh"
+#include "casm/monte_carlo/MotifSearch.hh"
+#include "casm/monte_carlo/NFoldWay.hh"
 #include "casm/monte_carlo/SiteExchanger.hh"
 #include "casm/monte_carlo/grand_canonical/GrandCanonicalConditions.hh"
 #include "casm/monte_carlo/grand_canonical/GrandCanonicalEvent.hh"
@@ -55,6 +58,10 @@ class GrandCanonical : public MonteCarlo {
   /// \brief Set configdof and clear previously collected data
   void set_configdof(const ConfigDoF &configdof, const std::string &msg = "");
 
+  /// \brief Set configdof without clearing previously collected data, as for
+  /// replica exchange
+  void exchange_configdof(const ConfigDoF &configdof);
+
   /// \brief Set configdof and conditions and clear previously collected data
   std::pair<ConfigDoF, std::string> set_state(
       const GrandCanonicalConditions &new_conditions,
@@ -79,6 +86,33 @@ class GrandCanonical : public MonteCarlo {
   /// \brief Nothing needs to be done to reject a GrandCanonicalEvent
   void reject(const EventType &event);
 
+  /// \brief True if using rejection-free (n-fold way) steps
+  bool rejection_free() const { return m_nfold != nullptr; }
+
+  /// \brief Number of steps before the next accepted event, for
+  /// rejection-free steps
+  size_type nfold_residence_steps();
+
+  /// \brief Skip steps that do not change the state, for rejection-free steps
+  void nfold_skip(size_type n_steps);
+
+  /// \brief Perform a rejection-free (n-fold way) step
+  bool nfold_step();
+
+  /// \brief True if using checkerboard steps
+  bool checkerboard() const { return m_checkerboard != nullptr; }
+
+  /// \brief Perform a checkerboard step of at most `max_steps` proposals, and
+  /// return the number of proposals
+  size_type checkerboard_step(size_type max_steps);
+
+  /// \brief Seed the random number generator. The checkerboard step threads'
+  /// random number generators are then seeded from it when next used.
+  void seed(MTRand::uint32 _seed) {
+    MonteCarlo::seed(_seed);
+    m_checkerboard_thread.clear();
+  }
+
   /// \brief Write results to files
   void write_results(size_type cond_index) const;
 
@@ -156,9 +190,29 @@ class GrandCanonical : public MonteCarlo {
   /// \brief Calculate properties given current conditions
   void _update_properties();
 
+  /// \brief Construct m_nfold, if using rejection-free steps
+  void _make_nfold(const SettingsType &settings);
+
+  /// \brief Return m_nfold, calculating event probabilities if necessary
+  NFoldWay &_nfold();
+
+  /// \brief Construct m_checkerboard, if using checkerboard steps
+  void _make_checkerboard(const SettingsType &settings);
+
+  /// \brief Throw if the conditions are not supported by checkerboard steps
+  void _check_checkerboard_conditions() const;
+
   /// \brief Generate supercell filling ConfigDoF from default configuration
   ConfigDoF _default_motif() const;
 
+  /// \brief Return m_motif_search, calculating database correlations if
+  /// necessary
+  const MotifSearch &_motif_search() const;
+
+  /// \brief Return m_motif_fills_supercell, checking database configurations
+  /// if necessary
+  const std::vector<bool> &_motif_fills_supercell() const;
+
   /// \brief Generate minimum potential energy ConfigDoF
   std::pair<ConfigDoF, std::string> _auto_motif(
       const GrandCanonicalConditions &cond) const;
@@ -195,6 +249,33 @@ class GrandCanonical : public MonteCarlo {
   /// Event to propose, check, accept/reject:
   EventType m_event;
 
+  /// Rejection-free (n-fold way) event probabilities, or nullptr if not used
+  std::unique_ptr<NFoldWay> m_nfold;
+
+  /// Event used to calculate rejection-free event probabilities
+  EventType m_nfold_event;
+
+  /// Sites and new occupants of the selected rejection-free event
+  std::vector<Index> m_nfold_site;
+  std::vector<int> m_nfold_occ;
+
+  /// Checkerboard partition of the variable sites, or nullptr if not used
+  std::unique_ptr<Checkerboard> m_checkerboard;
+
+  /// Number of threads used for checkerboard steps
+  Index m_checkerboard_n_threads;
+
+  /// Resources of each thread used for checkerboard steps
+  std::vector<CheckerboardThread> m_checkerboard_thread;
+
+  /// Correlations and composition of database configurations, for 'auto' and
+  /// 'restricted_auto' motifs, or nullptr if not yet calculated
+  mutable std::unique_ptr<MotifSearch> m_motif_search;
+
+  /// m_motif_fills_supercell[i]: true if configuration i of m_motif_search
+  /// can fill the Monte Carlo supercell
+  mutable std::vector<bool> m_motif_fills_supercell;
+
   // ---- Pointers to properties for faster access
 
   /// \brief Formation energy, normalized per primitive cell
@@ -0,0 +1,221 @@
+#ifndef CASM_KineticMonteCarlo_HH
+#define CASM_KineticMonteCarlo_HH
+
+#include <string>
+#include <vector>
+
+#include "casm/clex/Clex.hh"
+#include "casm/clex/Configuration.hh"
+#include "casm/external/MersenneTwister/MersenneTwister.h"
+#include "casm/global/definitions.hh"
+#include "casm/global/eigen.hh"
+#include "casm/monte_carlo/Conversions.hh"
+#include "casm/monte_carlo/OccCandidate.hh"
+#include "casm/monte_carlo/OccLocation.hh"
+#include "casm/monte_carlo/RateTree.hh"
+
+namespace CASM {
+
+struct ClexDescription;
+class jsonParser;
+class PrimClex;
+
+namespace Monte {
+
+/// \brief A hop event: exchange of the occupants of two sites
+struct HopEvent {
+  /// Linear site index of the first site of the hop cluster
+  Index l_a;
+
+  /// Linear site index of the second site of the hop cluster
+  Index l_b;
+
+  /// Linear index of the unit cell the hop cluster is translated to
+  Index unitcell_index;
+
+  /// Index of the equivalent phenomenal cluster, which selects the local
+  /// Clexulator
+  Index equivalent_index;
+};
+
+/// \brief Diffusion results for one species type
+struct SpeciesDiffusion {
+  /// Species name
+  std::string species_name;
+
+  /// Number of tracked species of this type
+  Index count = 0;
+
+  /// Total number of hops made by species of this type
+  Index n_hops = 0;
+
+  /// Tracer diffusion coefficient, sum_i |R_i|^2 / (6 t N)
+  double tracer_diffusion_coefficient = 0.0;
+
+  /// Collective diffusion coefficient, |sum_i R_i|^2 / (6 t N)
+  double collective_diffusion_coefficient = 0.0;
+
+  /// Correlation factor, sum_i |R_i|^2 / sum_i sum_hops |r|^2
+  double correlation_factor = 0.0;
+};
+
+jsonParser &to_json(const SpeciesDiffusion &diffusion, jsonParser &json);
+
+/// \brief Kinetic Monte Carlo of hops between pairs of sites
+///
+/// Hop events are the exchange of the occupants of the two sites of a
+/// phenomenal pair cluster, for every equivalent phenomenal cluster in every
+/// unit cell of the supercell. The rate of each event is:
+/// \code
+/// rate = attempt_frequency * exp(-beta * (E_kra + dE / 2))
+/// \endcode
+/// where:
+/// - E_kra, the kinetically resolved activation barrier, is evaluated using a
+///   local cluster expansion, whose phenomenal cluster is the hop pair
+/// - dE is the change in formation energy due to the hop, evaluated using a
+///   periodic cluster expansion
+///
+/// Events are selected with probability proportional to their rate, using a
+/// RateTree, and time is advanced by an exponentially distributed waiting
+/// time. After a hop, only the rates of events whose local environment
+/// includes one of the hop sites are updated.
+///
+/// The position of each atom and vacancy is tracked, using
+/// OccLocation species tracking, to calculate diffusion coefficients and
+/// correlation factors. Displacements are Cartesian, in the length units of
+/// the prim lattice, and time is in units of 1 / attempt_frequency.
+///
+class KineticMonteCarlo {
+ public:
+  /// \brief Constructor
+  KineticMonteCarlo(const PrimClex &primclex, const Configuration &config,
+                    const ClexDescription &formation_energy_desc,
+                    const ClexDescription &kra_desc, double temperature,
+                    double attempt_frequency);
+
+  /// \brief Current configuration
+  const Configuration &config() const { return m_config; }
+
+  /// \brief Temperature, in K
+  double temperature() const { return m_temperature; }
+
+  /// \brief Attempt frequency
+  double attempt_frequency() const { return m_attempt_frequency; }
+
+  /// \brief If true, only hops exchanging a vacancy and an atom are allowed
+  ///
+  /// - Default is true if any species is a vacancy, else all hops exchanging
+  ///   different occupants are allowed
+  bool vacancy_mediated() const { return m_vacancy_mediated; }
+
+  /// \brief Set vacancy_mediated, and recalculate all rates
+  void set_vacancy_mediated(bool _vacancy_mediated);
+
+  /// \brief Random number generator
+  MTRand &mtrand() { return m_mtrand; }
+
+  /// \brief All hop events
+  const std::vector<HopEvent> &events() const { return m_event; }
+
+  /// \brief Rate of an event
+  double rate(Index event_index) const { return m_rate_tree.rate(event_index); }
+
+  /// \brief Sum of the rates of all events
+  double total_rate() const { return m_rate_tree.total_rate(); }
+
+  /// \brief Calculate the rate of an event in the current configuration
+  double calc_rate(Index event_index) const;
+
+  /// \brief Select and apply one event, and advance time
+  void step();
+
+  /// \brief Perform n_steps steps
+  void run(Index n_steps);
+
+  /// \brief Time since the start, or since statistics were reset
+  double time() const { return m_time; }
+
+  /// \brief Number of steps since the start, or since statistics were reset
+  Index n_steps() const { return m_n_steps; }
+
+  /// \brief Reset time and species displacements, as after equilibration
+  void reset_statistics();
+
+  /// \brief Displacement of each tracked species, (Cartesian, as columns)
+  const Eigen::MatrixXd &displacement() const { return m_displacement; }
+
+  /// \brief Diffusion results, by species type
+  std::vector<SpeciesDiffusion> diffusion() const;
+
+ private:
+  /// \brief Recalculate all rates
+  void _update_all_rates();
+
+  /// \brief Apply event and update species displacements
+  void _apply(Index event_index);
+
+  double m_temperature;
+  double m_beta;
+  double m_attempt_frequency;
+  bool m_vacancy_mediated;
+
+  /// Current configuration
+  Configuration m_config;
+
+  /// Reference to m_config.configdof()
+  ConfigDoF &m_configdof;
+
+  Conversions m_convert;
+  OccCandidateList m_cand;
+  OccLocation m_occ_loc;
+
+  /// Formation energy cluster expansion
+  Clex m_formation_energy_clex;
+
+  /// Local Clexulator for each equivalent phenomenal hop cluster
+  std::vector<Clexulator> m_kra_clexulator;
+
+  /// ECI for the kinetically resolved activation barrier
+  ECIContainer m_kra_eci;
+
+  /// Cartesian hop vector, from site a to site b, for each equivalent
+  /// phenomenal hop cluster
+  std::vector<Eigen::Vector3d> m_hop_displacement;
+
+  /// m_is_vacancy[species_index]
+  std::vector<bool> m_is_vacancy;
+
+  std::vector<HopEvent> m_event;
+  RateTree m_rate_tree;
+
+  /// m_site_to_event[l]: events whose rate depends on the occupation of site l
+  std::vector<std::vector<Index>> m_site_to_event;
+
+  /// Marks events already updated after a step
+  std::vector<Index> m_event_mark;
+  Index m_mark;
+
+  MTRand m_mtrand;
+
+  double m_time;
+  Index m_n_steps;
+
+  /// Displacement of each tracked species, as columns
+  Eigen::MatrixXd m_displacement;
+
+  /// Sum of squared hop lengths of each tracked species
+  Eigen::VectorXd m_hop_length_sq;
+
+  /// Number of hops of each tracked species
+  std::vector<Index> m_n_hops;
+
+  /// Temporaries
+  mutable OccEvent m_occ_event;
+  mutable Eigen::VectorXd m_dcorr;
+  mutable Eigen::VectorXd m_kra_corr;
+};
+
+}  // namespace Monte
+}  // namespace CASM
+
+#endif
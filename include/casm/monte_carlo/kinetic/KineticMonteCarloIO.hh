@@ -0,0 +1,30 @@
+#ifndef CASM_KineticMonteCarloIO_HH
+#define CASM_KineticMonteCarloIO_HH
+
+namespace CASM {
+template <typename T>
+class DataFormatter;
+class Log;
+}  // namespace CASM
+
+namespace CASM {
+namespace Monte {
+
+class KineticMonteCarlo;
+typedef const KineticMonteCarlo *ConstKineticMonteCarloPtr;
+class CanonicalConditions;
+class MonteSettings;
+
+/// \brief Make a kinetic Monte Carlo results formatter
+DataFormatter<ConstKineticMonteCarloPtr> make_kinetic_results_formatter(
+    const KineticMonteCarlo &kmc, const CanonicalConditions &conditions);
+
+/// \brief Write kinetic Monte Carlo results
+void write_kinetic_results(const MonteSettings &settings,
+                           const KineticMonteCarlo &kmc,
+                           const CanonicalConditions &conditions, Log &_log);
+
+}  // namespace Monte
+}  // namespace CASM
+
+#endif
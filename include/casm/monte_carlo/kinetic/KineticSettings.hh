@@ -0,0 +1,57 @@
+#ifndef CASM_KineticSettings
+#define CASM_KineticSettings
+
+#include "casm/monte_carlo/canonical/CanonicalSettings.hh"
+
+namespace CASM {
+namespace Monte {
+
+/// \brief Settings for kinetic Monte Carlo calculations
+///
+/// Kinetic Monte Carlo input files are Canonical Monte Carlo input files with
+/// "method": "kinetic". The supercell, motif, and conditions are read as for
+/// Canonical Monte Carlo, and the initial state of each run is made using
+/// Canonical::set_state. The "data" sampling settings are not used by kinetic
+/// Monte Carlo, so "data"/"measurements" may be omitted.
+class KineticSettings : public CanonicalSettings {
+ public:
+  /// \brief Default constructor
+  KineticSettings() {}
+
+  /// \brief Construct KineticSettings by reading a settings JSON file
+  KineticSettings(const PrimClex &primclex, const fs::path &read_path);
+
+  // --- Project settings ---------------------
+
+  /// \brief Get the local cluster expansion for the kinetically resolved
+  /// activation barrier
+  ClexDescription kra(const PrimClex &primclex) const;
+
+  // --- Kinetic Monte Carlo settings ---------------------
+
+  /// \brief Attempt frequency, the rate prefactor. Default 1.0.
+  double attempt_frequency() const;
+
+  /// \brief Returns true if "kinetic"/"vacancy_mediated" is given
+  bool is_vacancy_mediated() const;
+
+  /// \brief If true, only hops exchanging a vacancy and an atom are allowed
+  bool vacancy_mediated() const;
+
+  /// \brief Number of steps to perform, for each run, before statistics are
+  /// collected. Default 0.
+  size_type equilibration_steps() const;
+
+  /// \brief Number of steps to perform, for each run, while statistics are
+  /// collected
+  size_type steps() const;
+
+ private:
+  /// \brief Returns true if (*this)["kinetic"].contains(level2)
+  bool _is_kinetic_setting(std::string level2) const;
+};
+
+}  // namespace Monte
+}  // namespace CASM
+
+#endif
@@ -29,7 +29,7 @@ namespace CASM {
 /// \code
 /// SupercellSymInfo sym_info = ...
 /// for( f=0; f<sym_info.factor_group().size(); f++) {
-///   for( t=0; t<sym_info.translation_permutations().size(); t++) {
+///   for( t=0; t<sym_info.translation_permutations_size(); t++) {
 ///     after_array =
 ///     sym_info.translation_permute(t).permute(sym_info.factor_group_permute(f).permute(before_array));
 ///   }
@@ -45,10 +45,6 @@ class PermuteIterator
       public Comparisons<CRTPBase<PermuteIterator>> {
   SupercellSymInfo const *m_sym_info;
 
-  /// Pointer to the vector<Permutation> of translation permutations
-  /// inside of m_sym_info (to provide faster access)
-  std::vector<Permutation> const *m_trans_permute;
-
   Index m_factor_group_index;
   Index m_translation_index;
 
@@ -93,7 +89,9 @@ class PermuteIterator
   const Permutation &factor_group_permute() const;
 
   /// Return the translation permutation being pointed at
-  const Permutation &translation_permute() const;
+  ///
+  /// Note: This is constructed on request. Prefer `permute_ind`.
+  Permutation translation_permute() const;
 
   /// Returns representation of current operation corresponding to species
   /// transformation on sublattice b
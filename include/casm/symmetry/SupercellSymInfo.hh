@@ -104,13 +104,33 @@ class SupercellSymInfo {
     return m_unitcellcoord_to_index_converter;
   }
 
+  /// \brief Number of lattice translations (equal to the number of unit cells
+  /// in the supercell)
+  Index translation_permutations_size() const { return m_n_unitcells; }
+
+  /// \brief Site permutation due to a lattice translation, evaluated on the
+  /// fly
+  ///
+  /// Equivalent to `translation_permute(translation_index)[site_index]`, i.e.
+  ///     after[site_index] = before[translation_permute_ind(t, site_index)],
+  /// but constant time and without storing any permutations.
+  Index translation_permute_ind(Index translation_index,
+                                Index site_index) const;
+
+  /// \brief Permutation describing reordering of sites of supercell due to a
+  /// lattice translation, translating the origin cell to unitcell[l] of the
+  /// supercell
+  Permutation translation_permute(Index translation_index) const;
+
   /// \brief Permutations describing reordering of sites of supercell due to a
   /// lattice translation of the primitive translation_permutation()[l] gives
   /// the site permutation due to translating to origin cell to unitcell[l] of
   /// the supercell
-  const std::vector<Permutation> &translation_permutations() const {
-    return m_translation_permutations;
-  }
+  ///
+  /// Note: This is constructed on request, and requires memory proportional to
+  /// (number of unit cells) * (number of sites). Prefer
+  /// `translation_permute_ind` or `translation_permute`.
+  std::vector<Permutation> translation_permutations() const;
 
   /// \brief Subgroup of primitive-cell factor group operations that leave
   /// supercell lattice invariant
@@ -183,9 +203,15 @@ class SupercellSymInfo {
   /// linear index
   xtal::UnitCellCoordIndexConverter m_unitcellcoord_to_index_converter;
 
-  /// Stores the permutations associated with making translations from a lattice
-  /// point to the origin
-  std::vector<Permutation> m_translation_permutations;
+  /// Number of unit cells in the supercell
+  Index m_n_unitcells;
+
+  /// Diagonal of the Smith Normal Form, S, of the transformation matrix,
+  /// T = U*S*V, which determines the order of unit cells used by
+  /// m_unitcell_to_index_converter. Translations are evaluated as addition of
+  /// (m,n,p) unit cell coordinates modulo S (see
+  /// xtal::impl::OrderedLatticePointGenerator).
+  Eigen::Vector3l m_smith_normal_diagonal;
 
   // m_factor_group is factor group of the super cell, found by identifying the
   // subgroup of
@@ -231,6 +257,35 @@ class SupercellSymInfo {
   mutable SymGroupRep::RemoteHandle m_site_perm_symrep;
 };
 
+/// \brief Site permutation due to a lattice translation, evaluated on the
+/// fly
+///
+/// Unit cell index l corresponds to the Smith Normal Form grid point
+/// (m,n,p) = (l%S0, (l/S0)%S1, l/(S0*S1)), and translations are addition
+/// modulo (S0,S1,S2), so the site which is translated onto `site_index` is
+/// found in constant time.
+inline Index SupercellSymInfo::translation_permute_ind(Index translation_index,
+                                                       Index site_index) const {
+  if (translation_index == 0) {
+    return site_index;
+  }
+  Index const &S0 = m_smith_normal_diagonal[0];
+  Index const &S1 = m_smith_normal_diagonal[1];
+  Index const &S2 = m_smith_normal_diagonal[2];
+  Index b = site_index / m_n_unitcells;
+  Index l = site_index % m_n_unitcells;
+
+  // (before) = (after) - (translation), modulo S
+  auto diff = [](Index after, Index translation, Index S) {
+    Index d = after - translation;
+    return d < 0 ? d + S : d;
+  };
+  Index m = diff(l % S0, translation_index % S0, S0);
+  Index n = diff((l / S0) % S1, (translation_index / S0) % S1, S1);
+  Index p = diff(l / (S0 * S1), translation_index / (S0 * S1), S2);
+  return b * m_n_unitcells + m + S0 * (n + S1 * p);
+}
+
 std::string hermite_normal_form_name(const Eigen::Matrix3l &matrix);
 
 Eigen::Matrix3l make_hermite_normal_form(std::string hermite_normal_form_name);
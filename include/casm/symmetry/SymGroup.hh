@@ -1,9 +1,13 @@
 #ifndef SYMGROUP_HH
 #define SYMGROUP_HH
 
+#include <array>
+#include <atomic>
 #include <iomanip>
 #include <iostream>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 
@@ -292,7 +296,10 @@ class MasterSymGroup : public SymGroup {
 
  public:
   MasterSymGroup(PERIODICITY_TYPE init_type = PERIODIC)
-      : SymGroup(init_type), m_group_index(GROUP_COUNT++) {}
+      : SymGroup(init_type),
+        m_group_index(GROUP_COUNT++),
+        m_coord_rep(nullptr),
+        m_reg_rep(nullptr) {}
 
   MasterSymGroup(const MasterSymGroup &RHS);
   ~MasterSymGroup();
@@ -348,6 +355,47 @@ class MasterSymGroup : public SymGroup {
   SymGroupRepID add_rotation_rep() const;
 
  private:
+  /// Array of SymGroupRep pointers, stored in blocks that are never moved once
+  /// allocated, so that elements may be read without locking while another
+  /// thread adds elements. Adding elements must be serialized by the caller.
+  class RepPtrArray {
+   public:
+    RepPtrArray() : m_size(0) {}
+
+    Index size() const { return m_size.load(std::memory_order_acquire); }
+
+    /// Element i, for i < size()
+    SymGroupRep *operator[](Index i) const {
+      return _element(i).load(std::memory_order_acquire);
+    }
+
+    void set(Index i, SymGroupRep *_rep_ptr) {
+      _element(i).store(_rep_ptr, std::memory_order_release);
+    }
+
+    void push_back(SymGroupRep *_rep_ptr);
+
+    /// Increase size to _size, adding nullptr elements
+    void resize(Index _size);
+
+    /// Remove all elements, without deleting the SymGroupReps. Not safe to call
+    /// while other threads are reading.
+    void clear();
+
+   private:
+    /// Block b holds (FIRST_BLOCK_SIZE << b) elements
+    static const Index FIRST_BLOCK_SIZE = 16;
+
+    std::atomic<SymGroupRep *> &_element(Index i) const;
+
+    /// Allocate blocks to hold at least _size elements
+    void _allocate(Index _size);
+
+    std::array<std::unique_ptr<std::atomic<SymGroupRep *>[]>, 48> m_blocks;
+
+    std::atomic<Index> m_size;
+  };
+
   SymGroupRep *_representation_ptr(SymGroupRepID _id) const;
 
   SymGroupRepID _add_reg_rep() const;
@@ -358,6 +406,10 @@ class MasterSymGroup : public SymGroup {
   /// calling
   SymGroupRepID _add_representation(SymGroupRep *_rep_ptr) const;
 
+  /// Add copies of the representations of RHS, including its Cartesian,
+  /// regular, and identity representations
+  void _copy_representations(MasterSymGroup const &RHS);
+
   /// Counts number of instantiated MasterSymGroups, excluding ones created via
   /// copy
   static Index GROUP_COUNT;
@@ -368,18 +420,23 @@ class MasterSymGroup : public SymGroup {
 
   /// Collection of alternate representations of this symmetry group
   /// Stored as pointers to avoid weird behavior with resizing
-  mutable std::vector<SymGroupRep *> m_rep_array;
+  mutable RepPtrArray m_rep_array;
+
+  /// Guards adding representations (for example, by constructing Supercell
+  /// site permutation representations from multiple threads). Representations
+  /// are looked up without locking.
+  mutable std::recursive_mutex m_rep_mutex;
 
-  /// ID of Cartesian representation
-  mutable SymGroupRepID m_coord_rep_ID;
+  /// Cartesian representation, or nullptr if not yet constructed
+  mutable std::atomic<SymGroupRep *> m_coord_rep;
 
-  /// ID of 'regular representation', which is (size() X size()) representation
-  /// constructed from alt_multi_table()
-  mutable SymGroupRepID m_reg_rep_ID;
+  /// 'regular representation', which is (size() X size()) representation
+  /// constructed from alt_multi_table(), or nullptr if not yet constructed
+  mutable std::atomic<SymGroupRep *> m_reg_rep;
 
-  /// identity representations: m_identity_rep_IDs[dim] refers to the Identity
-  /// representation of dimention 'dim'
-  mutable std::vector<SymGroupRepID> m_identity_rep_IDs;
+  /// identity representations: m_identity_reps[dim] is the Identity
+  /// representation of dimention 'dim', or nullptr if not yet constructed
+  mutable RepPtrArray m_identity_reps;
 
   /// Copy of *this with translations removed
   mutable SymGroup m_point_group;
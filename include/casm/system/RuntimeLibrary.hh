@@ -71,6 +71,11 @@ class RuntimeLibrary {
   /// \brief Remove the current library and source code
   void rm();
 
+  /// \brief Compile "filename_base.cc" into "filename_base.so", using the
+  /// compile cache if it is enabled
+  static void compile(std::string filename_base, std::string compile_options,
+                      std::string so_options);
+
   /// \brief Default c++ compiler options
   static std::pair<std::string, std::string> default_cxxflags();
 
@@ -92,6 +97,12 @@ class RuntimeLibrary {
   /// \brief Return default libdir for boost
   static std::pair<fs::path, std::string> default_boost_libdir();
 
+  /// \brief Return default compile cache directory
+  static std::pair<fs::path, std::string> default_cache_dir();
+
+  /// \brief Return default maximum number of parallel compile jobs
+  static std::pair<Index, std::string> default_compile_jobs();
+
  private:
   /// \brief Compile a shared library
   void _compile();
@@ -169,6 +169,18 @@ fs::path DirectoryStructure::config_list() const {
   return m_root / m_casm_dir / "config_list.json";
 }
 
+/// \brief Return superlattice_cache.json file path, which stores candidate
+/// supercell lattices for structure mapping
+fs::path DirectoryStructure::superlattice_cache() const {
+  return m_root / m_casm_dir / "superlattice_cache.json";
+}
+
+/// \brief Return property cache directory path, which stores calculated
+/// property values, such as correlations, for configurations
+fs::path DirectoryStructure::property_cache_dir() const {
+  return m_root / m_casm_dir / "property_cache";
+}
+
 /// \brief Return enumerators plugin dir
 fs::path DirectoryStructure::enumerator_plugins() const {
   return m_root / m_casm_dir / "enumerators";
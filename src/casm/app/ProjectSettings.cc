@@ -43,7 +43,8 @@ ProjectSettings::ProjectSettings(std::string project_name)
     : m_project_name(project_name),
       m_crystallography_tol(CASM::TOL),
       m_lin_alg_tol(1e-10),
-      m_default_database_name("jsonDB") {
+      m_default_database_name("jsonDB"),
+      m_database_cache_size(10000) {
   throw_if_project_name_is_not_valid(m_project_name);
 }
 
@@ -52,7 +53,8 @@ ProjectSettings::ProjectSettings(std::string project_name, fs::path root)
       m_dir(notstd::make_unique<DirectoryStructure>(root)),
       m_crystallography_tol(CASM::TOL),
       m_lin_alg_tol(1e-10),
-      m_default_database_name("jsonDB") {
+      m_default_database_name("jsonDB"),
+      m_database_cache_size(10000) {
   throw_if_project_name_is_not_valid(m_project_name);
 }
 
@@ -230,6 +232,14 @@ std::string ProjectSettings::default_database_name() const {
   return m_default_database_name;
 }
 
+void ProjectSettings::set_database_cache_size(Index _database_cache_size) {
+  m_database_cache_size = _database_cache_size;
+}
+
+Index ProjectSettings::database_cache_size() const {
+  return m_database_cache_size;
+}
+
 ProjectSettings::query_alias_map_type const &ProjectSettings::query_alias()
     const {
   return m_query_alias;
@@ -425,7 +435,14 @@ void print_compiler_settings_summary(ProjectSettings const &set, Log &log) {
       << _wdefaultval("casm_includedir", set.casm_includedir())
       << _wdefaultval("casm_libdir", set.casm_libdir())
       << _wdefaultval("boost_includedir", set.boost_includedir())
-      << _wdefaultval("boost_libdir", set.boost_libdir()) << std::endl;
+      << _wdefaultval("boost_libdir", set.boost_libdir())
+      << _wdefaultval("runtime_lib_cache_dir",
+                      RuntimeLibrary::default_cache_dir());
+  auto compile_jobs = RuntimeLibrary::default_compile_jobs();
+  log << _wdefaultval("compile_jobs",
+                      std::make_pair(std::to_string(compile_jobs.first),
+                                     compile_jobs.second))
+      << std::endl;
   log << "compile command: '" << set.compile_options() << "'\n\n";
   log << "so command: '" << set.so_options() << "'\n\n";
 }
@@ -541,6 +558,12 @@ jsonParser &to_json(const ProjectSettings &set, jsonParser &json) {
   json["lin_alg_tol"] = set.lin_alg_tol();
   json["lin_alg_tol"].set_scientific();
   json["query_alias"] = set.query_alias();
+  if (set.default_database_name() != "jsonDB") {
+    json["database"] = set.default_database_name();
+  }
+  if (set.database_cache_size() != 10000) {
+    json["database_cache_size"] = set.database_cache_size();
+  }
 
   return json;
 }
@@ -654,6 +677,15 @@ ProjectSettings jsonConstructor<ProjectSettings>::from_json(
       settings.set_query_alias(tmp);
     }
 
+    // read database type, "jsonDB" (default) or "binaryDB"
+    if (json.get_if(tmp_str, "database")) {
+      settings.set_default_database_name(tmp_str);
+    }
+    Index tmp_index;
+    if (json.get_if(tmp_index, "database_cache_size")) {
+      settings.set_database_cache_size(tmp_index);
+    }
+
     return settings;
 
   } catch (std::exception &e) {
@@ -83,6 +83,11 @@ void parse(InputParser<ConfigEnumOptions> &parser, std::string method_name,
 
   options.verbosity = parse_verbosity(parser);
 
+  parser.optional_else(options.n_threads, "n_threads", Index(1));
+  if (options.n_threads < 1) {
+    parser.insert_error("n_threads", "Error: n_threads must be >= 1");
+  }
+
   parser.optional(options.filter_expression, "filter");
   if (!options.filter_expression.empty()) {
     options.filter =
@@ -51,6 +51,11 @@ void parse(InputParser<EnumerateSupercellsOptions> &parser,
 
   options.verbosity = parse_verbosity(parser);
 
+  parser.optional_else(options.n_threads, "n_threads", Index(1));
+  if (options.n_threads < 1) {
+    parser.insert_error("n_threads", "Error: n_threads must be >= 1");
+  }
+
   std::vector<std::string> filter_expression;
   parser.optional(filter_expression, "filter");
   if (filter_expression.size()) {
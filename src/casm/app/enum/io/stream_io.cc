@@ -13,6 +13,7 @@ void print_options(Log &log, ConfigEnumOptions const &options) {
   }
   log.indent() << "verbosity: " << options.verbosity << std::endl;
   log.indent() << "dry_run: " << options.dry_run << std::endl;
+  log.indent() << "n_threads: " << options.n_threads << std::endl;
   log.indent() << "output_configurations: " << options.output_configurations
                << std::endl;
   if (options.output_configurations) {
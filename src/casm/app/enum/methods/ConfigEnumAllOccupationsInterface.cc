@@ -40,7 +40,17 @@ std::string ConfigEnumAllOccupationsInterface::desc() const {
       "    allows including non-canonical configurations in the  \n"
       "    output generated when \"output_configurations\"==true.\n"
       "    The default value is true if enumeration is occuring  \n"
-      "    on all sites in the configuration, and false otherwise.\n\n";
+      "    on all sites in the configuration, and false otherwise.\n\n"
+
+      "  orderly: bool (optional, default=false)\n"
+      "    If true, and non-canonical configurations are skipped,\n"
+      "    canonical occupations are generated directly, pruning \n"
+      "    non-canonical partial occupations, instead of checking\n"
+      "    every occupation. This is much faster for large       \n"
+      "    supercells. The same configurations are enumerated, in\n"
+      "    a different order, so configuration names may differ. \n"
+      "    Only used if occupation is isotropic and all other DoF\n"
+      "    values of the initial configuration are zero.         \n\n";
 
   std::string examples =
       "  Examples:\n"
@@ -100,6 +110,9 @@ void ConfigEnumAllOccupationsInterface::run(
   std::optional<bool> skip_non_canonical;
   parser.optional(skip_non_canonical, "skip_non_canonical");
 
+  bool orderly;
+  parser.optional_else(orderly, "orderly", false);
+
   log << std::boolalpha;
   log.indent() << "skip_non_primitive:";
   if (skip_non_primitive.has_value()) {
@@ -113,6 +126,7 @@ void ConfigEnumAllOccupationsInterface::run(
   } else {
     log << "null" << std::endl;
   }
+  log.indent() << "orderly:" << orderly << std::endl;
   log << std::noboolalpha;
 
   // 2) Parse initial enumeration states ------------------
@@ -145,7 +159,8 @@ void ConfigEnumAllOccupationsInterface::run(
       canonical_only = skip_non_canonical.value();
     }
     return ConfigEnumAllOccupations{initial_state, primitive_only,
-                                    canonical_only};
+                                    canonical_only, options.n_threads,
+                                    orderly};
   };
 
   typedef ConfigEnumData<ConfigEnumAllOccupations, ConfigEnumInput>
@@ -89,6 +89,11 @@ std::string ScelEnumInterface::desc() const {
       "    effect of fixing the shape in the dimensions being enumerated\n"
       "    but increasing the size.                                     \n"
       "\n"
+      "  n_threads: int (optional, default=1)\n"
+      "    Maximum number of threads used to enumerate supercells and make \n"
+      "    them canonical. Supercells of each volume are enumerated by one \n"
+      "    thread. Results are the same for any number of threads. \n"
+      "\n"
       "  filter: string (optional, default=None, override with --filter)\n"
       "    A query command to use to filter which Configurations are kept.     "
       "     \n\n"
@@ -183,7 +188,8 @@ void ScelEnumInterface::run(PrimClex &primclex, jsonParser const &json_options,
     formatter.push_back(ScelEnumIO::is_excluded_by_filter<ScelEnumDataType>());
   }
 
-  ScelEnumByProps enumerator{primclex.shared_prim(), scel_enum_props};
+  ScelEnumByProps enumerator{primclex.shared_prim(), scel_enum_props,
+                             options.n_threads};
   enumerate_supercells(options, enumerator, primclex.db<Supercell>(),
                        formatter);
 }
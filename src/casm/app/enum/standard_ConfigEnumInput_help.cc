@@ -22,6 +22,12 @@ std::string standard_ConfigEnumInput_help() {
          "        \n"
          "    configurations are saved. \n\n"
 
+         "  n_threads: int (optional, default=1)\n"
+         "    Maximum number of threads used to check if enumerated \n"
+         "    configurations are primitive and canonical, and to make \n"
+         "    them so before they are inserted in the configuration \n"
+         "    list. Results are the same for any number of threads. \n\n"
+
          "  output_configurations: bool (optional, default=false)\n"
          "    If true, write formatted data for each enumerated configuration. "
          "Formatting options are \n"
@@ -196,7 +196,17 @@ int format_command(const CommandArgs &args) {
     log() << "$ROOT/.casm/project_settings.json\n\n\n";
 
     log() << "DESCRIPTION:\n";
-    log() << "Current CASM project settings.\n\n\n";
+    log() << "Current CASM project settings.\n\n";
+    log() << "The optional \"database\" setting selects how configurations "
+             "are\n"
+             "stored: \"jsonDB\" (default), in $ROOT/.casm/jsonDB/config_list."
+             "json,\n"
+             "or \"binaryDB\", in the binary append-only record log \n"
+             "$ROOT/.casm/binaryDB/config_list.log. With \"binaryDB\", "
+             "configurations\n"
+             "are read on demand and at most \"database_cache_size\" "
+             "(default 10000)\n"
+             "unmodified configurations are held in memory.\n\n\n";
 
     log() << "EXAMPLE:\n";
     log() << "-------\n";
@@ -1786,7 +1796,19 @@ int format_command(const CommandArgs &args) {
            "    \"LTE1\" or \"lte1\": Single spin flip low temperature         "
            "\n"
            "    expansion calculations.                                        "
-           "\n\n\n"
+           "\n\n"
+
+           "    \"Kinetic\" or \"kinetic\": Kinetic Monte Carlo calculations\n"
+           "    of hops between pairs of sites, using the \"kinetic\"\n"
+           "    settings.\n"
+           "    Only supported for \"canonical\" calculations. The initial\n"
+           "    state of each run is made as for \"metropolis\" calculations,\n"
+           "    from the \"supercell\", \"motif\", and conditions. After each\n"
+           "    run, the temperature, composition, time, and for each species\n"
+           "    the tracer and collective diffusion coefficients and the\n"
+           "    correlation factor are appended to the results file. Of the\n"
+           "    \"data\" settings, only \"storage\"/\"output_format\" is\n"
+           "    used.\n\n\n"
 
            "\"model\": (JSON object)                                           "
            "\n\n"
@@ -1796,7 +1818,34 @@ int format_command(const CommandArgs &args) {
            "    Specifies the cluster expansion to use to calculated formation "
            "\n"
            "    energy. Should be one of the ones listed by 'casm settings "
-           "-l'.\n\n\n"
+           "-l'.\n\n"
+
+           "  /\"kra\": (string, optional, default=\"kra\", \"kinetic\" only)\n"
+           "    Specifies the local cluster expansion used to calculate the\n"
+           "    kinetically resolved activation barrier (KRA) of hops. Its\n"
+           "    phenomenal cluster must be a pair of sites. Hop rates are\n"
+           "    attempt_frequency * exp(-(KRA + dE / 2) / kT), where dE is\n"
+           "    the change in formation energy due to the hop.\n\n\n"
+
+           "\"kinetic\": (JSON object, \"kinetic\" method only)\n\n"
+
+           "  /\"steps\": (integer)\n"
+           "    Number of hops performed in each run while time and species\n"
+           "    displacements are collected.\n\n"
+
+           "  /\"equilibration_steps\": (integer, default 0)\n"
+           "    Number of hops performed in each run before time and species\n"
+           "    displacements are collected.\n\n"
+
+           "  /\"attempt_frequency\": (number, default 1.0)\n"
+           "    The prefactor of every hop rate. Time is in units of\n"
+           "    1 / attempt_frequency, and displacements are in the length\n"
+           "    units of the prim lattice.\n\n"
+
+           "  /\"vacancy_mediated\": (boolean, optional)\n"
+           "    If true, only hops exchanging a vacancy and an atom are\n"
+           "    allowed. If false, all hops exchanging different occupants\n"
+           "    are allowed. Default is true if any species is a vacancy.\n\n\n"
 
            "\"supercell\": (3x3 JSON arrays of integers)                      "
            "\n"
@@ -1962,6 +2011,14 @@ int format_command(const CommandArgs &args) {
            "      format.                                                      "
            "\n\n"
 
+           "    /\"stream_trajectory\": (boolean, default false)\n"
+           "      If true, with \"write_trajectory\", occupation changes since\n"
+           "      the previous sample are written to a compressed binary file\n"
+           "      as samples are taken, instead of keeping all samples in\n"
+           "      memory:\n"
+           "        \"output_directory\"/conditions.i/trajectory.occ.gz\n"
+           "      'casm monte --traj-POSCAR' reads this file if it is used.\n\n"
+
            "  /\"enumeration\": (JSON object, optional)                        "
            "\n"
            "    If included, save configurations encountered during Monte      "
@@ -2146,6 +2203,98 @@ int format_command(const CommandArgs &args) {
            "the\n"
            "    DoF specified for the \"motif\".\n\n"
 
+           "  /\"n_threads\": (integer, default 1)                              "
+           "\n\n"
+
+           "    If \"dependent_runs\" is false, the number of conditions to\n"
+           "    run concurrently, each on its own thread. Results are written\n"
+           "    to the results summary in conditions order. Not supported\n"
+           "    with enumeration.\n\n"
+
+           "  /\"seed\": (integer, optional)                                   "
+           "\n\n"
+
+           "    Random number generator seed. If \"dependent_runs\" is false,\n"
+           "    calculation i, in conditions list order, is seeded with\n"
+           "    seed + i, so results do not depend on \"n_threads\". If\n"
+           "    \"dependent_runs\" is true, the first calculation run is\n"
+           "    seeded with seed + i and later calculations continue with\n"
+           "    the same random number generator. For replica exchange,\n"
+           "    replica i is seeded with seed + i. If not given, seeds are\n"
+           "    chosen randomly.\n\n"
+
+           "  /\"correlations_n_threads\": (integer, default 1)                 "
+           "\n\n"
+
+           "    Number of threads used to calculate the correlations of the\n"
+           "    entire supercell, as is done at the beginning of each\n"
+           "    calculation. Results do not depend on the number of threads.\n"
+           "    Useful for very large supercells.\n\n"
+
+           "  /\"rejection_free\": (boolean, default false)                    "
+           "\n\n"
+
+           "    If true, use rejection-free (n-fold way) steps. The\n"
+           "    probability that each possible event is proposed and accepted\n"
+           "    is stored and updated as events occur. Accepted events are\n"
+           "    selected directly, and the steps in which all proposals would\n"
+           "    have been rejected are skipped, so results are equivalent to\n"
+           "    Metropolis Monte Carlo, with each state sampled in proportion\n"
+           "    to its residence time. Useful at low temperature, where most\n"
+           "    proposals are rejected. Only supported for\n"
+           "    \"grand_canonical\" calculations. Not supported with\n"
+           "    \"corr_matching_pot\", \"random_alloy_corr_matching_pot\", or\n"
+           "    quadratic composition or order parameter potentials.\n\n"
+
+           "  /\"checkerboard\": (boolean, default false)                      "
+           "\n\n"
+
+           "    If true, use checkerboard steps. Sites with variable\n"
+           "    occupation are colored by sublattice and by unit cell\n"
+           "    coordinates modulo a period that is chosen so that no\n"
+           "    cluster includes two sites of the same color. Each step\n"
+           "    chooses a color at random and proposes a change of the\n"
+           "    occupant of every site of that color (\"grand_canonical\"),\n"
+           "    or exchanges of the occupants of random pairs of sites of\n"
+           "    that color (\"canonical\"). The proposals do not affect each\n"
+           "    other, so they are evaluated concurrently and each is\n"
+           "    accepted or rejected with the Metropolis criterion,\n"
+           "    preserving detailed balance. A step counts as the number of\n"
+           "    proposals it makes. For \"canonical\" calculations, some\n"
+           "    steps instead make one proposal at a time, as without\n"
+           "    checkerboard steps, so that occupants are also exchanged\n"
+           "    between sites of different colors.\n"
+           "    The speedup relative to one proposal at a time is measured\n"
+           "    during the first of any \"equilibration_passes_first_run\"\n"
+           "    or \"equilibration_passes_each_run\", using those passes'\n"
+           "    steps, and written to the log. Requires the rows of the\n"
+           "    supercell transformation matrix to be divisible\n"
+           "    by the period. Not supported with \"rejection_free\",\n"
+           "    \"corr_matching_pot\", \"random_alloy_corr_matching_pot\",\n"
+           "    or composition or order parameter potentials other than\n"
+           "    \"param_chem_pot\". Useful for very large supercells.\n\n"
+
+           "  /\"checkerboard_n_threads\": (integer, default 1)                 "
+           "\n\n"
+
+           "    Number of threads used to evaluate checkerboard steps. Each\n"
+           "    thread uses its own random number generator, seeded from the\n"
+           "    calculation's, so results depend on the number of threads.\n\n"
+
+           "  /\"replica_exchange\": (JSON object, optional)                   "
+           "\n\n"
+
+           "    If present, run all conditions simultaneously as replicas, \n"
+           "    using up to \"n_threads\" threads, and periodically attempt to\n"
+           "    exchange the DoF of replicas at neighboring conditions (in\n"
+           "    conditions list order). Conditions should form a temperature\n"
+           "    ladder. Swap acceptance rates and round trip times are written\n"
+           "    to \"replica_exchange.json\". Ignores \"dependent_runs\".\n"
+           "    Not supported with enumeration.\n\n"
+
+           "    /\"swap_period\": (integer, default 1)\n"
+           "      Number of passes between exchange attempts.\n\n"
+
            "  /\"initial_conditions\",\n"
            "  /\"incremental_conditions\", \n"
            "  /\"final_conditions\": (JSON object, optional)                   "
@@ -3,6 +3,7 @@
 #include <iostream>
 #include <string>
 
+#include "casm/app/ClexDescription.hh"
 #include "casm/app/casm_functions.hh"
 #include "casm/casm_io/container/json_io.hh"
 #include "casm/clex/PrimClex_impl.hh"
@@ -10,12 +11,16 @@
 #include "casm/global/definitions.hh"
 #include "casm/monte_carlo/MonteDriver.hh"
 #include "casm/monte_carlo/MonteIO.hh"
+#include "casm/monte_carlo/ReplicaExchangeDriver.hh"
 #include "casm/monte_carlo/canonical/Canonical.hh"
 #include "casm/monte_carlo/canonical/CanonicalIO.hh"
 #include "casm/monte_carlo/canonical/CanonicalSettings.hh"
 #include "casm/monte_carlo/grand_canonical/GrandCanonical.hh"
 #include "casm/monte_carlo/grand_canonical/GrandCanonicalIO.hh"
 #include "casm/monte_carlo/grand_canonical/GrandCanonicalSettings.hh"
+#include "casm/monte_carlo/kinetic/KineticMonteCarlo.hh"
+#include "casm/monte_carlo/kinetic/KineticMonteCarloIO.hh"
+#include "casm/monte_carlo/kinetic/KineticSettings.hh"
 
 namespace CASM {
 
@@ -120,6 +125,11 @@ int _run_Canonical(PrimClex &primclex,
                    const CommandArgs &args,
                    const Completer::MonteOption &monte_opt);
 
+int _run_Kinetic(PrimClex &primclex,
+                 const Monte::MonteSettings &monte_settings,
+                 const CommandArgs &args,
+                 const Completer::MonteOption &monte_opt);
+
 int monte_command(const CommandArgs &args) {
   fs::path settings_path;
   std::string verbosity_str;
@@ -294,6 +304,12 @@ int _driver(PrimClex &primclex, const CommandArgs &args,
   try {
     typename MCType::SettingsType mc_settings(primclex,
                                               monte_opt.settings_path());
+    if (mc_settings.is_replica_exchange()) {
+      Monte::ReplicaExchangeDriver<MCType> driver(primclex, mc_settings, log(),
+                                                  err_log());
+      driver.run();
+      return 0;
+    }
     Monte::MonteDriver<MCType> driver(primclex, mc_settings, log(), err_log());
     driver.run();
     return 0;
@@ -438,7 +454,9 @@ int _run_Canonical(PrimClex &primclex,
   typedef Monte::Canonical MCType;
   const po::variables_map &vm = monte_opt.vm();
 
-  if (vm.count("initial-POSCAR")) {
+  if (monte_settings.method() == Monte::METHOD::Kinetic) {
+    return _run_Kinetic(primclex, monte_settings, args, monte_opt);
+  } else if (vm.count("initial-POSCAR")) {
     return _initial_POSCAR<MCType>(primclex, args, monte_opt);
   } else if (vm.count("final-POSCAR")) {
     return _final_POSCAR<MCType>(primclex, args, monte_opt);
@@ -452,4 +470,103 @@ int _run_Canonical(PrimClex &primclex,
     return ERR_INVALID_INPUT_FILE;
   }
 }
+
+int _run_Kinetic(PrimClex &primclex,
+                 const Monte::MonteSettings &monte_settings,
+                 const CommandArgs &args,
+                 const Completer::MonteOption &monte_opt) {
+  const po::variables_map &vm = monte_opt.vm();
+
+  if (vm.count("initial-POSCAR") || vm.count("final-POSCAR") ||
+      vm.count("traj-POSCAR")) {
+    err_log() << "ERROR: --initial-POSCAR, --final-POSCAR, and --traj-POSCAR "
+                 "are not supported for kinetic Monte Carlo.\n\n";
+    return ERR_INVALID_ARG;
+  }
+
+  try {
+    Monte::KineticSettings kmc_settings(primclex, monte_opt.settings_path());
+
+    Monte::MonteCarloDirectoryStructure dir(kmc_settings.output_directory());
+    if (kmc_settings.write_csv()) {
+      if (fs::exists(dir.results_csv())) {
+        err_log() << "Existing file at: " << dir.results_csv() << std::endl;
+        err_log() << "  Exiting..." << std::endl;
+        return ERR_EXISTING_FILE;
+      }
+    }
+    if (kmc_settings.write_json()) {
+      if (fs::exists(dir.results_json())) {
+        err_log() << "Existing file at: " << dir.results_json() << std::endl;
+        err_log() << "  Exiting..." << std::endl;
+        return ERR_EXISTING_FILE;
+      }
+    }
+
+    // the Canonical calculation makes the initial state of each run
+    Monte::Canonical mc(primclex, kmc_settings, log());
+    ClexDescription formation_energy_desc =
+        kmc_settings.formation_energy(primclex);
+    ClexDescription kra_desc = kmc_settings.kra(primclex);
+
+    std::vector<Monte::CanonicalConditions> conditions_list;
+    if (kmc_settings.drive_mode() == Monte::DRIVE_MODE::INCREMENTAL) {
+      auto init = kmc_settings.initial_conditions(mc);
+      auto incr = kmc_settings.incremental_conditions(mc);
+      auto final = kmc_settings.final_conditions(mc);
+      int num_conditions = (final - init) / incr + 1;
+
+      auto cond = init;
+      for (int index = 0; index < num_conditions; ++index) {
+        conditions_list.push_back(cond);
+        cond += incr;
+      }
+    } else {
+      conditions_list = kmc_settings.custom_conditions(mc);
+    }
+
+    std::unique_ptr<Monte::KineticMonteCarlo> kmc;
+    for (Index index = 0; index < conditions_list.size(); ++index) {
+      const Monte::CanonicalConditions &cond = conditions_list[index];
+      if (kmc_settings.dependent_runs() && kmc) {
+        mc.set_state(cond, kmc->config().configdof(),
+                     "Using final state of the previous run");
+      } else {
+        mc.set_state(cond, kmc_settings);
+      }
+
+      kmc = notstd::make_unique<Monte::KineticMonteCarlo>(
+          primclex, mc.config(), formation_energy_desc, kra_desc,
+          cond.temperature(), kmc_settings.attempt_frequency());
+      if (kmc_settings.is_vacancy_mediated()) {
+        kmc->set_vacancy_mediated(kmc_settings.vacancy_mediated());
+      }
+      if (kmc_settings.is_seed()) {
+        kmc->mtrand().seed(kmc_settings.seed() + index);
+      }
+
+      log().custom("Kinetic Monte Carlo");
+      log() << "events: " << kmc->events().size() << "\n";
+      log() << "vacancy_mediated: " << std::boolalpha
+            << kmc->vacancy_mediated() << "\n";
+      log() << "equilibration steps: " << kmc_settings.equilibration_steps()
+            << "\n";
+      kmc->run(kmc_settings.equilibration_steps());
+      kmc->reset_statistics();
+      log() << "steps: " << kmc_settings.steps() << "\n" << std::endl;
+      kmc->run(kmc_settings.steps());
+
+      log().write("Output files");
+      write_kinetic_results(kmc_settings, *kmc, cond, log());
+      log() << std::endl;
+    }
+
+    return 0;
+
+  } catch (std::exception &e) {
+    err_log() << "ERROR running kinetic Monte Carlo.\n\n";
+    err_log() << e.what() << std::endl;
+    return 1;
+  }
+}
 }  // namespace CASM
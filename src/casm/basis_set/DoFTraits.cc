@@ -122,22 +122,22 @@ std::string Traits::clexulator_point_prepare_string(
     std::string const &indent) const {
   std::stringstream ss;
   if (val_traits().global()) {
-    ss << indent << "  if(m_params.eval_mode(m_" << name()
+    ss << indent << "  if(_params(_context).eval_mode(m_" << name()
        << "_var_param_key) != ParamPack::READ) {\n";
     for (Index a = 0; a < _prim.structure().global_dof(name()).dim(); ++a) {
-      ss << indent << "    ParamPack::Val<Scalar>::set(m_params, m_" << name()
-         << "_var_param_key, " << a << ", eval_" << name() << "_var(" << a
-         << "));\n";
+      ss << indent << "    ParamPack::Val<Scalar>::set(_params(_context), m_"
+         << name() << "_var_param_key, " << a << ", eval_" << name()
+         << "_var(_context, " << a << "));\n";
     }
     ss << indent << "  }\n";
 
     if (requires_site_basis()) {
-      ss << indent << "  if(m_params.eval_mode(m_" << site_basis_name()
+      ss << indent << "  if(_params(_context).eval_mode(m_" << site_basis_name()
          << "_param_key) != ParamPack::READ) {\n";
       for (Index f = 0; f < site_bases[0].size(); f++) {
-        ss << indent << "    ParamPack::Val<Scalar>::set(m_params, m_"
+        ss << indent << "    ParamPack::Val<Scalar>::set(_params(_context), m_"
            << site_basis_name() << "_param_key, " << f << ", eval_"
-           << site_basis_name() << "_" << f << "<Scalar>());\n";
+           << site_basis_name() << "_" << f << "<Scalar>(_context));\n";
       }
       ss << indent << "  }\n";
     }
@@ -163,29 +163,32 @@ std::string Traits::clexulator_point_prepare_string(
           if (!_prim.basis()[b].has_dof(name())) continue;
 
           for (Index a = 0; a < _prim.basis()[b].dof(name()).dim(); ++a) {
-            ssvar << indent << "    ParamPack::Val<Scalar>::set(m_params, m_"
+            ssvar << indent
+                  << "    ParamPack::Val<Scalar>::set(_params(_context), m_"
                   << name() << "_var_param_key, " << a << ", " << n << ", eval_"
-                  << name() << "_var_" << b << "_" << a << "(" << n << "));\n";
+                  << name() << "_var_" << b << "_" << a << "(_context, " << n
+                  << "));\n";
           }
 
           if (requires_site_basis()) {
             for (Index f = 0; f < site_bases[b].size(); f++) {
-              ssfunc << indent << "    ParamPack::Val<Scalar>::set(m_params, m_"
+              ssfunc << indent
+                     << "    ParamPack::Val<Scalar>::set(_params(_context), m_"
                      << site_basis_name() << "_param_key, " << f << ", " << n
                      << ", eval_" << site_basis_name() << '_' << b << '_' << f
-                     << "<Scalar>(" << n << "));\n";
+                     << "<Scalar>(_context, " << n << "));\n";
             }
           }
         }
       }
 
-      ss << indent << "  if(m_params.eval_mode(m_" << name()
+      ss << indent << "  if(_params(_context).eval_mode(m_" << name()
          << "_var_param_key) != ParamPack::READ) {\n"
          << ssvar.str() << indent << "  }\n";
 
       if (requires_site_basis()) {
-        ss << indent << "  if(m_params.eval_mode(m_" << site_basis_name()
-           << "_param_key) != ParamPack::READ) {\n"
+        ss << indent << "  if(_params(_context).eval_mode(m_"
+           << site_basis_name() << "_param_key) != ParamPack::READ) {\n"
            << ssfunc.str() << indent << "  }\n";
       }
       ss << indent << "  break;\n";
@@ -205,22 +208,22 @@ std::string Traits::clexulator_global_prepare_string(
   std::stringstream ss;
 
   if (val_traits().global()) {
-    ss << indent << "  if(m_params.eval_mode(m_" << name()
+    ss << indent << "  if(_params(_context).eval_mode(m_" << name()
        << "_var_param_key) != ParamPack::READ) {\n";
     for (Index a = 0; a < _prim.structure().global_dof(name()).dim(); ++a) {
-      ss << indent << "    ParamPack::Val<Scalar>::set(m_params, m_" << name()
-         << "_var_param_key, " << a << ", eval_" << name() << "_var(" << a
-         << "));\n";
+      ss << indent << "    ParamPack::Val<Scalar>::set(_params(_context), m_"
+         << name() << "_var_param_key, " << a << ", eval_" << name()
+         << "_var(_context, " << a << "));\n";
     }
     ss << indent << "  }\n";
 
     if (requires_site_basis()) {
-      ss << indent << "  if(m_params.eval_mode(m_" << site_basis_name()
+      ss << indent << "  if(_params(_context).eval_mode(m_" << site_basis_name()
          << "_param_key) != ParamPack::READ) {\n";
       for (Index f = 0; f < site_bases[0].size(); f++) {
-        ss << indent << "    ParamPack::Val<Scalar>::set(m_params, m_"
+        ss << indent << "    ParamPack::Val<Scalar>::set(_params(_context), m_"
            << site_basis_name() << "_param_key, " << f << ", eval_"
-           << site_basis_name() << "_" << f << "<Scalar>());\n";
+           << site_basis_name() << "_" << f << "<Scalar>(_context));\n";
       }
       ss << indent << "  }\n";
     }
@@ -238,26 +241,29 @@ std::string Traits::clexulator_global_prepare_string(
         if (!_prim.basis()[b].has_dof(name())) continue;
 
         for (Index a = 0; a < _prim.basis()[b].dof(name()).dim(); ++a) {
-          ssvar << indent << "    ParamPack::Val<Scalar>::set(m_params, m_"
+          ssvar << indent
+                << "    ParamPack::Val<Scalar>::set(_params(_context), m_"
                 << name() << "_var_param_key, " << a << ", " << n << ", eval_"
-                << name() << "_var_" << b << "_" << a << "(" << n << "));\n";
+                << name() << "_var_" << b << "_" << a << "(_context, " << n
+                << "));\n";
         }
 
         if (requires_site_basis()) {
           for (Index f = 0; f < site_bases[b].size(); f++) {
-            ssfunc << indent << "    ParamPack::Val<Scalar>::set(m_params, m_"
+            ssfunc << indent
+                   << "    ParamPack::Val<Scalar>::set(_params(_context), m_"
                    << site_basis_name() << "_param_key, " << f << ", " << n
                    << ", eval_" << site_basis_name() << "_" << b << "_" << f
-                   << "<Scalar>(" << n << "));\n";
+                   << "<Scalar>(_context, " << n << "));\n";
           }
         }
       }
     }
-    ss << indent << "  if(m_params.eval_mode(m_" << name()
+    ss << indent << "  if(_params(_context).eval_mode(m_" << name()
        << "_var_param_key) != ParamPack::READ) {\n"
        << ssvar.str() << indent << "  }\n";
     if (requires_site_basis()) {
-      ss << indent << "  if(m_params.eval_mode(m_" << site_basis_name()
+      ss << indent << "  if(_params(_context).eval_mode(m_" << site_basis_name()
          << "_param_key) != ParamPack::READ) {\n"
          << ssfunc.str() << indent << "  }\n";
     }
@@ -337,16 +343,16 @@ std::string Traits::clexulator_private_method_declarations_string(
     // std::cout << "**GLOBAL PRIVATE METHOD DECLARATIONS FOR DOF " << name() <<
     // "\n";
     stream << indent << "double eval_" << name()
-           << "_var(const int &ind) const {\n"
-           << indent << "  return (*(m_global_dof_ptrs[m_" << name()
+           << "_var(EvaluationContext &_context, const int &ind) const {\n"
+           << indent << "  return (*(_global_dof_ptrs(_context)[m_" << name()
            << "_var_param_key.index()]))[ind];\n"
            << indent << "}\n\n";
 
     stream << indent << "template<typename Scalar>\n"
            << indent << "Scalar const &" << name()
-           << "_var(const int &ind) const {\n"
+           << "_var(EvaluationContext &_context, const int &ind) const {\n"
            << indent << "  return "
-           << "ParamPack::Val<Scalar>::get(m_params, m_" << name()
+           << "ParamPack::Val<Scalar>::get(_params(_context), m_" << name()
            << "_var_param_key, ind);\n"
            << indent << "}\n";
 
@@ -358,7 +364,7 @@ std::string Traits::clexulator_private_method_declarations_string(
       for (Index f = 0; f < site_basis.size(); f++) {
         stream << indent << "template<typename Scalar>\n"
                << indent << "Scalar eval_" << site_basis_name() << '_' << f
-               << "() const {\n"
+               << "(EvaluationContext &_context) const {\n"
                << indent << "  return " << site_basis[f]->formula() << ";\n"
                << indent << "}\n\n";
       }
@@ -393,9 +399,12 @@ std::string Traits::clexulator_private_method_declarations_string(
       max_na = max(max_na, _prim.basis()[nb].dof(name()).dim());
       for (Index a = 0; a < _prim.basis()[nb].dof(name()).dim(); ++a) {
         stream << indent << "double eval_" << name() << "_var_" << nb << '_'
-               << a << "(const int &nlist_ind) const {\n"
-               << indent << "  return m_local_dof_ptrs[m_" << name()
-               << "_var_param_key.index()]->col(_l(nlist_ind))[" << a << "];\n"
+               << a
+               << "(EvaluationContext &_context, const int &nlist_ind) const "
+                  "{\n"
+               << indent << "  return _local_dof_ptrs(_context)[m_" << name()
+               << "_var_param_key.index()]->col(_l(_context, nlist_ind))[" << a
+               << "];\n"
                << indent << "}\n\n";
       }
 
@@ -408,7 +417,9 @@ std::string Traits::clexulator_private_method_declarations_string(
         for (Index f = 0; f < site_basis.size(); f++) {
           stream << indent << "template<typename Scalar>\n"
                  << indent << "Scalar eval_" << site_basis_name() << "_" << nb
-                 << '_' << f << "(const int &nlist_ind) const {\n"
+                 << '_' << f
+                 << "(EvaluationContext &_context, const int &nlist_ind) "
+                    "const {\n"
                  << indent << "  return " << site_basis[f]->formula() << ";\n"
                  << indent << "}\n\n";
         }
@@ -419,19 +430,19 @@ std::string Traits::clexulator_private_method_declarations_string(
   for (Index a = 0; a < max_na; ++a) {
     stream << indent << "template<typename Scalar>\n"
            << indent << "Scalar const &" << name() << "_var_" << a
-           << "(const int &nlist_ind) const {\n"
+           << "(EvaluationContext &_context, const int &nlist_ind) const {\n"
            << indent << "  return "
-           << "ParamPack::Val<Scalar>::get(m_params, m_" << name()
+           << "ParamPack::Val<Scalar>::get(_params(_context), m_" << name()
            << "_var_param_key, " << a << ", nlist_ind);\n"
            << indent << "}\n";
   }
   for (Index f = 0; f < max_nf; ++f) {
     stream << indent << "template<typename Scalar>\n"
            << indent << "Scalar const &" << site_basis_name() << "_" << f
-           << "(const int &nlist_ind) const {\n"
+           << "(EvaluationContext &_context, const int &nlist_ind) const {\n"
            << indent << "  return "
-           << "ParamPack::Val<Scalar>::get(m_params, m_" << site_basis_name()
-           << "_param_key, " << f << ", nlist_ind);\n"
+           << "ParamPack::Val<Scalar>::get(_params(_context), m_"
+           << site_basis_name() << "_param_key, " << f << ", nlist_ind);\n"
            << indent << "}\n";
   }
   return stream.str();
@@ -491,7 +502,7 @@ std::vector<std::unique_ptr<FunctionVisitor> > Traits::site_function_visitors(
     std::string const &nlist_specifier) const {
   std::vector<std::unique_ptr<FunctionVisitor> > result;
   result.push_back(std::unique_ptr<FunctionVisitor>(new VariableLabeler(
-      name(), "%p_var_%f<Scalar>(" + nlist_specifier + ")")));
+      name(), "%p_var_%f<Scalar>(_context, " + nlist_specifier + ")")));
   return result;
 }
 
@@ -500,15 +511,16 @@ std::vector<std::unique_ptr<FunctionVisitor> > Traits::clust_function_visitors()
   std::vector<std::unique_ptr<FunctionVisitor> > result;
   if (val_traits().global()) {
     result.push_back(std::unique_ptr<FunctionVisitor>(
-        new VariableLabeler(name(), "%p_var<Scalar>(%f)")));
+        new VariableLabeler(name(), "%p_var<Scalar>(_context, %f)")));
   } else {
     if (requires_site_basis())
       result.push_back(
           std::unique_ptr<FunctionVisitor>(new SubExpressionLabeler(
-              site_basis_name(), site_basis_name() + "_%l<Scalar>(%n)")));
+              site_basis_name(),
+              site_basis_name() + "_%l<Scalar>(_context, %n)")));
     else
       result.push_back(std::unique_ptr<FunctionVisitor>(
-          new VariableLabeler(name(), "%p_var_%f<Scalar>(%n)")));
+          new VariableLabeler(name(), "%p_var_%f<Scalar>(_context, %n)")));
   }
   return result;
 }
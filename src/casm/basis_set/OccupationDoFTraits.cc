@@ -362,15 +362,17 @@ std::string OccupationDoFTraits::clexulator_point_prepare_string(
       Index b = sublat.first;
       for (Index n : sublat.second) {
         for (Index f = 0; f < site_bases[b].size(); f++) {
-          ssfunc << indent << "    ParamPack::Val<Scalar>::set(m_params, m_"
+          ssfunc << indent
+                 << "    ParamPack::Val<Scalar>::set(_params(_context), m_"
                  << site_basis_name() << "_param_key, " << f << ", " << n
-                 << ", eval_occ_func_" << b << "_" << f << "(" << n << "));\n";
+                 << ", eval_occ_func_" << b << "_" << f << "(_context, " << n
+                 << "));\n";
         }
       }
     }
     if (ssfunc.str().size()) {
-      ss << indent << "  if(m_params.eval_mode(m_" << site_basis_name()
-         << "_param_key) != ParamPack::READ) {\n"
+      ss << indent << "  if(_params(_context).eval_mode(m_"
+         << site_basis_name() << "_param_key) != ParamPack::READ) {\n"
          << ssfunc.str() << indent << "  }\n";
     }
     ss << indent << "  break;\n";
@@ -396,14 +398,16 @@ std::string OccupationDoFTraits::clexulator_global_prepare_string(
     Index b = nbor.first;
     for (Index n : nbor.second) {
       for (Index f = 0; f < site_bases[b].size(); f++) {
-        ssfunc << indent << "  ParamPack::Val<Scalar>::set(m_params, m_"
+        ssfunc << indent
+               << "  ParamPack::Val<Scalar>::set(_params(_context), m_"
                << site_basis_name() << "_param_key, " << f << ", " << n
-               << ", eval_occ_func_" << b << "_" << f << "(" << n << "));\n";
+               << ", eval_occ_func_" << b << "_" << f << "(_context, " << n
+               << "));\n";
       }
     }
   }
   if (ssfunc.str().size()) {
-    ss << indent << "if(m_params.eval_mode(m_" << site_basis_name()
+    ss << indent << "if(_params(_context).eval_mode(m_" << site_basis_name()
        << "_param_key) != ParamPack::READ) {\n"
        << ssfunc.str() << indent << "}\n";
   }
@@ -488,17 +492,21 @@ std::string OccupationDoFTraits::clexulator_private_method_declarations_string(
           << nb << ":\n";
       for (Index f = 0; f < _site_bases[nb].size(); f++) {
         stream << indent << "double const &eval_occ_func_" << nb << '_' << f
-               << "(const int &nlist_ind) const {\n"
+               << "(EvaluationContext &_context, const int &nlist_ind) const "
+                  "{\n"
                << indent << "  return "
-               << "m_occ_func_" << nb << '_' << f << "[_occ(nlist_ind)];\n"
+               << "m_occ_func_" << nb << '_' << f
+               << "[_occ(_context, nlist_ind)];\n"
                << indent << "}\n\n"
                <<
 
             indent << "double const &occ_func_" << nb << '_' << f
-               << "(const int &nlist_ind) const {\n"
+               << "(EvaluationContext &_context, const int &nlist_ind) const "
+                  "{\n"
                << indent << "  return "
-               << "m_params.read(m_" << site_basis_name() << "_param_key, " << f
-               << ", nlist_ind);\n"
+               << "_params(_context).read(m_" << site_basis_name()
+               << "_param_key, "
+               << f << ", nlist_ind);\n"
                << indent << "}\n";
       }
       stream << '\n';
@@ -605,7 +613,7 @@ OccupationDoFTraits::site_function_visitors(
     std::string const &nlist_specifier) const {
   std::vector<std::unique_ptr<FunctionVisitor>> result;
   result.push_back(std::unique_ptr<FunctionVisitor>(
-      new OccFuncLabeler("occ_func_%b_%f(" + nlist_specifier + ")")));
+      new OccFuncLabeler("occ_func_%b_%f(_context, " + nlist_specifier + ")")));
   return result;
 }
 
@@ -613,7 +621,7 @@ std::vector<std::unique_ptr<FunctionVisitor>>
 OccupationDoFTraits::clust_function_visitors() const {
   std::vector<std::unique_ptr<FunctionVisitor>> result;
   result.push_back(std::unique_ptr<FunctionVisitor>(
-      new OccFuncLabeler("occ_func_%b_%f(%n)")));
+      new OccFuncLabeler("occ_func_%b_%f(_context, %n)")));
   return result;
 }
 
@@ -3,6 +3,7 @@
 #include <boost/filesystem/fstream.hpp>
 #include <boost/filesystem/path.hpp>
 
+#include "casm/casm_io/json/jsonStream.hh"
 #include "casm/misc/CASM_math.hh"
 
 namespace CASM {
@@ -166,11 +167,21 @@ void from_json(fs::path &value, const jsonParser &json) {
 // ---- Read/Print JSON  ----------------------------------
 
 bool jsonParser::read(std::istream &stream) {
-  return json_spirit::read_stream(stream, (json_spirit::mValue &)*this);
+  try {
+    jsonBuilder builder(*this);
+    parse_json(stream, builder);
+  } catch (std::exception const &e) {
+    return false;
+  }
+  return true;
 }
 
 bool jsonParser::read(const fs::path &file_path) {
-  fs::ifstream stream(file_path);
+  // a larger buffer than the default speeds up reading large files
+  std::vector<char> buffer(1 << 20);
+  fs::ifstream stream;
+  stream.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+  stream.open(file_path);
   return read(stream);
 }
 
@@ -187,9 +198,10 @@ std::istream &operator>>(std::istream &stream, jsonParser &json) {
 /// Writes json to stream
 void jsonParser::print(std::ostream &stream, unsigned int indent,
                        unsigned int prec) const {
-  json_spirit::write_stream((json_spirit::mValue &)*this, stream, indent, prec,
-                            json_spirit::pretty_print | json_spirit::raw_utf8 |
-                                json_spirit::single_line_arrays);
+  jsonStreamWriter writer(stream, indent, prec,
+                          json_spirit::pretty_print | json_spirit::raw_utf8 |
+                              json_spirit::single_line_arrays);
+  writer.value(*this);
 };
 
 /// Write json to file
@@ -0,0 +1,850 @@
+#include "casm/casm_io/json/jsonStream.hh"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cwctype>
+#include <sstream>
+#include <stdexcept>
+
+#include "casm/misc/cloneable_ptr.hh"
+
+namespace CASM {
+
+namespace {
+
+/// \brief Reads JSON from a std::streambuf, passing events to a handler
+///
+/// Reads directly from the stream buffer, consuming only the characters of
+/// the value that is read. Like json_spirit, accepts "//" and "/* */"
+/// comments as whitespace, "\xHH" string escapes, and reals with a leading
+/// or trailing decimal point, and ignores any content following the value.
+class jsonStreamParser {
+ public:
+  jsonStreamParser(std::istream &stream, jsonEventHandler &handler)
+      : m_buf(stream.rdbuf()), m_handler(handler), m_line(1), m_col(0) {
+    if (!m_buf) {
+      throw std::runtime_error("Error parsing JSON: invalid stream");
+    }
+  }
+
+  void parse() {
+    // for each open object or array, its closing character
+    std::vector<char> stack;
+
+    while (true) {
+      _skip_ws();
+      int c = _peek();
+      if (c == '{') {
+        _get();
+        m_handler.on_begin_object();
+        _skip_ws();
+        if (_peek() == '}') {
+          _get();
+          m_handler.on_end_object();
+        } else {
+          stack.push_back('}');
+          _read_key();
+          continue;
+        }
+      } else if (c == '[') {
+        _get();
+        m_handler.on_begin_array();
+        _skip_ws();
+        if (_peek() == ']') {
+          _get();
+          m_handler.on_end_array();
+        } else {
+          stack.push_back(']');
+          continue;
+        }
+      } else {
+        _read_scalar();
+      }
+
+      // a value is complete: read separators and closing characters
+      while (true) {
+        if (stack.empty()) {
+          return;
+        }
+        _skip_ws();
+        c = _get();
+        if (c == ',') {
+          if (stack.back() == '}') {
+            _read_key();
+          }
+          break;
+        }
+        if (c != stack.back()) {
+          _error(std::string("expected ',' or '") + stack.back() + "'");
+        }
+        stack.pop_back();
+        if (c == '}') {
+          m_handler.on_end_object();
+        } else {
+          m_handler.on_end_array();
+        }
+      }
+    }
+  }
+
+ private:
+  typedef std::char_traits<char> traits;
+
+  int _peek() { return m_buf->sgetc(); }
+
+  int _get() {
+    int c = m_buf->sbumpc();
+    if (c == '\n') {
+      ++m_line;
+      m_col = 0;
+    } else {
+      ++m_col;
+    }
+    return c;
+  }
+
+  void _expect(char expected) {
+    if (_get() != expected) {
+      _error(std::string("expected '") + expected + "'");
+    }
+  }
+
+  [[noreturn]] void _error(std::string const &what) {
+    std::stringstream msg;
+    msg << "Error parsing JSON at line " << m_line << ", column " << m_col
+        << ": " << what;
+    throw std::runtime_error(msg.str());
+  }
+
+  /// \brief Skip whitespace and comments
+  void _skip_ws() {
+    while (true) {
+      int c = _peek();
+      if (c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\f' ||
+          c == '\v') {
+        _get();
+      } else if (c == '/') {
+        _get();
+        c = _get();
+        if (c == '/') {
+          while ((c = _peek()) != traits::eof() && c != '\n') {
+            _get();
+          }
+        } else if (c == '*') {
+          int prev = 0;
+          while ((c = _get()) != traits::eof() && !(prev == '*' && c == '/')) {
+            prev = c;
+          }
+          if (c == traits::eof()) {
+            _error("unterminated comment");
+          }
+        } else {
+          _error("unexpected '/'");
+        }
+      } else {
+        return;
+      }
+    }
+  }
+
+  /// \brief Read an object member name and the following ':'
+  void _read_key() {
+    _skip_ws();
+    _expect('"');
+    _read_string(m_str);
+    m_handler.on_key(m_str);
+    _skip_ws();
+    _expect(':');
+  }
+
+  void _read_scalar() {
+    int c = _peek();
+    if (c == '"') {
+      _get();
+      _read_string(m_str);
+      m_handler.on_string(m_str);
+    } else if (c == 't') {
+      _read_literal("true");
+      m_handler.on_bool(true);
+    } else if (c == 'f') {
+      _read_literal("false");
+      m_handler.on_bool(false);
+    } else if (c == 'n') {
+      _read_literal("null");
+      m_handler.on_null();
+    } else if (c == '-' || c == '+' || c == '.' || (c >= '0' && c <= '9')) {
+      _read_number();
+    } else if (c == traits::eof()) {
+      _error("unexpected end of input");
+    } else {
+      _error(std::string("unexpected character '") + char(c) + "'");
+    }
+  }
+
+  void _read_literal(char const *literal) {
+    for (char const *p = literal; *p; ++p) {
+      if (_get() != *p) {
+        _error(std::string("expected '") + literal + "'");
+      }
+    }
+  }
+
+  void _read_number() {
+    m_str.clear();
+    bool is_real = false;
+    int c;
+    while ((c = _peek()) != traits::eof()) {
+      if (c == '.' || c == 'e' || c == 'E') {
+        is_real = true;
+      } else if (!(c == '-' || c == '+' || (c >= '0' && c <= '9'))) {
+        break;
+      }
+      m_str.push_back(char(_get()));
+    }
+
+    char const *begin = m_str.c_str();
+    char const *end = begin + m_str.size();
+    char *stop = nullptr;
+    if (!is_real) {
+      errno = 0;
+      long long i = std::strtoll(begin, &stop, 10);
+      if (stop == end && errno == 0) {
+        m_handler.on_int(boost::int64_t(i));
+        return;
+      }
+      if (stop == end && m_str[0] != '-') {
+        errno = 0;
+        unsigned long long ui = std::strtoull(begin, &stop, 10);
+        if (stop == end && errno == 0) {
+          m_handler.on_uint(boost::uint64_t(ui));
+          return;
+        }
+      }
+    }
+    double d = std::strtod(begin, &stop);
+    if (stop != end || m_str.empty()) {
+      _error("invalid number '" + m_str + "'");
+    }
+    m_handler.on_real(d);
+  }
+
+  int _read_hex(int n_digits) {
+    int value = 0;
+    for (int i = 0; i < n_digits; ++i) {
+      int c = _get();
+      value <<= 4;
+      if (c >= '0' && c <= '9') {
+        value += c - '0';
+      } else if (c >= 'a' && c <= 'f') {
+        value += c - 'a' + 10;
+      } else if (c >= 'A' && c <= 'F') {
+        value += c - 'A' + 10;
+      } else {
+        _error("invalid hex digit in string escape");
+      }
+    }
+    return value;
+  }
+
+  /// \brief Read a string, after the opening '"'
+  void _read_string(std::string &str) {
+    str.clear();
+    while (true) {
+      int c = _get();
+      if (c == '"') {
+        return;
+      }
+      if (c == traits::eof()) {
+        _error("unterminated string");
+      }
+      if (c != '\\') {
+        str.push_back(char(c));
+        continue;
+      }
+      c = _get();
+      switch (c) {
+        case 't':
+          str.push_back('\t');
+          break;
+        case 'b':
+          str.push_back('\b');
+          break;
+        case 'f':
+          str.push_back('\f');
+          break;
+        case 'n':
+          str.push_back('\n');
+          break;
+        case 'r':
+          str.push_back('\r');
+          break;
+        case '\\':
+          str.push_back('\\');
+          break;
+        case '/':
+          str.push_back('/');
+          break;
+        case '"':
+          str.push_back('"');
+          break;
+        case 'x':
+          str.push_back(char(_read_hex(2)));
+          break;
+        case 'u':
+          _append_utf8(str, _read_hex(4));
+          break;
+        default:
+          if (c == traits::eof()) {
+            _error("unterminated string");
+          }
+          // json_spirit drops unknown escapes
+          break;
+      }
+    }
+  }
+
+  static void _append_utf8(std::string &str, int code) {
+    if (code < 0x80) {
+      str.push_back(char(code));
+    } else if (code < 0x800) {
+      str.push_back(char(0xC0 | (code >> 6)));
+      str.push_back(char(0x80 | (code & 0x3F)));
+    } else {
+      str.push_back(char(0xE0 | (code >> 12)));
+      str.push_back(char(0x80 | ((code >> 6) & 0x3F)));
+      str.push_back(char(0x80 | (code & 0x3F)));
+    }
+  }
+
+  std::streambuf *m_buf;
+  jsonEventHandler &m_handler;
+  Index m_line;
+  Index m_col;
+
+  // holds the current string or number
+  std::string m_str;
+};
+
+}  // namespace
+
+/// \brief Read one JSON value from a stream, passing events to a handler
+///
+/// - Characters are read from the stream until the end of the first JSON
+///   value. Any following content is not read.
+/// - Throws std::runtime_error, with the line and column, if the stream does
+///   not contain a valid JSON value
+void parse_json(std::istream &stream, jsonEventHandler &handler) {
+  jsonStreamParser(stream, handler).parse();
+}
+
+// --- jsonBuilder -------------------------------------
+
+jsonBuilder::jsonBuilder(jsonParser &json) : m_json(json), m_started(false) {}
+
+json_spirit::mValue &jsonBuilder::_next_value() {
+  if (m_stack.empty()) {
+    if (m_started) {
+      throw std::runtime_error(
+          "Error in jsonBuilder: received more than one value");
+    }
+    m_started = true;
+    return m_json;
+  }
+  json_spirit::mValue &top = *m_stack.back();
+  if (top.type() == json_spirit::array_type) {
+    json_spirit::mArray &array = top.get_array();
+    array.emplace_back();
+    return array.back();
+  }
+  return top.get_obj()[m_key];
+}
+
+void jsonBuilder::on_null() { _next_value() = json_spirit::mValue(); }
+
+void jsonBuilder::on_bool(bool value) {
+  _next_value() = json_spirit::mValue(value);
+}
+
+void jsonBuilder::on_int(boost::int64_t value) {
+  _next_value() = json_spirit::mValue(value);
+}
+
+void jsonBuilder::on_uint(boost::uint64_t value) {
+  _next_value() = json_spirit::mValue(value);
+}
+
+void jsonBuilder::on_real(double value) {
+  _next_value() = json_spirit::mValue(value);
+}
+
+void jsonBuilder::on_string(std::string &value) {
+  json_spirit::mValue &next = _next_value();
+  next = json_spirit::mValue(std::string());
+  // json_spirit::mValue has no move constructor: swap the contents in
+  const_cast<std::string &>(next.get_str()).swap(value);
+}
+
+void jsonBuilder::on_begin_object() {
+  json_spirit::mValue &next = _next_value();
+  next = json_spirit::mValue(json_spirit::mObject());
+  m_stack.push_back(&next);
+}
+
+void jsonBuilder::on_key(std::string &name) { m_key.swap(name); }
+
+void jsonBuilder::on_end_object() { m_stack.pop_back(); }
+
+void jsonBuilder::on_begin_array() {
+  json_spirit::mValue &next = _next_value();
+  next = json_spirit::mValue(json_spirit::mArray());
+  m_stack.push_back(&next);
+}
+
+void jsonBuilder::on_end_array() { m_stack.pop_back(); }
+
+// --- jsonSelectiveReader -------------------------------------
+
+jsonSelectiveReader::jsonSelectiveReader(SelectFunction select, ValueFunction f)
+    : m_select(select), m_f(f), m_depth(0) {}
+
+bool jsonSelectiveReader::_begin_value() {
+  if (!m_count.empty() && m_count.back() >= 0) {
+    m_path.back() = std::to_string(m_count.back()++);
+  }
+  if (m_select(m_path)) {
+    m_json = jsonParser();
+    m_builder = notstd::make_unique<jsonBuilder>(m_json);
+    return true;
+  }
+  return false;
+}
+
+void jsonSelectiveReader::_finish_value() {
+  m_builder.reset();
+  m_f(m_path, m_json);
+  m_json = jsonParser();
+}
+
+void jsonSelectiveReader::on_null() {
+  if (m_builder) {
+    m_builder->on_null();
+  } else if (_begin_value()) {
+    m_builder->on_null();
+    _finish_value();
+  }
+}
+
+void jsonSelectiveReader::on_bool(bool value) {
+  if (m_builder) {
+    m_builder->on_bool(value);
+  } else if (_begin_value()) {
+    m_builder->on_bool(value);
+    _finish_value();
+  }
+}
+
+void jsonSelectiveReader::on_int(boost::int64_t value) {
+  if (m_builder) {
+    m_builder->on_int(value);
+  } else if (_begin_value()) {
+    m_builder->on_int(value);
+    _finish_value();
+  }
+}
+
+void jsonSelectiveReader::on_uint(boost::uint64_t value) {
+  if (m_builder) {
+    m_builder->on_uint(value);
+  } else if (_begin_value()) {
+    m_builder->on_uint(value);
+    _finish_value();
+  }
+}
+
+void jsonSelectiveReader::on_real(double value) {
+  if (m_builder) {
+    m_builder->on_real(value);
+  } else if (_begin_value()) {
+    m_builder->on_real(value);
+    _finish_value();
+  }
+}
+
+void jsonSelectiveReader::on_string(std::string &value) {
+  if (m_builder) {
+    m_builder->on_string(value);
+  } else if (_begin_value()) {
+    m_builder->on_string(value);
+    _finish_value();
+  }
+}
+
+void jsonSelectiveReader::on_begin_object() {
+  if (m_builder) {
+    ++m_depth;
+    m_builder->on_begin_object();
+  } else if (_begin_value()) {
+    m_depth = 1;
+    m_builder->on_begin_object();
+  } else {
+    m_count.push_back(-1);
+    m_path.emplace_back();
+  }
+}
+
+void jsonSelectiveReader::on_key(std::string &name) {
+  if (m_builder) {
+    m_builder->on_key(name);
+  } else {
+    m_path.back().swap(name);
+  }
+}
+
+void jsonSelectiveReader::on_end_object() {
+  if (m_builder) {
+    m_builder->on_end_object();
+    if (--m_depth == 0) {
+      _finish_value();
+    }
+  } else {
+    m_count.pop_back();
+    m_path.pop_back();
+  }
+}
+
+void jsonSelectiveReader::on_begin_array() {
+  if (m_builder) {
+    ++m_depth;
+    m_builder->on_begin_array();
+  } else if (_begin_value()) {
+    m_depth = 1;
+    m_builder->on_begin_array();
+  } else {
+    m_count.push_back(0);
+    m_path.emplace_back();
+  }
+}
+
+void jsonSelectiveReader::on_end_array() {
+  if (m_builder) {
+    m_builder->on_end_array();
+    if (--m_depth == 0) {
+      _finish_value();
+    }
+  } else {
+    m_count.pop_back();
+    m_path.pop_back();
+  }
+}
+
+// --- jsonStreamWriter -------------------------------------
+
+namespace {
+
+/// Size at which jsonStreamWriter writes its buffer to the stream
+const std::size_t json_stream_writer_buffer_size = 1 << 16;
+
+}  // namespace
+
+jsonStreamWriter::jsonStreamWriter(std::ostream &stream, unsigned int indent,
+                                   unsigned int prec, unsigned int options)
+    : m_stream(stream),
+      m_indent(indent),
+      m_prec(prec),
+      m_pretty((options & json_spirit::pretty_print) != 0 ||
+               (options & json_spirit::single_line_arrays) != 0),
+      m_raw_utf8((options & json_spirit::raw_utf8) != 0),
+      m_esc_nonascii((options & json_spirit::always_escape_nonascii) != 0),
+      m_remove_trailing_zeros(
+          (options & json_spirit::remove_trailing_zeros) != 0),
+      m_after_key(false) {
+  m_buffer.reserve(json_stream_writer_buffer_size + 1024);
+}
+
+jsonStreamWriter::~jsonStreamWriter() {
+  try {
+    flush();
+  } catch (...) {
+  }
+}
+
+void jsonStreamWriter::begin_object() {
+  _begin_item();
+  _put('{');
+  m_empty.push_back(true);
+}
+
+void jsonStreamWriter::key(std::string const &name) {
+  _begin_item();
+  _write_string(name);
+  _space();
+  _put(':');
+  _space();
+  m_after_key = true;
+}
+
+void jsonStreamWriter::end_object() { _end_container('}'); }
+
+void jsonStreamWriter::begin_array() {
+  _begin_item();
+  _put('[');
+  m_empty.push_back(true);
+}
+
+void jsonStreamWriter::end_array() { _end_container(']'); }
+
+void jsonStreamWriter::value(json_spirit::mValue const &json) {
+  _begin_item();
+  _write_value(json);
+}
+
+void jsonStreamWriter::flush() {
+  m_stream.write(m_buffer.data(), m_buffer.size());
+  m_buffer.clear();
+}
+
+/// \brief Write the separator, new line, and indentation preceding an item in
+/// a column format object or array
+void jsonStreamWriter::_begin_item() {
+  if (m_after_key) {
+    m_after_key = false;
+    return;
+  }
+  if (m_empty.empty()) {
+    return;
+  }
+  if (!m_empty.back()) {
+    _put(',');
+  }
+  m_empty.back() = false;
+  _new_line();
+  _indent();
+}
+
+void jsonStreamWriter::_end_container(char end_char) {
+  m_empty.pop_back();
+  _new_line();
+  _indent();
+  _put(end_char);
+}
+
+void jsonStreamWriter::_write_value(json_spirit::mValue const &json) {
+  switch (json.type()) {
+    case json_spirit::obj_type: {
+      json_spirit::mObject const &obj = json.get_obj();
+      if (!json.get_force_column() && json.get_force_row()) {
+        _put('{');
+        _space();
+        for (auto it = obj.begin(); it != obj.end();) {
+          _write_string(it->first);
+          _space();
+          _put(':');
+          _space();
+          _write_value(it->second);
+          if (++it != obj.end()) {
+            _put(',');
+          }
+          _space();
+        }
+        _put('}');
+      } else {
+        _put('{');
+        m_empty.push_back(true);
+        for (auto const &member : obj) {
+          _begin_item();
+          _write_string(member.first);
+          _space();
+          _put(':');
+          _space();
+          _write_value(member.second);
+        }
+        _end_container('}');
+      }
+      break;
+    }
+    case json_spirit::array_type: {
+      json_spirit::mArray const &array = json.get_array();
+      bool is_composite = false;
+      for (auto const &element : array) {
+        if (element.type() == json_spirit::obj_type ||
+            element.type() == json_spirit::array_type) {
+          is_composite = true;
+          break;
+        }
+      }
+      if (!json.get_force_column() && (json.get_force_row() || !is_composite)) {
+        _put('[');
+        _space();
+        for (auto it = array.begin(); it != array.end();) {
+          _write_value(*it);
+          if (++it != array.end()) {
+            _put(',');
+          }
+          _space();
+        }
+        _put(']');
+      } else {
+        _put('[');
+        m_empty.push_back(true);
+        for (auto const &element : array) {
+          _begin_item();
+          _write_value(element);
+        }
+        _end_container(']');
+      }
+      break;
+    }
+    case json_spirit::str_type:
+      _write_string(json.get_str());
+      break;
+    case json_spirit::bool_type:
+      _put(json.get_bool() ? "true" : "false");
+      break;
+    case json_spirit::real_type:
+      _write_real(json, json.get_real());
+      break;
+    case json_spirit::int_type: {
+      char buf[32];
+      int n = json.is_uint64()
+                  ? std::snprintf(buf, sizeof(buf), "%llu",
+                                  (unsigned long long)json.get_uint64())
+                  : std::snprintf(buf, sizeof(buf), "%lld",
+                                  (long long)json.get_int64());
+      _put(buf, n);
+      break;
+    }
+    case json_spirit::null_type:
+      _put("null");
+      break;
+  }
+}
+
+/// \brief Write a quoted string, escaped the same as json_spirit
+void jsonStreamWriter::_write_string(std::string const &str) {
+  _put('"');
+  char const *begin = str.data();
+  char const *end = begin + str.size();
+  char const *unwritten = begin;
+  for (char const *p = begin; p != end; ++p) {
+    char c = *p;
+    char const *esc = nullptr;
+    switch (c) {
+      case '"':
+        esc = "\\\"";
+        break;
+      case '\\':
+        esc = "\\\\";
+        break;
+      case '\b':
+        esc = "\\b";
+        break;
+      case '\f':
+        esc = "\\f";
+        break;
+      case '\n':
+        esc = "\\n";
+        break;
+      case '\r':
+        esc = "\\r";
+        break;
+      case '\t':
+        esc = "\\t";
+        break;
+    }
+    if (esc) {
+      _put(unwritten, p - unwritten);
+      _put(esc);
+      unwritten = p + 1;
+      continue;
+    }
+    if (m_raw_utf8) {
+      continue;
+    }
+    wint_t unsigned_c = (c >= 0) ? c : 256 + c;
+    if (!m_esc_nonascii && std::iswprint(unsigned_c)) {
+      continue;
+    }
+    _put(unwritten, p - unwritten);
+    char buf[8];
+    std::snprintf(buf, sizeof(buf), "\\u%04X", unsigned(unsigned_c));
+    _put(buf, 6);
+    unwritten = p + 1;
+  }
+  _put(unwritten, end - unwritten);
+  _put('"');
+}
+
+/// \brief Write a real number, formatted the same as json_spirit
+void jsonStreamWriter::_write_real(json_spirit::mValue const &json, double d) {
+  char const *format = json.get_scientific() ? "%.*e" : "%#.*f";
+  char buf[64];
+  std::string str;
+  int n = std::snprintf(buf, sizeof(buf), format, int(m_prec), d);
+  if (n < int(sizeof(buf))) {
+    str.assign(buf, n);
+  } else {
+    str.resize(n + 1);
+    std::snprintf(&str[0], str.size(), format, int(m_prec), d);
+    str.resize(n);
+  }
+
+  if (!json.get_scientific() &&
+      (m_remove_trailing_zeros || json.get_remove_trailing_zeros())) {
+    // same as json_spirit::remove_trailing
+    std::string exp;
+    std::size_t exp_start = str.find('e');
+    if (exp_start != std::string::npos) {
+      exp = str.substr(exp_start);
+      str.erase(exp_start);
+    }
+    std::size_t first_non_zero = str.size() - 1;
+    for (; first_non_zero != 0; --first_non_zero) {
+      if (str[first_non_zero] != '0') {
+        break;
+      }
+    }
+    if (first_non_zero != 0) {
+      std::size_t offset = str[first_non_zero] == '.' ? 2 : 1;
+      if (first_non_zero + offset < str.size()) {
+        str.erase(first_non_zero + offset);
+      }
+    }
+    str += exp;
+  }
+  _put(str);
+}
+
+void jsonStreamWriter::_new_line() {
+  if (m_pretty) {
+    _put('\n');
+  }
+}
+
+void jsonStreamWriter::_indent() {
+  if (m_pretty) {
+    m_buffer.append(m_empty.size() * m_indent, ' ');
+  }
+}
+
+void jsonStreamWriter::_space() {
+  if (m_pretty) {
+    _put(' ');
+  }
+}
+
+void jsonStreamWriter::_put(char c) {
+  m_buffer.push_back(c);
+  if (m_buffer.size() >= json_stream_writer_buffer_size) {
+    flush();
+  }
+}
+
+void jsonStreamWriter::_put(char const *str, std::size_t size) {
+  m_buffer.append(str, size);
+  if (m_buffer.size() >= json_stream_writer_buffer_size) {
+    flush();
+  }
+}
+
+}  // namespace CASM
@@ -0,0 +1,161 @@
+#include "casm/clex/CanonicalOccupationGenerator.hh"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "casm/symmetry/PermuteIterator.hh"
+
+namespace CASM {
+
+/// \brief Construct an invalid generator
+CanonicalOccupationGenerator::CanonicalOccupationGenerator()
+    : m_n_sites(0), m_valid(false) {}
+
+/// \brief Constructor
+///
+/// \param min_allowed Minimum allowed occupation value, by site
+/// \param max_allowed Maximum allowed occupation value, by site. All values
+///     in `[min_allowed[i], max_allowed[i]]` are generated on site `i`. Use
+///     `min_allowed[i] == max_allowed[i]` to fix the occupation of site `i`.
+/// \param begin, end Range of permutations that define canonical
+///     occupations, typically
+///     `[supercell.sym_info().permute_begin(),
+///     supercell.sym_info().permute_end())`
+///
+/// After construction, occupation() is the first canonical occupation.
+CanonicalOccupationGenerator::CanonicalOccupationGenerator(
+    Eigen::VectorXi const &min_allowed, Eigen::VectorXi const &max_allowed,
+    PermuteIterator begin, PermuteIterator end)
+    : m_n_sites(max_allowed.size()),
+      m_min_allowed(min_allowed.data(),
+                    min_allowed.data() + min_allowed.size()),
+      m_max_allowed(max_allowed.data(), max_allowed.data() + m_n_sites),
+      m_occ(m_min_allowed),
+      m_active(m_n_sites + 1),
+      m_valid(false) {
+  if (m_min_allowed.size() != m_n_sites) {
+    throw std::runtime_error(
+        "Error in CanonicalOccupationGenerator: min_allowed and max_allowed "
+        "sizes do not match");
+  }
+
+  // unique permutations, excluding the identity
+  std::vector<std::vector<Index> > permutations;
+  std::vector<Index> identity(m_n_sites);
+  for (Index i = 0; i < m_n_sites; ++i) {
+    identity[i] = i;
+  }
+  for (; begin != end; ++begin) {
+    std::vector<Index> permute_ind(m_n_sites);
+    for (Index i = 0; i < m_n_sites; ++i) {
+      permute_ind[i] = begin.permute_ind(i);
+    }
+    if (permute_ind != identity) {
+      permutations.push_back(std::move(permute_ind));
+    }
+  }
+  std::sort(permutations.begin(), permutations.end());
+  permutations.erase(std::unique(permutations.begin(), permutations.end()),
+                     permutations.end());
+
+  for (Index op = 0; op < permutations.size(); ++op) {
+    m_permute_ind.insert(m_permute_ind.end(), permutations[op].begin(),
+                         permutations[op].end());
+    m_active[0].emplace_back(op, 0);
+  }
+
+  if (m_n_sites == 0) {
+    m_valid = true;
+    return;
+  }
+  _search(0);
+}
+
+/// \brief Advance to the next canonical occupation
+///
+/// \returns valid()
+bool CanonicalOccupationGenerator::next() {
+  if (!m_valid) {
+    return false;
+  }
+  if (m_n_sites == 0) {
+    m_valid = false;
+    return false;
+  }
+  Index k = m_n_sites - 1;
+  ++m_occ[k];
+  return _search(k);
+}
+
+/// \brief Find the next canonical occupation, beginning by trying the current
+/// value of m_occ[k] on site k
+///
+/// Requires that sites [0, k) are assigned and m_active[k] is set.
+bool CanonicalOccupationGenerator::_search(Index k) {
+  while (k >= 0) {
+    // all values of site k tried: backtrack
+    if (m_occ[k] > m_max_allowed[k]) {
+      m_occ[k] = m_min_allowed[k];
+      if (--k >= 0) {
+        ++m_occ[k];
+      }
+      continue;
+    }
+
+    // branch can not be canonical: try next value
+    if (!_extend(k)) {
+      ++m_occ[k];
+      continue;
+    }
+
+    // complete and canonical
+    if (k + 1 == m_n_sites) {
+      m_valid = true;
+      return m_valid;
+    }
+
+    // assign next site
+    ++k;
+    m_occ[k] = m_min_allowed[k];
+  }
+  m_valid = false;
+  return m_valid;
+}
+
+/// \brief Check permutations with site k assigned
+///
+/// Sets m_active[k + 1] from m_active[k], dropping permutations that are
+/// decided by the assignment of sites [0, k + 1).
+///
+/// \returns false if some permutation makes every completion of the
+///     assignment of sites [0, k + 1) non-canonical
+bool CanonicalOccupationGenerator::_extend(Index k) {
+  Index n_assigned = k + 1;
+  std::vector<std::pair<Index, Index> > const &active = m_active[k];
+  std::vector<std::pair<Index, Index> > &next_active = m_active[n_assigned];
+  next_active.clear();
+
+  for (auto const &op : active) {
+    Index const *permute_ind = m_permute_ind.data() + op.first * m_n_sites;
+    Index i = op.second;
+    bool is_decided = false;
+    for (; i < n_assigned && permute_ind[i] < n_assigned; ++i) {
+      int lhs = m_occ[i];
+      int rhs = m_occ[permute_ind[i]];
+      if (lhs == rhs) {
+        continue;
+      }
+      if (lhs < rhs) {
+        return false;
+      }
+      is_decided = true;
+      break;
+    }
+    if (!is_decided) {
+      next_active.emplace_back(op.first, i);
+    }
+  }
+  return true;
+}
+
+}  // namespace CASM
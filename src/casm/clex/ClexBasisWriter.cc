@@ -69,7 +69,15 @@ std::string clexulator_member_declarations(
 
       indent
      << "// ParamPack object, which stores temporary data for calculations\n"
-     << indent << "mutable ParamPack m_params;\n\n";
+     << indent << "ParamPack m_params;\n\n"
+     << indent
+     << "// ParamPack object of the EvaluationContext in use, which is a copy "
+        "of m_params\n"
+     << indent << "// (or m_params itself, for the default context)\n"
+     << indent << "ParamPack &_params(EvaluationContext &_context) const {\n"
+     << indent
+     << "  return static_cast<ParamPack &>(_context_params(_context));\n"
+     << indent << "}\n\n";
 
   Index ispec = 0;
   for (auto const &specialization :
@@ -79,12 +87,14 @@ std::string clexulator_member_declarations(
         indent << "// typedef for method pointers of scalar type "
        << specialization.second << "\n"
        << indent << "typedef " << specialization.second << " (" << class_name
-       << "::*BasisFuncPtr_" << ispec << ")() const;\n\n"
+       << "::*BasisFuncPtr_" << ispec
+       << ")(EvaluationContext &) const;\n\n"
        <<
 
         indent << "// typedef for method pointers\n"
        << indent << "typedef " << specialization.second << " (" << class_name
-       << "::*DeltaBasisFuncPtr_" << ispec << ")(int, int) const;\n\n"
+       << "::*DeltaBasisFuncPtr_" << ispec
+       << ")(EvaluationContext &, int, int) const;\n\n"
        <<
 
         indent
@@ -167,7 +177,8 @@ std::string clexulator_private_method_declarations(
      << "/// \\brief Calculate contribution to global correlations from one "
         "unit cell\n"
      << indent << "/// Result is recorded in ClexParamPack\n"
-     << indent << "void _calc_global_corr_contribution() const override;\n\n"
+     << indent << "void _calc_global_corr_contribution(EvaluationContext "
+                  "&_context) const override;\n\n"
      <<
 
       indent
@@ -176,7 +187,8 @@ std::string clexulator_private_method_declarations(
      << indent
      << "/// Result is recorded in double array starting at corr_begin\n"
      << indent
-     << "void _calc_global_corr_contribution(double *corr_begin) const "
+     << "void _calc_global_corr_contribution(EvaluationContext &_context, "
+        "double *corr_begin) const "
         "override;\n\n"
      <<
 
@@ -185,7 +197,8 @@ std::string clexulator_private_method_declarations(
         "one unit cell into ClexParamPack\n"
      << indent << "/// Result is recorded in ClexParamPack\n"
      << indent
-     << "void _calc_restricted_global_corr_contribution(size_type const "
+     << "void _calc_restricted_global_corr_contribution(EvaluationContext "
+        "&_context, size_type const "
         "*ind_list_begin, size_type const *ind_list_end) const override;\n\n"
      <<
 
@@ -195,7 +208,8 @@ std::string clexulator_private_method_declarations(
      << indent
      << "/// Result is recorded in double array starting at corr_begin\n"
      << indent
-     << "void _calc_restricted_global_corr_contribution(double *corr_begin, "
+     << "void _calc_restricted_global_corr_contribution(EvaluationContext "
+        "&_context, double *corr_begin, "
         "size_type const *ind_list_begin, size_type const *ind_list_end) const "
         "override;\n\n"
      <<
@@ -210,7 +224,8 @@ std::string clexulator_private_method_declarations(
      << "/// For local clexulators, 'nlist_ind' ranges over all sites in the "
         "neighborhood\n"
      << indent << "/// Result is recorded in ClexParamPack\n"
-     << indent << "void _calc_point_corr(int nlist_ind) const override;\n\n"
+     << indent << "void _calc_point_corr(EvaluationContext &_context, int "
+                  "nlist_ind) const override;\n\n"
      <<
 
       indent
@@ -225,7 +240,8 @@ std::string clexulator_private_method_declarations(
      << indent
      << "/// Result is recorded in double array starting at corr_begin\n"
      << indent
-     << "void _calc_point_corr(int nlist_ind, double *corr_begin) const "
+     << "void _calc_point_corr(EvaluationContext &_context, int nlist_ind, "
+        "double *corr_begin) const "
         "override;\n\n"
      <<
 
@@ -240,7 +256,8 @@ std::string clexulator_private_method_declarations(
         "neighborhood\n"
      << indent << "/// Result is recorded in ClexParamPack\n"
      << indent
-     << "void _calc_restricted_point_corr(int nlist_ind, size_type const "
+     << "void _calc_restricted_point_corr(EvaluationContext &_context, int "
+        "nlist_ind, size_type const "
         "*ind_list_begin, size_type const *ind_list_end) const override;\n\n"
      <<
 
@@ -256,7 +273,8 @@ std::string clexulator_private_method_declarations(
      << indent
      << "/// Result is recorded in double array starting at corr_begin\n"
      << indent
-     << "void _calc_restricted_point_corr(int nlist_ind, double *corr_begin, "
+     << "void _calc_restricted_point_corr(EvaluationContext &_context, int "
+        "nlist_ind, double *corr_begin, "
         "size_type const *ind_list_begin, size_type const *ind_list_end) const "
         "override;\n\n"
      <<
@@ -272,7 +290,8 @@ std::string clexulator_private_method_declarations(
         "neighborhood\n"
      << indent << "/// Result is recorded in ClexParamPack\n"
      << indent
-     << "void _calc_delta_point_corr(int nlist_ind, int occ_i, int occ_f) "
+     << "void _calc_delta_point_corr(EvaluationContext &_context, int "
+        "nlist_ind, int occ_i, int occ_f) "
         "const override;\n\n"
      <<
 
@@ -288,7 +307,8 @@ std::string clexulator_private_method_declarations(
      << indent
      << "/// Result is recorded in double array starting at corr_begin\n"
      << indent
-     << "void _calc_delta_point_corr(int nlist_ind, int occ_i, int occ_f, "
+     << "void _calc_delta_point_corr(EvaluationContext &_context, int "
+        "nlist_ind, int occ_i, int occ_f, "
         "double *corr_begin) const override;\n\n"
      <<
 
@@ -303,7 +323,8 @@ std::string clexulator_private_method_declarations(
         "neighborhood\n"
      << indent << "/// Result is recorded in ClexParamPack\n"
      << indent
-     << "void _calc_restricted_delta_point_corr(int nlist_ind, int occ_i, int "
+     << "void _calc_restricted_delta_point_corr(EvaluationContext &_context, "
+        "int nlist_ind, int occ_i, int "
         "occ_f, size_type const *ind_list_begin, size_type const "
         "*ind_list_end) const override;\n\n"
      <<
@@ -320,17 +341,32 @@ std::string clexulator_private_method_declarations(
      << indent
      << "/// Result is recorded in double array starting at corr_begin\n"
      << indent
-     << "void _calc_restricted_delta_point_corr(int nlist_ind, int occ_i, int "
+     << "void _calc_restricted_delta_point_corr(EvaluationContext &_context, "
+        "int nlist_ind, int occ_i, int "
         "occ_f, double *corr_begin, size_type const *ind_list_begin, size_type "
         "const *ind_list_end) const override;\n\n"
      <<
 
+      indent
+     << "/// \\brief Calculate the change in select point correlations due to "
+        "a sequence of occupant changes\n"
+     << indent
+     << "/// Result is recorded in double array starting at corr_begin\n"
+     << indent
+     << "void _calc_restricted_delta_point_corr(EvaluationContext &_context, "
+        "OccDelta const *delta_begin, "
+        "OccDelta const *delta_end, double *corr_begin, size_type const "
+        "*ind_list_begin, size_type const *ind_list_end) const override;\n\n"
+     <<
+
       indent << "template<typename Scalar>\n"
-     << indent << "void _global_prepare() const;\n\n"
+     << indent << "void _global_prepare(EvaluationContext &_context) const;\n\n"
      <<
 
       indent << "template<typename Scalar>\n"
-     << indent << "void _point_prepare(int nlist_ind) const;\n\n";
+     << indent
+     << "void _point_prepare(EvaluationContext &_context, int nlist_ind) "
+        "const;\n\n";
 
   {
     auto it(clex.site_bases().begin()), end_it(clex.site_bases().end());
@@ -352,13 +388,13 @@ std::string clexulator_private_method_declarations(
 
   ss << indent << "//default functions for basis function evaluation\n"
      << indent << "template <typename Scalar>\n"
-     << indent << "Scalar zero_func() const {\n"
+     << indent << "Scalar zero_func(EvaluationContext &) const {\n"
      << indent << "  return Scalar(0.0);\n"
      << indent << "}\n\n"
      <<
 
       indent << "template <typename Scalar>\n"
-     << indent << "Scalar zero_func(int, int) const {\n"
+     << indent << "Scalar zero_func(EvaluationContext &, int, int) const {\n"
      << indent << "  return Scalar(0.0);\n"
      << indent << "}\n\n";
 
@@ -420,11 +456,13 @@ std::string clexulator_interface_declaration(
      << "/// \\brief Calculate contribution to global correlations from one "
         "unit cell\n"
      << indent << "void " << class_name
-     << "::_calc_global_corr_contribution(double *corr_begin) const {\n"
-     << indent << "  _calc_global_corr_contribution();\n"
+     << "::_calc_global_corr_contribution(EvaluationContext &_context, double "
+        "*corr_begin) const {\n"
+     << indent << "  _calc_global_corr_contribution(_context);\n"
      << indent << "  for(size_type i = 0; i < corr_size(); i++) {\n"
      << indent
-     << "    *(corr_begin + i) = ParamPack::Val<double>::get(m_params, "
+     << "    *(corr_begin + i) = "
+        "ParamPack::Val<double>::get(_params(_context), "
         "m_corr_param_key, i);\n"
      << indent << "  }\n"
      << indent << "}\n\n"
@@ -436,8 +474,9 @@ std::string clexulator_interface_declaration(
      << "/// \\brief Calculate contribution to global correlations from one "
         "unit cell\n"
      << indent << "void " << class_name
-     << "::_calc_global_corr_contribution() const {\n"
-     << indent << "  m_params.pre_eval();\n";
+     << "::_calc_global_corr_contribution(EvaluationContext &_context) const "
+        "{\n"
+     << indent << "  _params(_context).pre_eval();\n";
 
   Index ispec = 0;
 
@@ -445,19 +484,22 @@ std::string clexulator_interface_declaration(
     if (specializations.size() > 1) {
       ss << indent << "  ";
       if (ispec > 0) ss << "else ";
-      ss << "if(m_params.eval_mode() == " << specialization.first << ")";
+      ss << "if(_params(_context).eval_mode() == " << specialization.first
+         << ")";
     }
     ss << indent << "  {\n"
-       << indent << "    _global_prepare<" << specialization.second << ">();\n"
+       << indent << "    _global_prepare<" << specialization.second
+       << ">(_context);\n"
        << indent << "    for(size_type i = 0; i < corr_size(); i++) {\n"
        << indent << "      ParamPack::Val<" << specialization.second
-       << ">::set(m_params, m_corr_param_key, i, (this->*m_orbit_func_table_"
-       << ispec << "[i])());\n"
+       << ">::set(_params(_context), m_corr_param_key, i, "
+          "(this->*m_orbit_func_table_"
+       << ispec << "[i])(_context));\n"
        << indent << "    }\n"
        << indent << "  }\n";
     ++ispec;
   }
-  ss << indent << "  m_params.post_eval();\n"
+  ss << indent << "  _params(_context).post_eval();\n"
      << indent << "}\n\n"
      <<
 
@@ -467,16 +509,17 @@ std::string clexulator_interface_declaration(
      << "/// \\brief Calculate contribution to select global correlations from "
         "one unit cell\n"
      << indent << "void " << class_name
-     << "::_calc_restricted_global_corr_contribution(double *corr_begin, "
+     << "::_calc_restricted_global_corr_contribution(EvaluationContext "
+        "&_context, double *corr_begin, "
         "size_type const *ind_list_begin, size_type const *ind_list_end) const "
         "{\n"
      << indent
-     << "  _calc_restricted_global_corr_contribution(ind_list_begin, "
+     << "  _calc_restricted_global_corr_contribution(_context, ind_list_begin, "
         "ind_list_end);\n"
      << indent << "  for(; ind_list_begin < ind_list_end; ind_list_begin++) {\n"
      << indent
      << "    *(corr_begin + *ind_list_begin) = "
-        "ParamPack::Val<double>::get(m_params, m_corr_param_key, "
+        "ParamPack::Val<double>::get(_params(_context), m_corr_param_key, "
         "*ind_list_begin);\n"
      << indent << "  }\n"
      << indent << "}\n\n"
@@ -488,30 +531,33 @@ std::string clexulator_interface_declaration(
      << "/// \\brief Calculate contribution to select global correlations from "
         "one unit cell\n"
      << indent << "void " << class_name
-     << "::_calc_restricted_global_corr_contribution(size_type const "
+     << "::_calc_restricted_global_corr_contribution(EvaluationContext "
+        "&_context, size_type const "
         "*ind_list_begin, size_type const *ind_list_end) const {\n"
-     << indent << "  m_params.pre_eval();\n";
+     << indent << "  _params(_context).pre_eval();\n";
 
   ispec = 0;
   for (auto const &specialization : specializations) {
     if (specializations.size() > 1) {
       ss << indent << "  ";
       if (ispec > 0) ss << "else ";
-      ss << "if(m_params.eval_mode() == " << specialization.first << ")";
+      ss << "if(_params(_context).eval_mode() == " << specialization.first
+         << ")";
     }
     ss << indent << "  {\n"
-       << indent << "    _global_prepare<" << specialization.second << ">();\n"
+       << indent << "    _global_prepare<" << specialization.second
+       << ">(_context);\n"
        << indent
        << "    for(; ind_list_begin < ind_list_end; ind_list_begin++) {\n"
        << indent << "      ParamPack::Val<" << specialization.second
-       << ">::set(m_params, m_corr_param_key, *ind_list_begin, "
+       << ">::set(_params(_context), m_corr_param_key, *ind_list_begin, "
           "(this->*m_orbit_func_table_"
-       << ispec << "[*ind_list_begin])());\n"
+       << ispec << "[*ind_list_begin])(_context));\n"
        << indent << "    }\n"
        << indent << "  }\n";
     ++ispec;
   }
-  ss << indent << "  m_params.post_eval();\n"
+  ss << indent << "  _params(_context).post_eval();\n"
      << indent << "}\n\n"
      <<
 
@@ -521,11 +567,13 @@ std::string clexulator_interface_declaration(
      << "/// \\brief Calculate point correlations about basis site "
         "'nlist_ind'\n"
      << indent << "void " << class_name
-     << "::_calc_point_corr(int nlist_ind, double *corr_begin) const {\n"
-     << indent << "  _calc_point_corr(nlist_ind);\n"
+     << "::_calc_point_corr(EvaluationContext &_context, int nlist_ind, double "
+        "*corr_begin) const {\n"
+     << indent << "  _calc_point_corr(_context, nlist_ind);\n"
      << indent << "  for(size_type i = 0; i < corr_size(); i++) {\n"
      << indent
-     << "    *(corr_begin + i) = ParamPack::Val<double>::get(m_params, "
+     << "    *(corr_begin + i) = "
+        "ParamPack::Val<double>::get(_params(_context), "
         "m_corr_param_key, i);\n"
      << indent << "  }\n"
      << indent << "}\n\n"
@@ -537,28 +585,31 @@ std::string clexulator_interface_declaration(
      << "/// \\brief Calculate point correlations about basis site "
         "'nlist_ind'\n"
      << indent << "void " << class_name
-     << "::_calc_point_corr(int nlist_ind) const {\n"
-     << indent << "  m_params.pre_eval();\n";
+     << "::_calc_point_corr(EvaluationContext &_context, int nlist_ind) const "
+        "{\n"
+     << indent << "  _params(_context).pre_eval();\n";
 
   ispec = 0;
   for (auto const &specialization : specializations) {
     if (specializations.size() > 1) {
       ss << indent << "  ";
       if (ispec > 0) ss << "else ";
-      ss << "if(m_params.eval_mode() == " << specialization.first << ")";
+      ss << "if(_params(_context).eval_mode() == " << specialization.first
+         << ")";
     }
     ss << indent << "  {\n"
        << indent << "    _point_prepare<" << specialization.second
-       << ">(nlist_ind);\n"
+       << ">(_context, nlist_ind);\n"
        << indent << "    for(size_type i = 0; i < corr_size(); i++) {\n"
        << indent << "      ParamPack::Val<" << specialization.second
-       << ">::set(m_params, m_corr_param_key, i, (this->*m_flower_func_table_"
-       << ispec << "[nlist_ind][i])());\n"
+       << ">::set(_params(_context), m_corr_param_key, i, "
+          "(this->*m_flower_func_table_"
+       << ispec << "[nlist_ind][i])(_context));\n"
        << indent << "    }\n"
        << indent << "  }\n";
     ++ispec;
   }
-  ss << indent << "  m_params.post_eval();\n"
+  ss << indent << "  _params(_context).post_eval();\n"
      << indent << "}\n\n"
      <<
 
@@ -568,16 +619,17 @@ std::string clexulator_interface_declaration(
      << "/// \\brief Calculate select point correlations about basis site "
         "'nlist_ind'\n"
      << indent << "void " << class_name
-     << "::_calc_restricted_point_corr(int nlist_ind, double *corr_begin, "
+     << "::_calc_restricted_point_corr(EvaluationContext &_context, int "
+        "nlist_ind, double *corr_begin, "
         "size_type const *ind_list_begin, size_type const *ind_list_end) const "
         "{\n"
      << indent
-     << "  _calc_restricted_point_corr(nlist_ind, ind_list_begin, "
+     << "  _calc_restricted_point_corr(_context, nlist_ind, ind_list_begin, "
         "ind_list_end);\n"
      << indent << "  for(; ind_list_begin < ind_list_end; ind_list_begin++) {\n"
      << indent
      << "    *(corr_begin + *ind_list_begin) = "
-        "ParamPack::Val<double>::get(m_params, m_corr_param_key, "
+        "ParamPack::Val<double>::get(_params(_context), m_corr_param_key, "
         "*ind_list_begin);\n"
      << indent << "  }\n"
      << indent << "}\n\n"
@@ -589,31 +641,33 @@ std::string clexulator_interface_declaration(
      << "/// \\brief Calculate select point correlations about basis site "
         "'nlist_ind'\n"
      << indent << "void " << class_name
-     << "::_calc_restricted_point_corr(int nlist_ind, size_type const "
+     << "::_calc_restricted_point_corr(EvaluationContext &_context, int "
+        "nlist_ind, size_type const "
         "*ind_list_begin, size_type const *ind_list_end) const {\n"
-     << indent << "  m_params.pre_eval();\n";
+     << indent << "  _params(_context).pre_eval();\n";
 
   ispec = 0;
   for (auto const &specialization : specializations) {
     if (specializations.size() > 1) {
       ss << indent << "  ";
       if (ispec > 0) ss << "else ";
-      ss << "if(m_params.eval_mode() == " << specialization.first << ")";
+      ss << "if(_params(_context).eval_mode() == " << specialization.first
+         << ")";
     }
     ss << indent << "  {\n"
        << indent << "    _point_prepare<" << specialization.second
-       << ">(nlist_ind);\n"
+       << ">(_context, nlist_ind);\n"
        << indent
        << "    for(; ind_list_begin < ind_list_end; ind_list_begin++) {\n"
        << indent << "      ParamPack::Val<" << specialization.second
-       << ">::set(m_params, m_corr_param_key, *ind_list_begin, "
+       << ">::set(_params(_context), m_corr_param_key, *ind_list_begin, "
           "(this->*m_flower_func_table_"
-       << ispec << "[nlist_ind][*ind_list_begin])());\n"
+       << ispec << "[nlist_ind][*ind_list_begin])(_context));\n"
        << indent << "    }\n"
        << indent << "  }\n";
     ++ispec;
   }
-  ss << indent << "  m_params.post_eval();\n"
+  ss << indent << "  _params(_context).post_eval();\n"
      << indent << "}\n\n"
      <<
 
@@ -623,12 +677,15 @@ std::string clexulator_interface_declaration(
      << "/// \\brief Calculate the change in point correlations due to "
         "changing an occupant\n"
      << indent << "void " << class_name
-     << "::_calc_delta_point_corr(int nlist_ind, int occ_i, int occ_f, double "
+     << "::_calc_delta_point_corr(EvaluationContext &_context, int nlist_ind, "
+        "int occ_i, int occ_f, double "
         "*corr_begin) const {\n"
-     << indent << "  _calc_delta_point_corr(nlist_ind, occ_i, occ_f);\n"
+     << indent << "  _calc_delta_point_corr(_context, nlist_ind, occ_i, "
+                  "occ_f);\n"
      << indent << "  for(size_type i = 0; i < corr_size(); i++) {\n"
      << indent
-     << "    *(corr_begin + i) = ParamPack::Val<double>::get(m_params, "
+     << "    *(corr_begin + i) = "
+        "ParamPack::Val<double>::get(_params(_context), "
         "m_corr_param_key, i);\n"
      << indent << "  }\n"
      << indent << "}\n\n"
@@ -640,29 +697,32 @@ std::string clexulator_interface_declaration(
      << "/// \\brief Calculate the change in point correlations due to "
         "changing an occupant\n"
      << indent << "void " << class_name
-     << "::_calc_delta_point_corr(int nlist_ind, int occ_i, int occ_f) const "
+     << "::_calc_delta_point_corr(EvaluationContext &_context, int nlist_ind, "
+        "int occ_i, int occ_f) const "
         "{\n"
-     << indent << "  m_params.pre_eval();\n";
+     << indent << "  _params(_context).pre_eval();\n";
 
   ispec = 0;
   for (auto const &specialization : specializations) {
     if (specializations.size() > 1) {
       ss << indent << "  ";
       if (ispec > 0) ss << "else ";
-      ss << "if(m_params.eval_mode() == " << specialization.first << ")";
+      ss << "if(_params(_context).eval_mode() == " << specialization.first
+         << ")";
     }
     ss << indent << "  {\n"
        << indent << "    _point_prepare<" << specialization.second
-       << ">(nlist_ind);\n"
+       << ">(_context, nlist_ind);\n"
        << indent << "   for(size_type i = 0; i < corr_size(); i++) {\n"
        << indent << "      ParamPack::Val<" << specialization.second
-       << ">::set(m_params, m_corr_param_key, i, (this->*m_delta_func_table_"
-       << ispec << "[nlist_ind][i])(occ_i, occ_f));\n"
+       << ">::set(_params(_context), m_corr_param_key, i, "
+          "(this->*m_delta_func_table_"
+       << ispec << "[nlist_ind][i])(_context, occ_i, occ_f));\n"
        << indent << "    }\n"
        << indent << "  }\n";
     ++ispec;
   }
-  ss << indent << "  m_params.post_eval();\n"
+  ss << indent << "  _params(_context).post_eval();\n"
      << indent << "}\n\n"
      <<
 
@@ -672,16 +732,18 @@ std::string clexulator_interface_declaration(
      << "/// \\brief Calculate the change in select point correlations due to "
         "changing an occupant\n"
      << indent << "void " << class_name
-     << "::_calc_restricted_delta_point_corr(int nlist_ind, int occ_i, int "
+     << "::_calc_restricted_delta_point_corr(EvaluationContext &_context, int "
+        "nlist_ind, int occ_i, int "
         "occ_f, double *corr_begin, size_type const *ind_list_begin, size_type "
         "const *ind_list_end) const {\n"
      << indent
-     << "  _calc_restricted_delta_point_corr(nlist_ind, occ_i, occ_f, "
+     << "  _calc_restricted_delta_point_corr(_context, nlist_ind, occ_i, "
+        "occ_f, "
         "ind_list_begin, ind_list_end);\n"
      << indent << "  for(; ind_list_begin < ind_list_end; ind_list_begin++) {\n"
      << indent
      << "    *(corr_begin + *ind_list_begin) = "
-        "ParamPack::Val<double>::get(m_params, m_corr_param_key, "
+        "ParamPack::Val<double>::get(_params(_context), m_corr_param_key, "
         "*ind_list_begin);\n"
      << indent << "  }\n"
      << indent << "}\n\n"
@@ -693,32 +755,102 @@ std::string clexulator_interface_declaration(
      << "/// \\brief Calculate the change in select point correlations due to "
         "changing an occupant\n"
      << indent << "void " << class_name
-     << "::_calc_restricted_delta_point_corr(int nlist_ind, int occ_i, int "
+     << "::_calc_restricted_delta_point_corr(EvaluationContext &_context, int "
+        "nlist_ind, int occ_i, int "
         "occ_f, size_type const *ind_list_begin, size_type const "
         "*ind_list_end) const {\n"
-     << indent << "  m_params.pre_eval();\n";
+     << indent << "  _params(_context).pre_eval();\n";
 
   ispec = 0;
   for (auto const &specialization : specializations) {
     if (specializations.size() > 1) {
       ss << indent << "  ";
       if (ispec > 0) ss << "else ";
-      ss << "if(m_params.eval_mode() == " << specialization.first << ")";
+      ss << "if(_params(_context).eval_mode() == " << specialization.first
+         << ")";
     }
     ss << indent << "  {\n"
        << indent << "    _point_prepare<" << specialization.second
-       << ">(nlist_ind);\n"
+       << ">(_context, nlist_ind);\n"
        << indent
        << "    for(; ind_list_begin < ind_list_end; ind_list_begin++) {\n"
        << indent << "      ParamPack::Val<" << specialization.second
-       << ">::set(m_params, m_corr_param_key, *ind_list_begin, "
+       << ">::set(_params(_context), m_corr_param_key, *ind_list_begin, "
           "(this->*m_delta_func_table_"
-       << ispec << "[nlist_ind][*ind_list_begin])(occ_i, occ_f));\n"
+       << ispec << "[nlist_ind][*ind_list_begin])(_context, occ_i, occ_f));\n"
        << indent << "    }\n"
        << indent << "  }\n";
     ++ispec;
   }
-  ss << indent << "  m_params.post_eval();\n" << indent << "}\n\n";
+  ss << indent << "  _params(_context).post_eval();\n" << indent << "}\n\n";
+
+  //-----
+
+  // The batched delta kernel accumulates directly into a double array, so it
+  // always uses the "double" scalar specialization. Other evaluation modes
+  // fall back to the per-site BaseClexulator implementation.
+  ss << indent
+     << "/// \\brief Calculate the change in select point correlations due to "
+        "a sequence of occupant changes\n"
+     << indent << "void " << class_name
+     << "::_calc_restricted_delta_point_corr(EvaluationContext &_context, "
+        "OccDelta const *delta_begin, "
+        "OccDelta const *delta_end, double *corr_begin, size_type const "
+        "*ind_list_begin, size_type const *ind_list_end) const {\n";
+
+  ispec = 0;
+  auto double_it = specializations.begin();
+  for (; double_it != specializations.end(); ++double_it, ++ispec) {
+    if (double_it->second == "double") break;
+  }
+  if (double_it == specializations.end()) {
+    ss << indent
+       << "  BaseClexulator::_calc_restricted_delta_point_corr(_context, "
+          "delta_begin, "
+          "delta_end, corr_begin, ind_list_begin, ind_list_end);\n"
+       << indent << "}\n\n";
+    return ss.str();
+  }
+  if (specializations.size() > 1) {
+    ss << indent << "  if(_params(_context).eval_mode() != " << double_it->first
+       << ") {\n"
+       << indent
+       << "    BaseClexulator::_calc_restricted_delta_point_corr(_context, "
+          "delta_begin, "
+          "delta_end, corr_begin, ind_list_begin, ind_list_end);\n"
+       << indent << "    return;\n"
+       << indent << "  }\n";
+  }
+  ss << indent
+     << "  for(size_type const *it = ind_list_begin; it < ind_list_end; it++) "
+        "{\n"
+     << indent << "    *(corr_begin + *it) = 0.0;\n"
+     << indent << "  }\n"
+     << indent << "  _params(_context).pre_eval();\n"
+     << indent
+     << "  for(OccDelta const *delta = delta_begin; delta < delta_end; "
+        "delta++) {\n"
+     << indent << "    _set_nlist(_context, delta->nlist_begin);\n"
+     << indent << "    _point_prepare<double>(_context, delta->neighbor_ind);\n"
+     << indent
+     << "    for(size_type const *it = ind_list_begin; it < ind_list_end; "
+        "it++) {\n"
+     << indent
+     << "      *(corr_begin + *it) += (this->*m_delta_func_table_" << ispec
+     << "[delta->neighbor_ind][*it])(_context, delta->occ_i, delta->occ_f);\n"
+     << indent << "    }\n"
+     << indent << "    _set_occ(_context, _l(_context, delta->neighbor_ind), "
+                  "delta->occ_f);\n"
+     << indent << "  }\n"
+     << indent << "  while(delta_end != delta_begin) {\n"
+     << indent << "    --delta_end;\n"
+     << indent
+     << "    _set_occ(_context, *(delta_end->nlist_begin + "
+        "delta_end->neighbor_ind), "
+        "delta_end->occ_i);\n"
+     << indent << "  }\n"
+     << indent << "  _params(_context).post_eval();\n"
+     << indent << "}\n\n";
 
   return ss.str();
 }
@@ -5,10 +5,25 @@
 #include "casm/app/LogRuntimeLibrary.hh"
 #include "casm/casm_io/Log.hh"
 #include "casm/clexulator/ClexParamPack.hh"
+#include "casm/misc/parallel.hh"
 #include "casm/system/RuntimeLibrary.hh"
 
 namespace CASM {
 
+namespace {
+
+/// \brief Return the CASM_CLEXULATOR_ABI_VERSION a Clexulator library was
+/// compiled with, or -1 if the library does not specify it
+int _clexulator_abi_version(RuntimeLibrary const &lib, std::string name) {
+  try {
+    return lib.get_function<int(void)>("clexulator_abi_version_" + name)();
+  } catch (std::exception &e) {
+    return -1;
+  }
+}
+
+}  // namespace
+
 /// \brief Construct a Clexulator
 ///
 /// \param name Class name for the Clexulator, typically
@@ -28,6 +43,11 @@ namespace CASM {
 /// - If not found, looks for 'path/to/X_Clexulator_default.cc' and tries to
 //    compile and load it.
 /// - If unsuccesful, will throw std::runtime_error.
+/// - If '/path/to/X_Clexulator_default.so' was compiled with a different
+///   CASM_CLEXULATOR_ABI_VERSION, it is removed and compiled again from
+///   'path/to/X_Clexulator_default.cc'. If the source code does not match the
+///   current version (i.e. it was generated by an older version of CASM), will
+///   throw std::runtime_error.
 ///
 /// The Clexulator has shared ownership of the loaded library,
 /// so it is preferrable to duplicate the Clexulator using it's copy constructor
@@ -50,6 +70,26 @@ Clexulator::Clexulator(std::string name, fs::path dirpath,
     throw;
   }
 
+  // Recompile libraries compiled for a different BaseClexulator ABI
+  fs::path filename_base = dirpath / name;
+  if (_clexulator_abi_version(*m_lib, name) != CASM_CLEXULATOR_ABI_VERSION) {
+    log() << "Clexulator library '" << filename_base.string() << ".so"
+          << "' was compiled for a different version of CASM. Recompiling."
+          << std::endl;
+    m_lib.reset();
+    fs::remove(filename_base.string() + ".so");
+    fs::remove(filename_base.string() + ".o");
+    m_lib = log_make_shared_runtime_lib(
+        filename_base.string(), compile_options, so_options,
+        "compile time depends on how many basis functions are included");
+    if (_clexulator_abi_version(*m_lib, name) != CASM_CLEXULATOR_ABI_VERSION) {
+      throw std::runtime_error(
+          "Error in Clexulator constructor: '" + filename_base.string() +
+          ".cc' was generated by a different version of CASM. Try 'casm "
+          "bset -uf'.");
+    }
+  }
+
   // Get the Clexulator factory function
   std::function<clexulator::BaseClexulator *(void)> factory;
   factory =
@@ -78,6 +118,32 @@ Clexulator::Clexulator(std::string name, fs::path dirpath,
   nlist.expand(neighborhood().begin(), neighborhood().end());
 }
 
+/// \brief Construct a Clexulator from a BaseClexulator that does not
+/// require a runtime library
+///
+/// \param name Name for the Clexulator
+/// \param clex The BaseClexulator, for example an OccTableClexulator
+/// \param nlist, A PrimNeighborList to be updated to include the
+///        neighborhood of this Clexulator
+///
+Clexulator::Clexulator(std::string name,
+                       std::unique_ptr<clexulator::BaseClexulator> clex,
+                       PrimNeighborList &nlist)
+    : m_name(name), m_clex(std::move(clex)) {
+  if (m_clex == nullptr) {
+    throw std::runtime_error(
+        "Error in Clexulator constructor: BaseClexulator is null");
+  }
+  if (nlist.weight_matrix() != m_clex->weight_matrix()) {
+    throw std::runtime_error(
+        "Error in Clexulator constructor: weight matrix of neighbor list does "
+        "not match the weight matrix of the clexulator.");
+  }
+
+  // Expand the given neighbor list as necessary
+  nlist.expand(neighborhood().begin(), neighborhood().end());
+}
+
 /// \brief Copy constructor
 Clexulator::Clexulator(const Clexulator &B) : m_name(B.name()), m_lib(B.m_lib) {
   if (B.m_clex != nullptr) {
@@ -113,12 +179,19 @@ Clexulator make_clexulator(std::string name, fs::path dirpath,
 }
 
 /// \brief Local Clexulator factory function
+///
+/// Equivalent local Clexulator libraries which have not been compiled yet are
+/// compiled in parallel, using up to `RuntimeLibrary::default_compile_jobs()`
+/// jobs, before the Clexulators are constructed in order. If a library fails
+/// to compile in parallel, it is compiled again when its Clexulator is
+/// constructed so that errors are reported as for `make_clexulator`.
 std::vector<Clexulator> make_local_clexulator(std::string name,
                                               fs::path dirpath,
                                               PrimNeighborList &nlist,
                                               std::string compile_options,
                                               std::string so_options) {
-  std::vector<Clexulator> result;
+  // (equiv_name, equiv_dir)
+  std::vector<std::pair<std::string, fs::path> > equivs;
   Index i = 0;
   fs::path equiv_dir = dirpath / fs::path(std::to_string(i));
   while (fs::exists(equiv_dir)) {
@@ -126,11 +199,39 @@ std::vector<Clexulator> make_local_clexulator(std::string name,
     if (!fs::exists(equiv_dir / (equiv_name + ".cc"))) {
       break;
     }
-    result.push_back(make_clexulator(equiv_name, equiv_dir, nlist,
-                                     compile_options, so_options));
+    equivs.emplace_back(equiv_name, equiv_dir);
     ++i;
     equiv_dir = dirpath / fs::path(std::to_string(i));
   }
+
+  std::vector<std::string> to_compile;
+  for (auto const &equiv : equivs) {
+    fs::path filename_base = equiv.second / equiv.first;
+    if (!fs::exists(filename_base.string() + ".so")) {
+      to_compile.push_back(filename_base.string());
+    }
+  }
+  Index n_jobs = RuntimeLibrary::default_compile_jobs().first;
+  if (to_compile.size() > 1 && n_jobs > 1) {
+    log().compiling<Log::standard>(std::to_string(to_compile.size()) +
+                                   " local clexulators");
+    log().begin_lap();
+    log() << "compiling using up to " << n_jobs << " jobs" << std::endl;
+    parallel_for(to_compile.size(), n_jobs, [&](Index j) {
+      try {
+        RuntimeLibrary::compile(to_compile[j], compile_options, so_options);
+      } catch (std::exception &e) {
+        // compile again, and report errors, when constructing the Clexulator
+      }
+    });
+    log() << "compile time: " << log().lap_time() << " (s)\n" << std::endl;
+  }
+
+  std::vector<Clexulator> result;
+  for (auto const &equiv : equivs) {
+    result.push_back(make_clexulator(equiv.first, equiv.second, nlist,
+                                     compile_options, so_options));
+  }
   return result;
 }
 
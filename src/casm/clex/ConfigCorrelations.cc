@@ -7,6 +7,7 @@
 #include "casm/clexulator/ClexParamPack.hh"
 #include "casm/crystallography/Coordinate.hh"
 #include "casm/crystallography/Structure.hh"
+#include "casm/misc/parallel.hh"
 
 namespace CASM {
 
@@ -14,7 +15,7 @@ namespace {
 
 /// Return const reference to vector of sequential indices of size >= n
 std::vector<unsigned int> const &all_correlation_indices(Index n) {
-  static std::vector<unsigned int> all_correlation_indices;
+  static thread_local std::vector<unsigned int> all_correlation_indices;
   if (all_correlation_indices.size() < n) {
     all_correlation_indices.reserve(n);
     unsigned int i = all_correlation_indices.size();
@@ -25,6 +26,43 @@ std::vector<unsigned int> const &all_correlation_indices(Index n) {
   return all_correlation_indices;
 }
 
+/// Number of unit cells in each block of a parallel evaluation over unit cells
+Index const unitcell_block_size = 1024;
+
+/// \brief Call f(context, thread_index, unitcell_index, block_index) for each
+/// unit cell in [0, n_unitcells), using up to n_threads threads
+///
+/// - Unit cells are divided into blocks of unitcell_block_size consecutive
+///   unit cells. Each block is visited in order by one thread.
+/// - If only one thread is used, `context` is nullptr and unit cells are
+///   visited in order on the calling thread, which should use the default
+///   context of `clexulator`. Otherwise, `context` points to a
+///   clexulator::EvaluationContext for the exclusive use of the thread
+///   identified by `thread_index`, in [0, n_threads).
+template <typename FunctionType>
+void for_each_unitcell(Clexulator const &clexulator, Index n_unitcells,
+                       Index n_threads, FunctionType f) {
+  Index n_blocks =
+      (n_unitcells + unitcell_block_size - 1) / unitcell_block_size;
+  n_threads = std::max(Index(1), std::min(n_threads, n_blocks));
+  if (n_threads == 1) {
+    for (Index l = 0; l < n_unitcells; ++l) {
+      f(nullptr, Index(0), l, l / unitcell_block_size);
+    }
+    return;
+  }
+  std::vector<clexulator::EvaluationContext> contexts(
+      n_threads, clexulator.make_context());
+  parallel_for_each_thread(
+      n_blocks, n_threads, [&](Index block_index, Index thread_index) {
+        Index begin = block_index * unitcell_block_size;
+        Index end = std::min(begin + unitcell_block_size, n_unitcells);
+        for (Index l = begin; l < end; ++l) {
+          f(&contexts[thread_index], thread_index, l, block_index);
+        }
+      });
+}
+
 }  // namespace
 
 // /// \brief Returns correlations using 'clexulator'. Supercell needs a
@@ -62,49 +100,62 @@ std::vector<unsigned int> const &all_correlation_indices(Index n) {
 // }
 
 /// \brief Returns correlations using 'clexulator'.
+///
+/// \param n_threads Maximum number of threads used to evaluate the
+///     contributions of unit cells. Results do not depend on `n_threads`.
 Eigen::VectorXd correlations(Configuration const &config,
-                             Clexulator const &clexulator) {
+                             Clexulator const &clexulator, Index n_threads) {
   Eigen::VectorXd corr = Eigen::VectorXd::Zero(clexulator.corr_size());
   correlations(corr, config.configdof(), config.supercell().nlist(),
-               clexulator);
+               clexulator, n_threads);
   return corr;
 }
 
 /// \brief Sets correlations using 'clexulator'. Mean of the contribution from
 /// every unit cell.
+///
+/// \param n_threads Maximum number of threads used to evaluate the
+///     contributions of unit cells. Results do not depend on `n_threads`.
 void correlations(Eigen::VectorXd &corr, ConfigDoF const &configdof,
                   SuperNeighborList const &supercell_neighbor_list,
-                  Clexulator const &clexulator) {
+                  Clexulator const &clexulator, Index n_threads) {
   auto n = clexulator.corr_size();
   auto const &correlation_indices = all_correlation_indices(n);
   restricted_correlations(corr, configdof, supercell_neighbor_list, clexulator,
                           correlation_indices.data(),
-                          correlation_indices.data() + n);
+                          correlation_indices.data() + n, n_threads);
 }
 
 /// \brief Sets correlations using 'clexulator', restricted to specified
 /// correlation indices. Mean of the contribution from every unit cell.
+///
+/// \param n_threads Maximum number of threads used to evaluate the
+///     contributions of unit cells. Results do not depend on `n_threads`.
 void restricted_correlations(Eigen::VectorXd &corr, ConfigDoF const &configdof,
                              SuperNeighborList const &supercell_neighbor_list,
                              Clexulator const &clexulator,
                              unsigned int const *corr_indices_begin,
-                             unsigned int const *corr_indices_end) {
+                             unsigned int const *corr_indices_end,
+                             Index n_threads) {
   restricted_extensive_correlations(corr, configdof, supercell_neighbor_list,
                                     clexulator, corr_indices_begin,
-                                    corr_indices_end);
+                                    corr_indices_end, n_threads);
   corr /= (double)supercell_neighbor_list.n_unitcells();
 }
 
 /// \brief Returns correlations using 'clexulator'. Sum of the contribution from
 /// every unit cell.
+///
+/// \param n_threads Maximum number of threads used to evaluate the
+///     contributions of unit cells. Results do not depend on `n_threads`.
 void extensive_correlations(Eigen::VectorXd &corr, ConfigDoF const &configdof,
                             SuperNeighborList const &supercell_neighbor_list,
-                            Clexulator const &clexulator) {
+                            Clexulator const &clexulator, Index n_threads) {
   auto n = clexulator.corr_size();
   auto const &correlation_indices = all_correlation_indices(n);
-  restricted_extensive_correlations(corr, configdof, supercell_neighbor_list,
-                                    clexulator, correlation_indices.data(),
-                                    correlation_indices.data() + n);
+  restricted_extensive_correlations(
+      corr, configdof, supercell_neighbor_list, clexulator,
+      correlation_indices.data(), correlation_indices.data() + n, n_threads);
 }
 
 /// \brief Sets correlations using 'clexulator', restricted to specified
@@ -112,32 +163,93 @@ void extensive_correlations(Eigen::VectorXd &corr, ConfigDoF const &configdof,
 ///
 /// \returns Eigen::VectorXd correlations, of size `clexulator.corr_size()`,
 /// with zero value for any correlations not in `correlations_indices`.
+///
+/// \param n_threads Maximum number of threads used to evaluate the
+///     contributions of unit cells.
+///
+/// Contributions are summed over blocks of unit cells, in parallel, and then
+/// the block sums are added in order, so results do not depend on
+/// `n_threads`. With one thread, or one block, unit cells are evaluated in a
+/// single loop using the default context of `clexulator`.
 void restricted_extensive_correlations(
     Eigen::VectorXd &corr, ConfigDoF const &configdof,
     SuperNeighborList const &supercell_neighbor_list,
     Clexulator const &clexulator, unsigned int const *corr_indices_begin,
-    unsigned int const *corr_indices_end) {
+    unsigned int const *corr_indices_end, Index n_threads) {
   int n_corr = clexulator.corr_size();
   int n_unitcells = supercell_neighbor_list.n_unitcells();
+  Index n_blocks =
+      (n_unitcells + unitcell_block_size - 1) / unitcell_block_size;
 
-  // Holds contribution to global correlations from a particular Neighborhood
-  static Eigen::VectorXd tcorr;
   corr.resize(n_corr);
-  tcorr.resize(n_corr);
-
   for (auto it = corr_indices_begin; it != corr_indices_end; ++it) {
     *(corr.data() + *it) = 0.0;
   }
 
-  for (int unitcell_index = 0; unitcell_index < n_unitcells; unitcell_index++) {
-    // Fill up contributions
-    clexulator.calc_restricted_global_corr_contribution(
-        configdof, supercell_neighbor_list.sites(unitcell_index).data(),
-        end_ptr(supercell_neighbor_list.sites(unitcell_index)), tcorr.data(),
-        end_ptr(tcorr), corr_indices_begin, corr_indices_end);
+  if (n_threads <= 1 || n_blocks <= 1) {
+    // Holds contribution to global correlations from a particular
+    // Neighborhood, and the sum of contributions from the current block
+    static thread_local Eigen::VectorXd tcorr;
+    static thread_local Eigen::VectorXd block_corr;
+    tcorr.resize(n_corr);
+    block_corr.resize(n_corr);
+
+    for (int unitcell_index = 0; unitcell_index < n_unitcells;
+         unitcell_index++) {
+      if (unitcell_index % unitcell_block_size == 0) {
+        for (auto it = corr_indices_begin; it != corr_indices_end; ++it) {
+          *(block_corr.data() + *it) = 0.0;
+        }
+      }
+
+      // Fill up contributions
+      clexulator.calc_restricted_global_corr_contribution(
+          configdof, supercell_neighbor_list.sites(unitcell_index).data(),
+          end_ptr(supercell_neighbor_list.sites(unitcell_index)), tcorr.data(),
+          end_ptr(tcorr), corr_indices_begin, corr_indices_end);
+
+      for (auto it = corr_indices_begin; it != corr_indices_end; ++it) {
+        *(block_corr.data() + *it) += *(tcorr.data() + *it);
+      }
+
+      if ((unitcell_index + 1) % unitcell_block_size == 0 ||
+          unitcell_index + 1 == n_unitcells) {
+        for (auto it = corr_indices_begin; it != corr_indices_end; ++it) {
+          *(corr.data() + *it) += *(block_corr.data() + *it);
+        }
+      }
+    }
+    return;
+  }
+
+  // Holds contribution to global correlations from a particular Neighborhood,
+  // for each thread, and the sum of contributions from each block of unit cells
+  std::vector<Eigen::VectorXd> tcorr(n_threads, Eigen::VectorXd(n_corr));
+  Eigen::MatrixXd block_corr = Eigen::MatrixXd::Zero(n_corr, n_blocks);
+
+  for_each_unitcell(
+      clexulator, n_unitcells, n_threads,
+      [&](clexulator::EvaluationContext *context, Index thread_index,
+          Index unitcell_index, Index block_index) {
+        // Fill up contributions
+        Eigen::VectorXd &_tcorr = tcorr[thread_index];
+        clexulator.calc_restricted_global_corr_contribution(
+            *context, configdof,
+            supercell_neighbor_list.sites(unitcell_index).data(),
+            end_ptr(supercell_neighbor_list.sites(unitcell_index)),
+            _tcorr.data(), end_ptr(_tcorr), corr_indices_begin,
+            corr_indices_end);
+
+        double *_block_corr = block_corr.col(block_index).data();
+        for (auto it = corr_indices_begin; it != corr_indices_end; ++it) {
+          *(_block_corr + *it) += *(_tcorr.data() + *it);
+        }
+      });
 
+  for (Index block_index = 0; block_index < n_blocks; ++block_index) {
+    double const *_block_corr = block_corr.col(block_index).data();
     for (auto it = corr_indices_begin; it != corr_indices_end; ++it) {
-      *(corr.data() + *it) += *(tcorr.data() + *it);
+      *(corr.data() + *it) += *(_block_corr + *it);
     }
   }
 }
@@ -186,13 +298,35 @@ void corr_contribution(Eigen::VectorXd &corr, Index linear_unitcell_index,
 ///   SupercellSymInfo::unitcell_index_converter().
 /// - Sum over rows is equal to the value returned by extensive_correlations
 /// - Average over rows is equal to value returned by correlations
+/// - Contributions are evaluated using up to `n_threads` threads
 Eigen::MatrixXd all_corr_contribution(Configuration const &config,
-                                      Clexulator const &clexulator) {
+                                      Clexulator const &clexulator,
+                                      Index n_threads) {
   int n_unitcells = config.supercell().volume();
-  Eigen::MatrixXd corr(n_unitcells, clexulator.corr_size());
-  for (Index i = 0; i < n_unitcells; i++) {
-    corr.row(i) = corr_contribution(i, config, clexulator);
-  }
+  int n_corr = clexulator.corr_size();
+  ConfigDoF const &configdof = config.configdof();
+  SuperNeighborList const &supercell_neighbor_list = config.supercell().nlist();
+  Eigen::MatrixXd corr(n_unitcells, n_corr);
+  std::vector<Eigen::VectorXd> tcorr(std::max(Index(1), n_threads),
+                                     Eigen::VectorXd(n_corr));
+  for_each_unitcell(
+      clexulator, n_unitcells, n_threads,
+      [&](clexulator::EvaluationContext *context, Index thread_index,
+          Index unitcell_index, Index block_index) {
+        Eigen::VectorXd &_tcorr = tcorr[thread_index];
+        auto const &unitcell_nlist =
+            supercell_neighbor_list.sites(unitcell_index);
+        if (context) {
+          clexulator.calc_global_corr_contribution(
+              *context, configdof, unitcell_nlist.data(),
+              end_ptr(unitcell_nlist), _tcorr.data(), end_ptr(_tcorr));
+        } else {
+          clexulator.calc_global_corr_contribution(
+              configdof, unitcell_nlist.data(), end_ptr(unitcell_nlist),
+              _tcorr.data(), end_ptr(_tcorr));
+        }
+        corr.row(unitcell_index) = _tcorr;
+      });
   return corr;
 }
 
@@ -268,18 +402,14 @@ void restricted_point_corr(Eigen::VectorXd &corr, Index linear_unitcell_index,
 /// - The value clexulator.n_point_corr() is the number of sites for which
 /// point correlations can be evaluated (per unit cell), which is the sum of
 /// cluster orbit size over all point cluster orbits.
+/// - Point correlations are evaluated using up to `n_threads` threads
 Eigen::MatrixXd all_point_corr(Configuration const &config,
-                               Clexulator const &clexulator) {
-  Index n_rows = config.supercell().volume() * clexulator.n_point_corr();
-  Eigen::MatrixXd corr(n_rows, clexulator.corr_size());
-  Index l = 0;
-  for (Index j = 0; j < clexulator.n_point_corr(); j++) {
-    for (Index i = 0; i < config.supercell().volume(); i++) {
-      corr.row(l) = point_corr(i, j, config, clexulator);
-      ++l;
-    }
-  }
-  return corr;
+                               Clexulator const &clexulator, Index n_threads) {
+  auto n = clexulator.corr_size();
+  auto const &correlation_indices = all_correlation_indices(n);
+  return all_restricted_point_corr(
+      config.configdof(), config.supercell().nlist(), clexulator,
+      correlation_indices.data(), correlation_indices.data() + n, n_threads);
 }
 
 /// \brief Returns point correlations from all sites, normalized by cluster
@@ -297,43 +427,58 @@ Eigen::MatrixXd all_point_corr(Configuration const &config,
 /// - The value clexulator.n_point_corr() is the number of sites for which
 /// point correlations can be evaluated (per unit cell), which is the sum of
 /// cluster orbit size over all point cluster orbits.
+/// - Point correlations are evaluated using up to `n_threads` threads
 Eigen::MatrixXd all_restricted_point_corr(
     ConfigDoF const &configdof,
     SuperNeighborList const &supercell_neighbor_list,
     Clexulator const &clexulator, unsigned int const *corr_indices_begin,
-    unsigned int const *corr_indices_end) {
+    unsigned int const *corr_indices_end, Index n_threads) {
   Index n_unitcells = supercell_neighbor_list.n_unitcells();
-  Index n_rows = n_unitcells * clexulator.n_point_corr();
+  Index n_point_corr = clexulator.n_point_corr();
+  Index n_rows = n_unitcells * n_point_corr;
   Index n_corr = clexulator.corr_size();
   Eigen::MatrixXd corr = Eigen::MatrixXd::Zero(n_rows, n_corr);
-  Eigen::VectorXd tcorr = Eigen::VectorXd::Zero(n_corr);
-  Index l = 0;
-  for (Index j = 0; j < clexulator.n_point_corr(); j++) {
-    for (Index i = 0; i < n_unitcells; i++) {
-      restricted_point_corr(tcorr, i, j, configdof, supercell_neighbor_list,
-                            clexulator, corr_indices_begin, corr_indices_end);
-      corr.row(l) = tcorr;
-      ++l;
-    }
-  }
+  std::vector<Eigen::VectorXd> tcorr(std::max(Index(1), n_threads),
+                                     Eigen::VectorXd::Zero(n_corr));
+  for_each_unitcell(
+      clexulator, n_unitcells, n_threads,
+      [&](clexulator::EvaluationContext *context, Index thread_index,
+          Index unitcell_index, Index block_index) {
+        Eigen::VectorXd &_tcorr = tcorr[thread_index];
+        auto const &unitcell_nlist =
+            supercell_neighbor_list.sites(unitcell_index);
+        for (Index j = 0; j < n_point_corr; j++) {
+          if (context) {
+            clexulator.calc_restricted_point_corr(
+                *context, configdof, unitcell_nlist.data(),
+                end_ptr(unitcell_nlist), j, _tcorr.data(), end_ptr(_tcorr),
+                corr_indices_begin, corr_indices_end);
+          } else {
+            clexulator.calc_restricted_point_corr(
+                configdof, unitcell_nlist.data(), end_ptr(unitcell_nlist), j,
+                _tcorr.data(), end_ptr(_tcorr), corr_indices_begin,
+                corr_indices_end);
+          }
+          corr.row(j * n_unitcells + unitcell_index) = _tcorr;
+        }
+      });
   return corr;
 }
 
 // --- Occupation ---
 
-/// \brief Sets change in (extensive) correlations due to an occupation
-/// change, restricted to specified correlations
-///
-/// \param dcorr, Eigen::VectorXd of change in correlations. Will be set to
-/// size `clexulator.corr_size()` if necessary.  Only elements corresponding to
-/// indices in `correlations_indices` will be modified.
-///
-void restricted_delta_corr(Eigen::VectorXd &dcorr, Index linear_site_index,
-                           int new_occ, ConfigDoF const &configdof,
-                           SuperNeighborList const &supercell_neighbor_list,
-                           Clexulator const &clexulator,
-                           unsigned int const *corr_indices_begin,
-                           unsigned int const *corr_indices_end) {
+namespace {
+
+/// \brief Implements `restricted_delta_corr` for an occupation change, using
+/// `context` if not nullptr, else the default context of `clexulator`
+void restricted_delta_corr_impl(clexulator::EvaluationContext *context,
+                                Eigen::VectorXd &dcorr,
+                                Index linear_site_index, int new_occ,
+                                ConfigDoF const &configdof,
+                                SuperNeighborList const &supercell_neighbor_list,
+                                Clexulator const &clexulator,
+                                unsigned int const *corr_indices_begin,
+                                unsigned int const *corr_indices_end) {
   int n_corr = clexulator.corr_size();
   dcorr.resize(n_corr);
 
@@ -350,11 +495,19 @@ void restricted_delta_corr(Eigen::VectorXd &dcorr, Index linear_site_index,
 
   if (!supercell_neighbor_list.overlaps()) {
     int curr_occ = configdof.occ(linear_site_index);
-    clexulator.calc_restricted_delta_point_corr(
-        configdof, nlist_begin, nlist_end, neighbor_index, curr_occ, new_occ,
-        corr_begin, corr_end, corr_indices_begin, corr_indices_end);
+    if (context) {
+      clexulator.calc_restricted_delta_point_corr(
+          *context, configdof, nlist_begin, nlist_end, neighbor_index,
+          curr_occ, new_occ, corr_begin, corr_end, corr_indices_begin,
+          corr_indices_end);
+    } else {
+      clexulator.calc_restricted_delta_point_corr(
+          configdof, nlist_begin, nlist_end, neighbor_index, curr_occ,
+          new_occ, corr_begin, corr_end, corr_indices_begin,
+          corr_indices_end);
+    }
   } else {
-    static Eigen::VectorXd before;
+    static thread_local Eigen::VectorXd before;
     before.resize(n_corr);
     Eigen::VectorXd &after = dcorr;
 
@@ -364,18 +517,26 @@ void restricted_delta_corr(Eigen::VectorXd &dcorr, Index linear_site_index,
 
     int curr_occ = configdof.occ(linear_site_index);
 
+    auto calc = [&](Eigen::VectorXd &corr) {
+      if (context) {
+        clexulator.calc_restricted_point_corr(
+            *context, configdof, nlist_begin, nlist_end, neighbor_index,
+            corr.data(), end_ptr(corr), corr_indices_begin, corr_indices_end);
+      } else {
+        clexulator.calc_restricted_point_corr(
+            configdof, nlist_begin, nlist_end, neighbor_index, corr.data(),
+            end_ptr(corr), corr_indices_begin, corr_indices_end);
+      }
+    };
+
     // Calculate before
-    clexulator.calc_restricted_point_corr(
-        configdof, nlist_begin, nlist_end, neighbor_index, before.data(),
-        end_ptr(before), corr_indices_begin, corr_indices_end);
+    calc(before);
 
     // Apply change
     mutable_configdof.occ(linear_site_index) = new_occ;
 
     // Calculate after
-    clexulator.calc_restricted_point_corr(
-        configdof, nlist_begin, nlist_end, neighbor_index, after.data(),
-        end_ptr(after), corr_indices_begin, corr_indices_end);
+    calc(after);
 
     // dcorr = after - before
     for (auto it = corr_indices_begin; it != corr_indices_end; ++it) {
@@ -387,6 +548,46 @@ void restricted_delta_corr(Eigen::VectorXd &dcorr, Index linear_site_index,
   }
 }
 
+}  // namespace
+
+/// \brief Sets change in (extensive) correlations due to an occupation
+/// change, restricted to specified correlations
+///
+/// \param dcorr, Eigen::VectorXd of change in correlations. Will be set to
+/// size `clexulator.corr_size()` if necessary.  Only elements corresponding to
+/// indices in `correlations_indices` will be modified.
+///
+void restricted_delta_corr(Eigen::VectorXd &dcorr, Index linear_site_index,
+                           int new_occ, ConfigDoF const &configdof,
+                           SuperNeighborList const &supercell_neighbor_list,
+                           Clexulator const &clexulator,
+                           unsigned int const *corr_indices_begin,
+                           unsigned int const *corr_indices_end) {
+  restricted_delta_corr_impl(nullptr, dcorr, linear_site_index, new_occ,
+                             configdof, supercell_neighbor_list, clexulator,
+                             corr_indices_begin, corr_indices_end);
+}
+
+/// \brief Sets change in (extensive) correlations due to an occupation
+/// change, restricted to specified correlations, using an EvaluationContext
+///
+/// Same as above, but may be called by threads using the same `clexulator`
+/// concurrently, each with its own `context`. If the supercell neighbor list
+/// overlaps, the occupation of `linear_site_index` is temporarily modified
+/// during evaluation, so it must not be read by other threads at the same
+/// time.
+void restricted_delta_corr(clexulator::EvaluationContext &context,
+                           Eigen::VectorXd &dcorr, Index linear_site_index,
+                           int new_occ, ConfigDoF const &configdof,
+                           SuperNeighborList const &supercell_neighbor_list,
+                           Clexulator const &clexulator,
+                           unsigned int const *corr_indices_begin,
+                           unsigned int const *corr_indices_end) {
+  restricted_delta_corr_impl(&context, dcorr, linear_site_index, new_occ,
+                             configdof, supercell_neighbor_list, clexulator,
+                             corr_indices_begin, corr_indices_end);
+}
+
 // --- Local continuous ---
 
 /// \brief Sets change in (extensive) correlations due to a local continuous
@@ -416,7 +617,7 @@ void restricted_delta_corr(Eigen::VectorXd &dcorr, Index linear_site_index,
   long int const *nlist_begin = nlist_sites.data();
   long int const *nlist_end = end_ptr(nlist_sites);
 
-  static Eigen::VectorXd before;
+  static thread_local Eigen::VectorXd before;
   before.resize(n_corr);
   Eigen::VectorXd &after = dcorr;
 
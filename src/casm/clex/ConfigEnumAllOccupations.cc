@@ -2,6 +2,9 @@
 
 #include "casm/clex/Supercell.hh"
 #include "casm/enumerator/ConfigEnumInput.hh"
+#include "casm/misc/CASM_Eigen_math.hh"
+#include "casm/misc/parallel.hh"
+#include "casm/symmetry/SupercellSymInfo.hh"
 
 namespace CASM {
 
@@ -27,6 +30,54 @@ void set_occupation(Configuration &configuration,
     configuration.set_occ(site_index, counter[i++]);
   }
 }
+
+/// Returns true if canonical occupations of `configuration` can be generated
+/// directly, which requires that occupation is isotropic and all other DoF
+/// values are zero, so that only occupation affects the canonical form
+bool orderly_is_allowed(Configuration const &configuration) {
+  if (configuration.supercell().sym_info().has_aniso_occs()) {
+    return false;
+  }
+  clexulator::ConfigDoFValues const &dof_values =
+      configuration.configdof().values();
+  for (auto const &dof : dof_values.global_dof_values) {
+    if (!almost_zero(dof.second)) {
+      return false;
+    }
+  }
+  for (auto const &dof : dof_values.local_dof_values) {
+    if (!almost_zero(dof.second)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// Make a generator of canonical occupations, with all allowed values on the
+/// selected sites and occupation fixed on the other sites
+CanonicalOccupationGenerator make_canonical_occupation_generator(
+    ConfigEnumInput const &config_enum_input) {
+  Configuration const &configuration = config_enum_input.configuration();
+  auto const &supercell = configuration.supercell();
+  Eigen::VectorXi min_allowed = configuration.occupation();
+  Eigen::VectorXi max_allowed = configuration.occupation();
+  Eigen::VectorXi supercell_max_allowed = supercell.max_allowed_occupation();
+  for (Index i : config_enum_input.sites()) {
+    min_allowed[i] = 0;
+    max_allowed[i] = supercell_max_allowed[i];
+  }
+  return CanonicalOccupationGenerator(min_allowed, max_allowed,
+                                      supercell.sym_info().permute_begin(),
+                                      supercell.sym_info().permute_end());
+}
+
+void set_occupation(Configuration &configuration,
+                    std::set<Index> const &site_indices,
+                    CanonicalOccupationGenerator const &generator) {
+  for (Index site_index : site_indices) {
+    configuration.set_occ(site_index, generator.occupation()[site_index]);
+  }
+}
 }  // namespace local_impl
 
 /// \brief Conditionally true for ConfigEnumAllOccupations
@@ -63,7 +114,9 @@ ConfigEnumAllOccupations::ConfigEnumAllOccupations(
           config_enum_input.configuration())),
       m_enumerate_on_a_subset_of_supercell_sites(
           m_site_index_selection.size() !=
-          config_enum_input.configuration().size()) {
+          config_enum_input.configuration().size()),
+      m_n_threads(1),
+      m_orderly(false) {
   if (m_enumerate_on_a_subset_of_supercell_sites) {
     m_primitive_only = true;
     m_canonical_only = false;
@@ -107,9 +160,20 @@ ConfigEnumAllOccupations::ConfigEnumAllOccupations(
 ///   skipped.
 /// - If `canonical_only==true`, then non-canonical configurations are
 ///   skipped.
+/// - If `n_threads > 1`, the primitive and canonical checks of the following
+///   candidate occupations are done in parallel, in batches, using up to
+///   `n_threads` threads. The enumerated configurations do not change.
+/// - If `orderly==true` and `canonical_only==true`, canonical occupations are
+///   generated directly using CanonicalOccupationGenerator, pruning
+///   non-canonical partial occupations, instead of checking every
+///   occupation. The same configurations are enumerated, but in a different
+///   order. This is only possible if occupation is isotropic and all other
+///   DoF values of `config_enum_input.configuration()` are zero, and is
+///   ignored otherwise. Check with `this->is_orderly()`. Orderly generation
+///   does not use `n_threads`.
 ConfigEnumAllOccupations::ConfigEnumAllOccupations(
     const ConfigEnumInput &config_enum_input, bool primitive_only,
-    bool canonical_only)
+    bool canonical_only, Index n_threads, bool orderly)
     : m_site_index_selection(config_enum_input.sites()),
       m_counter(std::vector<int>(config_enum_input.sites().size(), 0),
                 local_impl::max_selected_occupation(config_enum_input),
@@ -120,13 +184,26 @@ ConfigEnumAllOccupations::ConfigEnumAllOccupations(
           m_site_index_selection.size() !=
           config_enum_input.configuration().size()),
       m_primitive_only(primitive_only),
-      m_canonical_only(canonical_only) {
-  local_impl::set_occupation(*m_current, m_site_index_selection, m_counter);
+      m_canonical_only(canonical_only),
+      m_n_threads(n_threads),
+      m_orderly(orderly && canonical_only &&
+                local_impl::orderly_is_allowed(
+                    config_enum_input.configuration())) {
+  if (m_orderly) {
+    m_generator =
+        local_impl::make_canonical_occupation_generator(config_enum_input);
+    local_impl::set_occupation(*m_current, m_site_index_selection,
+                               m_generator);
+  } else {
+    local_impl::set_occupation(*m_current, m_site_index_selection, m_counter);
+  }
   reset_properties(*m_current);
   this->_initialize(&(*m_current));
 
   // Make sure that current() is a primitive canonical config
-  if (!_current_is_valid_for_output()) {
+  if (m_orderly && !m_generator.valid()) {
+    this->_invalidate();
+  } else if (!_current_is_valid_for_output()) {
     increment();
   }
 
@@ -145,11 +222,24 @@ bool ConfigEnumAllOccupations::primitive_canonical_guarantee() const {
   return m_primitive_only && m_canonical_only;
 }
 
+/// \brief Returns true if canonical occupations are generated directly,
+///     by orderly generation
+bool ConfigEnumAllOccupations::is_orderly() const { return m_orderly; }
+
 const std::string ConfigEnumAllOccupations::enumerator_name =
     "ConfigEnumAllOccupations";
 
 /// Implements _increment over all occupations
 void ConfigEnumAllOccupations::increment() {
+  if (m_orderly) {
+    _increment_orderly();
+    return;
+  }
+  if (m_n_threads > 1 && (m_primitive_only || m_canonical_only)) {
+    _increment_with_lookahead();
+    return;
+  }
+
   bool is_valid_config{false};
 
   while (!is_valid_config && ++m_counter) {
@@ -169,14 +259,88 @@ void ConfigEnumAllOccupations::increment() {
 }
 
 /// Returns true if current() is primitive and canonical
+///
+/// If m_orderly, current() is canonical by construction and is not checked.
 bool ConfigEnumAllOccupations::_current_is_valid_for_output() const {
   if (m_primitive_only && !current().is_primitive()) {
     return false;
   }
-  if (m_canonical_only && !current().is_canonical()) {
+  if (m_canonical_only && !m_orderly && !current().is_canonical()) {
     return false;
   }
   return true;
 }
 
+/// Implements _increment over all occupations, checking candidate occupations
+/// in parallel
+void ConfigEnumAllOccupations::_increment_with_lookahead() {
+  if (m_lookahead.empty()) {
+    _lookahead();
+  }
+
+  if (!m_lookahead.empty()) {
+    local_impl::set_occupation(*m_current, m_site_index_selection,
+                               m_lookahead.front());
+    m_lookahead.pop_front();
+    this->_increment_step();
+  } else {
+    this->_invalidate();
+  }
+  m_current->set_source(this->source(step()));
+}
+
+/// Implements _increment over canonical occupations, generated directly
+void ConfigEnumAllOccupations::_increment_orderly() {
+  bool is_valid_config{false};
+
+  while (!is_valid_config && m_generator.next()) {
+    local_impl::set_occupation(*m_current, m_site_index_selection,
+                               m_generator);
+    is_valid_config = _current_is_valid_for_output();
+  }
+
+  if (m_generator.valid()) {
+    this->_increment_step();
+  } else {
+    this->_invalidate();
+  }
+  m_current->set_source(this->source(step()));
+}
+
+/// Check the next candidate occupations in parallel and store those valid for
+/// output in m_lookahead
+///
+/// - Candidates are checked in batches, until at least one is valid or the
+///   counter hits the end
+/// - The site permutations used by the checks are made before the threads
+///   start, so the threads only read shared Supercell data
+void ConfigEnumAllOccupations::_lookahead() {
+  Index batch_size = 100 * m_n_threads;
+  m_current->supercell().sym_info().site_permutation_symrep();
+
+  while (m_lookahead.empty() && m_counter.valid()) {
+    std::vector<std::vector<int>> counter_values;
+    std::vector<Configuration> candidates;
+    while (counter_values.size() < batch_size && ++m_counter) {
+      counter_values.push_back(m_counter());
+      candidates.push_back(*m_current);
+      local_impl::set_occupation(candidates.back(), m_site_index_selection,
+                                 m_counter());
+    }
+
+    std::vector<char> is_valid(candidates.size());
+    parallel_for(candidates.size(), m_n_threads, [&](Index i) {
+      Configuration const &candidate = candidates[i];
+      is_valid[i] = (!m_primitive_only || candidate.is_primitive()) &&
+                    (!m_canonical_only || candidate.is_canonical());
+    });
+
+    for (Index i = 0; i < candidates.size(); ++i) {
+      if (is_valid[i]) {
+        m_lookahead.push_back(std::move(counter_values[i]));
+      }
+    }
+  }
+}
+
 }  // namespace CASM
@@ -33,6 +33,7 @@
 #include "casm/crystallography/io/VaspIO.hh"
 #include "casm/database/ConfigDatabase.hh"
 #include "casm/database/PropertiesDatabase.hh"
+#include "casm/database/PropertyCache.hh"
 #include "casm/database/Selected.hh"
 
 namespace CASM {
@@ -179,6 +180,59 @@ Eigen::VectorXd AtomFrac::evaluate(const Configuration &config) const {
   return species_frac(config);
 }
 
+namespace {
+
+/// \brief Open the correlations cache for a project basis set, or return
+/// nullptr if the basis set has no Clexulator source
+std::shared_ptr<DB::PropertyCache> open_corr_cache(PrimClex const &primclex,
+                                                   std::string const &bset,
+                                                   Index corr_size) {
+  auto const &dir = primclex.dir();
+  std::string key = DB::make_property_cache_key(
+      {dir.clexulator_src(primclex.settings().project_name(), bset)});
+  if (key.empty()) {
+    return nullptr;
+  }
+  return DB::open_property_cache(
+      dir.property_cache_dir() / ("corr." + bset + ".bin"), key, corr_size);
+}
+
+/// \brief Open the property value cache for a project cluster expansion, or
+/// return nullptr if the basis set has no Clexulator source or there are no
+/// ECI
+std::shared_ptr<DB::PropertyCache> open_clex_cache(
+    PrimClex const &primclex, ClexDescription const &desc) {
+  auto const &dir = primclex.dir();
+  std::string key = DB::make_property_cache_key(
+      {dir.clexulator_src(primclex.settings().project_name(), desc.bset),
+       dir.eci(desc.property, desc.calctype, desc.ref, desc.bset, desc.eci)});
+  if (key.empty()) {
+    return nullptr;
+  }
+  return DB::open_property_cache(
+      dir.property_cache_dir() / ("clex." + desc.name + ".bin"), key, 1);
+}
+
+/// \brief Returns all correlations, reading from and inserting in
+/// `corr_cache` if it is not nullptr and `config` is in the database
+Eigen::VectorXd cached_correlations(Configuration const &config,
+                                   Clexulator const &clexulator,
+                                   DB::PropertyCache *corr_cache) {
+  if (corr_cache == nullptr || config.id() == "none") {
+    return correlations(config, clexulator);
+  }
+  std::uint64_t dof_hash = DB::dof_hash(config.configdof().values());
+  double const *cached = corr_cache->find(config.name(), dof_hash);
+  if (cached != nullptr) {
+    return Eigen::Map<Eigen::VectorXd const>(cached, corr_cache->size());
+  }
+  Eigen::VectorXd corr = correlations(config, clexulator);
+  corr_cache->insert(config.name(), dof_hash, corr.data());
+  return corr;
+}
+
+}  // namespace
+
 // --- Corr implementations -----------
 
 const std::string Corr::Name = "corr";
@@ -200,7 +254,14 @@ const std::string Corr::Desc =
     "or 'corr(formation_energy,0:6)'.";
 
 /// \brief Returns the atom fraction
+///
+/// If using a project basis set, all correlations are evaluated and cached in
+/// the project property cache, so that later queries of any correlations of
+/// the same configuration are read from the cache.
 Eigen::VectorXd Corr::evaluate(const Configuration &config) const {
+  if (m_corr_cache != nullptr) {
+    return cached_correlations(config, m_clexulator, m_corr_cache.get());
+  }
   Eigen::VectorXd corr;
   restricted_extensive_correlations(
       corr, config.configdof(), config.supercell().nlist(), m_clexulator,
@@ -217,6 +278,8 @@ bool Corr::init(const Configuration &_tmplt) const {
                                ? primclex.settings().default_clex()
                                : primclex.settings().clex(m_clex_name);
     m_clexulator = primclex.clexulator(desc.bset);
+    m_corr_cache =
+        open_corr_cache(primclex, desc.bset, m_clexulator.corr_size());
   }
 
   VectorXdAttribute<Configuration>::init(_tmplt);
@@ -787,8 +850,26 @@ Clex::Clex(const Clexulator &clexulator, const ECIContainer &eci,
       m_norm(norm.clone()) {}
 
 /// \brief Returns the atom fraction
+///
+/// If using a project cluster expansion, the value per unit cell and the
+/// correlations are cached in the project property cache.
 double Clex::evaluate(const Configuration &config) const {
-  return m_eci * correlations(config, m_clexulator) / _norm(config);
+  if (m_clex_cache == nullptr || config.id() == "none") {
+    return m_eci *
+           cached_correlations(config, m_clexulator, m_corr_cache.get()) /
+           _norm(config);
+  }
+  std::uint64_t dof_hash = DB::dof_hash(config.configdof().values());
+  double const *cached = m_clex_cache->find(config.name(), dof_hash);
+  double value;
+  if (cached != nullptr) {
+    value = *cached;
+  } else {
+    value =
+        m_eci * cached_correlations(config, m_clexulator, m_corr_cache.get());
+    m_clex_cache->insert(config.name(), dof_hash, &value);
+  }
+  return value / _norm(config);
 }
 
 /// \brief Clone using copy constructor
@@ -813,6 +894,9 @@ bool Clex::init(const Configuration &_tmplt) const {
       err_log << "max eci index: " << m_eci.index().back() << std::endl;
       throw std::runtime_error("Error: bset and eci mismatch");
     }
+    m_corr_cache =
+        open_corr_cache(primclex, desc.bset, m_clexulator.corr_size());
+    m_clex_cache = open_clex_cache(primclex, desc);
   }
   return true;
 }
@@ -5,6 +5,7 @@
 #include "casm/crystallography/Structure.hh"
 #include "casm/crystallography/SuperlatticeEnumerator.hh"
 #include "casm/crystallography/SymType.hh"
+#include "casm/misc/parallel.hh"
 
 namespace CASM {
 
@@ -18,27 +19,31 @@ bool is_guaranteed_for_database_insert(ScelEnumByProps const &enumerator) {
 ///
 /// \param shared_prim A shared prim Structure for which to enumerate Supercells
 /// \param enum_props Specifies which Supercells to enumerate
+/// \param n_threads Maximum number of threads used to enumerate superlattices
+///     and make them canonical. If > 1, this is done for all superlattices on
+///     construction, with each volume enumerated by one thread.
 ///
 /// Note: This variant does not require a PrimClex, and there for cannot insert
 /// Supercells into a Supercell database automatically.
 ///
 ScelEnumByProps::ScelEnumByProps(
     std::shared_ptr<const Structure> const &shared_prim,
-    const xtal::ScelEnumProps &enum_props)
-    : m_shared_prim(shared_prim) {
+    const xtal::ScelEnumProps &enum_props, Index n_threads)
+    : m_shared_prim(shared_prim), m_n_threads(n_threads), m_lattice_index(0) {
   auto const &pg = m_shared_prim->point_group();
   m_lattice_enum.reset(new xtal::SuperlatticeEnumerator(
       pg.begin(), pg.end(), m_shared_prim->lattice(), enum_props));
 
-  m_lat_it = m_lattice_enum->begin();
-  m_lat_end = m_lattice_enum->end();
+  if (m_n_threads > 1) {
+    _make_canonical_lattices();
+  } else {
+    m_lat_it = m_lattice_enum->begin();
+    m_lat_end = m_lattice_enum->end();
+  }
 
-  if (m_lat_it != m_lat_end) {
-    double xtal_tol = m_shared_prim->lattice().tol();
-    Lattice canonical_lattice =
-        xtal::canonical::equivalent(*m_lat_it, pg, xtal_tol);
+  if (!_finished()) {
     m_current =
-        notstd::make_unique<Supercell>(m_shared_prim, canonical_lattice);
+        notstd::make_unique<Supercell>(m_shared_prim, _canonical_lattice());
     this->_initialize(&(*m_current));
   } else {
     this->_invalidate();
@@ -53,15 +58,15 @@ const std::string ScelEnumByProps::enumerator_name = "ScelEnumByProps";
 
 /// Implements increment over supercells
 void ScelEnumByProps::increment() {
-  ++m_lat_it;
+  if (m_n_threads > 1) {
+    ++m_lattice_index;
+  } else {
+    ++m_lat_it;
+  }
 
-  if (m_lat_it != m_lat_end) {
-    double xtal_tol = m_shared_prim->lattice().tol();
-    auto const &pg = m_shared_prim->point_group();
-    Lattice canonical_lattice =
-        xtal::canonical::equivalent(*m_lat_it, pg, xtal_tol);
+  if (!_finished()) {
     m_current =
-        notstd::make_unique<Supercell>(m_shared_prim, canonical_lattice);
+        notstd::make_unique<Supercell>(m_shared_prim, _canonical_lattice());
     this->_initialize(&(*m_current));
     this->_increment_step();
   } else {
@@ -69,4 +74,37 @@ void ScelEnumByProps::increment() {
   }
 }
 
+/// Enumerate all canonical superlattices in parallel
+void ScelEnumByProps::_make_canonical_lattices() {
+  std::vector<Eigen::Matrix3i> matrices = m_lattice_enum->matrices(m_n_threads);
+
+  Eigen::Matrix3d unit_column_mat = m_lattice_enum->unit().lat_column_mat();
+  double xtal_tol = m_shared_prim->lattice().tol();
+  auto const &pg = m_lattice_enum->point_group();
+  m_canonical_lattices.resize(matrices.size());
+  parallel_for(matrices.size(), m_n_threads, [&](Index i) {
+    // Lattice has lazily constructed data, so use a new one on each thread
+    Lattice super(unit_column_mat * matrices[i].cast<double>(), xtal_tol);
+    m_canonical_lattices[i] = xtal::canonical::equivalent(super, pg, xtal_tol);
+  });
+}
+
+/// True if all superlattices have been enumerated
+bool ScelEnumByProps::_finished() const {
+  if (m_n_threads > 1) {
+    return m_lattice_index >= m_canonical_lattices.size();
+  }
+  return m_lat_it == m_lat_end;
+}
+
+/// Canonical form of the current superlattice
+Lattice ScelEnumByProps::_canonical_lattice() const {
+  if (m_n_threads > 1) {
+    return m_canonical_lattices[m_lattice_index];
+  }
+  double xtal_tol = m_shared_prim->lattice().tol();
+  auto const &pg = m_shared_prim->point_group();
+  return xtal::canonical::equivalent(*m_lat_it, pg, xtal_tol);
+}
+
 }  // namespace CASM
@@ -0,0 +1,160 @@
+#include "casm/clex/TableClexulator.hh"
+
+#include "casm/basis_set/OccupantFunction.hh"
+#include "casm/basis_set/PolynomialFunction.hh"
+#include "casm/clex/ClexBasis_impl.hh"
+#include "casm/clex/TableClexulator_impl.hh"
+#include "casm/misc/CASM_math.hh"
+
+namespace CASM {
+
+namespace TableClexulator_impl {
+
+/// \brief Functor to construct an OccTableClexulator, for use with
+/// `for_clex_basis_and_orbits`
+struct MakeOccTableClexulator {
+  MakeOccTableClexulator(
+      PrimNeighborList &_nlist,
+      std::unique_ptr<clexulator::BaseClexulator> &_clexulator)
+      : nlist(_nlist), clexulator(_clexulator) {}
+
+  PrimNeighborList &nlist;
+  std::unique_ptr<clexulator::BaseClexulator> &clexulator;
+
+  template <typename OrbitVecType>
+  void operator()(ClexBasis const &clex_basis,
+                  OrbitVecType const &orbits) const {
+    clexulator = notstd::make_unique<clexulator::OccTableClexulator>(
+        make_occ_table_clexulator_data(clex_basis, orbits, nlist));
+  }
+};
+
+/// \brief Append the terms of an occupation cluster function
+///
+/// \param terms Vector to which terms are appended
+/// \param func Cluster function, a PolynomialFunction of OccupantFunction, with
+///     DoF IDs set to neighbor list indices
+/// \param prefactor Multiplies the coefficient of each term
+/// \param pivot_nlist_ind If valid, the site function of the neighbor with
+///     this index is stored as the term's pivot, separately from the other
+///     factors. Terms that do not depend on the pivot use the constant site
+///     function (offset 0).
+/// \param site_func_offset Offset into the site function value table of each
+///     site function, by (sublattice index, site function index)
+void append_occ_terms(std::vector<OccTerm> &terms, Function const *func,
+                      double prefactor, int pivot_nlist_ind,
+                      SiteFuncOffsetMap const &site_func_offset) {
+  if (!func || func->is_zero()) {
+    return;
+  }
+  PolynomialFunction const *poly =
+      dynamic_cast<PolynomialFunction const *>(func);
+  if (!poly) {
+    throw std::runtime_error(
+        "Error in TableClexulator: cluster function of type '" +
+        func->type_name() + "' is not supported");
+  }
+
+  // arguments, in the order of the polynomial exponents
+  std::vector<OccupantFunction const *> args;
+  for (auto const &arg_bset : poly->argument_bases()) {
+    for (Index i = 0; i < arg_bset->size(); ++i) {
+      args.push_back(dynamic_cast<OccupantFunction const *>((*arg_bset)[i]));
+    }
+  }
+
+  auto it = poly->poly_coeffs().begin();
+  auto end = poly->poly_coeffs().end();
+  for (; it != end; ++it) {
+    if (almost_zero(*it)) continue;
+
+    OccTerm term;
+    term.coeff = prefactor * (*it);
+    term.pivot_site_func = 0;
+    bool has_pivot = false;
+    Array<Index> const &key = it.key();
+    for (Index linear_ind = 0; linear_ind < key.size(); ++linear_ind) {
+      if (!key[linear_ind]) continue;
+      OccupantFunction const *occ_func = args[linear_ind];
+      if (!occ_func) {
+        throw std::runtime_error(
+            "Error in TableClexulator: cluster function arguments must be "
+            "occupation site basis functions");
+      }
+      int nlist_ind = occ_func->dof().ID();
+      int offset = site_func_offset.at(
+          std::make_pair(occ_func->basis_ind(), occ_func->occ_func_ind()));
+      for (Index p = 0; p < key[linear_ind]; ++p) {
+        if (nlist_ind == pivot_nlist_ind) {
+          if (has_pivot) {
+            throw std::runtime_error(
+                "Error in TableClexulator: cluster function terms with more "
+                "than one site function on one site are not supported");
+          }
+          term.pivot_site_func = offset;
+          has_pivot = true;
+        } else {
+          term.factor_nlist_ind.push_back(nlist_ind);
+          term.factor_site_func.push_back(offset);
+        }
+      }
+    }
+    terms.push_back(std::move(term));
+  }
+}
+
+/// \brief Flatten terms, by function, into an OccTermTable
+///
+/// \param terms Terms of each function
+/// \param with_pivot If true, store the pivot site function of each term
+clexulator::OccTermTable make_occ_term_table(
+    std::vector<std::vector<OccTerm> > const &terms, bool with_pivot) {
+  clexulator::OccTermTable table;
+  table.term_begin.push_back(0);
+  table.factor_begin.push_back(0);
+  for (auto const &function_terms : terms) {
+    for (auto const &term : function_terms) {
+      table.coeff.push_back(term.coeff);
+      if (with_pivot) {
+        table.pivot_site_func.push_back(term.pivot_site_func);
+      }
+      table.factor_nlist_ind.insert(table.factor_nlist_ind.end(),
+                                    term.factor_nlist_ind.begin(),
+                                    term.factor_nlist_ind.end());
+      table.factor_site_func.insert(table.factor_site_func.end(),
+                                    term.factor_site_func.begin(),
+                                    term.factor_site_func.end());
+      table.factor_begin.push_back(table.factor_nlist_ind.size());
+    }
+    table.term_begin.push_back(table.coeff.size());
+  }
+  return table;
+}
+
+}  // namespace TableClexulator_impl
+
+/// \brief Construct a Clexulator which evaluates occupation basis functions
+/// from tables, without generating and compiling source code
+///
+/// \param name Clexulator name
+/// \param shared_prim Shared prim structure
+/// \param basis_set_specs Describes how to generate cluster basis functions
+/// \param nlist PrimNeighborList, expanded as necessary to include the
+///     neighborhood of the basis functions
+///
+/// The resulting Clexulator evaluates the same functions as the Clexulator
+/// compiled from the source code written by `write_basis_set_data`. For local
+/// cluster expansions, the first equivalent local basis is used.
+///
+/// Throws if the basis functions include DoF other than occupation.
+Clexulator make_table_clexulator(
+    std::string name, std::shared_ptr<Structure const> const &shared_prim,
+    ClexBasisSpecs const &basis_set_specs, PrimNeighborList &nlist) {
+  std::unique_ptr<clexulator::BaseClexulator> clexulator;
+  TableClexulator_impl::MakeOccTableClexulator f{nlist, clexulator};
+  std::ostream nullstream(0);
+  for_clex_basis_and_orbits(shared_prim, basis_set_specs, nullstream, f);
+  return Clexulator(name, std::move(clexulator), nlist);
+}
+
+}  // namespace CASM
@@ -5,14 +5,56 @@
 namespace CASM {
 namespace clexulator {
 
+/// \brief Construct an empty EvaluationContext, which can not be used for
+/// evaluation
+EvaluationContext::EvaluationContext()
+    : m_clexulator(nullptr),
+      m_configdofvalues_ptr(nullptr),
+      m_nlist_ptr(nullptr),
+      m_occ_ptr(nullptr),
+      m_params(nullptr) {}
+
+/// \brief Construct an EvaluationContext for evaluating `_clexulator`
+///
+/// The context uses a copy of `_clexulator.param_pack()`, including its
+/// current evaluation modes and parameter values.
+EvaluationContext::EvaluationContext(BaseClexulator const &_clexulator)
+    : m_clexulator(&_clexulator),
+      m_configdofvalues_ptr(nullptr),
+      m_nlist_ptr(nullptr),
+      m_occ_ptr(nullptr),
+      m_local_dof_ptrs(_clexulator.m_dof_ptrs_size, nullptr),
+      m_global_dof_ptrs(_clexulator.m_dof_ptrs_size, nullptr),
+      m_owned_params(_clexulator.param_pack().clone()),
+      m_params(m_owned_params.get()) {}
+
+EvaluationContext::EvaluationContext(EvaluationContext const &other)
+    : m_clexulator(other.m_clexulator),
+      m_configdofvalues_ptr(other.m_configdofvalues_ptr),
+      m_nlist_ptr(other.m_nlist_ptr),
+      m_occ_ptr(other.m_occ_ptr),
+      m_local_dof_ptrs(other.m_local_dof_ptrs),
+      m_global_dof_ptrs(other.m_global_dof_ptrs),
+      m_owned_params(other.m_owned_params ? other.m_owned_params->clone()
+                                          : nullptr),
+      m_params(m_owned_params ? m_owned_params.get() : other.m_params) {}
+
+EvaluationContext &EvaluationContext::operator=(
+    EvaluationContext const &other) {
+  if (this != &other) {
+    *this = EvaluationContext(other);
+  }
+  return *this;
+}
+
+EvaluationContext::~EvaluationContext() {}
+
 BaseClexulator::BaseClexulator(size_type _nlist_size, size_type _corr_size,
                                size_type _n_point_corr)
     : m_nlist_size(_nlist_size),
       m_corr_size(_corr_size),
       m_n_point_corr(_n_point_corr),
-      m_configdofvalues_ptr(nullptr),
-      m_nlist_ptr(nullptr),
-      m_occ_ptr(nullptr) {}
+      m_dof_ptrs_size(0) {}
 
 BaseClexulator::~BaseClexulator() {}
 
@@ -27,5 +69,93 @@ ClexParamKey const &BaseClexulator::param_key(
   return param_pack().key(_param_name);
 }
 
+void BaseClexulator::_throw_context_error() const {
+  throw std::runtime_error(
+      "Clexulator error: EvaluationContext was not constructed for this "
+      "Clexulator");
+}
+
+/// \brief Reset the default context to use this BaseClexulator and its
+/// ClexParamPack
+///
+/// Notes:
+/// - The default context is copied along with the BaseClexulator, and is
+///   reset on first use by the copy
+void BaseClexulator::_reset_default_context() const {
+  EvaluationContext &context = m_default_context;
+  context.m_clexulator = this;
+  context.m_configdofvalues_ptr = nullptr;
+  context.m_nlist_ptr = nullptr;
+  context.m_occ_ptr = nullptr;
+  context.m_local_dof_ptrs.assign(m_dof_ptrs_size, nullptr);
+  context.m_global_dof_ptrs.assign(m_dof_ptrs_size, nullptr);
+  context.m_owned_params.reset();
+  context.m_params = &const_cast<BaseClexulator *>(this)->param_pack();
+}
+
+/// \brief Set pointers to DoF values in an EvaluationContext
+void BaseClexulator::_set_configdofvalues(
+    EvaluationContext &_context,
+    ConfigDoFValues const &_configdofvalues) const {
+  _context.m_configdofvalues_ptr = &_configdofvalues;
+  _context.m_occ_ptr = _configdofvalues.occupation.data();
+  for (auto const &dof : m_local_dof_registry) {
+    auto it = _configdofvalues.local_dof_values.find(dof.first);
+    if (it == _configdofvalues.local_dof_values.end()) {
+      std::stringstream msg;
+      msg << "Clexulator error: ConfigDoFValues missing required local DoF "
+             "type '"
+          << dof.first << "'";
+      throw std::runtime_error(msg.str());
+    }
+    _context.m_local_dof_ptrs[dof.second] = &it->second;
+  }
+
+  for (auto const &dof : m_global_dof_registry) {
+    auto it = _configdofvalues.global_dof_values.find(dof.first);
+    if (it == _configdofvalues.global_dof_values.end()) {
+      std::stringstream msg;
+      msg << "Clexulator error: ConfigDoFValues missing required global "
+             "DoF type '"
+          << dof.first << "'";
+      throw std::runtime_error(msg.str());
+    }
+    _context.m_global_dof_ptrs[dof.second] = &it->second;
+  }
+}
+
+/// \brief Calculate the change in select point correlations due to a
+/// sequence of occupant changes
+void BaseClexulator::_calc_restricted_delta_point_corr(
+    EvaluationContext &_context, OccDelta const *_delta_begin,
+    OccDelta const *_delta_end, double *_corr_begin,
+    size_type const *_corr_ind_begin, size_type const *_corr_ind_end) const {
+  for (auto it = _corr_ind_begin; it != _corr_ind_end; ++it) {
+    *(_corr_begin + *it) = 0.0;
+  }
+  std::vector<double> &tmp = _delta_corr_tmp(_context);
+  tmp.resize(corr_size());
+  double *tmp_begin = tmp.data();
+
+  for (auto delta = _delta_begin; delta != _delta_end; ++delta) {
+    _set_nlist(_context, delta->nlist_begin);
+    _calc_restricted_delta_point_corr(_context, delta->neighbor_ind,
+                                      delta->occ_i, delta->occ_f, tmp_begin,
+                                      _corr_ind_begin, _corr_ind_end);
+    for (auto it = _corr_ind_begin; it != _corr_ind_end; ++it) {
+      *(_corr_begin + *it) += *(tmp_begin + *it);
+    }
+    _set_occ(_context, *(delta->nlist_begin + delta->neighbor_ind),
+             delta->occ_f);
+  }
+
+  // revert changes, in reverse order in case a site is changed more than once
+  for (auto delta = _delta_end; delta != _delta_begin;) {
+    --delta;
+    _set_occ(_context, *(delta->nlist_begin + delta->neighbor_ind),
+             delta->occ_i);
+  }
+}
+
 }  // namespace clexulator
 }  // namespace CASM
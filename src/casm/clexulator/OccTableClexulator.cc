@@ -0,0 +1,257 @@
+#include "casm/clexulator/OccTableClexulator.hh"
+
+#include "casm/clexulator/BasicClexParamPack.hh"
+
+namespace CASM {
+namespace clexulator {
+
+OccTableClexulator::OccTableClexulator(OccTableClexulatorData _data)
+    : BaseClexulator(_data.nlist_size, _data.corr_size, _data.n_point_corr),
+      m_data(std::move(_data)),
+      m_params(new BasicClexParamPack()) {
+  if (m_data.global_terms.term_begin.size() != corr_size() + 1 ||
+      m_data.point_terms.term_begin.size() !=
+          n_point_corr() * corr_size() + 1) {
+    throw std::runtime_error(
+        "Error constructing OccTableClexulator: basis function tables are "
+        "not consistent with corr_size and n_point_corr");
+  }
+
+  m_corr_param_key = m_params->allocate("corr", corr_size(), 1, false);
+
+  m_neighborhood = m_data.neighborhood;
+  m_orbit_neighborhood = m_data.orbit_neighborhood;
+  m_orbit_site_neighborhood = m_data.orbit_site_neighborhood;
+  m_weight_matrix = m_data.weight_matrix;
+  m_sublat_indices = m_data.sublat_indices;
+  m_n_sublattices = m_data.n_sublattices;
+}
+
+OccTableClexulator::OccTableClexulator(OccTableClexulator const &other)
+    : BaseClexulator(other),
+      m_data(other.m_data),
+      m_params(new BasicClexParamPack(*other.m_params)),
+      m_corr_param_key(other.m_corr_param_key) {}
+
+OccTableClexulator::~OccTableClexulator() {}
+
+/// \brief Obtain const reference to abstract ClexParamPack object
+ClexParamPack const &OccTableClexulator::param_pack() const {
+  return *m_params;
+}
+
+/// \brief Obtain reference to abstract ClexParamPack object
+ClexParamPack &OccTableClexulator::param_pack() { return *m_params; }
+
+/// \brief Calculate contribution to global correlations from one unit cell
+void OccTableClexulator::_calc_global_corr_contribution(
+    EvaluationContext &_context) const {
+  for (size_type i = 0; i < corr_size(); i++) {
+    _context_params(_context).write(m_corr_param_key, i,
+                                    _eval_global(_context, i));
+  }
+}
+
+/// \brief Calculate contribution to global correlations from one unit cell
+void OccTableClexulator::_calc_global_corr_contribution(
+    EvaluationContext &_context, double *_corr_begin) const {
+  for (size_type i = 0; i < corr_size(); i++) {
+    *(_corr_begin + i) = _eval_global(_context, i);
+  }
+}
+
+/// \brief Calculate contribution to select global correlations from one unit
+/// cell
+void OccTableClexulator::_calc_restricted_global_corr_contribution(
+    EvaluationContext &_context, size_type const *_corr_ind_begin,
+    size_type const *_corr_ind_end) const {
+  for (; _corr_ind_begin < _corr_ind_end; _corr_ind_begin++) {
+    _context_params(_context).write(m_corr_param_key, *_corr_ind_begin,
+                                    _eval_global(_context, *_corr_ind_begin));
+  }
+}
+
+/// \brief Calculate contribution to select global correlations from one unit
+/// cell
+void OccTableClexulator::_calc_restricted_global_corr_contribution(
+    EvaluationContext &_context, double *_corr_begin,
+    size_type const *_corr_ind_begin, size_type const *_corr_ind_end) const {
+  for (; _corr_ind_begin < _corr_ind_end; _corr_ind_begin++) {
+    *(_corr_begin + *_corr_ind_begin) =
+        _eval_global(_context, *_corr_ind_begin);
+  }
+}
+
+/// \brief Calculate point correlations about basis site 'neighbor_ind'
+void OccTableClexulator::_calc_point_corr(EvaluationContext &_context,
+                                          int neighbor_ind) const {
+  for (size_type i = 0; i < corr_size(); i++) {
+    _context_params(_context).write(m_corr_param_key, i,
+                                    _eval_point(_context, neighbor_ind, i));
+  }
+}
+
+/// \brief Calculate point correlations about basis site 'neighbor_ind'
+void OccTableClexulator::_calc_point_corr(EvaluationContext &_context,
+                                          int neighbor_ind,
+                                          double *_corr_begin) const {
+  for (size_type i = 0; i < corr_size(); i++) {
+    *(_corr_begin + i) = _eval_point(_context, neighbor_ind, i);
+  }
+}
+
+/// \brief Calculate select point correlations about basis site 'neighbor_ind'
+void OccTableClexulator::_calc_restricted_point_corr(
+    EvaluationContext &_context, int neighbor_ind,
+    size_type const *_corr_ind_begin, size_type const *_corr_ind_end) const {
+  for (; _corr_ind_begin < _corr_ind_end; _corr_ind_begin++) {
+    _context_params(_context).write(
+        m_corr_param_key, *_corr_ind_begin,
+        _eval_point(_context, neighbor_ind, *_corr_ind_begin));
+  }
+}
+
+/// \brief Calculate select point correlations about basis site 'neighbor_ind'
+void OccTableClexulator::_calc_restricted_point_corr(
+    EvaluationContext &_context, int neighbor_ind, double *_corr_begin,
+    size_type const *_corr_ind_begin, size_type const *_corr_ind_end) const {
+  for (; _corr_ind_begin < _corr_ind_end; _corr_ind_begin++) {
+    *(_corr_begin + *_corr_ind_begin) =
+        _eval_point(_context, neighbor_ind, *_corr_ind_begin);
+  }
+}
+
+/// \brief Calculate the change in point correlations due to changing an
+/// occupant
+void OccTableClexulator::_calc_delta_point_corr(EvaluationContext &_context,
+                                                int neighbor_ind, int occ_i,
+                                                int occ_f) const {
+  for (size_type i = 0; i < corr_size(); i++) {
+    _context_params(_context).write(
+        m_corr_param_key, i,
+        _eval_delta_point(_context, neighbor_ind, occ_i, occ_f, i));
+  }
+}
+
+/// \brief Calculate the change in point correlations due to changing an
+/// occupant
+void OccTableClexulator::_calc_delta_point_corr(EvaluationContext &_context,
+                                                int neighbor_ind, int occ_i,
+                                                int occ_f,
+                                                double *_corr_begin) const {
+  for (size_type i = 0; i < corr_size(); i++) {
+    *(_corr_begin + i) =
+        _eval_delta_point(_context, neighbor_ind, occ_i, occ_f, i);
+  }
+}
+
+/// \brief Calculate the change in select point correlations due to changing
+/// an occupant
+void OccTableClexulator::_calc_restricted_delta_point_corr(
+    EvaluationContext &_context, int neighbor_ind, int occ_i, int occ_f,
+    size_type const *_corr_ind_begin, size_type const *_corr_ind_end) const {
+  for (; _corr_ind_begin < _corr_ind_end; _corr_ind_begin++) {
+    _context_params(_context).write(
+        m_corr_param_key, *_corr_ind_begin,
+        _eval_delta_point(_context, neighbor_ind, occ_i, occ_f,
+                          *_corr_ind_begin));
+  }
+}
+
+/// \brief Calculate the change in select point correlations due to changing
+/// an occupant
+void OccTableClexulator::_calc_restricted_delta_point_corr(
+    EvaluationContext &_context, int neighbor_ind, int occ_i, int occ_f,
+    double *_corr_begin, size_type const *_corr_ind_begin,
+    size_type const *_corr_ind_end) const {
+  for (; _corr_ind_begin < _corr_ind_end; _corr_ind_begin++) {
+    *(_corr_begin + *_corr_ind_begin) = _eval_delta_point(
+        _context, neighbor_ind, occ_i, occ_f, *_corr_ind_begin);
+  }
+}
+
+/// \brief Calculate the change in select point correlations due to a
+/// sequence of occupant changes
+void OccTableClexulator::_calc_restricted_delta_point_corr(
+    EvaluationContext &_context, OccDelta const *_delta_begin,
+    OccDelta const *_delta_end, double *_corr_begin,
+    size_type const *_corr_ind_begin, size_type const *_corr_ind_end) const {
+  for (auto it = _corr_ind_begin; it < _corr_ind_end; it++) {
+    *(_corr_begin + *it) = 0.0;
+  }
+  for (auto delta = _delta_begin; delta < _delta_end; delta++) {
+    _set_nlist(_context, delta->nlist_begin);
+    for (auto it = _corr_ind_begin; it < _corr_ind_end; it++) {
+      *(_corr_begin + *it) += _eval_delta_point(
+          _context, delta->neighbor_ind, delta->occ_i, delta->occ_f, *it);
+    }
+    _set_occ(_context, _l(_context, delta->neighbor_ind), delta->occ_f);
+  }
+
+  // revert changes, in reverse order in case a site is changed more than once
+  while (_delta_end != _delta_begin) {
+    --_delta_end;
+    _set_occ(_context, *(_delta_end->nlist_begin + _delta_end->neighbor_ind),
+             _delta_end->occ_i);
+  }
+}
+
+/// \brief Evaluate the product of factors of term `t`
+inline double OccTableClexulator::_eval_factors(
+    EvaluationContext const &_context, OccTermTable const &table,
+    Index t) const {
+  double const *values = m_data.site_func_values.data();
+  int const *nlist_ind = table.factor_nlist_ind.data();
+  int const *site_func = table.factor_site_func.data();
+  double result = table.coeff[t];
+  for (Index k = table.factor_begin[t]; k < table.factor_begin[t + 1]; ++k) {
+    result *= values[site_func[k] + _occ(_context, nlist_ind[k])];
+  }
+  return result;
+}
+
+/// \brief Evaluate global function `i`
+double OccTableClexulator::_eval_global(EvaluationContext const &_context,
+                                        Index i) const {
+  OccTermTable const &table = m_data.global_terms;
+  double result = 0.0;
+  for (Index t = table.term_begin[i]; t < table.term_begin[i + 1]; ++t) {
+    result += _eval_factors(_context, table, t);
+  }
+  return result;
+}
+
+/// \brief Evaluate point function `i` about neighbor `neighbor_ind`
+double OccTableClexulator::_eval_point(EvaluationContext const &_context,
+                                       int neighbor_ind, Index i) const {
+  OccTermTable const &table = m_data.point_terms;
+  double const *values = m_data.site_func_values.data();
+  int pivot_occ = _occ(_context, neighbor_ind);
+  Index f = neighbor_ind * Index(corr_size()) + i;
+  double result = 0.0;
+  for (Index t = table.term_begin[f]; t < table.term_begin[f + 1]; ++t) {
+    result += values[table.pivot_site_func[t] + pivot_occ] *
+              _eval_factors(_context, table, t);
+  }
+  return result;
+}
+
+/// \brief Evaluate change in point function `i` about neighbor `neighbor_ind`,
+/// due to changing its occupant from `occ_i` to `occ_f`
+double OccTableClexulator::_eval_delta_point(EvaluationContext const &_context,
+                                             int neighbor_ind, int occ_i,
+                                             int occ_f, Index i) const {
+  OccTermTable const &table = m_data.point_terms;
+  double const *values = m_data.site_func_values.data();
+  Index f = neighbor_ind * Index(corr_size()) + i;
+  double result = 0.0;
+  for (Index t = table.term_begin[f]; t < table.term_begin[f + 1]; ++t) {
+    int pivot = table.pivot_site_func[t];
+    result += (values[pivot + occ_f] - values[pivot + occ_i]) *
+              _eval_factors(_context, table, t);
+  }
+  return result;
+}
+
+}  // namespace clexulator
+}  // namespace CASM
@@ -160,7 +160,7 @@ PeriodicMaxLengthClusterSpecs::_make_periodic_orbits(
   // now generate orbits
   PeriodicOrbitVec orbits;
   make_orbits(specs.begin(), specs.end(), custom_generators,
-              std::back_inserter(orbits), status);
+              std::back_inserter(orbits), status, n_threads);
   return orbits;
 }
 
@@ -245,7 +245,7 @@ ClusterSpecs::LocalOrbitVec LocalMaxLengthClusterSpecs::_make_local_orbits(
   // now generate orbits
   LocalOrbitVec orbits;
   make_orbits(specs.begin(), specs.end(), custom_generators,
-              std::back_inserter(orbits), status);
+              std::back_inserter(orbits), status, n_threads);
   return orbits;
 }
 
@@ -206,7 +206,8 @@ std::unique_ptr<SymGroup> parse_local_generating_group(
 ///     ...},
 ///   "orbit_specs": [ // optional
 ///      ... prototype periodic clusters...
-///   ]
+///   ],
+///   "n_threads": <int> // optional, default=1
 /// }
 /// \endcode
 ///
@@ -238,12 +239,20 @@ void parse(InputParser<PeriodicMaxLengthClusterSpecs> &parser,
       parser.subparse_else<std::vector<IntegralClusterOrbitGenerator>>(
           "orbit_specs", default_custom_generators, *shared_prim);
 
+  // parse number of threads
+  Index n_threads;
+  parser.optional_else(n_threads, "n_threads", Index(1));
+  if (n_threads < 1) {
+    parser.insert_error("n_threads", "Error: n_threads must be >= 1");
+  }
+
   if (!parser.valid()) {
     return;
   }
   parser.value = notstd::make_unique<PeriodicMaxLengthClusterSpecs>(
       shared_prim, *generating_group_ptr, dof_sites_filter(), max_length,
       *custom_generators_parser->value);
+  parser.value->n_threads = n_threads;
 }
 
 /// Parse LocalMaxLengthClusterSpecs from JSON
@@ -306,6 +315,13 @@ void parse(InputParser<LocalMaxLengthClusterSpecs> &parser,
   // TODO: include option in JSON?
   bool include_phenomenal_sites = false;
 
+  // parse number of threads
+  Index n_threads;
+  parser.optional_else(n_threads, "n_threads", Index(1));
+  if (n_threads < 1) {
+    parser.insert_error("n_threads", "Error: n_threads must be >= 1");
+  }
+
   if (!parser.valid()) {
     return;
   }
@@ -313,6 +329,7 @@ void parse(InputParser<LocalMaxLengthClusterSpecs> &parser,
       shared_prim, *generating_group_ptr, phenomenal, dof_sites_filter(),
       max_length, cutoff_radius, include_phenomenal_sites,
       *custom_generators_parser->value);
+  parser.value->n_threads = n_threads;
 }
 
 /// \brief Parse PeriodicMaxLengthClusterSpecs or LocalMaxLengthClusterSpecs
@@ -429,6 +446,10 @@ void parse(InputParser<ClusterSpecs> &parser,
 ///                 An array of clusters which are used to generate and include
 ///                 orbits of clusters whether or not they meet the `max_length`
 ///                 truncation criteria. See the cluster input format below.
+///             n_threads: int (optional, default=1)
+///                 Number of threads used to generate orbits. The orbits
+///                 generated do not depend on `n_threads`. It is a runtime
+///                 setting and is not written by `to_json`.
 ///
 ///         For method=="local_max_length":
 ///             phenomenal: object (required)
@@ -463,6 +484,10 @@ void parse(InputParser<ClusterSpecs> &parser,
 ///                 orbits of clusters whether or not they meet the
 ///                 `cutoff_radius` or `max_length` truncation criteria. See the
 ///                 cluster input format below.
+///             n_threads: int (optional, default=1)
+///                 Number of threads used to generate orbits. The orbits
+///                 generated do not depend on `n_threads`. It is a runtime
+///                 setting and is not written by `to_json`.
 ///
 /// Cluster input format for "orbit_specs" and "phenomenal": object
 ///     coordinate_mode: string (optional, default="Integral")
@@ -420,6 +420,21 @@ StrucMapper::StrucMapper(
 
   // Make sure that max_volume_change is positive
   m_max_volume_change = max(3 * xtal_tol(), _max_volume_change);
+
+  m_superlat_cache = std::make_shared<SuperlatticeCache>(
+      Lattice(parent().lat_column_mat, xtal_tol()), m_calc_ptr->point_group());
+}
+
+//*******************************************************************************************
+
+void StrucMapper::set_superlattice_cache(
+    std::shared_ptr<SuperlatticeCache> _superlat_cache) {
+  if (_superlat_cache->key() != m_superlat_cache->key()) {
+    throw std::runtime_error(
+        "Error in StrucMapper::set_superlattice_cache: superlattice cache does "
+        "not match the parent lattice, point group, and tolerance");
+  }
+  m_superlat_cache = _superlat_cache;
 }
 
 //*******************************************************************************************
@@ -696,30 +711,13 @@ std::vector<Lattice> StrucMapper::_lattices_of_vol(Index prim_vol) const {
   if (this->lattices_constrained()) {
     // This may very well return an empty vector, saving painful time
     // enumerating things
-    return m_allowed_superlat_map[prim_vol];
-  }
-
-  // If we already have candidate lattices for the given volume, return those
-  auto it = m_superlat_map.find(prim_vol);
-  if (it != m_superlat_map.end()) return it->second;
-
-  // We don't have any lattices for the provided volume, enumerate them all!!!
-  std::vector<Lattice> &lat_vec = m_superlat_map[prim_vol];
-
-  auto pg = calculator().point_group();
-  SuperlatticeEnumerator enumerator(
-      pg.begin(), pg.end(), Lattice(parent().lat_column_mat, xtal_tol()),
-      ScelEnumProps(prim_vol, prim_vol + 1));
-
-  for (auto it = enumerator.begin(); it != enumerator.end(); ++it) {
-    Lattice canon_lat = *it;
-    if (canonical::check(canon_lat, calculator().point_group())) {
-      canon_lat = canonical::equivalent(canon_lat, calculator().point_group());
-    }
-    lat_vec.push_back(canon_lat);
+    auto it = m_allowed_superlat_map.find(prim_vol);
+    if (it == m_allowed_superlat_map.end()) return {};
+    return it->second;
   }
 
-  return lat_vec;
+  // Candidate lattices are enumerated once per volume, and shared by copies
+  return m_superlat_cache->lattices_of_vol(prim_vol);
 }
 
 //*******************************************************************************************
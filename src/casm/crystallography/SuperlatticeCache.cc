@@ -0,0 +1,147 @@
+#include "casm/crystallography/SuperlatticeCache.hh"
+
+#include <iomanip>
+#include <sstream>
+
+#include "casm/crystallography/CanonicalForm.hh"
+#include "casm/crystallography/SuperlatticeEnumerator.hh"
+
+namespace CASM {
+namespace xtal {
+
+namespace {
+
+/// FNV-1a hash of a string, as a hexadecimal string
+std::string _hash_string(std::string const &str) {
+  std::uint64_t hash = 14695981039346656037ULL;
+  for (unsigned char c : str) {
+    hash ^= c;
+    hash *= 1099511628211ULL;
+  }
+  std::stringstream ss;
+  ss << std::hex << std::setw(16) << std::setfill('0') << hash;
+  return ss.str();
+}
+
+/// Summarize the parent lattice, point group, and tolerance
+///
+/// Values are rounded, so that the key does not change with the last digits of
+/// the lattice vectors
+std::string _make_key(Lattice const &parent_lattice,
+                      SymOpVector const &point_group) {
+  std::stringstream ss;
+  ss << std::fixed << std::setprecision(6);
+  auto print = [&](Eigen::Matrix3d const &M) {
+    for (Index i = 0; i < 3; ++i) {
+      for (Index j = 0; j < 3; ++j) {
+        // avoid printing "-0.000000"
+        double value = std::abs(M(i, j)) < 5e-7 ? 0.0 : M(i, j);
+        ss << value << " ";
+      }
+    }
+  };
+  print(parent_lattice.lat_column_mat());
+  ss << std::scientific << parent_lattice.tol() << std::fixed << " ";
+  ss << point_group.size() << " ";
+  for (auto const &op : point_group) {
+    print(op.matrix);
+  }
+  return _hash_string(ss.str());
+}
+
+}  // namespace
+
+SuperlatticeCache::SuperlatticeCache(Lattice const &_parent_lattice,
+                                     SymOpVector const &_point_group)
+    : m_parent_lattice(_parent_lattice.lat_column_mat(),
+                       _parent_lattice.tol()),
+      m_point_group(_point_group),
+      m_key(_make_key(_parent_lattice, _point_group)),
+      m_modified(false) {}
+
+/// \brief Return canonical superlattices of the parent lattice with the given
+/// volume (as a multiple of the parent lattice volume)
+///
+/// - If the superlattices of the given volume are not yet in the cache, they
+///   are enumerated and stored. Enumeration is done without holding a lock, so
+///   other threads may use the cache meanwhile.
+std::vector<Lattice> SuperlatticeCache::lattices_of_vol(Index prim_vol) const {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  auto it = m_transf_mat.find(prim_vol);
+  if (it == m_transf_mat.end()) {
+    lock.unlock();
+    std::vector<Eigen::Matrix3l> transf_mat = _enumerate(prim_vol);
+    lock.lock();
+    // if another thread enumerated the same volume meanwhile, that is kept
+    auto res = m_transf_mat.emplace(prim_vol, std::move(transf_mat));
+    it = res.first;
+    if (res.second) {
+      m_modified = true;
+    }
+  }
+
+  std::vector<Lattice> result;
+  result.reserve(it->second.size());
+  for (auto const &T : it->second) {
+    result.emplace_back(m_parent_lattice.lat_column_mat() * T.cast<double>(),
+                        m_parent_lattice.tol());
+  }
+  return result;
+}
+
+/// \brief Insert superlattices of the given volume, as transformation
+/// matrices, if not yet in the cache
+///
+/// - Inserting does not set `modified()`
+void SuperlatticeCache::insert(
+    Index prim_vol,
+    std::vector<Eigen::Matrix3l> const &transformation_matrices) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_transf_mat.emplace(prim_vol, transformation_matrices);
+}
+
+/// \brief Copy of all cached transformation matrices
+SuperlatticeCache::TransfMatMapType SuperlatticeCache::transformation_matrices()
+    const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_transf_mat;
+}
+
+/// \brief True if superlattices were enumerated since construction or the
+/// last call to `set_saved`
+bool SuperlatticeCache::modified() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_modified;
+}
+
+/// \brief Indicate the cache contents have been saved
+void SuperlatticeCache::set_saved() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_modified = false;
+}
+
+/// Enumerate canonical superlattices of the parent lattice with given volume
+std::vector<Eigen::Matrix3l> SuperlatticeCache::_enumerate(
+    Index prim_vol) const {
+  // Lattice has lazily constructed data, so use a copy for thread safety
+  Lattice parent_lattice(m_parent_lattice.lat_column_mat(),
+                         m_parent_lattice.tol());
+
+  SuperlatticeEnumerator enumerator(m_point_group.begin(), m_point_group.end(),
+                                    parent_lattice,
+                                    ScelEnumProps(prim_vol, prim_vol + 1));
+
+  std::vector<Eigen::Matrix3l> result;
+  for (auto it = enumerator.begin(); it != enumerator.end(); ++it) {
+    Lattice canon_lat = *it;
+    if (canonical::check(canon_lat, m_point_group)) {
+      canon_lat = canonical::equivalent(canon_lat, m_point_group);
+    }
+    result.push_back(make_transformation_matrix_to_super(
+        parent_lattice, canon_lat, parent_lattice.tol()));
+  }
+  return result;
+}
+
+}  // namespace xtal
+}  // namespace CASM
@@ -3,10 +3,22 @@
 #include "casm/crystallography/HermiteCounter.hh"
 #include "casm/external/Eigen/Dense"
 #include "casm/misc/CASM_Eigen_math.hh"
+#include "casm/misc/parallel.hh"
 
 namespace CASM {
 namespace xtal {
 
+//*******************************************************************************************************************//
+// Matrix3iHash
+
+std::size_t Matrix3iHash::operator()(const Eigen::Matrix3i &value) const {
+  std::size_t seed = 9;
+  for (int i = 0; i < 9; ++i) {
+    seed ^= value(i) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+  }
+  return seed;
+}
+
 //*******************************************************************************************************************//
 // ScelEnumProps
 
@@ -91,7 +103,7 @@ void SuperlatticeIterator::_increment() {
   if (m_current->determinant() >= m_enum->end_volume()) {
     return;
   }
-  m_canon_hist.push_back(matrix());
+  m_canon_hist.insert(matrix());
   _advance_one();
   _advance_if_invalid();
 }
@@ -150,8 +162,7 @@ bool SuperlatticeIterator::_current_is_valid_and_unique() const {
   }
 
   // check canonical hnf criteria for uniqueness
-  if (std::find(m_canon_hist.begin(), m_canon_hist.end(), matrix()) !=
-      m_canon_hist.end()) {
+  if (m_canon_hist.count(matrix())) {
     return false;
   }
 
@@ -230,6 +241,36 @@ SuperlatticeEnumerator::citerator(size_type volume) const {
   return SuperlatticeIterator(*this, volume, dimension());
 }
 
+/// \brief Transformation matrices of all unique superlattices, in iteration
+/// order, enumerating volumes in parallel
+///
+/// \param n_threads Maximum number of threads. Superlattices of each volume
+///     are enumerated by one thread, starting with the largest volumes, which
+///     take the longest.
+///
+/// \returns The same matrices, in the same order, as iterating from begin()
+///     to end() and collecting `it.matrix()`, for any number of threads.
+///
+std::vector<Eigen::Matrix3i> SuperlatticeEnumerator::matrices(
+    Index n_threads) const {
+  Index n_volumes = std::max(m_end_volume - m_begin_volume, 0);
+  std::vector<std::vector<Eigen::Matrix3i>> matrices_by_volume(n_volumes);
+  parallel_for(n_volumes, n_threads, [&](Index i) {
+    Index volume_index = n_volumes - 1 - i;
+    size_type volume = m_begin_volume + volume_index;
+    auto &result = matrices_by_volume[volume_index];
+    for (auto it = citerator(volume); it.volume() == volume; ++it) {
+      result.push_back(it.matrix());
+    }
+  });
+
+  std::vector<Eigen::Matrix3i> result;
+  for (auto const &volume_matrices : matrices_by_volume) {
+    result.insert(result.end(), volume_matrices.begin(), volume_matrices.end());
+  }
+  return result;
+}
+
 //*******************************************************************************************************************//
 // Functions
 
@@ -271,6 +312,7 @@ Eigen::Matrix3i canonical_hnf(const Eigen::Matrix3i &T,
                               const SymOpVector &effective_pg,
                               const Lattice &ref_lattice) {
   Eigen::Matrix3d lat = ref_lattice.lat_column_mat();
+  Eigen::Matrix3d lat_inv = lat.inverse();
 
   // get T in hermite normal form
   // H is the canonical form of the initial T matrix
@@ -282,7 +324,7 @@ Eigen::Matrix3i canonical_hnf(const Eigen::Matrix3i &T,
 
   for (const auto &op : effective_pg) {
     Eigen::Matrix3i transformed =
-        iround(lat.inverse() * get_matrix(op) * lat) * H;
+        iround(lat_inv * get_matrix(op) * lat) * H;
     Eigen::Matrix3i H_transformed = hermite_normal_form(transformed).first;
 
     // If you fall in here then transformed was greater than H
@@ -0,0 +1,90 @@
+#include "casm/crystallography/io/SuperlatticeCacheIO.hh"
+
+#include <boost/filesystem.hpp>
+
+#include "casm/casm_io/container/json_io.hh"
+#include "casm/casm_io/json/jsonParser.hh"
+#include "casm/crystallography/SuperlatticeCache.hh"
+
+namespace CASM {
+
+// write as {"<volume>": [<transformation matrix>, ...], ...}
+jsonParser &to_json(const xtal::SuperlatticeCache &cache, jsonParser &json) {
+  json.put_obj();
+  for (auto const &value : cache.transformation_matrices()) {
+    jsonParser &vol_json = json[std::to_string(value.first)].put_array();
+    for (auto const &T : value.second) {
+      jsonParser tjson;
+      vol_json.push_back(to_json(T, tjson));
+    }
+  }
+  return json;
+}
+
+void from_json(xtal::SuperlatticeCache &cache, const jsonParser &json) {
+  for (auto it = json.begin(); it != json.end(); ++it) {
+    std::vector<Eigen::Matrix3l> transf_mat;
+    for (auto const &tjson : *it) {
+      transf_mat.push_back(tjson.get<Eigen::Matrix3l>());
+    }
+    cache.insert(std::stoi(it.name()), transf_mat);
+  }
+}
+
+/// Read superlattices from a cache file into a cache, if the file contains
+/// superlattices with a matching key
+///
+/// The cache file has the format {"<key>": {<to_json(cache)>}, ...}, so that
+/// it can store caches for multiple parent lattices, point groups, or
+/// tolerances.
+///
+/// - An unreadable cache file is ignored
+///
+/// \returns true if superlattices were read
+bool read_superlattice_cache(xtal::SuperlatticeCache &cache,
+                             const boost::filesystem::path &cache_path) {
+  // the cache is only an optimization, so an unreadable file is ignored
+  jsonParser json;
+  if (!boost::filesystem::exists(cache_path) || !json.read(cache_path) ||
+      !json.is_obj()) {
+    return false;
+  }
+  auto it = json.find(cache.key());
+  if (it == json.end()) {
+    return false;
+  }
+  from_json(cache, *it);
+  return true;
+}
+
+/// Save cached superlattices in a cache file, if the cache was modified
+///
+/// - Saved superlattices for other keys are kept
+/// - The file is written to a temporary file and then renamed, so that other
+///   processes never read a partially written file
+void write_superlattice_cache(xtal::SuperlatticeCache &cache,
+                              const boost::filesystem::path &cache_path) {
+  if (!cache.modified()) {
+    return;
+  }
+  jsonParser json;
+  if (!boost::filesystem::exists(cache_path) || !json.read(cache_path) ||
+      !json.is_obj()) {
+    json.put_obj();
+  }
+
+  // keep superlattices saved by other processes meanwhile
+  auto it = json.find(cache.key());
+  if (it != json.end()) {
+    from_json(cache, *it);
+  }
+  to_json(cache, json[cache.key()]);
+
+  boost::filesystem::path tmp_path = cache_path;
+  tmp_path += ".tmp";
+  json.write(tmp_path);
+  boost::filesystem::rename(tmp_path, cache_path);
+  cache.set_saved();
+}
+
+}  // namespace CASM
@@ -3,6 +3,8 @@
 #include "casm/clex/Configuration.hh"
 #include "casm/clex/FillSupercell.hh"
 #include "casm/database/ScelDatabaseTools.hh"
+#include "casm/misc/parallel.hh"
+#include "casm/symmetry/SupercellSymInfo.hh"
 
 namespace CASM {
 namespace DB {
@@ -152,5 +154,107 @@ ConfigInsertResult make_canonical_and_insert(
   }
   return res;
 }
+
+/// Insert configurations (in primitive & canonical form) in the database
+///
+/// \param configurations Configurations to insert, in order
+/// \param primitive_only If true, only the primitive Configuration are
+///     inserted.
+/// \param n_threads Maximum number of threads used to find primitive and
+///     canonical forms
+///
+/// \returns Insertion results, in the same order as `configurations`
+///
+/// Note:
+/// - Equivalent to calling `make_canonical_and_insert(configuration,
+///   supercell_db, configuration_db, primitive_only)` for each configuration,
+///   in order, so results do not depend on `n_threads`.
+/// - Primitive checks and canonical forms are found using up to `n_threads`
+///   threads. Supercells are constructed, and their site permutation
+///   representations are made, on the calling thread because they modify the
+///   prim factor group, so the threads only read shared Supercell data.
+/// - Database insertion is done on the calling thread, in order.
+std::vector<ConfigInsertResult> make_canonical_and_insert(
+    std::vector<Configuration> const &configurations,
+    Database<Supercell> &supercell_db,
+    Database<Configuration> &configuration_db, bool primitive_only,
+    Index n_threads) {
+  Index N = configurations.size();
+
+  // 1) check which configurations are primitive, in parallel
+  for (Configuration const &configuration : configurations) {
+    configuration.supercell().sym_info().site_permutation_symrep();
+  }
+  std::vector<char> is_primitive(N);
+  parallel_for(N, n_threads, [&](Index i) {
+    Configuration const &configuration = configurations[i];
+    is_primitive[i] = (configuration.find_translation() ==
+                       configuration.supercell().sym_info().translate_end());
+  });
+
+  // 2) put configurations in canonical supercells, on this thread
+  std::vector<Supercell const *> canon_supercell(N);
+  std::vector<Configuration> prim_config_in_canon_supercell;
+  std::vector<Configuration> configuration_in_canon_supercell;
+  std::vector<char> in_larger_supercell(N, false);
+  prim_config_in_canon_supercell.reserve(N);
+  configuration_in_canon_supercell.reserve(N);
+  for (Index i = 0; i < N; ++i) {
+    Configuration const &configuration = configurations[i];
+    canon_supercell[i] =
+        &canonical_supercell(configuration.supercell(), supercell_db);
+
+    Configuration prim_config =
+        is_primitive[i] ? configuration : configuration.primitive();
+    Supercell const &canon_prim_supercell =
+        *(make_canonical_and_insert(
+              prim_config.supercell().shared_prim(),
+              prim_config.supercell().sym_info().supercell_lattice(),
+              supercell_db)
+              .first);
+    canon_prim_supercell.sym_info().site_permutation_symrep();
+    prim_config_in_canon_supercell.push_back(
+        fill_supercell(prim_config, canon_prim_supercell));
+
+    if (!primitive_only && !(*canon_supercell[i] == canon_prim_supercell)) {
+      canon_supercell[i]->sym_info().site_permutation_symrep();
+      in_larger_supercell[i] = true;
+      configuration_in_canon_supercell.push_back(
+          fill_supercell(configuration, *canon_supercell[i]));
+    } else {
+      configuration_in_canon_supercell.push_back(configuration);
+    }
+  }
+
+  // 3) find canonical forms, in parallel
+  parallel_for(N, n_threads, [&](Index i) {
+    prim_config_in_canon_supercell[i] =
+        prim_config_in_canon_supercell[i].canonical_form();
+    if (in_larger_supercell[i]) {
+      configuration_in_canon_supercell[i] =
+          configuration_in_canon_supercell[i].canonical_form();
+    }
+  });
+
+  // 4) insert, in order, on this thread
+  std::vector<ConfigInsertResult> results(N);
+  for (Index i = 0; i < N; ++i) {
+    ConfigInsertResult &res = results[i];
+    std::tie(res.primitive_it, res.insert_primitive) =
+        configuration_db.insert(prim_config_in_canon_supercell[i]);
+
+    if (*canon_supercell[i] == prim_config_in_canon_supercell[i].supercell()) {
+      res.insert_canonical = res.insert_primitive;
+      res.canonical_it = res.primitive_it;
+    } else if (primitive_only) {
+      res.insert_canonical = false;
+      res.canonical_it = configuration_db.end();
+    } else {
+      std::tie(res.canonical_it, res.insert_canonical) =
+          configuration_db.insert(configuration_in_canon_supercell[i]);
+    }
+  }
+  return results;
+}
 }  // namespace DB
 }  // namespace CASM
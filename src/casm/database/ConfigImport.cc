@@ -9,12 +9,14 @@
 #include "casm/crystallography/SimpleStructure.hh"
 #include "casm/crystallography/SimpleStructureTools.hh"
 #include "casm/crystallography/io/SimpleStructureIO.hh"
+#include "casm/crystallography/io/SuperlatticeCacheIO.hh"
 #include "casm/database/ConfigDatabase.hh"
 #include "casm/database/Import_impl.hh"
 #include "casm/database/PropertiesDatabase.hh"
 #include "casm/database/ScelDatabase.hh"
 #include "casm/database/Selection_impl.hh"
 #include "casm/database/Update_impl.hh"
+#include "casm/misc/parallel.hh"
 
 namespace CASM {
 
@@ -106,6 +108,26 @@ StructureMap<Configuration>::StructureMap(ConfigMapping::Settings const &_set,
   // -- construct ConfigMapper --
   m_configmapper.reset(
       new ConfigMapper(primclex, _set, primclex.crystallography_tol()));
+
+  // -- read candidate supercell lattices saved by earlier imports --
+  if (primclex.has_dir()) {
+    read_superlattice_cache(
+        *m_configmapper->struc_mapper().superlattice_cache(),
+        primclex.dir().superlattice_cache());
+  }
+}
+
+/// \brief Save candidate supercell lattices enumerated while mapping, so that
+/// they are reused by later imports and updates
+///
+/// - The cache is shared by the ConfigMapper copies used by each thread
+/// - The cache is saved in the project's ".casm/superlattice_cache.json" file
+void StructureMap<Configuration>::commit() const {
+  if (m_primclex_ptr->has_dir()) {
+    write_superlattice_cache(
+        *m_configmapper->struc_mapper().superlattice_cache(),
+        m_primclex_ptr->dir().superlattice_cache());
+  }
 }
 
 /// \brief Specialized import method for ConfigType
@@ -124,14 +146,90 @@ StructureMap<Configuration>::map(
     fs::path p, std::vector<std::string> const &req_properties,
     std::unique_ptr<Configuration> const &hint_config,
     map_result_inserter result) const {
-  // need to set Result data (w/ defaults):
-  // - std::string pos = "";
-  // - MappedProperties mapped_props {origin:"", to:"", unmapped:{}, mapped:{}};
-  // - bool has_data = false;
-  // - bool has_complete_data = false;
-  // - bool is_new_config = false;
-  // - std::string fail_msg = "";
   ConfigIO::Result res;
+  ConfigMapperResult map_result =
+      _map_structure(p, hint_config.get(), *m_configmapper, res);
+  return _insert(p, req_properties, hint_config.get(), std::move(res),
+                 map_result, result);
+}
+
+/// \brief Map structures, using up to n_threads threads
+///
+/// \param paths Paths to structure or properties.calc.json files
+/// \param req_properties List of names of properties that are required for
+/// mapped data to be considered 'complete'
+/// \param hint_configs Either empty, or the 'from' config (or nullptr if
+/// unknown) for each path
+/// \param n_threads Maximum number of threads used for mapping
+///
+/// \returns Mapping results for each path, in the same order as `paths`
+std::vector<std::vector<ConfigIO::Result> > StructureMap<Configuration>::map(
+    std::vector<fs::path> const &paths,
+    std::vector<std::string> const &req_properties,
+    std::vector<std::unique_ptr<Configuration> > const &hint_configs,
+    Index n_threads) const {
+  if (!hint_configs.empty() && hint_configs.size() != paths.size()) {
+    throw std::runtime_error(
+        "Error in StructureMap<Configuration>::map: hint_configs must be empty "
+        "or the same size as paths");
+  }
+  auto hint = [&](Index i) -> Configuration const * {
+    return hint_configs.empty() ? nullptr : hint_configs[i].get();
+  };
+
+  Index size = paths.size();
+  std::vector<ConfigIO::Result> res(size);
+  std::vector<ConfigMapperResult> map_result(size);
+  std::vector<std::exception_ptr> errors(size);
+  auto map_one = [&](Index i, ConfigMapper const &configmapper) {
+    try {
+      map_result[i] = _map_structure(paths[i], hint(i), configmapper, res[i]);
+    } catch (...) {
+      errors[i] = std::current_exception();
+    }
+  };
+
+  // The first structure is mapped alone so that lazily constructed data
+  // shared by all threads (symmetry representations, lattice tables, etc.)
+  // exists before mapping in parallel. Hint configurations may share a
+  // Supercell, so its lazily constructed data is also made here.
+  for (auto const &hint_config : hint_configs) {
+    if (hint_config) {
+      hint_config->supercell().name();
+      hint_config->supercell().sym_info().site_permutation_symrep();
+    }
+  }
+  if (size) {
+    map_one(0, *m_configmapper);
+  }
+  n_threads = std::max(Index(1), std::min(n_threads, size - 1));
+  while (Index(m_thread_configmappers.size()) + 1 < n_threads) {
+    m_thread_configmappers.push_back(
+        notstd::make_unique<ConfigMapper>(*m_configmapper));
+  }
+  parallel_for_each_thread(size - 1, n_threads, [&](Index i, Index t) {
+    map_one(i + 1, t ? *m_thread_configmappers[t - 1] : *m_configmapper);
+  });
+
+  // Insert in order, so that results do not depend on n_threads
+  std::vector<std::vector<ConfigIO::Result> > results(size);
+  for (Index i = 0; i < size; ++i) {
+    if (errors[i]) {
+      std::rethrow_exception(errors[i]);
+    }
+    _insert(paths[i], req_properties, hint(i), std::move(res[i]),
+            map_result[i], std::back_inserter(results[i]));
+  }
+  return results;
+}
+
+/// \brief Read and map a structure, without modifying the database
+///
+/// - Sets res.pos_path, res.has_files, and, if the file does not exist,
+///   res.fail_msg
+ConfigMapperResult StructureMap<Configuration>::_map_structure(
+    fs::path const &p, Configuration const *hint_config,
+    ConfigMapper const &configmapper, ConfigIO::Result &res) const {
   res.pos_path = p.string();
 
   if (!fs::exists(res.pos_path)) {
@@ -144,9 +242,22 @@ StructureMap<Configuration>::map(
   SimpleStructure sstruc = this->_make_structure(res.pos_path);
 
   // do mapping
-  ConfigMapperResult map_result =
-      m_configmapper->import_structure(sstruc, hint_config.get());
+  return configmapper.import_structure(sstruc, hint_config);
+}
 
+/// \brief Insert mapped configurations in the database and output results
+StructureMap<Configuration>::map_result_inserter
+StructureMap<Configuration>::_insert(
+    fs::path const &p, std::vector<std::string> const &req_properties,
+    Configuration const *hint_config, ConfigIO::Result res,
+    ConfigMapperResult const &map_result, map_result_inserter result) const {
+  // need to set Result data (w/ defaults):
+  // - std::string pos = "";
+  // - MappedProperties mapped_props {origin:"", to:"", unmapped:{}, mapped:{}};
+  // - bool has_data = false;
+  // - bool has_complete_data = false;
+  // - bool is_new_config = false;
+  // - std::string fail_msg = "";
   if (!map_result.success()) {
     res.fail_msg = map_result.fail_msg;
     *result++ = std::move(res);
@@ -294,6 +405,11 @@ const std::string Import<Configuration>::desc =
 
     "Settings: \n\n"
 
+    "  n_threads: int (optional, default=1)\n"
+    "      Maximum number of threads used to read and map structures. Mapped \n"
+    "      configurations are inserted in the configuration list in input \n"
+    "      order, so results are the same for any number of threads.\n\n"
+
     "  mapping: JSON object (optional)\n"
     "      A JSON object containing the following options controlling the "
     "structure-\n"
@@ -430,6 +546,10 @@ int Import<Configuration>::run(const PrimClex &primclex,
 
   ImportSettings import_settings;
   if (kwargs.contains("data")) from_json(import_settings, kwargs["data"]);
+  kwargs.get_else(import_settings.n_threads, "n_threads", Index(1));
+  if (import_settings.n_threads < 1) {
+    throw std::runtime_error("Error in 'casm import': n_threads must be >= 1");
+  }
 
   // get input report_dir, check if exists, and create new report_dir.i if
   // necessary
@@ -444,6 +564,7 @@ int Import<Configuration>::run(const PrimClex &primclex,
   jsonParser used_settings;
   used_settings["mapping"] = mapper.settings();
   used_settings["data"] = import_settings;
+  used_settings["n_threads"] = import_settings.n_threads;
 
   // -- print used settings --
   Log &log = CASM::log();
@@ -498,6 +619,11 @@ const std::string Update<Configuration>::desc =
 
     "Settings: \n\n"
 
+    "  n_threads: int (optional, default=1)\n"
+    "      Maximum number of threads used to read and map structures. Mapped \n"
+    "      configurations are inserted in the configuration list in input \n"
+    "      order, so results are the same for any number of threads.\n\n"
+
     "  mapping: JSON object (optional)\n"
     "      A JSON object containing the following options controlling the "
     "structure-\n"
@@ -736,6 +862,11 @@ int Update<Configuration>::run(const PrimClex &primclex,
 
   // TODO: this could take more settings, for now output_as_json fixed true
   UpdateSettings update_settings;
+  kwargs.get_else(update_settings.n_threads, "n_threads", Index(1));
+  if (update_settings.n_threads < 1) {
+    throw std::runtime_error("Error in 'casm update': n_threads must be >= 1");
+  }
+  used["n_threads"] = update_settings.n_threads;
 
   // 'mapping' subsettings are used to construct ConfigMapper and return 'used'
   // settings values still need to figure out how to specify this in general
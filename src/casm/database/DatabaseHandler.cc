@@ -1,6 +1,7 @@
 #include "casm/app/ProjectSettings.hh"
 #include "casm/clex/PrimClex.hh"
 #include "casm/database/DatabaseHandler_impl.hh"
+#include "casm/database/binary/binaryDatabase.hh"
 #include "casm/database/json/jsonDatabase.hh"
 
 namespace CASM {
@@ -15,6 +16,7 @@ DatabaseHandler::DatabaseHandler(const PrimClex &_primclex)
     : m_primclex(&_primclex),
       m_default_db_name(m_primclex->settings().default_database_name()) {
   jsonDB::insert(*this);
+  binaryDB::insert(*this);
 }
 
 DatabaseHandler::~DatabaseHandler() { close(); }
@@ -0,0 +1,292 @@
+#include "casm/database/PropertyCache.hh"
+
+#include <algorithm>
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+
+#include "casm/clexulator/ConfigDoFValues.hh"
+
+namespace CASM {
+
+namespace DB {
+
+namespace {
+
+/// Identifies cache files
+const std::string cache_magic = "CASMPCAC";
+const uint32_t cache_version = 1;
+
+/// 64-bit FNV-1a hash
+class FNV1aHash {
+ public:
+  FNV1aHash() : m_hash(14695981039346656037ULL) {}
+
+  void add(void const *data, std::size_t size) {
+    unsigned char const *begin = static_cast<unsigned char const *>(data);
+    for (unsigned char const *it = begin; it != begin + size; ++it) {
+      m_hash ^= *it;
+      m_hash *= 1099511628211ULL;
+    }
+  }
+
+  void add(std::string const &str) {
+    add<uint64_t>(str.size());
+    add(str.data(), str.size());
+  }
+
+  template <typename T>
+  void add(T const &value) {
+    add(&value, sizeof(T));
+  }
+
+  std::uint64_t value() const { return m_hash; }
+
+ private:
+  std::uint64_t m_hash;
+};
+
+template <typename T>
+void write_value(std::ostream &sout, T const &value) {
+  sout.write(reinterpret_cast<char const *>(&value), sizeof(T));
+}
+
+/// Read a value, or return false if not read
+template <typename T>
+bool read_value(std::istream &sin, T &value) {
+  sin.read(reinterpret_cast<char *>(&value), sizeof(T));
+  return bool(sin);
+}
+
+void write_string(std::ostream &sout, std::string const &str) {
+  write_value<uint32_t>(sout, str.size());
+  sout.write(str.data(), str.size());
+}
+
+/// Read a string, or return false if not read
+bool read_string(std::istream &sin, std::string &str) {
+  uint32_t size;
+  if (!read_value(sin, size)) {
+    return false;
+  }
+  str.resize(size);
+  sin.read(&str[0], size);
+  return bool(sin);
+}
+
+}  // namespace
+
+/// \brief Open a cache file
+///
+/// \param _path Path to the cache file. It does not need to exist.
+/// \param _key Identifies the data the cached values are calculated from
+/// \param _size Number of values stored per configuration
+///
+/// If the cache file exists, and was written with the same key and size, the
+/// cached values are read. Otherwise, the cache begins empty, and the cache
+/// file is replaced on commit.
+PropertyCache::PropertyCache(fs::path _path, std::string _key, Index _size)
+    : m_path(std::move(_path)),
+      m_key(std::move(_key)),
+      m_size(_size),
+      m_modified(false) {
+  _read();
+}
+
+/// \brief Writes the cache file if modified, ignoring errors
+PropertyCache::~PropertyCache() {
+  if (!m_modified) {
+    return;
+  }
+  try {
+    commit();
+  } catch (...) {
+    // the cache is only an optimization, values are recalculated next time
+  }
+}
+
+/// \brief Return pointer to the cached values for a configuration, or
+/// nullptr if not cached for the given DoF hash
+double const *PropertyCache::find(std::string const &configname,
+                                  std::uint64_t dof_hash) const {
+  auto it = m_row.find(configname);
+  if (it == m_row.end() || m_dof_hash[it->second] != dof_hash) {
+    return nullptr;
+  }
+  return m_values.data() + it->second * m_size;
+}
+
+/// \brief Insert or replace the cached values for a configuration
+///
+/// \param configname Configuration name
+/// \param dof_hash Hash of the configuration DoF values, as from `dof_hash`
+/// \param values Pointer to `size()` values to be cached
+void PropertyCache::insert(std::string const &configname,
+                           std::uint64_t dof_hash, double const *values) {
+  auto result = m_row.emplace(configname, m_names.size());
+  Index row = result.first->second;
+  if (result.second) {
+    m_names.push_back(configname);
+    m_dof_hash.push_back(dof_hash);
+    m_values.insert(m_values.end(), values, values + m_size);
+  } else {
+    m_dof_hash[row] = dof_hash;
+    std::copy(values, values + m_size, m_values.data() + row * m_size);
+  }
+  m_modified = true;
+}
+
+/// \brief Remove all cached values
+void PropertyCache::clear() {
+  m_names.clear();
+  m_dof_hash.clear();
+  m_values.clear();
+  m_row.clear();
+  m_modified = true;
+}
+
+/// \brief Write the cache file
+///
+/// The cache file is replaced atomically, so concurrent readers never see a
+/// partially written file.
+void PropertyCache::commit() {
+  fs::create_directories(m_path.parent_path());
+  fs::path tmp =
+      m_path.parent_path() /
+      fs::unique_path(m_path.filename().string() + ".%%%%-%%%%-%%%%");
+  {
+    std::ofstream sout(tmp.string(), std::ios::binary | std::ios::trunc);
+    sout.write(cache_magic.data(), cache_magic.size());
+    write_value<uint32_t>(sout, cache_version);
+    write_string(sout, m_key);
+    write_value<uint64_t>(sout, m_size);
+    write_value<uint64_t>(sout, m_names.size());
+    for (auto const &name : m_names) {
+      write_string(sout, name);
+    }
+    sout.write(reinterpret_cast<char const *>(m_dof_hash.data()),
+               m_dof_hash.size() * sizeof(std::uint64_t));
+    sout.write(reinterpret_cast<char const *>(m_values.data()),
+               m_values.size() * sizeof(double));
+    if (!sout) {
+      fs::remove(tmp);
+      throw std::runtime_error("Error writing property cache: " +
+                               tmp.string());
+    }
+  }
+  fs::rename(tmp, m_path);
+  m_modified = false;
+}
+
+/// \brief Read the cache file, if it exists and matches key and size
+///
+/// A missing, mismatched, or unreadable cache file leaves the cache empty.
+void PropertyCache::_read() {
+  if (!fs::exists(m_path)) {
+    return;
+  }
+  std::ifstream sin(m_path.string(), std::ios::binary);
+  std::string magic(cache_magic.size(), '\0');
+  sin.read(&magic[0], magic.size());
+  uint32_t version;
+  std::string key;
+  uint64_t size;
+  uint64_t n_rows;
+  if (!sin || magic != cache_magic || !read_value(sin, version) ||
+      version != cache_version || !read_string(sin, key) || key != m_key ||
+      !read_value(sin, size) || size != m_size || !read_value(sin, n_rows)) {
+    return;
+  }
+
+  std::vector<std::string> names(n_rows);
+  for (auto &name : names) {
+    if (!read_string(sin, name)) {
+      return;
+    }
+  }
+  std::vector<std::uint64_t> dof_hash(n_rows);
+  sin.read(reinterpret_cast<char *>(dof_hash.data()),
+           n_rows * sizeof(std::uint64_t));
+  std::vector<double> values(n_rows * m_size);
+  sin.read(reinterpret_cast<char *>(values.data()),
+           values.size() * sizeof(double));
+  if (!sin) {
+    return;
+  }
+
+  m_names = std::move(names);
+  m_dof_hash = std::move(dof_hash);
+  m_values = std::move(values);
+  m_row.clear();
+  for (Index i = 0; i < m_names.size(); ++i) {
+    m_row.emplace(m_names[i], i);
+  }
+}
+
+/// \brief Return the PropertyCache for a cache file, sharing it with other
+/// users of the same file in this process
+///
+/// If a PropertyCache for `path` with the same key and size is open, it is
+/// returned. Otherwise, a new PropertyCache is opened. The cache file is
+/// written when the last user releases it.
+std::shared_ptr<PropertyCache> open_property_cache(fs::path const &path,
+                                                   std::string const &key,
+                                                   Index size) {
+  static std::mutex mutex;
+  static std::map<std::string, std::weak_ptr<PropertyCache> > open_caches;
+
+  std::lock_guard<std::mutex> lock{mutex};
+  std::weak_ptr<PropertyCache> &weak_cache = open_caches[path.string()];
+  std::shared_ptr<PropertyCache> cache = weak_cache.lock();
+  if (cache == nullptr || cache->key() != key || cache->size() != size) {
+    cache = std::make_shared<PropertyCache>(path, key, size);
+    weak_cache = cache;
+  }
+  return cache;
+}
+
+/// \brief Hash of configuration DoF values, for checking cached values
+std::uint64_t dof_hash(clexulator::ConfigDoFValues const &dof_values) {
+  FNV1aHash hash;
+  hash.add<uint64_t>(dof_values.occupation.size());
+  hash.add(dof_values.occupation.data(),
+           dof_values.occupation.size() * sizeof(int));
+  for (auto const &value : dof_values.local_dof_values) {
+    hash.add(value.first);
+    hash.add<uint64_t>(value.second.size());
+    hash.add(value.second.data(), value.second.size() * sizeof(double));
+  }
+  for (auto const &value : dof_values.global_dof_values) {
+    hash.add(value.first);
+    hash.add<uint64_t>(value.second.size());
+    hash.add(value.second.data(), value.second.size() * sizeof(double));
+  }
+  return hash.value();
+}
+
+/// \brief Make a PropertyCache key from the contents of files
+///
+/// \returns A hash of the contents of all files, or an empty string if any
+///     file does not exist
+std::string make_property_cache_key(std::vector<fs::path> const &files) {
+  std::stringstream ss;
+  for (auto const &file : files) {
+    if (!fs::exists(file)) {
+      return "";
+    }
+    std::ifstream in(file.string(), std::ios::binary);
+    std::stringstream contents;
+    contents << in.rdbuf();
+    FNV1aHash hash;
+    hash.add(contents.str());
+    ss << std::hex << std::setw(16) << std::setfill('0') << hash.value();
+  }
+  return ss.str();
+}
+
+}  // namespace DB
+}  // namespace CASM
@@ -166,18 +166,19 @@ Selection<ObjType>::Selection(Database<ObjType> &_db, fs::path selection_path)
         read(select_file);
         select_file.close();
       } else {
-        for (const auto &obj : db()) {
-          m_data.insert(std::make_pair(obj.name(), false));
+        // use iterator names, so that objects are not read from the database
+        for (auto it = db().begin(); it != db().end(); ++it) {
+          m_data.insert(std::make_pair(it.name(), false));
         }
       }
     } else if (sel == DB::SELECTION_TYPE::NONE) {
-      for (const auto &obj : db()) {
-        m_data.insert(std::make_pair(obj.name(), false));
+      for (auto it = db().begin(); it != db().end(); ++it) {
+        m_data.insert(std::make_pair(it.name(), false));
       }
     } else if (sel == DB::SELECTION_TYPE::EMPTY) {
     } else if (sel == DB::SELECTION_TYPE::ALL) {
-      for (const auto &obj : db()) {
-        m_data.insert(std::make_pair(obj.name(), true));
+      for (auto it = db().begin(); it != db().end(); ++it) {
+        m_data.insert(std::make_pair(it.name(), true));
       }
     } else if (sel == DB::SELECTION_TYPE::CALCULATED) {
       init_calculated(m_data, db());
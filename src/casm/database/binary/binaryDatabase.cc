@@ -0,0 +1,930 @@
+#include "casm/database/binary/binaryDatabase.hh"
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include "casm/app/DirectoryStructure.hh"
+#include "casm/app/QueryHandler_impl.hh"
+#include "casm/casm_io/Log.hh"
+#include "casm/casm_io/SafeOfstream.hh"
+#include "casm/casm_io/json/jsonStream.hh"
+#include "casm/clex/PrimClex_impl.hh"
+#include "casm/database/DatabaseHandler_impl.hh"
+#include "casm/database/DatabaseTypes_impl.hh"
+#include "casm/database/Database_impl.hh"
+#include "casm/database/json/jsonDatabase.hh"
+#include "casm/database/json/jsonPropertiesDatabase.hh"
+
+namespace CASM {
+
+const std::string traits<DB::binaryDB>::name = "binaryDB";
+
+const std::string traits<DB::binaryDB>::version = "1.0";
+
+namespace DB {
+
+namespace {
+
+/// Identifies the log and index files
+const std::string log_magic = "CASMCLOG";
+const std::string index_magic = "CASMCIDX";
+
+/// Log record kinds
+const uint8_t put_record = 1;
+const uint8_t erase_record = 2;
+
+template <typename T>
+void write_value(std::ostream &sout, T const &value) {
+  sout.write(reinterpret_cast<char const *>(&value), sizeof(T));
+}
+
+template <typename T>
+T read_value(std::istream &sin) {
+  T value;
+  sin.read(reinterpret_cast<char *>(&value), sizeof(T));
+  if (!sin) {
+    throw std::runtime_error("Error reading binaryDB: unexpected end of file");
+  }
+  return value;
+}
+
+void write_string(std::ostream &sout, std::string const &str) {
+  write_value<uint32_t>(sout, str.size());
+  sout.write(str.data(), str.size());
+}
+
+std::string read_string(std::istream &sin) {
+  std::string str(read_value<uint32_t>(sin), '\0');
+  sin.read(&str[0], str.size());
+  if (!sin) {
+    throw std::runtime_error("Error reading binaryDB: unexpected end of file");
+  }
+  return str;
+}
+
+void write_doubles(std::ostream &sout, double const *data, uint64_t size) {
+  write_value<uint64_t>(sout, size);
+  sout.write(reinterpret_cast<char const *>(data), size * sizeof(double));
+}
+
+void read_doubles(std::istream &sin, double *data, uint64_t size) {
+  if (read_value<uint64_t>(sin) != size) {
+    throw std::runtime_error("Error reading binaryDB: DoF size mismatch");
+  }
+  sin.read(reinterpret_cast<char *>(data), size * sizeof(double));
+  if (!sin) {
+    throw std::runtime_error("Error reading binaryDB: unexpected end of file");
+  }
+}
+
+/// Compact JSON string, or empty string for null or empty JSON
+std::string json_string(jsonParser const &json) {
+  if (json.is_null() || (json.is_obj() && json.size() == 0)) {
+    return std::string();
+  }
+  std::stringstream ss;
+  int indent = 0;
+  int prec = 12;
+  jsonStreamWriter writer(ss, indent, prec);
+  writer.value(json);
+  writer.flush();
+  return ss.str();
+}
+
+/// Search key: FNV-1a hash of supercell name and occupation
+///
+/// - Stored in the log and index, so it must not depend on the platform
+uint64_t search_key(Configuration const &config) {
+  uint64_t hash = 14695981039346656037ULL;
+  auto _add = [&](unsigned char byte) {
+    hash ^= byte;
+    hash *= 1099511628211ULL;
+  };
+  for (char c : config.supercell().name()) {
+    _add(c);
+  }
+  Eigen::VectorXi const &occ = config.occupation();
+  for (Index l = 0; l < occ.size(); ++l) {
+    uint32_t value = occ(l);
+    for (int b = 0; b < 4; ++b) {
+      _add((value >> (8 * b)) & 0xff);
+    }
+  }
+  return hash;
+}
+
+/// Split Configuration name into supercell name and id
+std::pair<std::string, std::string> split_name(std::string const &name) {
+  auto pos = name.rfind('/');
+  if (pos == std::string::npos) {
+    return std::make_pair(name, std::string());
+  }
+  return std::make_pair(name.substr(0, pos), name.substr(pos + 1));
+}
+
+/// Read a log record header and skip its payload, or return false if the
+/// record does not end before `log_size`
+///
+/// - A crash while appending to the log may leave a partial record at its end
+bool read_record_header(std::istream &sin, uint64_t log_size, uint8_t &kind,
+                        std::string &name, uint64_t &key,
+                        uint64_t &next_offset) {
+  uint64_t offset = sin.tellg();
+  uint64_t size = sizeof(uint8_t) + sizeof(uint32_t);
+  if (log_size - offset < size) {
+    return false;
+  }
+  kind = read_value<uint8_t>(sin);
+  uint32_t name_size = read_value<uint32_t>(sin);
+  size += name_size + 2 * sizeof(uint64_t);
+  if (log_size - offset < size) {
+    return false;
+  }
+  name.resize(name_size);
+  sin.read(&name[0], name_size);
+  key = read_value<uint64_t>(sin);
+  uint64_t payload_size = read_value<uint64_t>(sin);
+  if (log_size - offset - size < payload_size) {
+    return false;
+  }
+  sin.seekg(payload_size, std::ios::cur);
+  next_offset = offset + size + payload_size;
+  return true;
+}
+
+/// Check magic string and version at the beginning of the log or index
+void read_header(std::istream &sin, std::string magic, fs::path path) {
+  std::string found(magic.size(), '\0');
+  sin.read(&found[0], found.size());
+  if (!sin || found != magic) {
+    throw std::runtime_error(std::string("Error invalid format: ") +
+                             path.string());
+  }
+  std::string version = read_string(sin);
+  if (version != traits<binaryDB>::version) {
+    throw std::runtime_error(
+        std::string("Error binaryDB version mismatch: found: ") + version +
+        " expected: " + traits<binaryDB>::version);
+  }
+}
+
+void write_header(std::ostream &sout, std::string magic) {
+  sout.write(magic.data(), magic.size());
+  write_string(sout, traits<binaryDB>::version);
+}
+
+/// Write a log record storing a Configuration
+///
+/// Format: uint8 kind, name, uint64 search key, uint64 payload size, payload.
+/// The payload contains occupation, local DoF values, and global DoF values,
+/// in the prim DoF basis, and the source and cache as compact JSON.
+void write_put_record(std::ostream &sout, Configuration const &config,
+                      uint64_t key) {
+  std::stringstream payload;
+  ConfigDoF const &configdof = config.configdof();
+
+  Eigen::VectorXi const &occ = configdof.occupation();
+  write_value<uint64_t>(payload, occ.size());
+  for (Index l = 0; l < occ.size(); ++l) {
+    write_value<int32_t>(payload, occ(l));
+  }
+
+  write_value<uint32_t>(payload, configdof.local_dofs().size());
+  for (auto const &local_dof : configdof.local_dofs()) {
+    Eigen::MatrixXd const &values = local_dof.second.values();
+    write_string(payload, local_dof.first);
+    write_doubles(payload, values.data(), values.size());
+  }
+
+  write_value<uint32_t>(payload, configdof.global_dofs().size());
+  for (auto const &global_dof : configdof.global_dofs()) {
+    Eigen::VectorXd const &values = global_dof.second.values();
+    write_string(payload, global_dof.first);
+    write_doubles(payload, values.data(), values.size());
+  }
+
+  write_string(payload, json_string(config.source()));
+  write_string(payload, json_string(config.cache()));
+
+  std::string payload_str = payload.str();
+  write_value<uint8_t>(sout, put_record);
+  write_string(sout, config.name());
+  write_value<uint64_t>(sout, key);
+  write_value<uint64_t>(sout, payload_str.size());
+  sout.write(payload_str.data(), payload_str.size());
+}
+
+/// Write a log record marking a Configuration as erased
+void write_erase_record(std::ostream &sout, std::string const &name) {
+  write_value<uint8_t>(sout, erase_record);
+  write_string(sout, name);
+  write_value<uint64_t>(sout, 0);
+  write_value<uint64_t>(sout, 0);
+}
+
+/// Read the payload of a put record into 'configuration'
+void read_payload(std::istream &sin, Configuration &configuration) {
+  ConfigDoF &configdof = configuration.configdof();
+
+  Eigen::VectorXi occ(read_value<uint64_t>(sin));
+  for (Index l = 0; l < occ.size(); ++l) {
+    occ(l) = read_value<int32_t>(sin);
+  }
+  configdof.set_occupation(occ);
+
+  uint32_t n_local = read_value<uint32_t>(sin);
+  for (uint32_t i = 0; i < n_local; ++i) {
+    std::string key = read_string(sin);
+    if (!configdof.has_local_dof(key)) {
+      throw std::runtime_error("Error reading binaryDB: unknown local DoF " +
+                               key);
+    }
+    Eigen::MatrixXd values = configdof.local_dof(key).values();
+    read_doubles(sin, values.data(), values.size());
+    configdof.local_dof(key).set_values(values);
+  }
+
+  uint32_t n_global = read_value<uint32_t>(sin);
+  for (uint32_t i = 0; i < n_global; ++i) {
+    std::string key = read_string(sin);
+    if (!configdof.has_global_dof(key)) {
+      throw std::runtime_error("Error reading binaryDB: unknown global DoF " +
+                               key);
+    }
+    Eigen::VectorXd values = configdof.global_dof(key).values();
+    read_doubles(sin, values.data(), values.size());
+    configdof.global_dof(key).set_values(values);
+  }
+
+  std::string source = read_string(sin);
+  if (!source.empty()) {
+    configuration.set_source(jsonParser::parse(source));
+  }
+  std::string cache = read_string(sin);
+  if (!cache.empty()) {
+    configuration.set_initial_cache(jsonParser::parse(cache));
+  }
+}
+
+struct InsertPropsImpl {
+  InsertPropsImpl(DatabaseHandler &_db_handler)
+      : db_handler(_db_handler),
+        primclex(_db_handler.primclex()),
+        dir(primclex.dir()),
+        json_dir(dir.root_dir()) {}
+
+  DatabaseHandler &db_handler;
+  const PrimClex &primclex;
+  const DirectoryStructure &dir;
+  jsonDB::DirectoryStructure json_dir;
+
+  template <typename T>
+  void eval() {
+    for (auto calc_type : dir.all_calctype()) {
+      fs::path location = json_dir.props_list<T>(calc_type);
+      db_handler.insert_props<T>(traits<binaryDB>::name, calc_type,
+                                 notstd::make_unique<jsonPropertiesDatabase>(
+                                     primclex, calc_type, location));
+    }
+  }
+};
+}  // namespace
+
+/// Inserts binaryDatabase<Configuration>, and jsonDB implementations for
+/// other types and properties, under the name "binaryDB"
+void binaryDB::insert(DatabaseHandler &db_handler) {
+  db_handler.insert<Supercell>(
+      traits<binaryDB>::name,
+      notstd::make_unique<jsonDatabase<Supercell> >(db_handler.primclex()));
+  db_handler.insert<Configuration>(
+      traits<binaryDB>::name,
+      notstd::make_unique<binaryDatabase<Configuration> >(
+          db_handler.primclex(),
+          db_handler.primclex().settings().database_cache_size()));
+  if (db_handler.primclex().has_dir()) {
+    DB::for_each_config_type(InsertPropsImpl(db_handler));
+  }
+}
+
+binaryDB::DirectoryStructure::DirectoryStructure(const fs::path _root)
+    : m_dir(_root) {}
+
+template <typename DataObject>
+fs::path binaryDB::DirectoryStructure::obj_log() const {
+  return m_dir.casm_dir() / traits<binaryDB>::name /
+         (traits<DataObject>::short_name + "_list.log");
+}
+
+template <typename DataObject>
+fs::path binaryDB::DirectoryStructure::obj_index() const {
+  return m_dir.casm_dir() / traits<binaryDB>::name /
+         (traits<DataObject>::short_name + "_list.index");
+}
+
+bool ConfigNameCompare::operator()(std::string const &A,
+                                   std::string const &B) const {
+  std::size_t posA = std::min(A.rfind('/'), A.size());
+  std::size_t posB = std::min(B.rfind('/'), B.size());
+
+  // compare supercell name
+  int cmp = A.compare(0, posA, B, 0, posB);
+  if (cmp != 0) {
+    return cmp < 0;
+  }
+
+  // compare id, by length first so that integer ids are ordered by value
+  if (A.size() - posA != B.size() - posB) {
+    return A.size() - posA < B.size() - posB;
+  }
+  return A.compare(posA, std::string::npos, B, posB, std::string::npos) < 0;
+}
+
+/// Iterates over records, reading Configuration when dereferenced
+class binaryDatabase<Configuration>::RecordIterator
+    : public DatabaseIteratorBase<Configuration> {
+ public:
+  RecordIterator() : m_db(nullptr) {}
+
+  RecordIterator(binaryDatabase<Configuration> const *_db,
+                 record_map::iterator _it)
+      : m_db(_db), m_it(_it) {}
+
+  std::string name() const override { return m_it->first; }
+
+  record_map::iterator base() const { return m_it; }
+
+ private:
+  bool equal(const DatabaseIteratorBase<Configuration> &other) const override {
+    return m_it == static_cast<const RecordIterator &>(other).m_it;
+  }
+
+  void increment() override {
+    ++m_it;
+    m_config.reset();
+  }
+
+  const Configuration &dereference() const override {
+    if (!m_config) {
+      m_config = m_db->_config(m_it);
+    }
+    return *m_config;
+  }
+
+  RecordIterator *_clone() const override { return new RecordIterator(*this); }
+
+  binaryDatabase<Configuration> const *m_db;
+
+  record_map::iterator m_it;
+
+  // keeps the dereferenced Configuration valid, even if evicted from the
+  // database cache
+  mutable std::shared_ptr<Configuration const> m_config;
+};
+
+binaryDatabase<Configuration>::binaryDatabase(const PrimClex &_primclex,
+                                              Index _cache_capacity)
+    : Database<Configuration>(_primclex),
+      m_is_open(false),
+      m_log_size(0),
+      m_live_size(0) {
+  m_cache_stats.capacity = _cache_capacity;
+}
+
+/// Open the database
+///
+/// - Only the index is read. Configurations are read from the log when
+///   accessed.
+binaryDatabase<Configuration> &binaryDatabase<Configuration>::open() {
+  if (m_is_open) {
+    return *this;
+  }
+
+  if (primclex().has_dir()) {
+    binaryDB::DirectoryStructure dir(primclex().dir().root_dir());
+    if (fs::exists(dir.obj_log<Configuration>())) {
+      _read_index();
+    }
+  }
+
+  // mark open before constructing the master selection, which may access the
+  // database contents
+  m_is_open = true;
+  master_selection() = Selection<Configuration>(*this);
+  this->read_aliases();
+  return *this;
+}
+
+void binaryDatabase<Configuration>::commit() {
+  if (!m_is_open) {
+    throw std::runtime_error(
+        "Error in binaryDatabase<Configuration>::commit(): Database not open");
+  }
+  if (!primclex().has_dir()) {
+    throw std::runtime_error(
+        "Error in binaryDatabase<Configuration>::commit(): CASM project has no "
+        "root directory.");
+  }
+
+  // the log is appended to, and may be replaced by compaction
+  m_log_in.reset();
+
+  binaryDB::DirectoryStructure dir(primclex().dir().root_dir());
+  fs::path log_path = dir.obj_log<Configuration>();
+  fs::path index_path = dir.obj_index<Configuration>();
+  if (primclex().db_handler().db<Supercell>(traits<binaryDB>::name).size() ==
+      0) {
+    fs::remove(log_path);
+    fs::remove(index_path);
+    m_log_size = 0;
+    m_live_size = 0;
+    return;
+  }
+
+  // append records for erased, inserted, updated, and cache-updated
+  // Configuration
+  fs::create_directories(log_path.parent_path());
+  fs::ofstream sout(log_path, std::ios::binary | std::ios::app);
+  if (m_log_size == 0) {
+    write_header(sout, log_magic);
+    m_log_size = sout.tellp();
+  }
+
+  for (auto const &value : m_erased) {
+    write_erase_record(sout, value.first);
+    m_live_size -= value.second;
+  }
+  m_erased.clear();
+
+  for (auto &value : m_records) {
+    Record &record = value.second;
+    if (!record.config ||
+        (!record.is_modified && !record.config->cache_updated())) {
+      continue;
+    }
+    uint64_t begin = sout.tellp();
+    write_put_record(sout, *record.config, record.key);
+    uint64_t size = uint64_t(sout.tellp()) - begin;
+    if (record.offset) {
+      m_live_size -= record.size;
+    }
+    record.offset = begin;
+    record.size = size;
+    m_live_size += size;
+
+    // now saved, so may be evicted
+    record.config->set_cache_saved();
+    record.is_modified = false;
+    if (!record.in_lru) {
+      _touch(&value);
+    }
+  }
+  m_log_size = sout.tellp();
+  sout.close();
+  if (!sout) {
+    throw std::runtime_error("Error in binaryDatabase<Configuration>::commit()"
+                             ": failed writing " +
+                             log_path.string());
+  }
+  _evict();
+
+  if (2 * m_live_size < m_log_size) {
+    _compact();
+  }
+  _write_index();
+
+  this->write_aliases();
+  auto handler = primclex().settings().query_handler<Configuration>();
+  handler.set_selected(master_selection());
+
+  bool write_json = false;
+  bool only_selected = false;
+  master_selection().write(
+      handler.dict(),
+      primclex().dir().template master_selection<Configuration>(), write_json,
+      only_selected);
+}
+
+void binaryDatabase<Configuration>::close() {
+  m_log_in.reset();
+  m_lru.clear();
+  m_records.clear();
+  m_search_index.clear();
+  m_erased.clear();
+  m_config_id.clear();
+  m_log_size = 0;
+  m_live_size = 0;
+
+  Index capacity = m_cache_stats.capacity;
+  m_cache_stats = CacheStats();
+  m_cache_stats.capacity = capacity;
+
+  m_is_open = false;
+}
+
+binaryDatabase<Configuration>::iterator binaryDatabase<Configuration>::begin()
+    const {
+  return _iterator(m_records.begin());
+}
+
+binaryDatabase<Configuration>::iterator binaryDatabase<Configuration>::end()
+    const {
+  return _iterator(m_records.end());
+}
+
+binaryDatabase<Configuration>::size_type binaryDatabase<Configuration>::size()
+    const {
+  return m_records.size();
+}
+
+/// Insert a Configuration, if no equivalent Configuration exists
+///
+/// - New Configuration are kept in memory until commit
+std::pair<binaryDatabase<Configuration>::iterator, bool>
+binaryDatabase<Configuration>::insert(const Configuration &config) {
+  auto existing = search(config);
+  if (existing != end()) {
+    return std::make_pair(existing, false);
+  }
+
+  // set the config id, and increment
+  auto ptr = std::make_shared<Configuration>(config);
+  Index &next_id = m_config_id[config.supercell().name()];
+  this->set_id(*ptr, next_id++);
+
+  Record record;
+  record.key = search_key(*ptr);
+  record.config = ptr;
+  record.is_modified = true;
+  auto record_it = m_records.emplace(ptr->name(), record).first;
+  m_search_index.emplace(record.key, &record_it->first);
+  ++m_cache_stats.size;
+
+  master_selection().data().emplace(ptr->name(), 0);
+
+  return std::make_pair(_iterator(record_it), true);
+}
+
+/// Replace a Configuration with the same name
+///
+/// - Updated Configuration are kept in memory until commit
+binaryDatabase<Configuration>::iterator binaryDatabase<Configuration>::update(
+    const Configuration &config) {
+  auto record_it = m_records.find(config.name());
+  if (record_it == m_records.end()) {
+    throw std::runtime_error(
+        "Error in binaryDatabase<Configuration>::update: Configuration not "
+        "found");
+  }
+  _erase_search_key(record_it);
+
+  Record &record = record_it->second;
+  if (record.in_lru) {
+    m_lru.erase(record.lru_it);
+    record.in_lru = false;
+  }
+  if (!record.config) {
+    ++m_cache_stats.size;
+  }
+  record.config = std::make_shared<Configuration>(config);
+  record.key = search_key(config);
+  record.is_modified = true;
+  m_search_index.emplace(record.key, &record_it->first);
+
+  return _iterator(record_it);
+}
+
+binaryDatabase<Configuration>::iterator binaryDatabase<Configuration>::erase(
+    iterator pos) {
+  auto record_it = static_cast<RecordIterator *>(pos.get())->base();
+  Record &record = record_it->second;
+
+  // record erasure, if the Configuration is in the log
+  if (record.offset) {
+    m_erased[record_it->first] = record.size;
+  }
+
+  if (record.in_lru) {
+    m_lru.erase(record.lru_it);
+  }
+  if (record.config) {
+    --m_cache_stats.size;
+  }
+  _erase_search_key(record_it);
+  master_selection().data().erase(record_it->first);
+
+  return _iterator(m_records.erase(record_it));
+}
+
+binaryDatabase<Configuration>::iterator binaryDatabase<Configuration>::find(
+    const std::string &name_or_alias) const {
+  return _iterator(m_records.find(this->name(name_or_alias)));
+}
+
+/// Range of Configuration in a particular supecell
+boost::iterator_range<binaryDatabase<Configuration>::iterator>
+binaryDatabase<Configuration>::scel_range(const std::string &scelname) const {
+  // "scelname/" is ordered before all Configuration in the supercell
+  auto begin = m_records.lower_bound(scelname + "/");
+  auto end = begin;
+  while (end != m_records.end() && split_name(end->first).first == scelname) {
+    ++end;
+  }
+  return boost::make_iterator_range(_iterator(begin), _iterator(end));
+}
+
+/// Find canonical Configuration in database by comparing DoF
+///
+/// \param config A Configuration in canonical form
+///
+/// - Only Configuration with the same supercell name and occupation hash are
+///   read and compared
+binaryDatabase<Configuration>::iterator binaryDatabase<Configuration>::search(
+    const Configuration &config) const {
+  auto range = m_search_index.equal_range(search_key(config));
+  for (auto it = range.first; it != range.second; ++it) {
+    auto record_it = m_records.find(*it->second);
+    auto candidate = _config(record_it);
+    if (!(*candidate < config) && !(config < *candidate)) {
+      return _iterator(record_it);
+    }
+  }
+  return end();
+}
+
+/// Set maximum number of unmodified Configuration held in memory
+void binaryDatabase<Configuration>::set_cache_capacity(Index _cache_capacity) {
+  m_cache_stats.capacity = _cache_capacity;
+  _evict();
+}
+
+/// Read the index, or rebuild it from the log
+///
+/// The index is used if it describes the entire log, otherwise the log is
+/// scanned to rebuild it.
+void binaryDatabase<Configuration>::_read_index() {
+  binaryDB::DirectoryStructure dir(primclex().dir().root_dir());
+  fs::path log_path = dir.obj_log<Configuration>();
+  fs::path index_path = dir.obj_index<Configuration>();
+
+  m_records.clear();
+  m_search_index.clear();
+  m_config_id.clear();
+  m_log_size = fs::file_size(log_path);
+  m_live_size = 0;
+
+  bool is_current = false;
+  if (fs::exists(index_path)) {
+    fs::ifstream sin(index_path, std::ios::binary);
+    read_header(sin, index_magic, index_path);
+    if (read_value<uint64_t>(sin) == m_log_size) {
+      uint64_t n_config_id = read_value<uint64_t>(sin);
+      for (uint64_t i = 0; i < n_config_id; ++i) {
+        std::string scelname = read_string(sin);
+        m_config_id[scelname] = read_value<uint64_t>(sin);
+      }
+      uint64_t n_records = read_value<uint64_t>(sin);
+      for (uint64_t i = 0; i < n_records; ++i) {
+        std::string name = read_string(sin);
+        Record record;
+        record.offset = read_value<uint64_t>(sin);
+        record.size = read_value<uint64_t>(sin);
+        record.key = read_value<uint64_t>(sin);
+        m_live_size += record.size;
+        m_records.emplace_hint(m_records.end(), name, record);
+      }
+      is_current = true;
+    }
+  }
+  if (!is_current) {
+    _scan_log();
+  }
+
+  for (auto const &value : m_records) {
+    m_search_index.emplace(value.second.key, &value.first);
+  }
+}
+
+/// Rebuild the index by scanning the log
+///
+/// - Only record headers are read
+/// - Next config ids are set to one more than the largest id found in each
+///   supercell, including erased Configuration
+/// - If the last record is incomplete, as after a crash while appending, the
+///   log is truncated to the end of the last complete record
+void binaryDatabase<Configuration>::_scan_log() {
+  binaryDB::DirectoryStructure dir(primclex().dir().root_dir());
+  fs::path log_path = dir.obj_log<Configuration>();
+
+  fs::ifstream sin(log_path, std::ios::binary);
+  read_header(sin, log_magic, log_path);
+  uint64_t offset = sin.tellg();
+  uint8_t kind;
+  std::string name;
+  uint64_t key;
+  uint64_t next_offset;
+  while (offset < m_log_size) {
+    if (!read_record_header(sin, m_log_size, kind, name, key, next_offset)) {
+      sin.close();
+      err_log() << "Warning: incomplete record at the end of " << log_path
+                << ", truncating from " << m_log_size << " to " << offset
+                << " bytes" << std::endl;
+      fs::resize_file(log_path, offset);
+      m_log_size = offset;
+      break;
+    }
+
+    auto record_it = m_records.find(name);
+    if (record_it != m_records.end()) {
+      m_live_size -= record_it->second.size;
+      m_records.erase(record_it);
+    }
+    if (kind == put_record) {
+      Record record;
+      record.offset = offset;
+      record.size = next_offset - offset;
+      record.key = key;
+      m_records.emplace(name, record);
+      m_live_size += record.size;
+    }
+
+    auto scelname_and_id = split_name(name);
+    Index id = std::stol(scelname_and_id.second);
+    Index &next_id = m_config_id[scelname_and_id.first];
+    next_id = std::max(next_id, id + 1);
+
+    offset = next_offset;
+  }
+}
+
+/// Return Configuration, reading it from the log if not in memory
+std::shared_ptr<Configuration const> binaryDatabase<Configuration>::_config(
+    record_map::iterator record_it) const {
+  Record &record = record_it->second;
+  if (record.config) {
+    ++m_cache_stats.hits;
+    if (record.in_lru) {
+      m_lru.splice(m_lru.begin(), m_lru, record.lru_it);
+    }
+    return record.config;
+  }
+  ++m_cache_stats.misses;
+
+  binaryDB::DirectoryStructure dir(primclex().dir().root_dir());
+  fs::path log_path = dir.obj_log<Configuration>();
+  if (!m_log_in) {
+    m_log_in = notstd::make_unique<fs::ifstream>(log_path, std::ios::binary);
+  }
+  std::istream &sin = *m_log_in;
+  sin.clear();
+  sin.seekg(record.offset);
+  std::string const &name = record_it->first;
+  if (read_value<uint8_t>(sin) != put_record || read_string(sin) != name) {
+    throw std::runtime_error(std::string("Error invalid format: ") +
+                             log_path.string());
+  }
+  read_value<uint64_t>(sin);
+  read_value<uint64_t>(sin);
+
+  auto scelname_and_id = split_name(name);
+  auto const &supercell_db =
+      primclex().db_handler().db<Supercell>(traits<binaryDB>::name);
+  auto scel_it = supercell_db.find(scelname_and_id.first);
+  if (scel_it == supercell_db.end()) {
+    throw std::runtime_error(
+        "Error in binaryDatabase<Configuration>: Supercell not found for " +
+        name);
+  }
+  auto ptr = std::make_shared<Configuration>(*scel_it);
+  read_payload(sin, *ptr);
+  this->clear_name(*ptr);
+  this->set_id(*ptr, scelname_and_id.second);
+
+  record.config = ptr;
+  ++m_cache_stats.size;
+  _touch(&*record_it);
+  _evict();
+  return ptr;
+}
+
+/// Add a record to m_lru as most recently used
+void binaryDatabase<Configuration>::_touch(record_value *value) const {
+  value->second.lru_it = m_lru.insert(m_lru.begin(), value);
+  value->second.in_lru = true;
+}
+
+/// Remove least recently used Configuration from memory until within
+/// capacity
+///
+/// - Configuration with an updated cache are kept in memory until commit
+void binaryDatabase<Configuration>::_evict() const {
+  while (Index(m_lru.size()) > m_cache_stats.capacity) {
+    Record &record = m_lru.back()->second;
+    m_lru.pop_back();
+    record.in_lru = false;
+    if (record.config->cache_updated()) {
+      continue;
+    }
+    record.config.reset();
+    --m_cache_stats.size;
+    ++m_cache_stats.evictions;
+  }
+}
+
+/// Remove a record from m_search_index
+void binaryDatabase<Configuration>::_erase_search_key(
+    record_map::iterator record_it) {
+  auto range = m_search_index.equal_range(record_it->second.key);
+  for (auto it = range.first; it != range.second; ++it) {
+    if (it->second == &record_it->first) {
+      m_search_index.erase(it);
+      return;
+    }
+  }
+}
+
+/// Rewrite the log with only current records
+///
+/// - Records are copied from the old log, in log order
+void binaryDatabase<Configuration>::_compact() {
+  binaryDB::DirectoryStructure dir(primclex().dir().root_dir());
+  fs::path log_path = dir.obj_log<Configuration>();
+
+  std::vector<std::pair<uint64_t, Record *> > order;
+  order.reserve(m_records.size());
+  for (auto &value : m_records) {
+    order.emplace_back(value.second.offset, &value.second);
+  }
+  std::sort(order.begin(), order.end());
+
+  SafeOfstream file;
+  file.open(log_path);
+  {
+    fs::ifstream sin(log_path, std::ios::binary);
+    std::ostream &sout = file.ofstream();
+    write_header(sout, log_magic);
+    std::string buffer;
+    for (auto const &value : order) {
+      Record &record = *value.second;
+      buffer.resize(record.size);
+      sin.seekg(record.offset);
+      sin.read(&buffer[0], record.size);
+      if (!sin) {
+        throw std::runtime_error(std::string("Error invalid format: ") +
+                                 log_path.string());
+      }
+      record.offset = sout.tellp();
+      sout.write(buffer.data(), buffer.size());
+    }
+    m_log_size = sout.tellp();
+  }
+  file.close();
+}
+
+/// Write the index
+///
+/// Format: header, uint64 log size, uint64 number of supercells, (scelname,
+/// uint64 next config id) for each supercell, uint64 number of records, and
+/// (name, uint64 offset, uint64 size, uint64 search key) for each record
+void binaryDatabase<Configuration>::_write_index() const {
+  binaryDB::DirectoryStructure dir(primclex().dir().root_dir());
+
+  SafeOfstream file;
+  file.open(dir.obj_index<Configuration>());
+  std::ostream &sout = file.ofstream();
+  write_header(sout, index_magic);
+  write_value<uint64_t>(sout, m_log_size);
+  write_value<uint64_t>(sout, m_config_id.size());
+  for (auto const &value : m_config_id) {
+    write_string(sout, value.first);
+    write_value<uint64_t>(sout, value.second);
+  }
+  write_value<uint64_t>(sout, m_records.size());
+  for (auto const &value : m_records) {
+    write_string(sout, value.first);
+    write_value<uint64_t>(sout, value.second.offset);
+    write_value<uint64_t>(sout, value.second.size);
+    write_value<uint64_t>(sout, value.second.key);
+  }
+  file.close();
+}
+
+binaryDatabase<Configuration>::iterator
+binaryDatabase<Configuration>::_iterator(record_map::iterator record_it) const {
+  return iterator(RecordIterator(this, record_it));
+}
+
+}  // namespace DB
+}  // namespace CASM
+
+// explicit template instantiations
+#define INST_binaryDB(r, data, type)                                       \
+  template fs::path binaryDB::DirectoryStructure::obj_log<type>() const; \
+  template fs::path binaryDB::DirectoryStructure::obj_index<type>() const;
+
+namespace CASM {
+namespace DB {
+
+BOOST_PP_SEQ_FOR_EACH(INST_binaryDB, _, CASM_DB_CONFIG_TYPES)
+}  // namespace DB
+}  // namespace CASM
@@ -1,12 +1,14 @@
 #include "casm/database/json/jsonDatabase.hh"
 
 #include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
 #include <boost/range/iterator_range.hpp>
 
 #include "casm/app/DirectoryStructure.hh"
 #include "casm/app/QueryHandler_impl.hh"
 #include "casm/casm_io/SafeOfstream.hh"
 #include "casm/casm_io/container/json_io.hh"
+#include "casm/casm_io/json/jsonStream.hh"
 #include "casm/clex/PrimClex_impl.hh"
 #include "casm/clex/io/json/ConfigDoF_json_io.hh"
 #include "casm/database/DatabaseHandler_impl.hh"
@@ -240,60 +242,105 @@ jsonDatabase<Configuration> &jsonDatabase<Configuration>::open() {
     return *this;
   }
 
-  jsonParser json(config_list_path);
-
-  if (!json.is_obj() || !json.contains("supercells")) {
-    throw std::runtime_error(std::string("Error invalid format: ") +
-                             config_list_path.string());
-  }
-
-  // check json version
-  if (!json.contains("version") ||
-      json["version"].get<std::string>() != traits<jsonDB>::version) {
-    throw std::runtime_error(
-        std::string("Error jsonDB version mismatch: found: ") +
-        json["version"].get<std::string>() +
-        " expected: " + traits<jsonDB>::version);
-  }
-
-  // read config list contents
-  auto scel_it = json["supercells"].begin();
-  auto scel_end = json["supercells"].end();
+  // read the config list one configuration at a time, rather than
+  // constructing a jsonParser for the entire file
+  bool has_supercells = false;
+  bool has_version = false;
+  std::string version;
+  jsonParser config_id_json;
+  std::exception_ptr config_error;
   bool is_new = false;
 
-  for (; scel_it != scel_end; ++scel_it) {
-    auto config_it = scel_it->begin();
-    auto config_end = scel_it->end();
-
-    const Supercell &scel = *primclex()
-                                 .db_handler()
-                                 .db<Supercell>(traits<jsonDB>::name)
-                                 .find(scel_it.name());
+  auto select = [&](jsonSelectiveReader::Path const &path) {
+    if (path.size() == 1) {
+      if (path[0] == "supercells") {
+        has_supercells = true;
+        return false;
+      }
+      return path[0] == "version" || path[0] == "config_id";
+    }
+    return path.size() == 3 && path[0] == "supercells";
+  };
+
+  auto f = [&](jsonSelectiveReader::Path const &path, jsonParser &json) {
+    if (path.size() == 1) {
+      if (path[0] == "version") {
+        has_version = true;
+        version = json.is_string() ? json.get<std::string>() : "";
+      } else {
+        config_id_json = json;
+      }
+      return;
+    }
+    if (config_error) {
+      return;
+    }
+    try {
+      const Supercell &scel = *primclex()
+                                   .db_handler()
+                                   .db<Supercell>(traits<jsonDB>::name)
+                                   .find(path[1]);
 
-    for (; config_it != config_end; ++config_it) {
       Configuration configuration{scel};
-      from_json(configuration.configdof(), (*config_it)["dof"]);
+      from_json(configuration.configdof(), json["dof"]);
 
-      auto source_it = config_it->find("source");
-      if (source_it != config_it->end()) {
+      auto source_it = json.find("source");
+      if (source_it != json.end()) {
         configuration.set_source(*source_it);
       }
-      auto cache_it = config_it->find("cache");
-      if (cache_it != config_it->end()) {
+      auto cache_it = json.find("cache");
+      if (cache_it != json.end()) {
         configuration.set_initial_cache(*cache_it);
       }
 
       this->clear_name(configuration);
-      // config_it.name() is the JSON attribute name, which is the config ID
-      this->set_id(configuration, config_it.name());
+      // path[2] is the JSON attribute name, which is the config ID
+      this->set_id(configuration, path[2]);
 
       auto result = m_config_list.emplace(configuration);
       _on_insert_or_emplace(result, is_new);
+    } catch (...) {
+      // report after the version is checked
+      config_error = std::current_exception();
+    }
+  };
+
+  {
+    std::vector<char> buffer(1 << 20);
+    fs::ifstream stream;
+    stream.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+    stream.open(config_list_path);
+    jsonSelectiveReader reader{select, f};
+    try {
+      parse_json(stream, reader);
+    } catch (std::exception const &e) {
+      close();
+      throw std::runtime_error(std::string("Error reading ") +
+                               config_list_path.string() + ": " + e.what());
     }
   }
 
+  if (!has_supercells) {
+    close();
+    throw std::runtime_error(std::string("Error invalid format: ") +
+                             config_list_path.string());
+  }
+
+  // check json version
+  if (!has_version || version != traits<jsonDB>::version) {
+    close();
+    throw std::runtime_error(
+        std::string("Error jsonDB version mismatch: found: ") + version +
+        " expected: " + traits<jsonDB>::version);
+  }
+
+  if (config_error) {
+    close();
+    std::rethrow_exception(config_error);
+  }
+
   // read next config id for each supercell
-  from_json(m_config_id, json["config_id"]);
+  from_json(m_config_id, config_id_json);
   master_selection() = Selection<Configuration>(*this);
   this->read_aliases();
 
@@ -319,35 +366,51 @@ void jsonDatabase<Configuration>::commit() {
     return;
   }
 
-  jsonParser json;
-  if (fs::exists(config_list_path)) {
-    json.read(config_list_path);
-  } else {
-    json.put_obj();
-  }
-  json["version"] = traits<jsonDB>::version;
-
-  json["supercells"] = jsonParser::object();
+  // write the config list one configuration at a time, in the same order
+  // and format as a compact jsonParser: members sorted by name
+  std::map<std::string, std::map<std::string, const Configuration *> >
+      sorted_configs;
   for (const auto &config : m_config_list) {
-    jsonParser &configjson =
-        json["supercells"][config.supercell().name()][config.id()];
-    to_json(config.configdof(), configjson["dof"]);
-    to_json(config.source(), configjson["source"]);
-    configjson["cache"].put_obj();
-    if (config.cache_updated()) {
-      to_json(config.cache(), configjson["cache"]);
-    }
+    sorted_configs[config.supercell().name()][config.id()] = &config;
   }
 
-  json["config_id"] = m_config_id;
-
   SafeOfstream file;
   fs::create_directories(config_list_path.parent_path());
   file.open(config_list_path);
   int indent = 0;
   int prec = 12;
-  json_spirit::write_stream((json_spirit::mValue &)json, file.ofstream(),
-                            indent, prec);
+  jsonStreamWriter writer(file.ofstream(), indent, prec);
+  writer.begin_object();
+
+  writer.key("config_id");
+  writer.value(jsonParser(m_config_id));
+
+  writer.key("supercells");
+  writer.begin_object();
+  for (const auto &scel_configs : sorted_configs) {
+    writer.key(scel_configs.first);
+    writer.begin_object();
+    for (const auto &id_config : scel_configs.second) {
+      const Configuration &config = *id_config.second;
+      jsonParser configjson;
+      configjson["cache"].put_obj();
+      if (config.cache_updated()) {
+        to_json(config.cache(), configjson["cache"]);
+      }
+      to_json(config.configdof(), configjson["dof"]);
+      to_json(config.source(), configjson["source"]);
+      writer.key(id_config.first);
+      writer.value(configjson);
+    }
+    writer.end_object();
+  }
+  writer.end_object();
+
+  writer.key("version");
+  writer.value(jsonParser(traits<jsonDB>::version));
+
+  writer.end_object();
+  writer.flush();
   file.close();
 
   this->write_aliases();
@@ -4,6 +4,7 @@
 
 #include "casm/casm_io/SafeOfstream.hh"
 #include "casm/casm_io/container/json_io.hh"
+#include "casm/casm_io/json/jsonStream.hh"
 #include "casm/global/errors.hh"
 
 namespace CASM {
@@ -43,8 +44,9 @@ void jsonPropertiesDatabase::commit() {
   // json.print(file.ofstream());
   int indent = 0;
   int prec = 12;
-  json_spirit::write_stream((json_spirit::mValue &)json, file.ofstream(),
-                            indent, prec);
+  jsonStreamWriter writer(file.ofstream(), indent, prec);
+  writer.value(json);
+  writer.flush();
   file.close();
 }
 
@@ -1,12 +1,15 @@
 #include "casm/hull/Hull.hh"
 
 #include <iterator>
+#include <queue>
+#include <unordered_map>
 
 #include "casm/casm_io/dataformatter/DataFormatter_impl.hh"
 #include "casm/clex/PrimClex.hh"
 #include "casm/database/ConfigDatabase.hh"
 #include "casm/external/Eigen/Dense"
 #include "casm/external/qhull/libqhullcpp/QhullFacetList.h"
+#include "casm/external/qhull/libqhullcpp/QhullFacetSet.h"
 #include "casm/external/qhull/libqhullcpp/QhullVertexSet.h"
 #include "casm/misc/PCA.hh"
 
@@ -113,6 +116,8 @@ Hull::Hull(const DB::Selection<Configuration> &_selection,
       m_bottom_vertices.insert(*vertex_it);
     }
   }
+
+  _build_facet_index();
 }
 
 /// \brief const Access the hull object directly
@@ -234,6 +239,14 @@ double Hull::dist_to_hull(const Configuration &config) const {
 
 /// \brief The distance a point in the reduced composition/energy space is above
 /// the hull along the energy axis
+///
+/// - Equal to the minimum, over all bottom facets, of the distance along the
+///   energy axis from the point to the facet hyperplane
+/// - The bottom facet below the point is found by walking across neighboring
+///   bottom facets, beginning from a facet near the point, so the cost does
+///   not grow linearly with the number of bottom facets. For points with
+///   composition outside the range spanned by the hull, all bottom facets are
+///   checked.
 double Hull::dist_to_hull(Eigen::VectorXd _reduced_point) const {
   // want to find minimum distance from point to a bottom facet
 
@@ -244,22 +257,248 @@ double Hull::dist_to_hull(Eigen::VectorXd _reduced_point) const {
   // distance to facet along normal: V.dot(N) = a (Qhull reports this as a
   // negative number) proj of D onto N: D.dot(N) = b (if b is positive, then
   // this is 'bottom' facet) distance along D to facet: a/b
+  //
+  // The lower hull is convex, so if the point's composition is not in the
+  // projection of a bottom facet, the neighboring facet across the ridge
+  // separating the facet from the point is closer to the point along D.
+  // Walking to closer neighbors therefore ends at the facet below the point,
+  // unless the point's composition is outside the range spanned by the hull.
+
+  Index n_facets = m_bottom_facets.size();
+  if (m_index.grid_start.empty()) {
+    return _scan_dist_to_hull(_reduced_point);
+  }
 
-  orgQhull::QhullPoint qpoint(_reduced_point.size(), _reduced_point.data());
+  Index i = _start_facet(_reduced_point);
+  double dist_to_hull = _facet_dist(i, _reduced_point);
+  for (Index n_steps = 0;; ++n_steps) {
+    if (n_steps > n_facets) {
+      return _scan_dist_to_hull(_reduced_point);
+    }
+    Index next = -1;
+    for (Index j : m_index.neighbors[i]) {
+      double d = _facet_dist(j, _reduced_point);
+      if (d < dist_to_hull) {
+        dist_to_hull = d;
+        next = j;
+      }
+    }
+    if (next == -1) {
+      break;
+    }
+    i = next;
+  }
 
-  double a, b;
-  double dist_to_hull = std::numeric_limits<double>::max();
+  // a facet with a non-bottom neighbor may be closest only because the point
+  // is outside the range spanned by the hull
+  if (m_index.is_boundary[i] && !_facet_contains(i, _reduced_point)) {
+    return _scan_dist_to_hull(_reduced_point);
+  }
+  return dist_to_hull;
+}
 
-  for (auto facet_it = m_bottom_facets.begin();
-       facet_it != m_bottom_facets.end(); ++facet_it) {
-    // Qhull distance is negative for internal points
-    a = -(facet_it->first).distance(qpoint);
-    b = facet_it->second;
-    if (a / b < dist_to_hull) {
-      dist_to_hull = a / b;
+/// \brief The distance each selected Configuration is above the hull along
+/// the energy axis
+///
+/// \returns Distances, in the order of `selection.selected()`
+std::vector<double> Hull::dist_to_hull(
+    const DB::Selection<Configuration> &selection) const {
+  Eigen::MatrixXd mat(m_reduce.cols(), selection.selected_size());
+  Index i = 0;
+  for (const auto &config : selection.selected()) {
+    mat.col(i) = point(config);
+    ++i;
+  }
+  Eigen::VectorXd dist = dist_to_hull_batch(m_reduce * mat);
+  return std::vector<double>(dist.data(), dist.data() + dist.size());
+}
+
+/// \brief The distance each column of a matrix of points in the reduced
+/// composition/energy space is above the hull along the energy axis
+Eigen::VectorXd Hull::dist_to_hull_batch(
+    const Eigen::MatrixXd &reduced_points) const {
+  Eigen::VectorXd dist(reduced_points.cols());
+  for (Index i = 0; i < reduced_points.cols(); ++i) {
+    dist(i) = dist_to_hull(reduced_points.col(i));
+  }
+  return dist;
+}
+
+/// \brief Build the point location data used by dist_to_hull
+///
+/// - Stores the hyperplane and neighboring bottom facets of each bottom facet
+/// - For simplicial facets, stores the inverse of the matrix with columns
+///   `[vertex composition; 1]`, which gives barycentric coordinates
+/// - Assigns each bottom facet to the cell of a uniform grid containing the
+///   projection of its centroid, with roughly one cell per bottom facet, and
+///   fills empty cells from neighboring cells
+void Hull::_build_facet_index() {
+  int dim = m_hull.dimension();
+  int comp_dim = dim - 1;
+  Index n_facets = m_bottom_facets.size();
+
+  m_index.normal.resize(dim, n_facets);
+  m_index.offset.resize(n_facets);
+  m_index.neighbors.assign(n_facets, std::vector<Index>());
+  m_index.is_boundary.assign(n_facets, false);
+  m_index.barycentric.assign(n_facets, Eigen::MatrixXd());
+  m_index.grid_start.clear();
+
+  std::unordered_map<countT, Index> bottom_facet_index;
+  for (Index i = 0; i < n_facets; ++i) {
+    bottom_facet_index[m_bottom_facets[i].first.id()] = i;
+  }
+
+  Eigen::MatrixXd centroid = Eigen::MatrixXd::Zero(comp_dim, n_facets);
+  for (Index i = 0; i < n_facets; ++i) {
+    const orgQhull::QhullFacet &facet = m_bottom_facets[i].first;
+    m_index.normal.col(i) =
+        Eigen::Map<const Eigen::VectorXd>(facet.hyperplane().begin(), dim);
+    m_index.offset(i) = facet.hyperplane().offset();
+
+    orgQhull::QhullFacetSet neighbors = facet.neighborFacets();
+    neighbors.selectAll();
+    for (auto it = neighbors.begin(); it != neighbors.end(); ++it) {
+      auto res = bottom_facet_index.find((*it).id());
+      if (res == bottom_facet_index.end()) {
+        m_index.is_boundary[i] = true;
+      } else {
+        m_index.neighbors[i].push_back(res->second);
+      }
+    }
+
+    orgQhull::QhullVertexSet vertices = facet.vertices();
+    Eigen::MatrixXd M(dim, vertices.size());
+    Index j = 0;
+    for (auto it = vertices.begin(); it != vertices.end(); ++it) {
+      M.block(0, j, comp_dim, 1) =
+          Eigen::Map<const Eigen::VectorXd>((*it).point().begin(), comp_dim);
+      M(comp_dim, j) = 1.0;
+      ++j;
     }
+    centroid.col(i) = M.topRows(comp_dim).rowwise().mean();
+
+    if (facet.isSimplicial() && M.cols() == dim) {
+      Eigen::FullPivLU<Eigen::MatrixXd> lu(M);
+      if (lu.isInvertible()) {
+        m_index.barycentric[i] = lu.inverse();
+      }
+    }
+  }
+
+  if (n_facets == 0 || comp_dim == 0) {
+    return;
+  }
+
+  // grid over the range of bottom vertex compositions
+  Eigen::VectorXd grid_max = Eigen::VectorXd::Constant(
+      comp_dim, -std::numeric_limits<double>::infinity());
+  m_index.grid_min = Eigen::VectorXd::Constant(
+      comp_dim, std::numeric_limits<double>::infinity());
+  for (const auto &vertex : m_bottom_vertices) {
+    Eigen::Map<const Eigen::VectorXd> comp(vertex.point().begin(), comp_dim);
+    m_index.grid_min = m_index.grid_min.cwiseMin(comp);
+    grid_max = grid_max.cwiseMax(comp);
+  }
+  m_index.grid_n = std::max(
+      Index(1), Index(std::floor(std::pow(double(n_facets), 1.0 / comp_dim))));
+  m_index.grid_cell_width = (grid_max - m_index.grid_min) / m_index.grid_n;
+
+  Index n_cells = 1;
+  for (int k = 0; k < comp_dim; ++k) {
+    n_cells *= m_index.grid_n;
+  }
+  m_index.grid_start.assign(n_cells, -1);
+
+  std::queue<Index> filled;
+  Eigen::VectorXd tmp(comp_dim);
+  for (Index i = 0; i < n_facets; ++i) {
+    tmp = centroid.col(i);
+    Index cell = _grid_cell(tmp);
+    if (m_index.grid_start[cell] == -1) {
+      m_index.grid_start[cell] = i;
+      filled.push(cell);
+    }
+  }
+
+  // breadth-first fill of empty cells
+  while (!filled.empty()) {
+    Index cell = filled.front();
+    filled.pop();
+    Index stride = 1;
+    for (int k = 0; k < comp_dim; ++k) {
+      Index c_k = (cell / stride) % m_index.grid_n;
+      if (c_k > 0 && m_index.grid_start[cell - stride] == -1) {
+        m_index.grid_start[cell - stride] = m_index.grid_start[cell];
+        filled.push(cell - stride);
+      }
+      if (c_k < m_index.grid_n - 1 &&
+          m_index.grid_start[cell + stride] == -1) {
+        m_index.grid_start[cell + stride] = m_index.grid_start[cell];
+        filled.push(cell + stride);
+      }
+      stride *= m_index.grid_n;
+    }
+  }
+}
+
+/// \brief Distance along the energy axis from a reduced point to the
+/// hyperplane of the i-th bottom facet
+double Hull::_facet_dist(Index i, const Eigen::VectorXd &_reduced_point) const {
+  // Qhull distance is negative for internal points
+  double a = -(m_index.normal.col(i).dot(_reduced_point) + m_index.offset(i));
+  return a / m_bottom_facets[i].second;
+}
+
+/// \brief True if the projection of the i-th bottom facet onto composition
+/// space contains the composition of a reduced point
+///
+/// - Only checked for simplicial facets, returns false otherwise
+bool Hull::_facet_contains(Index i,
+                           const Eigen::VectorXd &_reduced_point) const {
+  const Eigen::MatrixXd &B = m_index.barycentric[i];
+  if (B.size() == 0) {
+    return false;
+  }
+  Index comp_dim = B.cols() - 1;
+  Eigen::VectorXd lambda =
+      B.leftCols(comp_dim) * _reduced_point.head(comp_dim) + B.col(comp_dim);
+  return lambda.minCoeff() > -1e-10;
+}
+
+/// \brief Index of the point location grid cell containing the composition of
+/// a reduced point
+///
+/// - Points outside the grid are assigned to the nearest cell
+Index Hull::_grid_cell(const Eigen::VectorXd &_reduced_point) const {
+  Index cell = 0;
+  Index stride = 1;
+  for (Index k = 0; k < m_index.grid_min.size(); ++k) {
+    Index c_k = 0;
+    if (m_index.grid_cell_width(k) > 0.0) {
+      double x = (_reduced_point(k) - m_index.grid_min(k)) /
+                 m_index.grid_cell_width(k);
+      if (x >= 1.0) {
+        c_k = Index(std::min(double(m_index.grid_n - 1), std::floor(x)));
+      }
+    }
+    cell += c_k * stride;
+    stride *= m_index.grid_n;
   }
+  return cell;
+}
 
+/// \brief Index of the bottom facet to begin the point location walk from
+Index Hull::_start_facet(const Eigen::VectorXd &_reduced_point) const {
+  return m_index.grid_start[_grid_cell(_reduced_point)];
+}
+
+/// \brief Minimum distance over all bottom facets
+double Hull::_scan_dist_to_hull(const Eigen::VectorXd &_reduced_point) const {
+  double dist_to_hull = std::numeric_limits<double>::max();
+  for (Index i = 0; i < m_bottom_facets.size(); ++i) {
+    dist_to_hull = std::min(dist_to_hull, _facet_dist(i, _reduced_point));
+  }
   return dist_to_hull;
 }
 
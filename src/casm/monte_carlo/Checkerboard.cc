@@ -0,0 +1,107 @@
+#include "casm/monte_carlo/Checkerboard.hh"
+
+#include <cstdlib>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+
+#include "casm/clex/Supercell.hh"
+#include "casm/crystallography/UnitCellCoord.hh"
+#include "casm/monte_carlo/Conversions.hh"
+
+namespace CASM {
+namespace Monte {
+
+/// \brief Constructor
+///
+/// \param convert Conversions for the Monte Carlo supercell
+/// \param site_neighborhood The sites involved in evaluating the change in
+///     potential energy due to changing the occupation of a site in the origin
+///     unit cell, as given by `Clexulator::site_neighborhood`
+///
+/// \throws If the supercell is too small to be colored, because along some
+///     prim lattice vector no integer larger than the extent of the
+///     neighborhood divides the corresponding row of the supercell
+///     transformation matrix
+Checkerboard::Checkerboard(
+    Conversions const &convert,
+    std::set<xtal::UnitCellCoord> const &site_neighborhood) {
+  Eigen::Vector3l extent = Eigen::Vector3l::Zero();
+  for (xtal::UnitCellCoord const &bijk : site_neighborhood) {
+    for (int i = 0; i < 3; ++i) {
+      extent(i) = std::max(extent(i), std::abs(bijk.unitcell()(i)));
+    }
+  }
+
+  Eigen::Matrix3l T = convert.mc_scel().transf_mat();
+  for (int i = 0; i < 3; ++i) {
+    long row_gcd = std::gcd(std::gcd(T(i, 0), T(i, 1)), T(i, 2));
+    long m = extent(i) + 1;
+    while (m <= row_gcd && row_gcd % m != 0) {
+      ++m;
+    }
+    if (m > row_gcd) {
+      std::stringstream msg;
+      msg << "Error constructing Checkerboard: supercell is too small. "
+          << "Along prim lattice vector " << i << ", the site neighborhood "
+          << "extends " << extent(i) << " unit cells, but no larger integer "
+          << "divides the row of the supercell transformation matrix: "
+          << T.row(i);
+      throw std::runtime_error(msg.str());
+    }
+    m_period(i) = m;
+  }
+
+  // color index, before removing colors without variable sites
+  Index n_sites = convert.mc_scel().num_sites();
+  Index n_cell_colors = m_period.prod();
+  std::vector<std::vector<Index>> sites(
+      convert.mc_scel().basis_size() * n_cell_colors);
+  for (Index l = 0; l < n_sites; ++l) {
+    if (convert.occ_size(convert.l_to_asym(l)) < 2) {
+      continue;
+    }
+    xtal::UnitCell ijk = convert.l_to_ijk(l);
+    Index c = convert.l_to_b(l);
+    for (int i = 0; i < 3; ++i) {
+      long r = ijk(i) % m_period(i);
+      c = c * m_period(i) + (r < 0 ? r + m_period(i) : r);
+    }
+    sites[c].push_back(l);
+  }
+
+  m_color.resize(n_sites, -1);
+  for (auto &color_sites : sites) {
+    if (color_sites.empty()) {
+      continue;
+    }
+    for (Index l : color_sites) {
+      m_color[l] = m_sites.size();
+    }
+    m_sites.push_back(std::move(color_sites));
+  }
+}
+
+CheckerboardThread::CheckerboardThread(Clexulator const &clexulator,
+                                       Index n_species, MTRand::uint32 seed)
+    : mtrand(seed),
+      context(clexulator.make_context()),
+      dcorr(Eigen::VectorXd::Zero(clexulator.corr_size())),
+      tmp_dcorr(Eigen::VectorXd::Zero(clexulator.corr_size())),
+      sum_dcorr(Eigen::VectorXd::Zero(clexulator.corr_size())),
+      sum_dEf(0.0),
+      sum_dEpot(0.0),
+      sum_dN(Eigen::VectorXl::Zero(n_species)) {}
+
+/// \brief Clear accepted changes and sums of property changes
+void CheckerboardThread::reset() {
+  site.clear();
+  new_occ.clear();
+  sum_dcorr.setZero();
+  sum_dEf = 0.0;
+  sum_dEpot = 0.0;
+  sum_dN.setZero();
+}
+
+}  // namespace Monte
+}  // namespace CASM
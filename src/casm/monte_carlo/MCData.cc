@@ -5,6 +5,82 @@
 namespace CASM {
 namespace Monte {
 
+const MCData::size_type MCData::lag_block_size;
+const MCData::size_type MCData::max_tracked_lag;
+
+/// \brief Sum of (X(j) - mean)*(X(j+lag) - mean), for j in range
+/// [begin, end - lag)
+///
+/// - Uses the partial sums accumulated by push_back, so the cost does not
+///   depend on the number of observations (after the first use of 'lag')
+double MCData::lag_covariance_sum(size_type begin, size_type end,
+                                  size_type lag, double mean) const {
+  double mu = mean - m_shift;
+  double range_size = end - begin - lag;
+  double sum_yy =
+      _lag_partial_sum(lag, end) - _lag_partial_sum(lag, begin + lag);
+  double sum_first = m_partial_sum[end - lag] - m_partial_sum[begin];
+  double sum_second = m_partial_sum[end] - m_partial_sum[begin + lag];
+  return sum_yy - mu * (sum_first + sum_second) + range_size * mu * mu;
+}
+
+/// \brief Sum of Y(j)*Y(j+lag), for j+lag < k, where Y = X - m_shift
+///
+/// - Lags > max_tracked_lag are summed directly
+double MCData::_lag_partial_sum(size_type lag, size_type k) const {
+  if (lag == 0) {
+    return m_partial_sum_sq[k];
+  }
+
+  size_type c = 0;
+  double result = 0.0;
+  if (lag <= max_tracked_lag) {
+    // start from the nearest checkpoint, and add remaining products
+    _track_lag(lag);
+    c = k / lag_block_size;
+    result = m_lag_checkpoint[lag - 1][c];
+  }
+  for (size_type m = std::max(c * lag_block_size, lag); m < k; ++m) {
+    result += (m_observation(m - lag) - m_shift) * (m_observation(m) - m_shift);
+  }
+  return result;
+}
+
+/// \brief Begin accumulating lag products for all lags <= 'lag'
+///
+/// - Each lag requires one pass over existing observations when it is first
+///   used, and is then updated by push_back
+void MCData::_track_lag(size_type lag) const {
+  while (m_lag_sum.size() < lag) {
+    size_type l = m_lag_sum.size() + 1;
+    std::vector<double> checkpoint(1, 0.0);
+    double value = 0.0;
+    for (size_type m = 0; m < m_size; ++m) {
+      if (m >= l) {
+        value +=
+            (m_observation(m - l) - m_shift) * (m_observation(m) - m_shift);
+      }
+      if ((m + 1) % lag_block_size == 0) {
+        checkpoint.push_back(value);
+      }
+    }
+    m_lag_sum.push_back(value);
+    m_lag_checkpoint.push_back(std::move(checkpoint));
+  }
+}
+
+namespace {
+
+MCData _make_data(const Eigen::VectorXd &observations) {
+  MCData data(observations.size() + 1);
+  for (Index i = 0; i < observations.size(); ++i) {
+    data.push_back(observations(i));
+  }
+  return data;
+}
+
+}  // namespace
+
 /// \brief Check if a range of observations have equilibrated
 ///
 /// \param observations An Eigen::VectorXd of observations
@@ -37,9 +113,21 @@ namespace Monte {
 ///    set: m_is_equilibrated = false; m_equil_samples = N-1;
 ///
 MCDataEquilibration::MCDataEquilibration(const Eigen::VectorXd &observations,
-                                         double prec) {
+                                         double prec)
+    : MCDataEquilibration(_make_data(observations), prec) {}
+
+/// \brief Check if all observations in 'data' have equilibrated
+///
+/// \param data Observations, with accumulated partial sums
+/// \param prec Desired absolute precision (<X> +/- prec)
+///
+/// - Same as MCDataEquilibration(data.observations(), prec), but uses the
+///   partial sums accumulated by MCData instead of re-scanning all
+///   observations
+MCDataEquilibration::MCDataEquilibration(const MCData &data, double prec) {
   size_type start1, start2, N;
   double sum1, sum2;
+  const auto &observations = data.observations();
   double eps =
       (observations(0) == 0.0) ? 1e-8 : std::abs(observations(0)) * 1e-8;
 
@@ -49,13 +137,7 @@ MCDataEquilibration::MCDataEquilibration(const Eigen::VectorXd &observations,
   // -------------------------------------------------
   // if the values are all the same to observations(0)*1e-8, set
   // m_is_equilibrated = true; m_equil_samples = 0;
-  bool all_same = true;
-  for (size_type i = 0; i < N; i++)
-    if (std::abs(observations(i) - observations(0)) > eps) {
-      all_same = false;
-      break;
-    }
-  if (all_same) {
+  if (data.max_deviation() <= eps) {
     m_is_equilibrated = true;
     m_equil_samples = 0;
     return;
@@ -66,24 +148,15 @@ MCDataEquilibration::MCDataEquilibration(const Eigen::VectorXd &observations,
   start2 = (is_even) ? N / 2 : (N / 2) + 1;
 
   // find sums for each partition
-  sum1 = observations.head(start2).sum();
+  sum1 = data.sum(start1, start2);
   // mean1 = sum1 / (start2 - start1)
-  sum2 = observations.segment(start2, N - start2).sum();
+  sum2 = data.sum(start2, N);
   // mean2 = sum2 / (N - start2)
 
-  // std::cout << observations << std::endl;
-
   // increment start1 (and update start2, sum1, and sum2) until abs(mean1 -
   // mean2) < prec
   while (std::abs((sum1 / (start2 - start1)) - (sum2 / (N - start2))) > prec &&
          start1 < N - 2) {
-    /*std::cout << "  start1: " << start1 << "  start2: " << start2 << "  N: "
-       << N
-              << "  mean1: " << (sum1 / (start2 - start1)) << "  mean2: " <<
-       (sum2 / (N - start2))
-              << "  diff: " << std::abs((sum1 / (start2 - start1)) - (sum2 / (N
-       - start2)))
-              << "  prec: " << prec << std::endl;*/
     if (is_even) {
       sum1 -= observations(start1);
       sum1 += observations(start2);
@@ -131,19 +204,29 @@ MCDataEquilibration::MCDataEquilibration(const Eigen::VectorXd &observations,
 ///
 MCDataConvergence::MCDataConvergence(const Eigen::VectorXd &observations,
                                      double conf)
+    : MCDataConvergence(_make_data(observations), 0, conf) {}
+
+/// \brief Construct a MCDataConvergence object for observations in range
+/// [begin, data.size())
+///
+/// - Same as MCDataConvergence(data.observations().segment(begin, ...), conf),
+///   but uses the partial sums accumulated by MCData instead of re-scanning
+///   all observations for each lag
+MCDataConvergence::MCDataConvergence(const MCData &data, size_type begin,
+                                     double conf)
     : m_is_converged(false),
-      m_mean(observations.mean()),
-      m_squared_norm(observations.squaredNorm()) {
+      m_mean(data.sum(begin, data.size()) / (data.size() - begin)),
+      m_squared_norm(data.squared_norm(begin, data.size())) {
   // will check if Var <= criteria
   double z_alpha = sqrt(2.0) * boost::math::erf_inv(conf);
 
   bool found_rho;
   double rho;
   double CoVar0;
-  size_type N = observations.size();
+  size_type N = data.size() - begin;
 
   // try to calculate variance taking into account correlations
-  std::tie(found_rho, rho, CoVar0) = _calc_rho(observations);
+  std::tie(found_rho, rho, CoVar0) = _calc_rho(data, begin);
 
   if (!found_rho) {
     m_is_converged = false;
@@ -156,21 +239,16 @@ MCDataConvergence::MCDataConvergence(const Eigen::VectorXd &observations,
   m_calculated_prec = z_alpha * sqrt(var_of_mean);
 }
 
-double covariance(const Eigen::VectorXd &X, const Eigen::VectorXd &Y,
-                  double mean) {
-  Eigen::VectorXd vmean = Eigen::VectorXd::Ones(X.size()) * mean;
-  return (X - vmean).dot(Y - vmean) / X.size();
-}
-
 /// \brief Try to find rho = pow(2.0, -1.0/i), using min i such that
 /// CoVar[i]/CoVar[0] <= 0.5
 ///
 /// \returns std::tuple<bool, double> : (found_rho?, rho)
 ///
 std::tuple<bool, double, double> MCDataConvergence::_calc_rho(
-    const Eigen::VectorXd &observations) {
-  size_type N = observations.size();
-  double CoVar0 = m_squared_norm / N - m_mean * m_mean;
+    const MCData &data, size_type begin) {
+  size_type end = data.size();
+  size_type N = end - begin;
+  double CoVar0 = data.squared_deviation(begin, end, m_mean) / N;
 
   // if there is essentially no variation, return rho(l==1)
   if (std::abs(CoVar0 / m_mean) < 1e-8 || CoVar0 == 0.0) {
@@ -182,8 +260,7 @@ std::tuple<bool, double, double> MCDataConvergence::_calc_rho(
   for (size_type i = 1; i < N; ++i) {
     size_type range_size = N - i;
 
-    double cov = covariance(observations.segment(0, range_size),
-                            observations.segment(i, range_size), m_mean);
+    double cov = data.lag_covariance_sum(begin, end, i, m_mean) / range_size;
 
     if (std::abs(cov / CoVar0) <= 0.5) {
       return std::make_tuple(true, pow(2.0, (-1.0 / i)), CoVar0);
@@ -39,13 +39,39 @@ void MonteCarlo::sample_data(const MonteCounter &counter) {
   m_sample_time.push_back(std::make_pair(counter.pass(), counter.step()));
 
   if (m_write_trajectory) {
-    m_trajectory.push_back(configdof());
+    if (m_trajectory_writer) {
+      m_trajectory_writer->write(counter.pass(), counter.step(),
+                                 configdof().occupation());
+    } else {
+      m_trajectory.push_back(configdof());
+    }
   }
 
   m_is_equil_uptodate = false;
   m_is_converged_uptodate = false;
 }
 
+/// \brief Stream snapshots to 'file_path', as they are taken, instead of
+/// storing them in trajectory()
+///
+/// - Only the occupation is written, see OccTrajectoryWriter for the format
+/// - Has no effect unless snapshots are requested (write_trajectory)
+void MonteCarlo::begin_trajectory_stream(const fs::path &file_path) {
+  end_trajectory_stream();
+  if (m_write_trajectory) {
+    m_trajectory_writer = notstd::make_unique<OccTrajectoryWriter>(
+        file_path, configdof().occupation().size());
+  }
+}
+
+/// \brief Finish streaming snapshots and close the file
+void MonteCarlo::end_trajectory_stream() {
+  if (m_trajectory_writer) {
+    m_trajectory_writer->close();
+    m_trajectory_writer.reset();
+  }
+}
+
 /// \brief Clear all data from all samplers
 void MonteCarlo::clear_samples() {
   for (auto it = m_sampler.begin(); it != m_sampler.end(); ++it) {
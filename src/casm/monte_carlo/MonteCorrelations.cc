@@ -2,6 +2,7 @@
 
 #include "casm/clex/Clexulator.hh"
 #include "casm/clex/ConfigCorrelations.hh"
+#include "casm/clex/NeighborList.hh"
 #include "casm/monte_carlo/Conversions.hh"
 #include "casm/monte_carlo/OccLocation.hh"
 
@@ -24,9 +25,6 @@ void restricted_delta_corr(Eigen::VectorXd &dcorr, OccEvent const &occ_event,
                            unsigned int const *corr_indices_end) {
   const OccEvent &e = occ_event;
 
-  // we'll revert changes when we're done so in the end nothing changes
-  ConfigDoF &mutable_configdof = const_cast<ConfigDoF &>(configdof);
-
   if (e.occ_transform.size() == 0) {
     for (auto it = corr_indices_begin; it != corr_indices_end; ++it) {
       *(dcorr.data() + *it) = 0.0;
@@ -34,7 +32,30 @@ void restricted_delta_corr(Eigen::VectorXd &dcorr, OccEvent const &occ_event,
     return;
   }
 
-  static std::vector<int> curr_occ;
+  if (!supercell_neighbor_list.overlaps()) {
+    // evaluate all changes with one call to the clexulator
+    static thread_local std::vector<clexulator::OccDelta> occ_delta;
+    occ_delta.resize(e.occ_transform.size());
+    for (Index i = 0; i < e.occ_transform.size(); ++i) {
+      OccTransform const &t = e.occ_transform[i];
+      clexulator::OccDelta &delta = occ_delta[i];
+      Index unitcell_index = supercell_neighbor_list.unitcell_index(t.l);
+      delta.nlist_begin = supercell_neighbor_list.sites(unitcell_index).data();
+      delta.neighbor_ind = supercell_neighbor_list.neighbor_index(t.l);
+      delta.occ_i = configdof.occ(t.l);
+      delta.occ_f = convert.occ_index(t.asym, t.to_species);
+    }
+    dcorr.resize(clexulator.corr_size());
+    clexulator.calc_restricted_delta_point_corr(
+        configdof, occ_delta.data(), end_ptr(occ_delta), dcorr.data(),
+        end_ptr(dcorr), corr_indices_begin, corr_indices_end);
+    return;
+  }
+
+  // we'll revert changes when we're done so in the end nothing changes
+  ConfigDoF &mutable_configdof = const_cast<ConfigDoF &>(configdof);
+
+  static thread_local std::vector<int> curr_occ;
   curr_occ.resize(e.occ_transform.size());
 
   // first swap
@@ -46,7 +67,7 @@ void restricted_delta_corr(Eigen::VectorXd &dcorr, OccEvent const &occ_event,
   mutable_configdof.occ(t.l) = new_occ;
 
   // subsequent swaps
-  static Eigen::VectorXd tmp_dcorr;
+  static thread_local Eigen::VectorXd tmp_dcorr;
   for (Index i = 1; i < e.occ_transform.size(); ++i) {
     OccTransform const &t = e.occ_transform[i];
     curr_occ[i] = configdof.occ(t.l);
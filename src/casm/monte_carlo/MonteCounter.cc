@@ -162,6 +162,38 @@ MonteCounter MonteCounter::operator++(int) {
   return init;
 }
 
+/// \brief Increment by n_steps steps and update pass, as for steps skipped
+/// by rejection-free Monte Carlo
+///
+/// - Equivalent to n_steps prefix increments
+void MonteCounter::increment(size_type n_steps) {
+  m_step += n_steps;
+  size_type n_pass = m_step / m_steps_per_pass;
+  m_pass += n_pass;
+  m_step -= n_pass * m_steps_per_pass;
+
+  if (m_sample_mode == Monte::SAMPLE_MODE::PASS) {
+    m_since_last_sample += n_pass;
+  } else {
+    m_since_last_sample += n_steps;
+  }
+}
+
+/// \brief Number of steps until it is time to take the next sample
+///
+/// - Returns 0 if it is time to take a sample, or if the sample time was
+///   passed without taking a sample
+MonteCounter::size_type MonteCounter::steps_until_sample() const {
+  size_type remaining = m_sample_period - m_since_last_sample;
+  if (remaining <= 0) {
+    return 0;
+  }
+  if (m_sample_mode == Monte::SAMPLE_MODE::STEP) {
+    return remaining;
+  }
+  return (remaining - 1) * m_steps_per_pass + (m_steps_per_pass - m_step);
+}
+
 /// \brief Check if requested number of pass, step, or samples has been met
 bool MonteCounter::is_complete() const {
   if (m_is_N_step && step() >= m_N_step) {
@@ -22,7 +22,8 @@ const std::string traits<Monte::METHOD>::name = "method";
 const std::multimap<Monte::METHOD, std::vector<std::string> >
     traits<Monte::METHOD>::strval = {
         {Monte::METHOD::Metropolis, {"Metropolis", "metropolis"}},
-        {Monte::METHOD::LTE1, {"LTE1", "lte1"}}};
+        {Monte::METHOD::LTE1, {"LTE1", "lte1"}},
+        {Monte::METHOD::Kinetic, {"Kinetic", "kinetic"}}};
 
 namespace Monte {
 ENUM_IO_DEF(CASM::Monte::METHOD)
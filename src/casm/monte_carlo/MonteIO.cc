@@ -16,6 +16,7 @@
 #include "casm/external/gzstream/gzstream.h"
 #include "casm/monte_carlo/MonteCarlo.hh"
 #include "casm/monte_carlo/MonteSettings.hh"
+#include "casm/monte_carlo/OccTrajectory.hh"
 
 namespace CASM {
 
@@ -313,6 +314,66 @@ void write_observations(const MonteSettings &settings, const MonteCarlo &mc,
   }
 }
 
+namespace {
+
+/// \brief Write "occupation_key.csv"
+///
+/// \code
+/// site_index occ_index_0 occ_index_1 ...
+/// 0          Ni          Al
+/// 1          Ni          -
+/// ...
+/// \endcode
+void write_occupation_key_csv(const Structure &prim,
+                              const MonteCarloDirectoryStructure &dir,
+                              Log &_log) {
+  int max_allowed = 0;
+  for (int i = 0; i < prim.basis().size(); i++) {
+    if (prim.basis()[i].allowed_occupants().size() > max_allowed) {
+      max_allowed = prim.basis()[i].allowed_occupants().size();
+    }
+  }
+
+  fs::ofstream keyout(dir.occupation_key_csv());
+  _log << "write: " << dir.occupation_key_csv() << "\n";
+  keyout << "site_index";
+  for (int i = 0; i < max_allowed; i++) {
+    keyout << "\tocc_index_" << i;
+  }
+  keyout << "\n";
+
+  for (int i = 0; i < prim.basis().size(); i++) {
+    keyout << i;
+    for (int j = 0; j < max_allowed; j++) {
+      if (j < prim.basis()[i].allowed_occupants().size()) {
+        keyout << "\t" << prim.basis()[i].allowed_occupants()[j];
+      } else {
+        keyout << "\t-";
+      }
+    }
+    keyout << "\n";
+  }
+  keyout.close();
+}
+
+/// \brief Write "occupation_key.json"
+///
+/// \code
+/// [["A", "B"],["A" "C"], ... ]
+/// \endcode
+void write_occupation_key_json(const Structure &prim,
+                               const MonteCarloDirectoryStructure &dir,
+                               Log &_log) {
+  jsonParser key = jsonParser::array();
+  for (int i = 0; i < prim.basis().size(); i++) {
+    key.push_back(prim.basis()[i].allowed_occupants());
+  }
+  key.write(dir.occupation_key_json());
+  _log << "write: " << dir.occupation_key_json() << "\n";
+}
+
+}  // namespace
+
 /// \brief Will create (and possibly overwrite) new file with all observations
 /// from run with conditions.cond_index
 ///
@@ -341,9 +402,22 @@ void write_trajectory(const MonteSettings &settings, const MonteCarlo &mc,
 
     MonteCarloDirectoryStructure dir(settings.output_directory());
     fs::create_directories(dir.conditions_dir(cond_index));
-    auto formatter = make_trajectory_formatter(mc);
     const Structure &prim = mc.primclex().prim();
 
+    // snapshots were already written by MonteCarlo::sample_data
+    if (settings.stream_trajectory()) {
+      _log << "streamed: " << dir.trajectory_occ(cond_index) << "\n";
+      if (settings.write_csv()) {
+        write_occupation_key_csv(prim, dir, _log);
+      }
+      if (settings.write_json()) {
+        write_occupation_key_json(prim, dir, _log);
+      }
+      return;
+    }
+
+    auto formatter = make_trajectory_formatter(mc);
+
     std::vector<std::pair<ConstMonteCarloPtr, size_type> > observations;
     ConstMonteCarloPtr ptr = &mc;
     for (size_type i = 0; i < mc.sample_times().size(); ++i) {
@@ -358,39 +432,7 @@ void write_trajectory(const MonteSettings &settings, const MonteCarlo &mc,
       sout << formatter(observations.cbegin(), observations.cend());
       sout.close();
 
-      int max_allowed = 0;
-      for (int i = 0; i < prim.basis().size(); i++) {
-        if (prim.basis()[i].allowed_occupants().size() > max_allowed) {
-          max_allowed = prim.basis()[i].allowed_occupants().size();
-        }
-      }
-
-      // --- Write "occupation_key.csv" ------------
-      //
-      // site_index occ_index_0 occ_index_1 ...
-      // 0          Ni          Al
-      // 1          Ni          -
-      // ...
-      fs::ofstream keyout(dir.occupation_key_csv());
-      _log << "write: " << dir.occupation_key_csv() << "\n";
-      keyout << "site_index";
-      for (int i = 0; i < max_allowed; i++) {
-        keyout << "\tocc_index_" << i;
-      }
-      keyout << "\n";
-
-      for (int i = 0; i < prim.basis().size(); i++) {
-        keyout << i;
-        for (int j = 0; j < max_allowed; j++) {
-          if (j < prim.basis()[i].allowed_occupants().size()) {
-            keyout << "\t" << prim.basis()[i].allowed_occupants()[j];
-          } else {
-            keyout << "\t-";
-          }
-        }
-        keyout << "\n";
-      }
-      keyout.close();
+      write_occupation_key_csv(prim, dir, _log);
     }
 
     if (settings.write_json()) {
@@ -415,16 +457,7 @@ void write_trajectory(const MonteSettings &settings, const MonteCarlo &mc,
       sout << json;
       sout.close();
 
-      // --- Write "occupation_key.json" ------------
-      //
-      // [["A", "B"],["A" "C"], ... ]
-
-      jsonParser key = jsonParser::array();
-      for (int i = 0; i < prim.basis().size(); i++) {
-        key.push_back(prim.basis()[i].allowed_occupants());
-      }
-      key.write(dir.occupation_key_json());
-      _log << "write: " << dir.occupation_key_json() << "\n";
+      write_occupation_key_json(prim, dir, _log);
     }
 
   } catch (...) {
@@ -499,6 +532,34 @@ void write_POSCAR_trajectory(const MonteCarlo &mc, size_type cond_index,
   MonteCarloDirectoryStructure dir(mc.settings().output_directory());
   fs::create_directories(dir.trajectory_dir(cond_index));
 
+  // POSCAR title comment is printed with "Sample: #  Pass: #  Step: #"
+  auto write_snapshot = [&](size_type i, size_type pass, size_type step,
+                            const ConfigDoF &config_dof) {
+    std::stringstream ss;
+    ss << "Sample: " << i << "  Pass: " << pass << "  Step: " << step;
+
+    // write file
+    fs::ofstream sout(dir.POSCAR_snapshot(cond_index, i));
+    _log << "write: " << dir.POSCAR_snapshot(cond_index, i) << "\n";
+    VaspIO::PrintPOSCAR p(make_simple_structure(mc.supercell(), config_dof));
+    p.set_title(ss.str());
+    p.sort();
+    p.print(sout);
+    sout.close();
+  };
+
+  // streamed trajectory: write each snapshot as it is read
+  if (mc.settings().stream_trajectory()) {
+    OccTrajectoryReader reader(dir.trajectory_occ(cond_index));
+    ConfigDoF config_dof(Configuration(mc.supercell()).configdof());
+    while (reader.next()) {
+      config_dof.set_occupation(reader.occupation());
+      write_snapshot(reader.frame_index(), reader.pass(), reader.step(),
+                     config_dof);
+    }
+    return;
+  }
+
   std::vector<size_type> pass;
   std::vector<size_type> step;
   std::vector<ConfigDoF> trajectory;
@@ -556,18 +617,7 @@ void write_POSCAR_trajectory(const MonteCarlo &mc, size_type cond_index,
   }
 
   for (size_type i = 0; i < trajectory.size(); i++) {
-    // POSCAR title comment is printed with "Sample: #  Pass: #  Step: #"
-    std::stringstream ss;
-    ss << "Sample: " << i << "  Pass: " << pass[i] << "  Step: " << step[i];
-
-    // write file
-    fs::ofstream sout(dir.POSCAR_snapshot(cond_index, i));
-    _log << "write: " << dir.POSCAR_snapshot(cond_index, i) << "\n";
-    VaspIO::PrintPOSCAR p(make_simple_structure(mc.supercell(), trajectory[i]));
-    p.set_title(ss.str());
-    p.sort();
-    p.print(sout);
-    sout.close();
+    write_snapshot(i, pass[i], step[i], trajectory[i]);
   }
 
   return;
@@ -134,6 +134,135 @@ bool MonteSettings::dependent_runs() const {
   return _get_setting<bool>("driver", "dependent_runs", help);
 }
 
+/// \brief Number of threads to use for running independent conditions
+///        concurrently. Default 1.
+Index MonteSettings::n_threads() const {
+  if (!_is_setting("driver", "n_threads")) {
+    return 1;
+  }
+  std::string help =
+      "int (default=1)\n"
+      "  Number of conditions to run concurrently, each on its own thread.\n"
+      "  Only used if \"dependent_runs\" is false, or for replica exchange.\n";
+  Index result = _get_setting<Index>("driver", "n_threads", help);
+  if (result < 1) {
+    throw std::runtime_error(
+        "Error reading Monte Carlo settings: \"driver\"/\"n_threads\" must "
+        "be >= 1");
+  }
+  return result;
+}
+
+/// \brief Number of threads to use for calculating the correlations of the
+///        entire supercell. Default 1.
+Index MonteSettings::correlations_n_threads() const {
+  if (!_is_setting("driver", "correlations_n_threads")) {
+    return 1;
+  }
+  std::string help =
+      "int (default=1)\n"
+      "  Number of threads used to calculate the correlations of the entire\n"
+      "  supercell, as is done at the beginning of each calculation.\n";
+  Index result = _get_setting<Index>("driver", "correlations_n_threads", help);
+  if (result < 1) {
+    throw std::runtime_error(
+        "Error reading Monte Carlo settings: "
+        "\"driver\"/\"correlations_n_threads\" must be >= 1");
+  }
+  return result;
+}
+
+/// \brief If true, use rejection-free (n-fold way) steps. Default false.
+bool MonteSettings::rejection_free() const {
+  if (!_is_setting("driver", "rejection_free")) {
+    return false;
+  }
+  std::string help =
+      "bool (default=false)\n"
+      "  If true, instead of proposing events that may be rejected, select\n"
+      "  accepted events directly and skip the steps that would have been\n"
+      "  rejected (n-fold way). Sampling is equivalent to Metropolis Monte\n"
+      "  Carlo. Only supported for grand canonical calculations.\n";
+  return _get_setting<bool>("driver", "rejection_free", help);
+}
+
+/// \brief If true, use checkerboard steps. Default false.
+bool MonteSettings::checkerboard() const {
+  if (!_is_setting("driver", "checkerboard")) {
+    return false;
+  }
+  std::string help =
+      "bool (default=false)\n"
+      "  If true, instead of proposing changes to one site at a time, propose\n"
+      "  changes to every site of one color of a checkerboard partition of the\n"
+      "  supercell, whose sites do not share any cluster, and evaluate them\n"
+      "  concurrently.\n";
+  return _get_setting<bool>("driver", "checkerboard", help);
+}
+
+/// \brief Number of threads to use for checkerboard steps. Default 1.
+Index MonteSettings::checkerboard_n_threads() const {
+  if (!_is_setting("driver", "checkerboard_n_threads")) {
+    return 1;
+  }
+  std::string help =
+      "int (default=1)\n"
+      "  Number of threads used to evaluate checkerboard steps.\n";
+  Index result = _get_setting<Index>("driver", "checkerboard_n_threads", help);
+  if (result < 1) {
+    throw std::runtime_error(
+        "Error reading Monte Carlo settings: "
+        "\"driver\"/\"checkerboard_n_threads\" must be >= 1");
+  }
+  return result;
+}
+
+/// \brief Returns true if a random number generator seed is given
+///        ("driver"/"seed" exists)
+bool MonteSettings::is_seed() const { return _is_setting("driver", "seed"); }
+
+/// \brief Random number generator seed. Calculation i, in conditions list
+///        order, is seeded with seed() + i.
+Index MonteSettings::seed() const {
+  std::string help =
+      "int (optional)\n"
+      "  Random number generator seed. Calculation i, in conditions list\n"
+      "  order, is seeded with seed + i. If not given, each calculation is\n"
+      "  seeded randomly.\n";
+  Index result = _get_setting<Index>("driver", "seed", help);
+  if (result < 0) {
+    throw std::runtime_error(
+        "Error reading Monte Carlo settings: \"driver\"/\"seed\" must be "
+        ">= 0");
+  }
+  return result;
+}
+
+/// \brief Returns true if the conditions should be run as replicas, with
+///        replica exchange ("driver"/"replica_exchange" exists)
+bool MonteSettings::is_replica_exchange() const {
+  return _is_setting("driver", "replica_exchange");
+}
+
+/// \brief Number of passes between replica exchange attempts. Default 1.
+Index MonteSettings::replica_exchange_swap_period() const {
+  if (!_is_setting("driver", "replica_exchange", "swap_period")) {
+    return 1;
+  }
+  std::string help =
+      "int (default=1)\n"
+      "  Number of passes between attempts to exchange the DoF of replicas at\n"
+      "  neighboring conditions.\n";
+  Index result =
+      _get_setting<Index>("driver", "replica_exchange", "swap_period", help);
+  if (result < 1) {
+    throw std::runtime_error(
+        "Error reading Monte Carlo settings: "
+        "\"driver\"/\"replica_exchange\"/\"swap_period\" must be >= 1");
+  }
+  return result;
+}
+
 /// \brief Directory where output should go
 const fs::path MonteSettings::output_directory() const {
   return m_output_directory;
@@ -164,6 +293,20 @@ bool MonteSettings::write_trajectory() const {
   return _get_setting<bool>(level1, level2, level3, help);
 }
 
+/// \brief Returns true if snapshots should be streamed to a compressed file
+/// of occupation changes as they are taken. Requires write_trajectory.
+bool MonteSettings::stream_trajectory() const {
+  std::string level1 = "data";
+  std::string level2 = "storage";
+  std::string level3 = "stream_trajectory";
+  std::string help = "(bool, default=false)";
+  if (!_is_setting(level1, level2, level3)) {
+    return false;
+  }
+
+  return _get_setting<bool>(level1, level2, level3, help);
+}
+
 /// \brief Returns true if POSCARs of snapshots are requsted. Requires
 /// write_trajectory.
 bool MonteSettings::write_POSCAR_snapshots() const {
@@ -0,0 +1,132 @@
+#include "casm/monte_carlo/MotifSearch.hh"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <stdexcept>
+
+#include "casm/clex/ConfigCorrelations.hh"
+#include "casm/clex/Configuration.hh"
+#include "casm/clex/ECIContainer.hh"
+#include "casm/database/ConfigDatabase.hh"
+
+namespace CASM {
+namespace Monte {
+
+/// \brief Constructor
+///
+/// \param _configname Name of each configuration
+/// \param _corr Correlations, normalized per primitive cell (rows:
+///     configurations, columns: correlations corresponding to `_eci`)
+/// \param _comp_x Parametric composition (rows: configurations)
+/// \param _eci ECI values, for each column of `_corr`
+MotifSearch::MotifSearch(std::vector<std::string> _configname,
+                         Eigen::MatrixXd _corr, Eigen::MatrixXd _comp_x,
+                         Eigen::VectorXd const &_eci)
+    : m_configname(std::move(_configname)),
+      m_corr(std::move(_corr)),
+      m_comp_x(std::move(_comp_x)) {
+  if (m_corr.rows() != size() || m_comp_x.rows() != size() ||
+      m_corr.cols() != _eci.size()) {
+    throw std::runtime_error(
+        "Error constructing MotifSearch: inconsistent dimensions");
+  }
+  m_formation_energy = m_corr * _eci;
+}
+
+/// \brief Potential energy, normalized per primitive cell, of each
+/// configuration (rows) for each set of parametric chemical potential
+/// (columns)
+///
+/// \param param_chem_pot Parametric chemical potential (rows: composition
+///     axes, columns: sets of conditions)
+Eigen::MatrixXd MotifSearch::potential_energy(
+    Eigen::MatrixXd const &param_chem_pot) const {
+  if (param_chem_pot.rows() != m_comp_x.cols()) {
+    throw std::runtime_error(
+        "Error in MotifSearch::potential_energy: param_chem_pot size does not "
+        "match the number of composition axes");
+  }
+  Eigen::MatrixXd result = -m_comp_x * param_chem_pot;
+  result.colwise() += m_formation_energy;
+  return result;
+}
+
+/// \brief Minimum potential energy configurations for each set of
+/// parametric chemical potential
+///
+/// \param param_chem_pot Parametric chemical potential (rows: composition
+///     axes, columns: sets of conditions)
+/// \param tol Configurations with potential energy within `tol` of the
+///     minimum are considered degenerate
+/// \param allowed If not empty, only configurations `i` with `allowed[i] ==
+///     true` are considered
+///
+/// \returns result[j]: indices of the degenerate minimum potential energy
+///     configurations for column `j` of `param_chem_pot`, sorted by
+///     potential energy and then by index. Empty if no configurations are
+///     allowed.
+std::vector<std::vector<Index>> MotifSearch::ground_states(
+    Eigen::MatrixXd const &param_chem_pot, double tol,
+    std::vector<bool> const &allowed) const {
+  if (!allowed.empty() && allowed.size() != size()) {
+    throw std::runtime_error(
+        "Error in MotifSearch::ground_states: allowed size does not match the "
+        "number of configurations");
+  }
+  Eigen::MatrixXd Epot = potential_energy(param_chem_pot);
+
+  std::vector<std::vector<Index>> result(Epot.cols());
+  for (Index j = 0; j < Epot.cols(); ++j) {
+    double min_Epot = std::numeric_limits<double>::infinity();
+    for (Index i = 0; i < size(); ++i) {
+      if (allowed.empty() || allowed[i]) {
+        min_Epot = std::min(min_Epot, Epot(i, j));
+      }
+    }
+    std::vector<Index> &min_i = result[j];
+    for (Index i = 0; i < size(); ++i) {
+      if ((allowed.empty() || allowed[i]) && Epot(i, j) < min_Epot + tol) {
+        min_i.push_back(i);
+      }
+    }
+    std::stable_sort(min_i.begin(), min_i.end(), [&](Index a, Index b) {
+      return Epot(a, j) < Epot(b, j);
+    });
+  }
+  return result;
+}
+
+/// \brief Calculate the correlations and parametric composition of all
+/// configurations in a database
+///
+/// Only correlations with ECI are stored, in the order of `eci.index()`.
+MotifSearch make_motif_search(DB::Database<Configuration> const &db,
+                              Clexulator const &clexulator,
+                              ECIContainer const &eci) {
+  std::vector<std::string> configname;
+  Eigen::MatrixXd corr_mat(db.size(), eci.size());
+  Eigen::MatrixXd comp_mat;
+  Index i = 0;
+  for (Configuration const &config : db) {
+    configname.push_back(config.name());
+    Eigen::VectorXd corr = correlations(config, clexulator);
+    for (Index j = 0; j < eci.size(); ++j) {
+      corr_mat(i, j) = corr(eci.index()[j]);
+    }
+    Eigen::VectorXd comp_x = comp(config);
+    if (i == 0) {
+      comp_mat.resize(db.size(), comp_x.size());
+    }
+    comp_mat.row(i) = comp_x.transpose();
+    ++i;
+  }
+
+  Eigen::VectorXd eci_value = Eigen::Map<const Eigen::VectorXd>(
+      eci.value().data(), eci.value().size());
+  return MotifSearch(std::move(configname), std::move(corr_mat),
+                     std::move(comp_mat), eci_value);
+}
+
+}  // namespace Monte
+}  // namespace CASM
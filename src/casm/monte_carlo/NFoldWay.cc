@@ -0,0 +1,235 @@
+#include "casm/monte_carlo/NFoldWay.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "casm/clex/ConfigDoF.hh"
+#include "casm/clex/NeighborList.hh"
+#include "casm/clex/Supercell.hh"
+#include "casm/external/MersenneTwister/MersenneTwister.h"
+#include "casm/monte_carlo/Conversions.hh"
+
+namespace CASM {
+namespace Monte {
+
+/// \brief Constructor
+///
+/// \param _convert Conversions for the Monte Carlo supercell
+/// \param _nlist Neighbor list for the Monte Carlo supercell
+/// \param _site_change_f Returns dEpot of changing the occupant of one site
+///
+/// Event probabilities are not calculated until `initialize` is called.
+NFoldWay::NFoldWay(Conversions const &_convert,
+                   SuperNeighborList const &_nlist,
+                   SiteChangeFunction _site_change_f)
+    : m_convert(&_convert),
+      m_nlist(&_nlist),
+      m_site_change_f(std::move(_site_change_f)),
+      m_is_initialized(false),
+      m_beta(0.0),
+      m_residence_steps(0),
+      m_mark(0) {
+  _make_tables();
+}
+
+/// \brief Calculate all event probabilities and sample the residence time
+///
+/// \param configdof Current state
+/// \param beta 1/(kB*T)
+/// \param mtrand Random number generator
+///
+/// The site change function is called for the state `configdof`.
+void NFoldWay::initialize(ConfigDoF const &configdof, double beta,
+                          MTRand &mtrand) {
+  m_beta = beta;
+
+  for (Index v = 0; v < m_variable_site.size(); ++v) {
+    m_occ[v] = configdof.occ(m_variable_site[v]);
+    _update_site_changes(v);
+  }
+
+  std::vector<double> rate(m_tree.size(), 0.0);
+  for (Index v = 0; v < m_variable_site.size(); ++v) {
+    Index n_occ = m_convert->occ_size(m_asym[v]);
+    for (int occ = 0; occ < n_occ; ++occ) {
+      if (occ != m_occ[v]) {
+        rate[m_offset[v] + occ] =
+            _acceptance(m_site_change[m_offset[v] + occ]) / (n_occ - 1);
+      }
+    }
+  }
+  m_tree.set_rates(rate);
+
+  m_is_initialized = true;
+  _sample_residence_steps(mtrand);
+}
+
+/// \brief Probability that one Metropolis step leaves the current state
+double NFoldWay::escape_probability() const {
+  if (m_variable_site.size() == 0) {
+    return 0.0;
+  }
+  return m_tree.total_rate() / m_variable_site.size();
+}
+
+/// \brief Consume `n_steps` steps of the residence time
+void NFoldWay::skip(Index n_steps) {
+  if (m_residence_steps == std::numeric_limits<Index>::max()) {
+    return;
+  }
+  if (n_steps > m_residence_steps) {
+    throw std::runtime_error(
+        "Error in NFoldWay::skip: n_steps exceeds the residence time");
+  }
+  m_residence_steps -= n_steps;
+}
+
+/// \brief Select an event, with probability proportional to the
+/// probability per step that it occurs
+///
+/// \param mtrand Random number generator
+/// \param linear_site_index Set to the linear indices of the sites the event
+///     changes
+/// \param new_occ Set to the occupant indices of the sites after the event
+///
+/// \throws If no event is possible
+void NFoldWay::select(MTRand &mtrand, std::vector<Index> &linear_site_index,
+                      std::vector<int> &new_occ) const {
+  Index index = m_tree.find(mtrand.randExc(m_tree.total_rate()));
+  Index v = std::upper_bound(m_offset.begin(), m_offset.end(), index) -
+            m_offset.begin() - 1;
+  linear_site_index.assign(1, m_variable_site[v]);
+  new_occ.assign(1, index - m_offset[v]);
+}
+
+/// \brief Update event probabilities after the occupation of sites
+/// changed, and sample the next residence time
+///
+/// \param configdof State after the change
+/// \param linear_site_index Linear indices of the sites that changed
+/// \param mtrand Random number generator
+///
+/// Only single-site changes of the changed sites, or of sites whose
+/// neighborhoods include them, are recalculated.
+void NFoldWay::update(ConfigDoF const &configdof,
+                      std::vector<Index> const &linear_site_index,
+                      MTRand &mtrand) {
+  for (Index l : linear_site_index) {
+    m_occ[m_l_to_variable[l]] = configdof.occ(l);
+  }
+
+  ++m_mark;
+  std::vector<Index> updated;
+  auto add = [&](Index v) {
+    if (m_updated_mark[v] != m_mark) {
+      m_updated_mark[v] = m_mark;
+      updated.push_back(v);
+    }
+  };
+  for (Index l : linear_site_index) {
+    add(m_l_to_variable[l]);
+    for (Index v : m_dependent[l]) {
+      add(v);
+    }
+  }
+
+  for (Index v : updated) {
+    _update_site_changes(v);
+    _update_site_change_events(v);
+  }
+
+  _sample_residence_steps(mtrand);
+}
+
+/// \brief Construct site and neighborhood tables
+void NFoldWay::_make_tables() {
+  Index n_sites = m_convert->mc_scel().num_sites();
+  m_l_to_variable.assign(n_sites, -1);
+  Index n_site_changes = 0;
+  for (Index l = 0; l < n_sites; ++l) {
+    Index asym = m_convert->l_to_asym(l);
+    if (m_convert->occ_size(asym) > 1) {
+      m_l_to_variable[l] = m_variable_site.size();
+      m_variable_site.push_back(l);
+      m_asym.push_back(asym);
+      m_offset.push_back(n_site_changes);
+      n_site_changes += m_convert->occ_size(asym);
+    }
+  }
+  m_offset.push_back(n_site_changes);
+  m_site_change.assign(n_site_changes, 0.0);
+  m_occ.assign(m_variable_site.size(), 0);
+
+  m_dependent.assign(n_sites, std::vector<Index>());
+  for (Index v = 0; v < m_variable_site.size(); ++v) {
+    Index unitcell_index = m_nlist->unitcell_index(m_variable_site[v]);
+    for (Index l : m_nlist->sites(unitcell_index)) {
+      if (m_dependent[l].empty() || m_dependent[l].back() != v) {
+        m_dependent[l].push_back(v);
+      }
+    }
+  }
+
+  m_tree = RateTree(n_site_changes);
+  m_updated_mark.assign(m_variable_site.size(), 0);
+}
+
+/// \brief Calculate single-site change dEpot of variable site v
+void NFoldWay::_update_site_changes(Index v) {
+  Index l = m_variable_site[v];
+  Index n_occ = m_convert->occ_size(m_asym[v]);
+  for (int occ = 0; occ < n_occ; ++occ) {
+    m_site_change[m_offset[v] + occ] =
+        (occ == m_occ[v]) ? 0.0 : m_site_change_f(l, occ);
+  }
+}
+
+/// \brief Probability per step of single-site change events on variable
+/// site v, relative to the uniform proposal of a variable site
+void NFoldWay::_update_site_change_events(Index v) {
+  Index n_occ = m_convert->occ_size(m_asym[v]);
+  for (int occ = 0; occ < n_occ; ++occ) {
+    double rate = 0.0;
+    if (occ != m_occ[v]) {
+      rate = _acceptance(m_site_change[m_offset[v] + occ]) / (n_occ - 1);
+    }
+    m_tree.set_rate(m_offset[v] + occ, rate);
+  }
+}
+
+/// \brief Metropolis acceptance probability
+double NFoldWay::_acceptance(double dEpot) const {
+  if (dEpot < 0.0) {
+    return 1.0;
+  }
+  return std::exp(-dEpot * m_beta);
+}
+
+/// \brief Sample the residence time of the current state
+///
+/// The number of steps rejecting every proposal before one is accepted is
+/// geometrically distributed, with success probability equal to the escape
+/// probability.
+void NFoldWay::_sample_residence_steps(MTRand &mtrand) {
+  double p = escape_probability();
+  Index max_steps = std::numeric_limits<Index>::max();
+  if (p >= 1.0) {
+    m_residence_steps = 0;
+    return;
+  }
+  if (p <= 0.0) {
+    m_residence_steps = max_steps;
+    return;
+  }
+  double n_steps = std::floor(std::log(1.0 - mtrand.rand53()) / std::log1p(-p));
+  if (n_steps >= (double)max_steps) {
+    m_residence_steps = max_steps;
+    return;
+  }
+  m_residence_steps = (Index)n_steps;
+}
+
+}  // namespace Monte
+}  // namespace CASM
@@ -9,8 +9,11 @@ namespace CASM {
 namespace Monte {
 
 OccLocation::OccLocation(const Conversions &_convert,
-                         const OccCandidateList &_cand)
-    : m_convert(_convert), m_cand(_cand), m_loc(_cand.size()), m_kmc(false) {}
+                         const OccCandidateList &_cand, bool _update_species)
+    : m_convert(_convert),
+      m_cand(_cand),
+      m_loc(_cand.size()),
+      m_kmc(_update_species) {}
 
 /// Fill tables with occupation info
 void OccLocation::initialize(const Configuration &config) {
@@ -99,6 +102,63 @@ Index OccLocation::mol_id(const OccCandidate &cand, Index loc) const {
 /// Convert from config index to variable site index
 Index OccLocation::l_to_mol_id(Index l) const { return m_l_to_mol[l]; }
 
+/// Total number of tracked Species (0 if not updating species)
+OccLocation::size_type OccLocation::species_size() const {
+  return m_species.size();
+}
+
+/// Access a tracked Species, by Species.id
+const Species &OccLocation::species(Index species_id) const {
+  return m_species[species_id];
+}
+
+/// True if the location of each Species is tracked
+bool OccLocation::update_species() const { return m_kmc; }
+
+/// Make OccEvent exchanging the occupants of two variable sites
+///
+/// - The occupant on site `l_a` moves to site `l_b`, and vice versa
+/// - If updating species, `e.species_traj` moves each component Species with
+///   its Mol
+/// - Both sites must be variable, and each occupant must be allowed on the
+///   other site
+OccEvent &OccLocation::make_exchange(OccEvent &e, Index l_a, Index l_b) const {
+  e.occ_transform.resize(2);
+  e.species_traj.resize(0);
+  e.linear_site_index.resize(2);
+  e.new_occ.resize(2);
+
+  Index l[2] = {l_a, l_b};
+  for (Index i = 0; i < 2; ++i) {
+    const Mol &mol = m_mol[m_l_to_mol[l[i]]];
+    const Mol &other = m_mol[m_l_to_mol[l[1 - i]]];
+
+    OccTransform &t = e.occ_transform[i];
+    t.l = mol.l;
+    t.mol_id = mol.id;
+    t.asym = mol.asym;
+    t.from_species = mol.species_index;
+    t.to_species = other.species_index;
+
+    e.linear_site_index[i] = t.l;
+    e.new_occ[i] = m_convert.occ_index(t.asym, t.to_species);
+
+    if (m_kmc) {
+      for (Index c = 0; c < other.component.size(); ++c) {
+        SpeciesTraj traj;
+        traj.from.l = other.l;
+        traj.from.mol_id = other.id;
+        traj.from.mol_comp = c;
+        traj.to.l = mol.l;
+        traj.to.mol_id = mol.id;
+        traj.to.mol_comp = c;
+        e.species_traj.push_back(traj);
+      }
+    }
+  }
+  return e;
+}
+
 /// Propose canonical OccEvent
 OccEvent &OccLocation::propose_canonical(
     OccEvent &e, const std::vector<OccSwap> &canonical_swap,
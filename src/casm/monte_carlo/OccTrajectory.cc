@@ -0,0 +1,178 @@
+#include "casm/monte_carlo/OccTrajectory.hh"
+
+#include <boost/filesystem.hpp>
+#include <cstring>
+#include <stdexcept>
+
+#include "casm/misc/cloneable_ptr.hh"
+
+namespace CASM {
+namespace Monte {
+
+namespace {
+
+const char occ_trajectory_magic[] = "CASMOCCT";
+const uint32_t occ_trajectory_version = 1;
+
+template <typename T>
+void write_binary(std::ostream &sout, T value) {
+  sout.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template <typename T>
+bool read_binary(std::istream &sin, T &value) {
+  sin.read(reinterpret_cast<char *>(&value), sizeof(T));
+  return static_cast<bool>(sin);
+}
+
+}  // namespace
+
+/// \brief Open 'file_path' and write header
+///
+/// \param file_path Path to output file (overwritten)
+/// \param n_sites Number of sites in each frame
+/// \param flush_period Number of frames between flushes to the file
+OccTrajectoryWriter::OccTrajectoryWriter(const fs::path &file_path,
+                                         Index n_sites, Index flush_period)
+    : m_file_path(file_path),
+      m_stream(file_path.string().c_str()),
+      m_flush_period(flush_period),
+      m_size(0),
+      m_last(Eigen::VectorXi::Zero(n_sites)) {
+  if (!m_stream) {
+    throw std::runtime_error("Error in OccTrajectoryWriter: could not open " +
+                             file_path.string());
+  }
+  m_stream.write(occ_trajectory_magic, 8);
+  write_binary<uint32_t>(m_stream, occ_trajectory_version);
+  write_binary<uint64_t>(m_stream, n_sites);
+}
+
+OccTrajectoryWriter::~OccTrajectoryWriter() { close(); }
+
+/// \brief Write a frame
+///
+/// - Writes the sites whose occupation changed since the previous frame (all
+///   sites for the first frame)
+void OccTrajectoryWriter::write(size_type pass, size_type step,
+                                const Eigen::VectorXi &occupation) {
+  if (occupation.size() != m_last.size()) {
+    throw std::runtime_error(
+        "Error in OccTrajectoryWriter::write: occupation size mismatch");
+  }
+
+  m_changes.clear();
+  for (Index l = 0; l < occupation.size(); ++l) {
+    if (m_size == 0 || occupation(l) != m_last(l)) {
+      m_changes.emplace_back(l, occupation(l));
+    }
+  }
+  m_last = occupation;
+
+  write_binary<uint64_t>(m_stream, pass);
+  write_binary<uint64_t>(m_stream, step);
+  write_binary<uint64_t>(m_stream, m_changes.size());
+  for (const auto &change : m_changes) {
+    write_binary<uint64_t>(m_stream, change.first);
+    write_binary<int32_t>(m_stream, change.second);
+  }
+  ++m_size;
+
+  if (m_size % m_flush_period == 0) {
+    m_stream.flush();
+  }
+  if (!m_stream) {
+    throw std::runtime_error("Error in OccTrajectoryWriter: could not write " +
+                             m_file_path.string());
+  }
+}
+
+/// \brief Flush and close the file
+void OccTrajectoryWriter::close() {
+  if (m_stream.rdbuf()->is_open()) {
+    m_stream.close();
+  }
+}
+
+/// \brief Open 'file_path' and read header
+OccTrajectoryReader::OccTrajectoryReader(const fs::path &file_path)
+    : m_file_path(file_path) {
+  _open();
+}
+
+/// \brief Read the next frame, return false if there are no more frames
+bool OccTrajectoryReader::next() {
+  uint64_t pass, step, n_changes;
+  if (!read_binary(*m_stream, pass)) {
+    return false;
+  }
+  if (!read_binary(*m_stream, step) || !read_binary(*m_stream, n_changes)) {
+    throw std::runtime_error(
+        "Error in OccTrajectoryReader: truncated frame in " +
+        m_file_path.string());
+  }
+  for (uint64_t i = 0; i < n_changes; ++i) {
+    uint64_t l;
+    int32_t occ;
+    if (!read_binary(*m_stream, l) || !read_binary(*m_stream, occ) ||
+        l >= m_occupation.size()) {
+      throw std::runtime_error(
+          "Error in OccTrajectoryReader: invalid frame in " +
+          m_file_path.string());
+    }
+    m_occupation(l) = occ;
+  }
+  m_pass = pass;
+  m_step = step;
+  ++m_frame_index;
+  return true;
+}
+
+/// \brief Read frame 'index'
+///
+/// - Throws if there are fewer than 'index' + 1 frames
+const Eigen::VectorXi &OccTrajectoryReader::frame(Index index) {
+  if (index < m_frame_index) {
+    _open();
+  }
+  while (m_frame_index < index) {
+    if (!next()) {
+      throw std::runtime_error("Error in OccTrajectoryReader: frame " +
+                               std::to_string(index) + " not found in " +
+                               m_file_path.string());
+    }
+  }
+  return m_occupation;
+}
+
+/// \brief (Re-)open the file and read the header
+void OccTrajectoryReader::_open() {
+  if (!fs::exists(m_file_path)) {
+    throw std::runtime_error("Error in OccTrajectoryReader: file not found: " +
+                             m_file_path.string());
+  }
+  m_stream = notstd::make_unique<gz::igzstream>(m_file_path.string().c_str());
+
+  char magic[8];
+  uint32_t version;
+  uint64_t n_sites;
+  m_stream->read(magic, 8);
+  if (!*m_stream || std::memcmp(magic, occ_trajectory_magic, 8) != 0 ||
+      !read_binary(*m_stream, version) || !read_binary(*m_stream, n_sites)) {
+    throw std::runtime_error(
+        "Error in OccTrajectoryReader: not an occupation trajectory file: " +
+        m_file_path.string());
+  }
+  if (version != occ_trajectory_version) {
+    throw std::runtime_error(
+        "Error in OccTrajectoryReader: unsupported version " +
+        std::to_string(version) + " in " + m_file_path.string());
+  }
+  m_frame_index = -1;
+  m_pass = 0;
+  m_step = 0;
+  m_occupation = Eigen::VectorXi::Zero(n_sites);
+}
+
+}  // namespace Monte
+}  // namespace CASM
@@ -0,0 +1,92 @@
+#include "casm/monte_carlo/RateTree.hh"
+
+#include <stdexcept>
+
+namespace CASM {
+namespace Monte {
+
+/// \brief Construct with all rates equal to zero
+RateTree::RateTree(Index _size) {
+  set_rates(std::vector<double>(_size, 0.0));
+}
+
+/// \brief Construct from rates
+RateTree::RateTree(std::vector<double> const &_rate) { set_rates(_rate); }
+
+/// \brief Set the rate of event `event_index`, in O(log N)
+void RateTree::set_rate(Index event_index, double rate) {
+  double delta = rate - m_rate[event_index];
+  m_rate[event_index] = rate;
+  if (++m_n_updates >= size()) {
+    _rebuild();
+    return;
+  }
+  for (Index i = event_index + 1; i <= size(); i += (i & -i)) {
+    m_tree[i] += delta;
+  }
+}
+
+/// \brief Set all rates, in O(N)
+void RateTree::set_rates(std::vector<double> const &_rate) {
+  m_rate = _rate;
+  m_top_step = 1;
+  while (2 * m_top_step <= size()) {
+    m_top_step *= 2;
+  }
+  _rebuild();
+}
+
+/// \brief Sum of rates of events [0, end), in O(log N)
+double RateTree::partial_sum(Index end) const {
+  double sum = 0.0;
+  for (Index i = end; i > 0; i -= (i & -i)) {
+    sum += m_tree[i];
+  }
+  return sum;
+}
+
+/// \brief Find the event selected by `value`, in [0, total_rate()), in
+/// O(log N)
+///
+/// \returns The event index, `i`, such that `partial_sum(i) <= value <
+///     partial_sum(i + 1)`. Events with zero rate are never selected.
+///
+/// \throws std::runtime_error if there are no events with non-zero rate
+Index RateTree::find(double value) const {
+  if (size() == 0) {
+    throw std::runtime_error("Error in RateTree::find: no events");
+  }
+  Index pos = 0;
+  for (Index step = m_top_step; step > 0; step /= 2) {
+    if (pos + step <= size() && m_tree[pos + step] <= value) {
+      pos += step;
+      value -= m_tree[pos];
+    }
+  }
+
+  // rounding may select a zero-rate event or run past the end: use the
+  // previous event with non-zero rate
+  while (pos == size() || (pos > 0 && m_rate[pos] == 0.0)) {
+    --pos;
+  }
+  if (m_rate[pos] == 0.0) {
+    throw std::runtime_error("Error in RateTree::find: all rates are zero");
+  }
+  return pos;
+}
+
+/// \brief Recalculate partial sums from m_rate
+void RateTree::_rebuild() {
+  m_tree.assign(size() + 1, 0.0);
+  for (Index i = 1; i <= size(); ++i) {
+    m_tree[i] += m_rate[i - 1];
+    Index parent = i + (i & -i);
+    if (parent <= size()) {
+      m_tree[parent] += m_tree[i];
+    }
+  }
+  m_n_updates = 0;
+}
+
+}  // namespace Monte
+}  // namespace CASM
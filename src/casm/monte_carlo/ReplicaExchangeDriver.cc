@@ -0,0 +1,30 @@
+#include <cmath>
+
+#include "casm/crystallography/Molecule.hh"
+#include "casm/monte_carlo/ReplicaExchangeDriver_impl.hh"
+#include "casm/monte_carlo/canonical/Canonical.hh"
+#include "casm/monte_carlo/canonical/CanonicalIO.hh"
+#include "casm/monte_carlo/grand_canonical/GrandCanonical.hh"
+#include "casm/monte_carlo/grand_canonical/GrandCanonicalIO.hh"
+
+namespace CASM {
+namespace Monte {
+template class ReplicaExchangeDriver<Canonical>;
+template class ReplicaExchangeDriver<GrandCanonical>;
+
+/// \brief Probability of accepting the exchange of DoF x_a and x_b between
+/// replicas at conditions a and b, given extensive potential energies
+///
+/// \returns min(1, exp(-beta_a*(E_a_xb - E_a_xa) - beta_b*(E_b_xa - E_b_xb)))
+double replica_exchange_probability(double beta_a, double beta_b,
+                                    double E_a_xa, double E_a_xb,
+                                    double E_b_xa, double E_b_xb) {
+  double delta = beta_a * (E_a_xb - E_a_xa) + beta_b * (E_b_xa - E_b_xb);
+  if (delta <= 0.0) {
+    return 1.0;
+  }
+  return std::exp(-delta);
+}
+
+}  // namespace Monte
+}  // namespace CASM
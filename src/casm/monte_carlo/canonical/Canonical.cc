@@ -7,6 +7,7 @@
 #include "casm/enumerator/io/json/DoFSpace.hh"
 #include "casm/misc/CASM_Eigen_math.hh"
 #include "casm/misc/algorithm.hh"
+#include "casm/misc/parallel.hh"
 #include "casm/monte_carlo/MonteCarloEnum_impl.hh"
 #include "casm/monte_carlo/MonteCarlo_impl.hh"
 #include "casm/monte_carlo/MonteCorrelations.hh"
@@ -60,6 +61,9 @@ Canonical::Canonical(const PrimClex &primclex,
       m_occ_loc(m_convert, m_cand),
       m_event(primclex.composition_axes().components().size(),
               _clexulator().corr_size()) {
+  if (settings.rejection_free()) {
+    _throw_rejection_free();
+  }
   const auto &desc = settings.formation_energy(primclex);
 
   _log().construct("Canonical Monte Carlo");
@@ -92,6 +96,9 @@ Canonical::Canonical(const PrimClex &primclex,
   }
   _log() << "\nautomatic convergence mode?: " << std::boolalpha
          << must_converge() << std::endl;
+  _log() << "checkerboard steps?: " << std::boolalpha
+         << settings.checkerboard() << std::endl;
+  _make_checkerboard(settings);
   _log() << std::endl;
 
   _log() << std::pair<const OccCandidateList &, const Conversions &>(m_cand,
@@ -131,6 +138,17 @@ void Canonical::set_configdof(const ConfigDoF &configdof,
   reset(configdof);
 }
 
+/// \brief Set configdof without clearing previously collected data, as for
+/// replica exchange
+///
+/// - Samples collected before the exchange are kept, so that sampled data
+///   describes the conditions rather than the DoF trajectory
+void Canonical::exchange_configdof(const ConfigDoF &configdof) {
+  _configdof().values() = configdof.values();
+  m_occ_loc.initialize(config());
+  _update_properties();
+}
+
 /// \brief Set configdof and conditions and clear previously collected data
 ///
 /// \returns Specified ConfigDoF and configname (or configdof path)
@@ -301,6 +319,142 @@ void Canonical::reject(const EventType &event) {
   return;
 }
 
+/// \brief Not supported, see `rejection_free`
+Index Canonical::nfold_residence_steps() { _throw_rejection_free(); }
+
+/// \brief Not supported, see `rejection_free`
+void Canonical::nfold_skip(Index n_steps) { _throw_rejection_free(); }
+
+/// \brief Not supported, see `rejection_free`
+bool Canonical::nfold_step() { _throw_rejection_free(); }
+
+/// \brief Perform a checkerboard step of at most `max_steps` proposals, and
+/// return the number of proposals
+///
+/// A color of the checkerboard is chosen at random, and its sites are paired
+/// at random. For every pair, the exchange of their occupants is proposed and
+/// accepted or rejected, as by `check`. If there are more than `max_steps`
+/// pairs, only the first `max_steps` random pairs are proposed, so that the
+/// driver can stop exactly at the next sample. No cluster includes two sites
+/// of the same color, so the proposals do not change each other's dEpot, and
+/// the result is the same as making them one after another. Because the color
+/// and pairs are chosen independently of the state, detailed balance is
+/// preserved.
+///
+/// Exchanges between sites of one color never change the composition of each
+/// color, so with equal probability to any color, `m_checkerboard_n_serial`
+/// proposals are instead made one at a time, as by `propose`. Those
+/// exchanges, between any sites, change the composition of each color and
+/// the occupants of different sublattices, without which sampling would not
+/// be ergodic.
+///
+/// Proposals are evaluated concurrently by `checkerboard_n_threads` threads,
+/// each with its own random number generator and a fixed range of the pairs,
+/// and then the accepted changes are applied.
+Index Canonical::checkerboard_step(Index max_steps) {
+  _check_checkerboard_conditions();
+  if (m_checkerboard_thread.empty()) {
+    for (Index t = 0; t < m_checkerboard_n_threads; ++t) {
+      m_checkerboard_thread.emplace_back(_clexulator(), m_event.dN().size(),
+                                         _mtrand().randInt());
+    }
+  }
+
+  // color_index == n_colors selects proposals made one at a time
+  Index n_colors = m_checkerboard->n_colors();
+  Index color_index = _mtrand().randInt(n_colors);
+  max_steps = std::max(Index(1), max_steps);
+  if (color_index == n_colors) {
+    Index n_serial = std::min(m_checkerboard_n_serial, max_steps);
+    for (Index i = 0; i < n_serial; ++i) {
+      const EventType &event = propose();
+      if (check(event)) {
+        accept(event);
+      } else {
+        reject(event);
+      }
+    }
+    return n_serial;
+  }
+
+  // pair sites at random: sites 2*p and 2*p+1 form pair p
+  std::vector<Index> &sites = m_checkerboard_sites;
+  sites = m_checkerboard->sites(color_index);
+  for (Index i = sites.size() - 1; i > 0; --i) {
+    std::swap(sites[i], sites[_mtrand().randInt(i)]);
+  }
+  Index n_pairs = std::min(Index(sites.size() / 2), max_steps);
+
+  ConfigDoF const &curr_configdof = configdof();
+  SuperNeighborList const &nlist = supercell().nlist();
+  unsigned int const *corr_indices_begin = _eci().index().data();
+  unsigned int const *corr_indices_end = end_ptr(_eci().index());
+  double beta = m_condition.beta();
+  Index n_chunks = m_checkerboard_thread.size();
+
+  parallel_for_each_thread(n_chunks, n_chunks, [&](Index chunk, Index) {
+    CheckerboardThread &thread = m_checkerboard_thread[chunk];
+    thread.reset();
+    Index begin = n_pairs * chunk / n_chunks;
+    Index end = n_pairs * (chunk + 1) / n_chunks;
+    for (Index p = begin; p < end; ++p) {
+      Index l_a = sites[2 * p];
+      Index l_b = sites[2 * p + 1];
+      int occ_a = curr_configdof.occ(l_a);
+      int occ_b = curr_configdof.occ(l_b);
+      if (occ_a == occ_b) {
+        continue;
+      }
+
+      // the sites do not share a cluster, so dCorr is the sum of the changes
+      // of each site
+      restricted_delta_corr(thread.context, thread.dcorr, l_a, occ_b,
+                            curr_configdof, nlist, _clexulator(),
+                            corr_indices_begin, corr_indices_end);
+      restricted_delta_corr(thread.context, thread.tmp_dcorr, l_b, occ_a,
+                            curr_configdof, nlist, _clexulator(),
+                            corr_indices_begin, corr_indices_end);
+      thread.dcorr += thread.tmp_dcorr;
+      double dEf = _eci() * thread.dcorr.data();
+
+      double dEpot = 0.0;
+      if (m_condition.include_formation_energy()) {
+        dEpot += dEf;
+      }
+      if (dEpot >= 0.0 && thread.mtrand.rand53() >= exp(-dEpot * beta)) {
+        continue;
+      }
+
+      thread.site.push_back(l_a);
+      thread.new_occ.push_back(occ_b);
+      thread.site.push_back(l_b);
+      thread.new_occ.push_back(occ_a);
+      thread.sum_dcorr += thread.dcorr;
+      thread.sum_dEf += dEf;
+      thread.sum_dEpot += dEpot;
+    }
+  });
+
+  // apply accepted changes and update properties
+  double volume = supercell().volume();
+  for (CheckerboardThread &thread : m_checkerboard_thread) {
+    for (Index i = 0; i < thread.site.size(); i += 2) {
+      Index l_a = thread.site[i];
+      Index l_b = thread.site[i + 1];
+      if (m_order_parameter != nullptr) {
+        _eta() += m_order_parameter->occ_delta(l_a, thread.new_occ[i]);
+        _eta() += m_order_parameter->occ_delta(l_b, thread.new_occ[i + 1]);
+      }
+      m_occ_loc.make_exchange(m_event.occ_event(), l_a, l_b);
+      m_occ_loc.apply(m_event.occ_event(), _configdof());
+    }
+    _formation_energy() += thread.sum_dEf / volume;
+    _potential_energy() += thread.sum_dEpot / volume;
+    _corr() += thread.sum_dcorr / volume;
+  }
+  return n_pairs;
+}
+
 /// \brief Write results to files
 void Canonical::write_results(Index cond_index) const {
   CASM::Monte::write_results(settings(), *this, _log());
@@ -567,7 +721,8 @@ void Canonical::_update_deltas(CanonicalEvent &event) const {
 /// \brief Calculate properties given current conditions
 void Canonical::_update_properties() {
   // initialize properties and store pointers to the data strucures
-  _vector_properties()["corr"] = correlations(_config(), _clexulator());
+  _vector_properties()["corr"] = correlations(
+      _config(), _clexulator(), settings().correlations_n_threads());
   m_corr = &_vector_property("corr");
 
   _vector_properties()["comp_n"] = CASM::comp_n(_configdof(), supercell());
@@ -586,6 +741,71 @@ void Canonical::_update_properties() {
 
   _scalar_properties()["potential_energy"] = this->potential_energy(config());
   m_potential_energy = &_scalar_property("potential_energy");
+
+}
+
+/// \brief Throw, because rejection-free steps are not supported by canonical
+/// calculations
+///
+/// Events would be exchanges of the occupants of every pair of sites, so
+/// memory use would scale with the square of the number of sites, and every
+/// accepted event would update a number of events that scales with the number
+/// of sites, which is slower than Metropolis Monte Carlo for useful supercell
+/// sizes.
+void Canonical::_throw_rejection_free() {
+  throw std::runtime_error(
+      "Error in Canonical: rejection-free steps (\"driver\"/"
+      "\"rejection_free\") are only supported for grand canonical "
+      "calculations");
+}
+
+/// \brief Construct m_checkerboard, if using checkerboard steps
+///
+/// - Colors are chosen so that no cluster with non-zero ECI includes two sites
+///   of the same color
+/// - Pairs of sites of one color never change the composition of each color,
+///   so on average one step in (n_colors + 1) makes proposals one at a time,
+///   as many as the number of pairs of a color
+void Canonical::_make_checkerboard(const CanonicalSettings &settings) {
+  m_checkerboard_n_threads = settings.checkerboard_n_threads();
+  m_checkerboard_n_serial = 0;
+  if (!settings.checkerboard()) {
+    return;
+  }
+  m_checkerboard = notstd::make_unique<Checkerboard>(
+      m_convert, _clexulator().site_neighborhood(_eci().index().data(),
+                                                 end_ptr(_eci().index())));
+
+  // every color has the same number of sites
+  m_checkerboard_n_serial = m_checkerboard->sites(0).size() / 2;
+  if (m_checkerboard_n_serial == 0) {
+    throw std::runtime_error(
+        "Error in Canonical: supercell is too small for checkerboard steps, "
+        "which require at least two sites of each color");
+  }
+
+  _log() << "checkerboard period: " << m_checkerboard->period().transpose()
+         << "\n";
+  _log() << "checkerboard colors: " << m_checkerboard->n_colors() << "\n";
+  _log() << "checkerboard threads: " << m_checkerboard_n_threads << "\n";
+}
+
+/// \brief Throw if the conditions are not supported by checkerboard steps
+///
+/// Potentials that depend on the current correlations or order parameter
+/// change the dEpot of every proposal after any change, and so prevent
+/// evaluating proposals concurrently.
+void Canonical::_check_checkerboard_conditions() const {
+  if (m_condition.corr_matching_pot() ||
+      m_condition.random_alloy_corr_matching_pot() ||
+      (m_order_parameter != nullptr &&
+       (m_condition.order_parameter_pot().has_value() ||
+        m_condition.order_parameter_quad_pot_vector().has_value() ||
+        m_condition.order_parameter_quad_pot_matrix().has_value()))) {
+    throw std::runtime_error(
+        "Error in Canonical: checkerboard steps do not support correlation "
+        "matching potentials, or order parameter potentials");
+  }
 }
 
 /// \brief Generate supercell filling ConfigDoF from default configuration
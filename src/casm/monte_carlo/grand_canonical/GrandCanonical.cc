@@ -11,6 +11,7 @@
 #include "casm/enumerator/io/json/DoFSpace.hh"
 #include "casm/misc/CASM_Eigen_math.hh"
 #include "casm/misc/algorithm.hh"
+#include "casm/misc/parallel.hh"
 #include "casm/monte_carlo/MonteCarloEnum_impl.hh"
 #include "casm/monte_carlo/MonteCarlo_impl.hh"
 #include "casm/monte_carlo/MonteIO_impl.hh"
@@ -65,7 +66,9 @@ GrandCanonical::GrandCanonical(const PrimClex &primclex,
       m_random_alloy_corr_f(make_random_alloy_corr_f(primclex, settings)),
       m_convert(_supercell()),
       m_event(m_composition_converter.components().size(),
-              _clexulator().corr_size()) {
+              _clexulator().corr_size()),
+      m_nfold_event(m_composition_converter.components().size(),
+                    _clexulator().corr_size()) {
   const auto &desc = settings.formation_energy(primclex);
 
   _log().construct("Grand Canonical Monte Carlo");
@@ -98,7 +101,14 @@ GrandCanonical::GrandCanonical(const PrimClex &primclex,
   }
   _log() << "\nautomatic convergence mode?: " << std::boolalpha
          << must_converge() << std::endl;
+  _log() << "rejection-free (n-fold way)?: " << std::boolalpha
+         << settings.rejection_free() << std::endl;
+  _log() << "checkerboard steps?: " << std::boolalpha
+         << settings.checkerboard() << std::endl;
+  _make_checkerboard(settings);
   _log() << std::endl;
+
+  _make_nfold(settings);
 }
 
 /// \brief Return number of steps per pass. Equals number of sites with variable
@@ -136,6 +146,19 @@ void GrandCanonical::set_configdof(const ConfigDoF &configdof,
   _log() << std::endl;
 
   reset(configdof);
+  if (m_nfold != nullptr) {
+    m_nfold->invalidate();
+  }
+}
+
+/// \brief Set configdof without clearing previously collected data, as for
+/// replica exchange
+///
+/// - Samples collected before the exchange are kept, so that sampled data
+///   describes the conditions rather than the DoF trajectory
+void GrandCanonical::exchange_configdof(const ConfigDoF &configdof) {
+  _configdof().values() = configdof.values();
+  _update_properties();
 }
 
 /// \brief Set configdof and conditions and clear previously collected data
@@ -317,6 +340,140 @@ void GrandCanonical::reject(const EventType &event) {
   return;
 }
 
+/// \brief Number of steps before the next accepted event, for
+/// rejection-free steps
+///
+/// - Equal to the maximum Index value if no event is possible
+Index GrandCanonical::nfold_residence_steps() { return _nfold().residence_steps(); }
+
+/// \brief Skip steps that do not change the state, for rejection-free steps
+///
+/// - n_steps must not exceed `nfold_residence_steps()`
+void GrandCanonical::nfold_skip(Index n_steps) { _nfold().skip(n_steps); }
+
+/// \brief Perform a rejection-free (n-fold way) step
+///
+/// If steps remain in the residence time of the current state, one is
+/// consumed, as for a rejected proposal. Otherwise, an event is selected with
+/// probability proportional to the probability that a step proposes and
+/// accepts it, and it is accepted.
+///
+/// \returns True if an event was accepted
+bool GrandCanonical::nfold_step() {
+  NFoldWay &nfold = _nfold();
+  if (nfold.residence_steps() > 0) {
+    nfold.skip(1);
+    return false;
+  }
+
+  nfold.select(_mtrand(), m_nfold_site, m_nfold_occ);
+  Index l = m_nfold_site[0];
+  _update_deltas(m_event, l, m_convert.l_to_b(l), configdof().occ(l),
+                 m_nfold_occ[0]);
+  accept(m_event);
+  nfold.update(configdof(), m_nfold_site, _mtrand());
+  return true;
+}
+
+/// \brief Perform a checkerboard step of at most `max_steps` proposals, and
+/// return the number of proposals
+///
+/// A color of the checkerboard is chosen at random, and for every site of that
+/// color a new occupant is proposed, as by `propose`, and accepted or rejected,
+/// as by `check`. If the color has more than `max_steps` sites, proposals are
+/// made for `max_steps` consecutive sites of the color, starting from a random
+/// site, so that the driver can stop exactly at the next sample. No cluster
+/// includes two sites of the same color, so the proposals do not change each
+/// other's dEpot, and the result is the same as making them one after another.
+/// Because the color is chosen independently of the state, detailed balance is
+/// preserved.
+///
+/// Proposals are evaluated concurrently by `checkerboard_n_threads` threads,
+/// each with its own random number generator and a fixed range of the sites,
+/// and then the accepted changes are applied.
+Index GrandCanonical::checkerboard_step(Index max_steps) {
+  _check_checkerboard_conditions();
+  if (m_checkerboard_thread.empty()) {
+    for (Index t = 0; t < m_checkerboard_n_threads; ++t) {
+      m_checkerboard_thread.emplace_back(_clexulator(), m_event.dN().size(),
+                                         _mtrand().randInt());
+    }
+  }
+
+  std::vector<Index> const &sites =
+      m_checkerboard->sites(_mtrand().randInt(m_checkerboard->n_colors() - 1));
+  Index n_sites = std::min(Index(sites.size()), std::max(Index(1), max_steps));
+  Index offset = n_sites < sites.size() ? _mtrand().randInt(sites.size() - 1)
+                                        : Index(0);
+
+  ConfigDoF const &curr_configdof = configdof();
+  SuperNeighborList const &nlist = supercell().nlist();
+  unsigned int const *corr_indices_begin = _eci().index().data();
+  unsigned int const *corr_indices_end = end_ptr(_eci().index());
+  double beta = m_condition.beta();
+  Index n_chunks = m_checkerboard_thread.size();
+
+  parallel_for_each_thread(n_chunks, n_chunks, [&](Index chunk, Index) {
+    CheckerboardThread &thread = m_checkerboard_thread[chunk];
+    thread.reset();
+    Index begin = n_sites * chunk / n_chunks;
+    Index end = n_sites * (chunk + 1) / n_chunks;
+    for (Index i = begin; i < end; ++i) {
+      Index l = sites[(offset + i) % sites.size()];
+      Index sublat = m_convert.l_to_b(l);
+      int current_occupant = curr_configdof.occ(l);
+      const std::vector<int> &possible_mutation =
+          m_site_swaps.possible_swap()[sublat][current_occupant];
+      int new_occupant = possible_mutation[thread.mtrand.randInt(
+          possible_mutation.size() - 1)];
+
+      restricted_delta_corr(thread.context, thread.dcorr, l, new_occupant,
+                            curr_configdof, nlist, _clexulator(),
+                            corr_indices_begin, corr_indices_end);
+      double dEf = _eci() * thread.dcorr.data();
+      Index curr_species =
+          m_site_swaps.sublat_to_mol()[sublat][current_occupant];
+      Index new_species = m_site_swaps.sublat_to_mol()[sublat][new_occupant];
+
+      double dEpot = 0.0;
+      if (m_condition.include_formation_energy()) {
+        dEpot += dEf;
+      }
+      if (m_condition.include_param_chem_pot()) {
+        dEpot -= m_condition.exchange_chem_pot(new_species, curr_species);
+      }
+      if (dEpot >= 0.0 && thread.mtrand.rand53() >= exp(-dEpot * beta)) {
+        continue;
+      }
+
+      thread.site.push_back(l);
+      thread.new_occ.push_back(new_occupant);
+      thread.sum_dcorr += thread.dcorr;
+      thread.sum_dEf += dEf;
+      thread.sum_dEpot += dEpot;
+      thread.sum_dN(curr_species) -= 1;
+      thread.sum_dN(new_species) += 1;
+    }
+  });
+
+  // apply accepted changes and update properties
+  double volume = supercell().volume();
+  for (CheckerboardThread &thread : m_checkerboard_thread) {
+    for (Index i = 0; i < thread.site.size(); ++i) {
+      if (m_order_parameter != nullptr) {
+        _eta() +=
+            m_order_parameter->occ_delta(thread.site[i], thread.new_occ[i]);
+      }
+      _configdof().occ(thread.site[i]) = thread.new_occ[i];
+    }
+    _formation_energy() += thread.sum_dEf / volume;
+    _potential_energy() += thread.sum_dEpot / volume;
+    _corr() += thread.sum_dcorr / volume;
+    _comp_n() += thread.sum_dN.cast<double>() / volume;
+  }
+  return n_sites;
+}
+
 /// \brief Calculate the single spin flip low temperature expansion of the grand
 /// canonical potential
 ///
@@ -824,7 +981,8 @@ void GrandCanonical::_update_deltas(GrandCanonicalEvent &event,
 /// \brief Calculate properties given current conditions
 void GrandCanonical::_update_properties() {
   // initialize properties and store pointers to the data strucures
-  _vector_properties()["corr"] = correlations(_config(), _clexulator());
+  _vector_properties()["corr"] = correlations(
+      _config(), _clexulator(), settings().correlations_n_threads());
   m_corr = &_vector_property("corr");
 
   _vector_properties()["comp_n"] = CASM::comp_n(_configdof(), supercell());
@@ -843,6 +1001,95 @@ void GrandCanonical::_update_properties() {
 
   _scalar_properties()["potential_energy"] = this->potential_energy(config());
   m_potential_energy = &_scalar_property("potential_energy");
+
+  if (m_nfold != nullptr) {
+    m_nfold->invalidate();
+  }
+}
+
+/// \brief Construct m_nfold, if using rejection-free steps
+///
+/// - Events are changes of the occupant of one site, as proposed by `propose`
+void GrandCanonical::_make_nfold(const GrandCanonicalSettings &settings) {
+  if (!settings.rejection_free()) {
+    return;
+  }
+  auto site_change_f = [this](Index l, int new_occ) {
+    _update_deltas(m_nfold_event, l, m_convert.l_to_b(l), configdof().occ(l),
+                   new_occ);
+    return m_nfold_event.dEpot();
+  };
+  m_nfold = notstd::make_unique<NFoldWay>(m_convert, supercell().nlist(),
+                                          site_change_f);
+}
+
+/// \brief Return m_nfold, calculating event probabilities if necessary
+///
+/// \throws If the conditions include potentials that depend on the current
+///     correlations, composition, or order parameter, which change the
+///     probability of every event after any event
+NFoldWay &GrandCanonical::_nfold() {
+  if (!m_nfold->is_initialized()) {
+    if (m_condition.corr_matching_pot() ||
+        m_condition.random_alloy_corr_matching_pot() ||
+        m_condition.param_comp_quad_pot_vector().has_value() ||
+        m_condition.param_comp_quad_pot_matrix().has_value() ||
+        (m_order_parameter != nullptr &&
+         (m_condition.order_parameter_quad_pot_vector().has_value() ||
+          m_condition.order_parameter_quad_pot_matrix().has_value()))) {
+      throw std::runtime_error(
+          "Error in GrandCanonical: rejection-free Monte Carlo does not "
+          "support correlation matching potentials, or quadratic composition "
+          "or order parameter potentials");
+    }
+    m_nfold->initialize(configdof(), m_condition.beta(), _mtrand());
+  }
+  return *m_nfold;
+}
+
+/// \brief Construct m_checkerboard, if using checkerboard steps
+///
+/// - Colors are chosen so that no cluster with non-zero ECI includes two sites
+///   of the same color
+void GrandCanonical::_make_checkerboard(
+    const GrandCanonicalSettings &settings) {
+  m_checkerboard_n_threads = settings.checkerboard_n_threads();
+  if (!settings.checkerboard()) {
+    return;
+  }
+  if (settings.rejection_free()) {
+    throw std::runtime_error(
+        "Error in GrandCanonical: checkerboard steps are not supported with "
+        "rejection-free steps");
+  }
+  m_checkerboard = notstd::make_unique<Checkerboard>(
+      m_convert, _clexulator().site_neighborhood(_eci().index().data(),
+                                                 end_ptr(_eci().index())));
+  _log() << "checkerboard period: " << m_checkerboard->period().transpose()
+         << "\n";
+  _log() << "checkerboard colors: " << m_checkerboard->n_colors() << "\n";
+  _log() << "checkerboard threads: " << m_checkerboard_n_threads << "\n";
+}
+
+/// \brief Throw if the conditions are not supported by checkerboard steps
+///
+/// Potentials that depend on the current correlations, composition, or order
+/// parameter change the dEpot of every proposal after any change, and so
+/// prevent evaluating proposals concurrently.
+void GrandCanonical::_check_checkerboard_conditions() const {
+  if (m_condition.corr_matching_pot() ||
+      m_condition.random_alloy_corr_matching_pot() ||
+      m_condition.param_comp_quad_pot_vector().has_value() ||
+      m_condition.param_comp_quad_pot_matrix().has_value() ||
+      (m_order_parameter != nullptr &&
+       (m_condition.order_parameter_pot().has_value() ||
+        m_condition.order_parameter_quad_pot_vector().has_value() ||
+        m_condition.order_parameter_quad_pot_matrix().has_value()))) {
+    throw std::runtime_error(
+        "Error in GrandCanonical: checkerboard steps do not support "
+        "correlation matching potentials, or composition or order parameter "
+        "potentials other than param_chem_pot");
+  }
 }
 
 /// \brief Generate supercell filling ConfigDoF from default configuration
@@ -854,6 +1101,45 @@ ConfigDoF GrandCanonical::_default_motif() const {
   return Configuration::zeros(_supercell()).configdof();
 }
 
+/// \brief Return m_motif_search, calculating the correlations and composition
+/// of all configurations in the database if necessary
+///
+/// The database correlations do not depend on conditions, so they are
+/// calculated once and re-used each time the conditions are set.
+const MotifSearch &GrandCanonical::_motif_search() const {
+  if (!m_motif_search) {
+    _log() << "calculating correlations of all configurations in the "
+              "database..."
+           << std::endl;
+    m_motif_search = notstd::make_unique<MotifSearch>(make_motif_search(
+        primclex().db<Configuration>(), _clexulator(), _eci()));
+  }
+  return *m_motif_search;
+}
+
+/// \brief Return m_motif_fills_supercell, checking which database
+/// configurations can fill the supercell if necessary
+const std::vector<bool> &GrandCanonical::_motif_fills_supercell() const {
+  const MotifSearch &search = _motif_search();
+  if (m_motif_fills_supercell.size() != search.size()) {
+    const Lattice &scel_lat = supercell().lattice();
+    const SymGroup &g = primclex().prim().factor_group();
+    auto begin = g.begin();
+    auto end = g.end();
+    const auto &db = primclex().db<Configuration>();
+
+    m_motif_fills_supercell.clear();
+    for (const auto &configname : search.configname()) {
+      const Lattice &motif_lat = db.find(configname)->supercell().lattice();
+      m_motif_fills_supercell.push_back(
+          xtal::is_equivalent_superlattice(scel_lat, motif_lat, begin, end,
+                                           TOL)
+              .first != end);
+    }
+  }
+  return m_motif_fills_supercell;
+}
+
 /// \brief Generate minimum potential energy ConfigDoF
 ///
 /// Raises exception if it doesn't tile the supercell
@@ -864,29 +1150,29 @@ std::pair<ConfigDoF, std::string> GrandCanonical::_auto_motif(
   _log() << "searching for minimum potential energy motif..." << std::endl;
 
   double tol = 1e-6;
-  auto compare = [&](double A, double B) { return A < B - tol; };
 
   _log() << "using conditions: \n";
   _log() << cond << std::endl;
 
-  std::multimap<double, std::string, decltype(compare)> configmap(compare);
-  const auto &db = primclex().db<Configuration>();
-  for (const auto &tconfig : db) {
-    configmap.insert(
-        std::make_pair(_eci() * correlations(tconfig, _clexulator()) -
-                           cond.param_chem_pot().dot(CASM::comp(tconfig)),
-                       tconfig.name()));
+  const MotifSearch &search = _motif_search();
+  if (!search.size()) {
+    throw std::runtime_error(
+        "Error: no configurations in the database for motif 'auto'");
   }
+  std::vector<Index> min_index =
+      search.ground_states(cond.param_chem_pot(), tol)[0];
 
-  Configuration min_config = *db.find(configmap.begin()->second);
-  double min_potential_energy = configmap.begin()->first;
-  auto eq_range = configmap.equal_range(min_potential_energy);
+  const auto &db = primclex().db<Configuration>();
+  Configuration min_config = *db.find(search.configname()[min_index[0]]);
+  double min_potential_energy =
+      search.formation_energy()(min_index[0]) -
+      cond.param_chem_pot().dot(search.comp_x().row(min_index[0]));
 
-  if (std::distance(eq_range.first, eq_range.second) > 1) {
+  if (min_index.size() > 1) {
     _log() << "Warning: Found degenerate ground states with potential energy: "
            << std::setprecision(8) << min_potential_energy << std::endl;
-    for (auto it = eq_range.first; it != eq_range.second; ++it) {
-      _log() << "  " << db.find(it->second)->name() << std::endl;
+    for (Index i : min_index) {
+      _log() << "  " << search.configname()[i] << std::endl;
     }
     _log() << "using: " << min_config.name() << "\n" << std::endl;
   } else {
@@ -908,50 +1194,16 @@ std::pair<ConfigDoF, std::string> GrandCanonical::_restricted_auto_motif(
   _log() << "searching for minimum potential energy motif..." << std::endl;
 
   double tol = 1e-6;
-  auto compare = [&](double A, double B) { return A < B - tol; };
 
   _log() << "using conditions: \n";
   _log() << cond << std::endl;
 
-  std::multimap<double, std::string, decltype(compare)> configmap(compare);
-  const auto &db = primclex().db<Configuration>();
-  for (const auto &tconfig : db) {
-    configmap.insert(
-        std::make_pair(_eci() * correlations(tconfig, _clexulator()) -
-                           cond.param_chem_pot().dot(CASM::comp(tconfig)),
-                       tconfig.name()));
-  }
-
-  // used to check if configurations can fill the monte carlo supercell
-  const Lattice &scel_lat = supercell().lattice();
-  const SymGroup &g = primclex().prim().factor_group();
-  auto begin = g.begin();
-  auto end = g.end();
-
-  // save iterators pointing to configs that will fill the supercell
-  std::vector<decltype(configmap)::const_iterator> allowed;
-
-  // iterate through groups of degenerate configs
-  auto next_it = configmap.begin();
-  while (next_it != configmap.end()) {
-    auto eq_range = configmap.equal_range(next_it->first);
-
-    // save allowed configs
-    for (auto it = eq_range.first; it != eq_range.second; ++it) {
-      const Lattice &motif_lat = db.find(it->second)->supercell().lattice();
-      if (xtal::is_equivalent_superlattice(scel_lat, motif_lat, begin, end, TOL)
-              .first != end) {
-        allowed.push_back(it);
-      }
-    }
-
-    // if some found, break
-    if (allowed.size()) {
-      break;
-    }
-
-    // else, continue to next group
-    next_it = eq_range.second;
+  // only consider configs that will fill the supercell
+  const MotifSearch &search = _motif_search();
+  std::vector<Index> allowed;
+  if (search.size()) {
+    allowed = search.ground_states(cond.param_chem_pot(), tol,
+                                   _motif_fills_supercell())[0];
   }
 
   if (!allowed.size()) {
@@ -962,22 +1214,28 @@ std::pair<ConfigDoF, std::string> GrandCanonical::_restricted_auto_motif(
                           "default");
   }
 
+  double min_potential_energy =
+      search.formation_energy()(allowed[0]) -
+      cond.param_chem_pot().dot(search.comp_x().row(allowed[0]));
+
   if (allowed.size() > 1) {
     _log() << "Warning: Found degenerate allowed configurations with potential "
               "energy: "
-           << std::setprecision(8) << allowed[0]->first << std::endl;
-    for (auto it = allowed.begin(); it != allowed.end(); ++it) {
-      _log() << "  " << (*it)->second << std::endl;
+           << std::setprecision(8) << min_potential_energy << std::endl;
+    for (Index i : allowed) {
+      _log() << "  " << search.configname()[i] << std::endl;
     }
-    _log() << "using: " << allowed[0]->second << "\n" << std::endl;
+    _log() << "using: " << search.configname()[allowed[0]] << "\n"
+           << std::endl;
   } else {
-    _log() << "using: " << allowed[0]->second
+    _log() << "using: " << search.configname()[allowed[0]]
            << " with potential energy: " << std::setprecision(8)
-           << allowed[0]->first << "\n"
+           << min_potential_energy << "\n"
            << std::endl;
   }
 
-  Configuration min_config = *db.find(allowed[0]->second);
+  const auto &db = primclex().db<Configuration>();
+  Configuration min_config = *db.find(search.configname()[allowed[0]]);
   return std::make_pair(fill_supercell(min_config, _supercell()).configdof(),
                         min_config.name());
 }
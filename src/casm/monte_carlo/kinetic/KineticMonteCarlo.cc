@@ -0,0 +1,338 @@
+#include "casm/monte_carlo/kinetic/KineticMonteCarlo.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "casm/app/ClexDescription.hh"
+#include "casm/casm_io/json/jsonParser.hh"
+#include "casm/clex/ClexBasisSpecs.hh"
+#include "casm/clex/ConfigCorrelations.hh"
+#include "casm/clex/PrimClex_impl.hh"
+#include "casm/clex/Supercell.hh"
+#include "casm/clexulator/NeighborList.hh"
+#include "casm/clusterography/ClusterSpecs.hh"
+#include "casm/clusterography/IntegralCluster.hh"
+#include "casm/clusterography/IntegralCluster_impl.hh"
+#include "casm/crystallography/Coordinate.hh"
+#include "casm/crystallography/LinearIndexConverter.hh"
+#include "casm/crystallography/Structure.hh"
+#include "casm/monte_carlo/MonteCorrelations.hh"
+#include "casm/symmetry/SupercellSymInfo.hh"
+
+namespace CASM {
+namespace Monte {
+
+jsonParser &to_json(const SpeciesDiffusion &diffusion, jsonParser &json) {
+  json.put_obj();
+  json["species"] = diffusion.species_name;
+  json["count"] = diffusion.count;
+  json["n_hops"] = diffusion.n_hops;
+  json["tracer_diffusion_coefficient"] =
+      diffusion.tracer_diffusion_coefficient;
+  json["collective_diffusion_coefficient"] =
+      diffusion.collective_diffusion_coefficient;
+  json["correlation_factor"] = diffusion.correlation_factor;
+  return json;
+}
+
+/// \brief Constructor
+///
+/// \param primclex PrimClex
+/// \param config Initial configuration. The supercell determines the events.
+/// \param formation_energy_desc Periodic cluster expansion used to calculate
+///     the change in formation energy due to a hop
+/// \param kra_desc Local cluster expansion used to calculate the kinetically
+///     resolved activation barrier. The phenomenal cluster must be a pair of
+///     sites.
+/// \param temperature Temperature, in K
+/// \param attempt_frequency Attempt frequency, the rate prefactor
+///
+KineticMonteCarlo::KineticMonteCarlo(
+    const PrimClex &primclex, const Configuration &config,
+    const ClexDescription &formation_energy_desc,
+    const ClexDescription &kra_desc, double temperature,
+    double attempt_frequency)
+    : m_temperature(temperature),
+      m_beta(1.0 / (KB * temperature)),
+      m_attempt_frequency(attempt_frequency),
+      m_config(config),
+      m_configdof(m_config.configdof()),
+      m_convert(m_config.supercell()),
+      m_cand(m_convert),
+      m_occ_loc(m_convert, m_cand, true),
+      m_formation_energy_clex(
+          primclex.clexulator(formation_energy_desc.bset),
+          primclex.eci(formation_energy_desc)),
+      m_kra_clexulator(primclex.local_clexulator(kra_desc.bset)),
+      m_kra_eci(primclex.eci(kra_desc)),
+      m_mark(0),
+      m_time(0.0),
+      m_n_steps(0) {
+  if (!(temperature > 0.0)) {
+    throw std::runtime_error(
+        "Error constructing KineticMonteCarlo: temperature must be > 0");
+  }
+
+  // get the equivalent phenomenal hop clusters
+  auto const &prim = primclex.prim();
+  ClusterSpecs const &cluster_specs =
+      *primclex.basis_set_specs(kra_desc.bset).cluster_specs;
+  if (cluster_specs.periodicity_type() != CLUSTER_PERIODICITY_TYPE::LOCAL) {
+    throw std::runtime_error(
+        "Error constructing KineticMonteCarlo: the activation barrier must "
+        "be a local cluster expansion.");
+  }
+  IntegralCluster const &prototype_phenom =
+      cluster_specs.get_phenomenal_cluster();
+  if (prototype_phenom.size() != 2) {
+    throw std::runtime_error(
+        "Error constructing KineticMonteCarlo: the phenomenal cluster of the "
+        "activation barrier basis set must be a pair of sites.");
+  }
+  std::vector<IntegralCluster> phenom_orbit;
+  for (auto const &op : make_equivalents_generating_ops(
+           primclex.shared_prim(), prototype_phenom,
+           cluster_specs.get_generating_group())) {
+    phenom_orbit.push_back(sym::copy_apply(op, prototype_phenom, prim));
+  }
+  if (phenom_orbit.size() != m_kra_clexulator.size()) {
+    throw std::runtime_error(
+        "Error constructing KineticMonteCarlo: the number of local "
+        "clexulators does not match the number of equivalent phenomenal "
+        "clusters.");
+  }
+  for (auto const &phenom : phenom_orbit) {
+    m_hop_displacement.push_back(phenom[1].coordinate(prim).const_cart() -
+                                 phenom[0].coordinate(prim).const_cart());
+  }
+
+  // vacancies
+  m_is_vacancy.resize(m_convert.species_size());
+  for (Index i = 0; i < m_convert.species_size(); ++i) {
+    m_is_vacancy[i] = m_convert.species_to_mol(i).is_vacancy();
+  }
+  m_vacancy_mediated =
+      std::find(m_is_vacancy.begin(), m_is_vacancy.end(), true) !=
+      m_is_vacancy.end();
+
+  // make the event catalog
+  Supercell const &supercell = m_config.supercell();
+  SuperNeighborList const &nlist = supercell.nlist();
+  for (auto const &clex : m_kra_clexulator) {
+    if (clex.nlist_size() > nlist.sites(0).size()) {
+      throw std::runtime_error(
+          "Error constructing KineticMonteCarlo: the supercell neighbor list "
+          "does not include the activation barrier neighborhood.");
+    }
+  }
+  auto const &unitcell_index_converter =
+      supercell.sym_info().unitcell_index_converter();
+  auto const &unitcellcoord_index_converter =
+      supercell.sym_info().unitcellcoord_index_converter();
+  Index n_sites = m_configdof.size();
+  m_site_to_event.resize(n_sites);
+  std::vector<Index> influence;
+  for (Index u = 0; u < nlist.n_unitcells(); ++u) {
+    xtal::UnitCell unitcell = unitcell_index_converter(u);
+    for (Index p = 0; p < phenom_orbit.size(); ++p) {
+      IntegralCluster clust = phenom_orbit[p] + unitcell;
+      HopEvent event;
+      event.l_a = unitcellcoord_index_converter(clust[0]);
+      event.l_b = unitcellcoord_index_converter(clust[1]);
+      event.unitcell_index = u;
+      event.equivalent_index = p;
+
+      // skip hops between periodic images, or involving fixed sites
+      if (event.l_a == event.l_b ||
+          m_convert.occ_size(m_convert.l_to_asym(event.l_a)) < 2 ||
+          m_convert.occ_size(m_convert.l_to_asym(event.l_b)) < 2) {
+        continue;
+      }
+
+      // the rate depends on the local environment of the hop cluster, and
+      // the environment of both hop sites
+      influence.clear();
+      for (Index unitcell_index : {u, nlist.unitcell_index(event.l_a),
+                                   nlist.unitcell_index(event.l_b)}) {
+        auto const &sites = nlist.sites(unitcell_index);
+        influence.insert(influence.end(), sites.begin(), sites.end());
+      }
+      influence.push_back(event.l_a);
+      influence.push_back(event.l_b);
+      std::sort(influence.begin(), influence.end());
+      influence.erase(std::unique(influence.begin(), influence.end()),
+                      influence.end());
+      for (Index l : influence) {
+        m_site_to_event[l].push_back(m_event.size());
+      }
+      m_event.push_back(event);
+    }
+  }
+  m_event_mark.resize(m_event.size(), 0);
+
+  m_occ_loc.initialize(m_config);
+  _update_all_rates();
+  reset_statistics();
+}
+
+/// \brief Set vacancy_mediated, and recalculate all rates
+void KineticMonteCarlo::set_vacancy_mediated(bool _vacancy_mediated) {
+  m_vacancy_mediated = _vacancy_mediated;
+  _update_all_rates();
+}
+
+/// \brief Calculate the rate of an event in the current configuration
+///
+/// \returns Zero if the event is not allowed: if the occupants of the sites are
+///     the same, if an occupant is not allowed on the other site, or if
+///     vacancy_mediated() and the event is not an exchange of a vacancy and
+///     an atom
+double KineticMonteCarlo::calc_rate(Index event_index) const {
+  HopEvent const &event = m_event[event_index];
+  Mol const &mol_a = m_occ_loc.mol(m_occ_loc.l_to_mol_id(event.l_a));
+  Mol const &mol_b = m_occ_loc.mol(m_occ_loc.l_to_mol_id(event.l_b));
+  if (mol_a.species_index == mol_b.species_index ||
+      !m_convert.species_allowed(mol_a.asym, mol_b.species_index) ||
+      !m_convert.species_allowed(mol_b.asym, mol_a.species_index)) {
+    return 0.0;
+  }
+  if (m_vacancy_mediated && m_is_vacancy[mol_a.species_index] ==
+                                m_is_vacancy[mol_b.species_index]) {
+    return 0.0;
+  }
+
+  SuperNeighborList const &nlist = m_config.supercell().nlist();
+
+  // change in formation energy
+  ECIContainer const &eci = m_formation_energy_clex.eci;
+  m_occ_loc.make_exchange(m_occ_event, event.l_a, event.l_b);
+  restricted_delta_corr(m_dcorr, m_occ_event, m_convert, m_configdof, nlist,
+                        m_formation_energy_clex.clexulator,
+                        eci.index().data(), end_ptr(eci.index()));
+  double dE = eci * m_dcorr.data();
+
+  // kinetically resolved activation barrier
+  corr_contribution(m_kra_corr, event.unitcell_index, m_configdof, nlist,
+                    m_kra_clexulator[event.equivalent_index]);
+  double E_kra = m_kra_eci * m_kra_corr.data();
+
+  return m_attempt_frequency * std::exp(-m_beta * (E_kra + dE / 2.0));
+}
+
+/// \brief Select and apply one event, and advance time
+///
+/// \throws std::runtime_error if no event is possible
+void KineticMonteCarlo::step() {
+  double total_rate = m_rate_tree.total_rate();
+  if (!(total_rate > 0.0)) {
+    throw std::runtime_error(
+        "Error in KineticMonteCarlo::step: no events are possible");
+  }
+  Index event_index = m_rate_tree.find(m_mtrand.randExc(total_rate));
+  m_time -= std::log(m_mtrand.randDblExc()) / total_rate;
+  ++m_n_steps;
+
+  _apply(event_index);
+
+  // update events whose local environment includes a hop site
+  HopEvent const &event = m_event[event_index];
+  ++m_mark;
+  for (Index l : {event.l_a, event.l_b}) {
+    for (Index e : m_site_to_event[l]) {
+      if (m_event_mark[e] != m_mark) {
+        m_event_mark[e] = m_mark;
+        m_rate_tree.set_rate(e, calc_rate(e));
+      }
+    }
+  }
+}
+
+/// \brief Perform n_steps steps
+void KineticMonteCarlo::run(Index n_steps) {
+  for (Index i = 0; i < n_steps; ++i) {
+    step();
+  }
+}
+
+/// \brief Reset time and species displacements, as after equilibration
+void KineticMonteCarlo::reset_statistics() {
+  m_time = 0.0;
+  m_n_steps = 0;
+  m_displacement = Eigen::MatrixXd::Zero(3, m_occ_loc.species_size());
+  m_hop_length_sq = Eigen::VectorXd::Zero(m_occ_loc.species_size());
+  m_n_hops.assign(m_occ_loc.species_size(), 0);
+}
+
+/// \brief Diffusion results, by species type
+///
+/// Species types with no tracked species are not included.
+std::vector<SpeciesDiffusion> KineticMonteCarlo::diffusion() const {
+  Index n_types = m_convert.species_size();
+  std::vector<SpeciesDiffusion> result(n_types);
+  std::vector<Eigen::Vector3d> total_displacement(n_types,
+                                                  Eigen::Vector3d::Zero());
+  std::vector<double> total_hop_length_sq(n_types, 0.0);
+  std::vector<double> total_displacement_sq(n_types, 0.0);
+
+  for (Index id = 0; id < m_occ_loc.species_size(); ++id) {
+    Index i = m_occ_loc.species(id).species_index;
+    result[i].count++;
+    result[i].n_hops += m_n_hops[id];
+    total_displacement[i] += m_displacement.col(id);
+    total_displacement_sq[i] += m_displacement.col(id).squaredNorm();
+    total_hop_length_sq[i] += m_hop_length_sq(id);
+  }
+
+  std::vector<SpeciesDiffusion> nonempty;
+  for (Index i = 0; i < n_types; ++i) {
+    SpeciesDiffusion &d = result[i];
+    if (d.count == 0) {
+      continue;
+    }
+    d.species_name = m_convert.species_name(i);
+    if (m_time > 0.0) {
+      double N = d.count;
+      d.tracer_diffusion_coefficient =
+          total_displacement_sq[i] / (6.0 * m_time * N);
+      d.collective_diffusion_coefficient =
+          total_displacement[i].squaredNorm() / (6.0 * m_time * N);
+    }
+    if (total_hop_length_sq[i] > 0.0) {
+      d.correlation_factor = total_displacement_sq[i] / total_hop_length_sq[i];
+    }
+    nonempty.push_back(d);
+  }
+  return nonempty;
+}
+
+/// \brief Recalculate all rates
+void KineticMonteCarlo::_update_all_rates() {
+  std::vector<double> rate(m_event.size());
+  for (Index e = 0; e < m_event.size(); ++e) {
+    rate[e] = calc_rate(e);
+  }
+  m_rate_tree.set_rates(rate);
+}
+
+/// \brief Apply event and update species displacements
+void KineticMonteCarlo::_apply(Index event_index) {
+  HopEvent const &event = m_event[event_index];
+  Eigen::Vector3d const &hop = m_hop_displacement[event.equivalent_index];
+  m_occ_loc.make_exchange(m_occ_event, event.l_a, event.l_b);
+  for (auto const &traj : m_occ_event.species_traj) {
+    Index id =
+        m_occ_loc.mol(traj.from.mol_id).component[traj.from.mol_comp];
+    if (traj.to.l == event.l_b) {
+      m_displacement.col(id) += hop;
+    } else {
+      m_displacement.col(id) -= hop;
+    }
+    m_hop_length_sq(id) += hop.squaredNorm();
+    m_n_hops[id]++;
+  }
+  m_occ_loc.apply(m_occ_event, m_configdof);
+}
+
+}  // namespace Monte
+}  // namespace CASM
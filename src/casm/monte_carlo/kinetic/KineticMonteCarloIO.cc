@@ -0,0 +1,195 @@
+#include "casm/monte_carlo/kinetic/KineticMonteCarloIO.hh"
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+#include "casm/casm_io/Log.hh"
+#include "casm/casm_io/dataformatter/DataFormatter_impl.hh"
+#include "casm/casm_io/dataformatter/DataFormatterTools.hh"
+#include "casm/casm_io/json/jsonParser.hh"
+#include "casm/clex/CompositionConverter.hh"
+#include "casm/clex/PrimClex.hh"
+#include "casm/monte_carlo/MonteIO.hh"
+#include "casm/monte_carlo/MonteSettings.hh"
+#include "casm/monte_carlo/canonical/CanonicalConditions.hh"
+#include "casm/monte_carlo/kinetic/KineticMonteCarlo.hh"
+
+namespace CASM {
+namespace Monte {
+
+/// \brief Make a kinetic Monte Carlo results formatter
+///
+/// Output data is:
+/// - T
+/// - comp(a) ...
+/// - N_step
+/// - time
+/// - for each species type X present in the supercell:
+///   - count(X)
+///   - n_hops(X)
+///   - D_tracer(X)
+///   - D_collective(X)
+///   - correlation_factor(X)
+///
+/// N_step and time count from the end of equilibration. See
+/// SpeciesDiffusion for the definitions of the diffusion coefficients and
+/// correlation factor.
+///
+/// For csv format:
+/// \code
+/// # T comp(a) ... N_step time count(X) n_hops(X) ...
+/// \endcode
+///
+/// For JSON format is:
+/// \code
+/// { "key0":[...], "key1":[...], ... }
+/// \endcode
+///
+DataFormatter<ConstKineticMonteCarloPtr> make_kinetic_results_formatter(
+    const KineticMonteCarlo &kmc, const CanonicalConditions &conditions) {
+  DataFormatter<ConstKineticMonteCarloPtr> formatter;
+  std::string name;
+
+  {
+    name = "T";
+    double T = conditions.temperature();
+    auto evaluator = [=](const ConstKineticMonteCarloPtr &ptr) { return T; };
+    formatter.push_back(
+        GenericDatumFormatter<double, ConstKineticMonteCarloPtr>(name, name,
+                                                                 evaluator));
+  }
+
+  const auto &comp_converter = conditions.primclex().composition_axes();
+  for (Index i = 0; i < comp_converter.independent_compositions(); ++i) {
+    name = std::string("comp(") + comp_converter.comp_var(i) + ")";
+    double comp = conditions.param_composition(i);
+    auto evaluator = [=](const ConstKineticMonteCarloPtr &ptr) {
+      return comp;
+    };
+    formatter.push_back(
+        GenericDatumFormatter<double, ConstKineticMonteCarloPtr>(name, name,
+                                                                 evaluator));
+  }
+
+  {
+    name = "N_step";
+    auto evaluator = [=](const ConstKineticMonteCarloPtr &ptr) {
+      return ptr->n_steps();
+    };
+    formatter.push_back(
+        GenericDatumFormatter<Index, ConstKineticMonteCarloPtr>(name, name,
+                                                                evaluator));
+  }
+
+  {
+    name = "time";
+    auto evaluator = [=](const ConstKineticMonteCarloPtr &ptr) {
+      return ptr->time();
+    };
+    formatter.push_back(
+        GenericDatumFormatter<double, ConstKineticMonteCarloPtr>(name, name,
+                                                                 evaluator));
+  }
+
+  // the species types present do not change during a run
+  std::vector<SpeciesDiffusion> diffusion = kmc.diffusion();
+  for (Index i = 0; i < diffusion.size(); ++i) {
+    std::string species = "(" + diffusion[i].species_name + ")";
+
+    name = "count" + species;
+    auto count = [=](const ConstKineticMonteCarloPtr &ptr) {
+      return ptr->diffusion()[i].count;
+    };
+    formatter.push_back(
+        GenericDatumFormatter<Index, ConstKineticMonteCarloPtr>(name, name,
+                                                                count));
+
+    name = "n_hops" + species;
+    auto n_hops = [=](const ConstKineticMonteCarloPtr &ptr) {
+      return ptr->diffusion()[i].n_hops;
+    };
+    formatter.push_back(
+        GenericDatumFormatter<Index, ConstKineticMonteCarloPtr>(name, name,
+                                                                n_hops));
+
+    name = "D_tracer" + species;
+    auto tracer = [=](const ConstKineticMonteCarloPtr &ptr) {
+      return ptr->diffusion()[i].tracer_diffusion_coefficient;
+    };
+    formatter.push_back(
+        GenericDatumFormatter<double, ConstKineticMonteCarloPtr>(name, name,
+                                                                 tracer));
+
+    name = "D_collective" + species;
+    auto collective = [=](const ConstKineticMonteCarloPtr &ptr) {
+      return ptr->diffusion()[i].collective_diffusion_coefficient;
+    };
+    formatter.push_back(
+        GenericDatumFormatter<double, ConstKineticMonteCarloPtr>(name, name,
+                                                                 collective));
+
+    name = "correlation_factor" + species;
+    auto correlation_factor = [=](const ConstKineticMonteCarloPtr &ptr) {
+      return ptr->diffusion()[i].correlation_factor;
+    };
+    formatter.push_back(
+        GenericDatumFormatter<double, ConstKineticMonteCarloPtr>(
+            name, name, correlation_factor));
+  }
+
+  return formatter;
+}
+
+/// \brief Write kinetic Monte Carlo results
+///
+/// - Appends the results of one run to the results.csv and/or results.json
+///   files in the output directory
+void write_kinetic_results(const MonteSettings &settings,
+                           const KineticMonteCarlo &kmc,
+                           const CanonicalConditions &conditions, Log &_log) {
+  try {
+    fs::create_directories(settings.output_directory());
+    MonteCarloDirectoryStructure dir(settings.output_directory());
+    auto formatter = make_kinetic_results_formatter(kmc, conditions);
+
+    // write csv path results
+    if (settings.write_csv()) {
+      fs::path file = dir.results_csv();
+      _log << "write: " << dir.results_csv() << "\n";
+      fs::ofstream sout;
+
+      if (!fs::exists(file)) {
+        sout.open(file);
+        formatter.print_header(&kmc, sout);
+      } else {
+        sout.open(file, std::ios::app);
+      }
+
+      formatter.print(&kmc, sout);
+
+      sout.close();
+    }
+
+    // write json path results
+    if (settings.write_json()) {
+      fs::path file = dir.results_json();
+      _log << "write: " << dir.results_json() << "\n";
+
+      jsonParser results;
+      if (fs::exists(file)) {
+        results.read(file);
+      } else {
+        results = jsonParser::object();
+      }
+
+      formatter.to_json_arrays(&kmc, results);
+      results.write(file);
+    }
+  } catch (...) {
+    std::cerr << "ERROR writing results" << std::endl;
+    throw;
+  }
+}
+
+}  // namespace Monte
+}  // namespace CASM
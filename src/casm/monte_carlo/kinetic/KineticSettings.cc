@@ -0,0 +1,120 @@
+#include "casm/monte_carlo/kinetic/KineticSettings.hh"
+
+#include <stdexcept>
+
+#include "casm/app/ProjectSettings.hh"
+#include "casm/casm_io/Log.hh"
+#include "casm/clex/PrimClex.hh"
+
+namespace CASM {
+namespace Monte {
+
+/// \brief Construct KineticSettings by reading a settings JSON file
+///
+/// - The Canonical calculation used to make initial states reads
+///   "data"/"measurements", so an empty array is added if not given
+KineticSettings::KineticSettings(const PrimClex &_primclex,
+                                 const fs::path &read_path)
+    : CanonicalSettings(_primclex, read_path) {
+  jsonParser &data = (*this)["data"];
+  if (!data.contains("measurements")) {
+    data["measurements"] = jsonParser::array();
+  }
+}
+
+// --- Project settings ---------------------
+
+/// \brief Get the local cluster expansion for the kinetically resolved
+/// activation barrier
+ClexDescription KineticSettings::kra(const PrimClex &primclex) const {
+  const ProjectSettings &set = primclex.settings();
+  std::string level1 = "model";
+  std::string help =
+      "(string, default='kra')\n"
+      "  Names the local cluster expansion used for calculating the\n"
+      "  kinetically resolved activation barrier.\n";
+
+  std::string kra = "kra";
+  if (_is_setting(level1, "kra")) {
+    kra = _get_setting<std::string>(level1, "kra", help);
+  }
+
+  if (!set.has_clex(kra)) {
+    Log &err_log = CASM::err_log();
+    err_log.error<Log::standard>("Reading Monte Carlo settings");
+    err_log << "Error reading [\"model\"][\"kra\"]\n";
+    err_log << "[\"model\"][\"kra\"]: " << help;
+    err_log << "No cluster expansion named: '" << kra << "' exists.\n";
+  }
+  return set.clex(kra);
+}
+
+// --- Kinetic Monte Carlo settings ---------------------
+
+/// \brief Attempt frequency, the rate prefactor. Default 1.0.
+///
+/// Time is output in units of 1 / attempt_frequency.
+double KineticSettings::attempt_frequency() const {
+  if (!_is_kinetic_setting("attempt_frequency")) {
+    return 1.0;
+  }
+  std::string help =
+      "number (optional, default=1.0)\n"
+      "  Attempt frequency, the prefactor of every hop rate.\n";
+  double result = _get_setting<double>("kinetic", "attempt_frequency", help);
+  if (!(result > 0.0)) {
+    throw std::runtime_error(
+        "Error reading Monte Carlo settings: [\"kinetic\"]"
+        "[\"attempt_frequency\"] must be > 0");
+  }
+  return result;
+}
+
+/// \brief Returns true if "kinetic"/"vacancy_mediated" is given
+bool KineticSettings::is_vacancy_mediated() const {
+  return _is_kinetic_setting("vacancy_mediated");
+}
+
+/// \brief If true, only hops exchanging a vacancy and an atom are allowed
+///
+/// If not given, KineticMonteCarlo allows only vacancy-mediated hops when any
+/// species is a vacancy.
+bool KineticSettings::vacancy_mediated() const {
+  std::string help =
+      "bool (optional)\n"
+      "  If true, only hops exchanging a vacancy and an atom are allowed. If\n"
+      "  false, all hops exchanging different occupants are allowed. Default\n"
+      "  is true if any species is a vacancy.\n";
+  return _get_setting<bool>("kinetic", "vacancy_mediated", help);
+}
+
+/// \brief Number of steps to perform, for each run, before statistics are
+/// collected. Default 0.
+KineticSettings::size_type KineticSettings::equilibration_steps() const {
+  if (!_is_kinetic_setting("equilibration_steps")) {
+    return 0;
+  }
+  std::string help =
+      "int (optional, default=0)\n"
+      "  Number of steps to perform, for each run, before time and species\n"
+      "  displacements are collected.\n";
+  return _get_setting<size_type>("kinetic", "equilibration_steps", help);
+}
+
+/// \brief Number of steps to perform, for each run, while statistics are
+/// collected
+KineticSettings::size_type KineticSettings::steps() const {
+  std::string help =
+      "int (required)\n"
+      "  Number of steps to perform, for each run, while time and species\n"
+      "  displacements are collected.\n";
+  return _get_setting<size_type>("kinetic", "steps", help);
+}
+
+/// \brief Returns true if (*this)["kinetic"].contains(level2)
+bool KineticSettings::_is_kinetic_setting(std::string level2) const {
+  return contains("kinetic") && _is_setting("kinetic", level2);
+}
+
+}  // namespace Monte
+}  // namespace CASM
@@ -15,7 +15,6 @@ PermuteIterator::PermuteIterator() {}
 
 PermuteIterator::PermuteIterator(const PermuteIterator &iter)
     : m_sym_info(iter.m_sym_info),
-      m_trans_permute(&(m_sym_info->translation_permutations())),
       m_factor_group_index(iter.m_factor_group_index),
       m_translation_index(iter.m_translation_index) {}
 
@@ -23,7 +22,6 @@ PermuteIterator::PermuteIterator(SupercellSymInfo const &_sym_info,
                                  Index _factor_group_index,
                                  Index _translation_index)
     : m_sym_info(&_sym_info),
-      m_trans_permute(&(m_sym_info->translation_permutations())),
       m_factor_group_index(_factor_group_index),
       m_translation_index(_translation_index) {}
 
@@ -41,7 +39,13 @@ const PermuteIterator *PermuteIterator::operator->() const { return this; }
 /// Returns the combination of factor_group permutation and translation
 /// permutation
 Permutation PermuteIterator::combined_permute() const {
-  return translation_permute() * factor_group_permute();
+  Permutation const &fg_permute = factor_group_permute();
+  std::vector<Index> perm(fg_permute.size());
+  for (Index i = 0; i < fg_permute.size(); ++i) {
+    perm[i] = fg_permute[sym_info().translation_permute_ind(
+        m_translation_index, i)];
+  }
+  return Permutation(std::move(perm));
 }
 
 /// Reference the SupercellSymInfo containing the operations being pointed at
@@ -84,8 +88,8 @@ const Permutation &PermuteIterator::factor_group_permute() const {
 }
 
 /// Return the translation permutation being pointed at
-const Permutation &PermuteIterator::translation_permute() const {
-  return m_trans_permute->at(m_translation_index);
+Permutation PermuteIterator::translation_permute() const {
+  return sym_info().translation_permute(m_translation_index);
 }
 
 /// Returns representation of current operation corresponding to species
@@ -128,7 +132,8 @@ SymOp PermuteIterator::sym_op() const {
 }
 
 Index PermuteIterator::permute_ind(Index i) const {
-  return factor_group_permute()[translation_permute()[i]];
+  return factor_group_permute()[sym_info().translation_permute_ind(
+      m_translation_index, i)];
 }
 
 bool PermuteIterator::operator<(const PermuteIterator &iter) const {
@@ -149,7 +154,7 @@ bool PermuteIterator::eq_impl(const PermuteIterator &iter) const {
 // prefix ++PermuteIterator
 PermuteIterator &PermuteIterator::operator++() {
   m_translation_index++;
-  if (m_translation_index == m_trans_permute->size()) {
+  if (m_translation_index == sym_info().translation_permutations_size()) {
     m_translation_index = 0;
     m_factor_group_index++;
   }
@@ -167,7 +172,7 @@ PermuteIterator PermuteIterator::operator++(int) {
 PermuteIterator &PermuteIterator::operator--() {
   if (m_translation_index == 0) {
     m_factor_group_index--;
-    m_translation_index = m_trans_permute->size();
+    m_translation_index = sym_info().translation_permutations_size();
   }
   m_translation_index--;
   return *this;
@@ -432,7 +437,6 @@ template std::vector<PermuteIterator> make_allowed_permute(
 
 void swap(PermuteIterator &a, PermuteIterator &b) {
   std::swap(a.m_sym_info, b.m_sym_info);
-  std::swap(a.m_trans_permute, b.m_trans_permute);
   std::swap(a.m_factor_group_index, b.m_factor_group_index);
   std::swap(a.m_translation_index, b.m_translation_index);
 }
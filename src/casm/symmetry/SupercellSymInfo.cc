@@ -10,6 +10,7 @@
 #include "casm/crystallography/LinearIndexConverter.hh"
 #include "casm/crystallography/SymTools.hh"
 #include "casm/crystallography/UnitCellCoord.hh"
+#include "casm/misc/CASM_Eigen_math.hh"
 #include "casm/misc/CASM_math.hh"
 #include "casm/symmetry/PermuteIterator.hh"
 #include "casm/symmetry/SupercellSymInfo.hh"
@@ -21,38 +22,6 @@
 
 namespace CASM {
 
-std::vector<Permutation> make_translation_permutations(
-    const Eigen::Matrix3l &transformation_matrix, int basis_sites_in_prim) {
-  xtal::UnitCellCoordIndexConverter bijk_index_converter(transformation_matrix,
-                                                         basis_sites_in_prim);
-  xtal::UnitCellIndexConverter ijk_index_converter(transformation_matrix);
-  std::vector<Permutation> translation_permutations;
-
-  // Loops over lattice points
-  for (Index translation_ix = 0;
-       translation_ix < ijk_index_converter.total_sites(); ++translation_ix) {
-    std::vector<Index> single_translation_permutation(
-        bijk_index_converter.total_sites(), -1);
-    UnitCell translation_uc = ijk_index_converter(translation_ix);
-
-    // Loops over all the sites
-    for (Index old_site_ix = 0;
-         old_site_ix < bijk_index_converter.total_sites(); ++old_site_ix) {
-      UnitCellCoord old_site_ucc = bijk_index_converter(old_site_ix);
-      Index new_site_ix = bijk_index_converter(old_site_ucc + translation_uc);
-
-      single_translation_permutation[new_site_ix] = old_site_ix;
-    }
-    // You should have given a permutation value to every single site
-    assert(std::find(single_translation_permutation.begin(),
-                     single_translation_permutation.end(),
-                     -1) == single_translation_permutation.end());
-    translation_permutations.push_back(
-        Permutation(single_translation_permutation));
-  }
-  return translation_permutations;
-}
-
 SupercellSymInfo::SupercellSymInfo(
     Lattice const &_prim_lat, Lattice const &_super_lat,
     Index num_sites_in_prim, SymGroup const &_prim_factor_group,
@@ -66,13 +35,17 @@ SupercellSymInfo::SupercellSymInfo(
       m_unitcellcoord_to_index_converter(
           m_supercell_superlattice.transformation_matrix_to_super(),
           num_sites_in_prim),
-      m_translation_permutations(make_translation_permutations(
-          this->superlattice().transformation_matrix_to_super(),
-          num_sites_in_prim)),
+      m_n_unitcells(m_unitcell_to_index_converter.total_sites()),
       m_factor_group(sym::invariant_subgroup(_prim_factor_group, _super_lat)),
       m_basis_perm_symrep(factor_group(), basis_permutation_symrep_ID),
       m_has_aniso_occs(false),
       m_has_occupation_dofs(false) {
+  // same decomposition as used by the UnitCellIndexConverter
+  Eigen::Matrix3l U, S, V;
+  smith_normal_form(this->superlattice().transformation_matrix_to_super(), U,
+                    S, V);
+  m_smith_normal_diagonal = S.diagonal();
+
   for (auto const &dofID : global_dof_symrep_IDs)
     m_global_dof_symreps.emplace(std::make_pair(
         dofID.first, SymGroupRep::RemoteHandle(factor_group(), dofID.second)));
@@ -175,6 +148,33 @@ SymGroupRep::RemoteHandle const &SupercellSymInfo::site_permutation_symrep()
   return m_site_perm_symrep;
 }
 
+/// \brief Permutation describing reordering of sites of supercell due to a
+/// lattice translation, translating the origin cell to unitcell[l] of the
+/// supercell
+Permutation SupercellSymInfo::translation_permute(
+    Index translation_index) const {
+  Index n_sites = m_unitcellcoord_to_index_converter.total_sites();
+  std::vector<Index> perm(n_sites);
+  for (Index i = 0; i < n_sites; ++i) {
+    perm[i] = translation_permute_ind(translation_index, i);
+  }
+  return Permutation(std::move(perm));
+}
+
+/// \brief Permutations describing reordering of sites of supercell due to a
+/// lattice translation
+///
+/// Note: This is constructed on request, and requires memory proportional to
+/// (number of unit cells) * (number of sites).
+std::vector<Permutation> SupercellSymInfo::translation_permutations() const {
+  std::vector<Permutation> result;
+  result.reserve(m_n_unitcells);
+  for (Index t = 0; t < m_n_unitcells; ++t) {
+    result.push_back(translation_permute(t));
+  }
+  return result;
+}
+
 /// Site permutation corresponding to supercell factor group operation
 const Permutation &SupercellSymInfo::factor_group_permute(
     Index supercell_factor_group_index) const {
@@ -358,6 +358,62 @@ static std::map<std::string, std::string> _nonmagnetic_point_group_info(
 }
 }  // namespace Local
 
+//*******************************************************************************************
+
+void MasterSymGroup::RepPtrArray::push_back(SymGroupRep *_rep_ptr) {
+  Index i = size();
+  _allocate(i + 1);
+  set(i, _rep_ptr);
+  m_size.store(i + 1, std::memory_order_release);
+}
+
+//*******************************************************************************************
+
+void MasterSymGroup::RepPtrArray::resize(Index _size) {
+  _allocate(_size);
+  if (_size > size()) m_size.store(_size, std::memory_order_release);
+}
+
+//*******************************************************************************************
+
+void MasterSymGroup::RepPtrArray::clear() {
+  for (auto &block : m_blocks) block.reset();
+  m_size.store(0, std::memory_order_release);
+}
+
+//*******************************************************************************************
+
+std::atomic<SymGroupRep *> &MasterSymGroup::RepPtrArray::_element(
+    Index i) const {
+  Index b = 0;
+  Index block_size = FIRST_BLOCK_SIZE;
+  while (i >= block_size) {
+    i -= block_size;
+    block_size <<= 1;
+    ++b;
+  }
+  return m_blocks[b][i];
+}
+
+//*******************************************************************************************
+
+void MasterSymGroup::RepPtrArray::_allocate(Index _size) {
+  Index b = 0;
+  Index block_begin = 0;
+  Index block_size = FIRST_BLOCK_SIZE;
+  while (block_begin < _size) {
+    if (!m_blocks[b]) {
+      // value-initialized elements are nullptr
+      m_blocks[b].reset(new std::atomic<SymGroupRep *>[block_size]());
+    }
+    block_begin += block_size;
+    block_size <<= 1;
+    ++b;
+  }
+}
+
+//*******************************************************************************************
+
 // INITIALIZE STATIC MEMBER MasterSymGroup::GROUP_COUNT
 // THIS MUST OCCUR IN A .CC FILE; MAY CAUSE PROBLEMS IF WE
 // CHANGE COMPILING/LINKING STRATEGY
@@ -368,14 +424,9 @@ Index MasterSymGroup::GROUP_COUNT(0);
 MasterSymGroup::MasterSymGroup(const MasterSymGroup &RHS)
     : SymGroup(RHS),
       m_group_index(RHS.m_group_index),
-      m_coord_rep_ID(RHS.m_coord_rep_ID),
-      m_reg_rep_ID(RHS.m_reg_rep_ID),
-      m_identity_rep_IDs(RHS.m_identity_rep_IDs) {
-  m_rep_array.reserve(RHS.m_rep_array.size());
-
-  for (Index i = 0; i < RHS.m_rep_array.size(); i++) {
-    _add_representation(RHS.m_rep_array[i]->copy());
-  }
+      m_coord_rep(nullptr),
+      m_reg_rep(nullptr) {
+  _copy_representations(RHS);
 
   for (Index i = 0; i < size(); i++) at(i).set_index(*this, i);
 }
@@ -390,11 +441,7 @@ MasterSymGroup::~MasterSymGroup() {
 //*******************************************************************************************
 MasterSymGroup &MasterSymGroup::operator=(const MasterSymGroup &RHS) {
   SymGroup::operator=(RHS);
-  m_coord_rep_ID = RHS.m_coord_rep_ID;
-  m_reg_rep_ID = RHS.m_reg_rep_ID;
-  m_rep_array.reserve(RHS.m_rep_array.size());
-  for (Index i = 0; i < RHS.m_rep_array.size(); i++)
-    _add_representation(RHS.m_rep_array[i]->copy());
+  _copy_representations(RHS);
 
   for (Index i = 0; i < size(); i++) at(i).set_index(*this, i);
 
@@ -429,9 +476,9 @@ void MasterSymGroup::clear() {
   }
   m_rep_array.clear();
 
-  m_reg_rep_ID = m_coord_rep_ID = SymGroupRepID();
+  m_reg_rep = m_coord_rep = nullptr;
 
-  m_identity_rep_IDs.clear();
+  m_identity_reps.clear();
 
   // Yes, by the time you return GROUP_COUNT is greater than m_group_index, and
   // that's how we like it around here.
@@ -443,41 +490,51 @@ void MasterSymGroup::clear() {
 //*******************************************************************************************
 
 SymGroupRepID MasterSymGroup::coord_rep_ID() const {
-  if (m_coord_rep_ID.empty()) _add_coord_rep();
-  return m_coord_rep_ID;
+  return coord_rep().symrep_ID();
 }
 
 //*******************************************************************************************
 
 SymGroupRepID MasterSymGroup::reg_rep_ID() const {
-  if (m_reg_rep_ID.empty()) _add_reg_rep();
-  return m_reg_rep_ID;
+  SymGroupRep const *rep_ptr = m_reg_rep.load(std::memory_order_acquire);
+  if (rep_ptr) return rep_ptr->symrep_ID();
+
+  std::lock_guard<std::recursive_mutex> lock(m_rep_mutex);
+  rep_ptr = m_reg_rep.load(std::memory_order_acquire);
+  return rep_ptr ? rep_ptr->symrep_ID() : _add_reg_rep();
 }
 
 //*******************************************************************************************
 
 SymGroupRepID MasterSymGroup::identity_rep_ID(Index dim) const {
-  if (m_identity_rep_IDs.size() < dim + 1) {
-    auto tail = std::vector<SymGroupRepID>(dim + 1 - m_identity_rep_IDs.size());
-    m_identity_rep_IDs.insert(m_identity_rep_IDs.end(), tail.begin(),
-                              tail.end());
+  if (dim < m_identity_reps.size() && m_identity_reps[dim]) {
+    return m_identity_reps[dim]->symrep_ID();
+  }
+
+  std::lock_guard<std::recursive_mutex> lock(m_rep_mutex);
+  if (m_identity_reps.size() < dim + 1) {
+    m_identity_reps.resize(dim + 1);
   }
-  if (m_identity_rep_IDs[dim].empty()) {
-    m_rep_array.push_back(new SymGroupRep(*this));
+  if (!m_identity_reps[dim]) {
+    SymGroupRep *identityrep(new SymGroupRep(*this));
+    _add_representation(identityrep);
     for (Index i = 0; i < size(); i++) {
-      m_rep_array.back()->set_rep(i, SymPermutation(Permutation(dim)));
+      identityrep->set_rep(i, SymPermutation(Permutation(dim)));
     }
-    m_identity_rep_IDs[dim] =
-        SymGroupRepID(group_index(), m_rep_array.size() - 1);
+    m_identity_reps.set(dim, identityrep);
   }
-  return m_identity_rep_IDs[dim];
+  return m_identity_reps[dim]->symrep_ID();
 }
 
 //*******************************************************************************************
 
 SymGroupRep const &MasterSymGroup::coord_rep() const {
-  if (m_coord_rep_ID.empty()) _add_coord_rep();
-  return representation(m_coord_rep_ID);
+  SymGroupRep const *rep_ptr = m_coord_rep.load(std::memory_order_acquire);
+  if (rep_ptr) return *rep_ptr;
+
+  std::lock_guard<std::recursive_mutex> lock(m_rep_mutex);
+  if (!m_coord_rep.load(std::memory_order_acquire)) _add_coord_rep();
+  return *m_coord_rep.load(std::memory_order_acquire);
 }
 
 //*******************************************************************************************
@@ -491,8 +548,7 @@ void MasterSymGroup::set_rep(SymGroupRepID rep_ID,
 //*******************************************************************************************
 
 SymGroupRep const &MasterSymGroup::reg_rep() const {
-  if (m_reg_rep_ID.empty()) _add_reg_rep();
-  return representation(m_reg_rep_ID);
+  return representation(reg_rep_ID());
 }
 
 //*******************************************************************************************
@@ -502,8 +558,9 @@ SymGroupRepID MasterSymGroup::_add_coord_rep() const {
   for (Index i = 0; i < size(); i++)
     coordrep->set_rep(i, SymMatrixXd(at(i).matrix()));
 
-  m_coord_rep_ID = _add_representation(coordrep);
-  return m_coord_rep_ID;
+  SymGroupRepID coordrep_ID = _add_representation(coordrep);
+  m_coord_rep.store(coordrep, std::memory_order_release);
+  return coordrep_ID;
 }
 
 //*******************************************************************************************
@@ -526,9 +583,10 @@ SymGroupRepID MasterSymGroup::_add_reg_rep() const {
     regrep->set_rep(i, SymMatrixXd(regrep_mat));
   }
 
-  m_reg_rep_ID = _add_representation(regrep);
+  SymGroupRepID regrep_ID = _add_representation(regrep);
+  m_reg_rep.store(regrep, std::memory_order_release);
 
-  return m_reg_rep_ID;
+  return regrep_ID;
 }
 
 //*******************************************************************************************
@@ -698,6 +756,7 @@ SymGroupRepID MasterSymGroup::add_transformed_rep(
 //*******************************************************************************************
 
 SymGroupRepID MasterSymGroup::allocate_representation() const {
+  std::lock_guard<std::recursive_mutex> lock(m_rep_mutex);
   SymGroupRepID new_ID(group_index(), m_rep_array.size());
   m_rep_array.push_back(new SymGroupRep(*this, new_ID));
   return new_ID;
@@ -713,12 +772,36 @@ SymGroupRepID MasterSymGroup::add_representation(
 //*******************************************************************************************
 
 SymGroupRepID MasterSymGroup::_add_representation(SymGroupRep *new_rep) const {
+  std::lock_guard<std::recursive_mutex> lock(m_rep_mutex);
   SymGroupRepID new_ID(group_index(), m_rep_array.size());
   m_rep_array.push_back(new_rep);
-  m_rep_array.back()->set_master_group(*this, new_ID);
+  new_rep->set_master_group(*this, new_ID);
   return new_ID;
 }
 
+//*******************************************************************************************
+
+void MasterSymGroup::_copy_representations(MasterSymGroup const &RHS) {
+  Index offset = m_rep_array.size();
+  for (Index i = 0; i < RHS.m_rep_array.size(); i++) {
+    _add_representation(RHS.m_rep_array[i]->copy());
+  }
+
+  // the Cartesian, regular, and identity representations of RHS are among the
+  // representations just copied
+  auto copied_rep = [&](SymGroupRep const *rhs_rep) -> SymGroupRep * {
+    return rhs_rep ? m_rep_array[offset + rhs_rep->symrep_ID().rep_index()]
+                   : nullptr;
+  };
+  m_coord_rep = copied_rep(RHS.m_coord_rep);
+  m_reg_rep = copied_rep(RHS.m_reg_rep);
+  m_identity_reps.clear();
+  m_identity_reps.resize(RHS.m_identity_reps.size());
+  for (Index i = 0; i < RHS.m_identity_reps.size(); i++) {
+    m_identity_reps.set(i, copied_rep(RHS.m_identity_reps[i]));
+  }
+}
+
 //*******************************************************************************************
 const SymGroupRep &MasterSymGroup::representation(SymGroupRepID _id) const {
   return *_representation_ptr(_id);
@@ -1,10 +1,17 @@
 #include "casm/system/RuntimeLibrary.hh"
 
+#include <algorithm>
 #include <boost/algorithm/string.hpp>
 #include <boost/filesystem.hpp>
+#include <cstdint>
+#include <iomanip>
+#include <set>
+#include <sstream>
+#include <thread>
 #include <vector>
 
 #include "casm/system/Popen.hh"
+#include "casm/version/version.hh"
 
 namespace CASM {
 
@@ -84,38 +91,241 @@ RuntimeLibrary::~RuntimeLibrary() {
 
 /// \brief Compile a shared library
 ///
-/// \param _filename_base Base name for the source code file. For example,
-/// "/path/to/hello" looks for "/path/to/hello.cc",
-///        and compile "/path/to/hello.o" and "/path/to/hello.so".
-///
-/// \result Compiles file "/path/to/hello.cc" into an object file and shared
-/// library using the options
-///         provided when this RuntimeLibrary object was constructed. By
-///         default, "example.o" and "example.so".
-///
-/// To enable runtime symbol lookup use C-style functions, i.e use extern "C"
-/// for functions you want to use via get_function.  This means no member
-/// functions or overloaded functions.
+/// Compiles "filename_base.cc" into "filename_base.so" using the options
+/// provided when this RuntimeLibrary object was constructed. See
+/// `RuntimeLibrary::compile` for details.
 ///
 void RuntimeLibrary::_compile() {
+  compile(m_filename_base, m_compile_options, m_so_options);
+}
+
+namespace {
+
+/// \brief Compile "filename_base.cc" into "filename_base.o" and
+/// "filename_base.so", without using the compile cache
+void _compile_so(std::string filename_base, std::string compile_options,
+                 std::string so_options) {
   // compile the source code into a dynamic library
   Popen p;
-  std::string cmd = m_compile_options + " -o " + m_filename_base + ".o" +
-                    " -c " + m_filename_base + ".cc";
+  std::string cmd = compile_options + " -o " + filename_base + ".o" + " -c " +
+                    filename_base + ".cc";
   p.popen(cmd);
   if (p.exit_code()) {
-    throw runtime_lib_compile_error(
-        m_filename_base, cmd, p.gets(),
-        "Can not compile " + m_filename_base + ".cc");
+    throw runtime_lib_compile_error(filename_base, cmd, p.gets(),
+                                    "Can not compile " + filename_base + ".cc");
   }
 
-  cmd = m_so_options + " -o " + m_filename_base + ".so" + " " +
-        m_filename_base + ".o";
+  cmd = so_options + " -o " + filename_base + ".so" + " " + filename_base +
+        ".o";
   p.popen(cmd);
   if (p.exit_code()) {
-    throw runtime_lib_shared_error(
-        m_filename_base, cmd, p.gets(),
-        "Can not compile " + m_filename_base + ".cc");
+    throw runtime_lib_shared_error(filename_base, cmd, p.gets(),
+                                   "Can not compile " + filename_base + ".cc");
+  }
+}
+
+/// \brief Read an entire file into a string
+std::string _read_file(fs::path const &path) {
+  std::ifstream in(path.string(), std::ios::binary);
+  std::stringstream ss;
+  ss << in.rdbuf();
+  return ss.str();
+}
+
+/// \brief 64-bit FNV-1a hash, as a hexadecimal string
+std::string _hash_str(std::string const &str) {
+  std::uint64_t hash = 14695981039346656037ULL;
+  for (unsigned char c : str) {
+    hash ^= c;
+    hash *= 1099511628211ULL;
+  }
+  std::stringstream ss;
+  ss << std::hex << std::setw(16) << std::setfill('0') << hash;
+  return ss.str();
+}
+
+/// \brief Copy a file, replacing `to` atomically so that concurrent readers
+/// never see a partially written file
+void _atomic_copy(fs::path const &from, fs::path const &to) {
+  fs::path tmp = to.parent_path() /
+                 fs::unique_path(to.filename().string() + ".%%%%-%%%%-%%%%");
+  fs::copy_file(from, tmp);
+  fs::rename(tmp, to);
+}
+
+/// \brief Write a file, replacing `to` atomically so that concurrent readers
+/// never see a partially written file
+void _atomic_write(std::string const &content, fs::path const &to) {
+  fs::path tmp = to.parent_path() /
+                 fs::unique_path(to.filename().string() + ".%%%%-%%%%-%%%%");
+  {
+    std::ofstream out(tmp.string(), std::ios::binary);
+    out << content;
+    if (!out) {
+      throw std::runtime_error("Could not write: " + tmp.string());
+    }
+  }
+  fs::rename(tmp, to);
+}
+
+/// \brief Include directories specified by "-I" compile options
+std::vector<fs::path> _include_dirs(std::string compile_options) {
+  std::vector<std::string> splt;
+  boost::split(splt, compile_options, boost::is_any_of(" "),
+               boost::token_compress_on);
+  std::vector<fs::path> result;
+  for (Index i = 0; i < splt.size(); ++i) {
+    if (splt[i] == "-I" && i + 1 < splt.size()) {
+      result.emplace_back(splt[++i]);
+    } else if (boost::starts_with(splt[i], "-I")) {
+      result.emplace_back(splt[i].substr(2));
+    }
+  }
+  return result;
+}
+
+/// \brief Append the contents of the CASM headers included by `source`,
+/// directly or indirectly, to `headers`
+///
+/// Headers are found from `#include "casm/..."` directives, excluding
+/// "casm/external/...", by searching `include_dirs` in order. Each header is
+/// only appended once, tracked by `found`.
+void _append_casm_headers(std::string const &source,
+                          std::vector<fs::path> const &include_dirs,
+                          std::set<std::string> &found, std::string &headers) {
+  std::string const directive = "#include \"";
+  std::istringstream in(source);
+  std::string line;
+  while (std::getline(in, line)) {
+    boost::trim(line);
+    if (!boost::starts_with(line, directive)) continue;
+    auto end = line.find('"', directive.size());
+    if (end == std::string::npos) continue;
+    std::string name =
+        line.substr(directive.size(), end - directive.size());
+    if (!boost::starts_with(name, "casm/") ||
+        boost::starts_with(name, "casm/external/") ||
+        !found.insert(name).second) {
+      continue;
+    }
+    for (auto const &dir : include_dirs) {
+      fs::path header = dir / name;
+      if (fs::exists(header)) {
+        std::string content = _read_file(header);
+        headers += name + "\n" + content + "\n";
+        _append_casm_headers(content, include_dirs, found, headers);
+        break;
+      }
+    }
+  }
+}
+
+/// \brief Text identifying everything, other than the source code, that
+/// determines the compiled library
+///
+/// Includes the CASM version, the compiler version, the compile and shared
+/// library options, and a hash of the CASM headers included by the source
+/// code. The CASM version is often "unknown" for development builds, so the
+/// header hash is what ensures a library is recompiled after a change to the
+/// interface it is compiled against (i.e. BaseClexulator).
+std::string _compile_cache_key(std::string const &source,
+                               std::string compile_options,
+                               std::string so_options) {
+  std::string cxx_version;
+  std::vector<std::string> splt;
+  boost::split(splt, compile_options, boost::is_any_of(" "),
+               boost::token_compress_on);
+  for (auto const &token : splt) {
+    if (token.empty()) continue;
+    Popen p;
+    p.popen(token + " --version");
+    cxx_version = p.gets();
+    break;
+  }
+  std::set<std::string> found;
+  std::string headers;
+  _append_casm_headers(source, _include_dirs(compile_options), found,
+                       headers);
+  return "casm_version: " + version() + "\n" + "cxx_version: " + cxx_version +
+         "\n" + "compile_options: " + compile_options + "\n" +
+         "so_options: " + so_options + "\n" +
+         "casm_headers: " + _hash_str(headers) + "\n";
+}
+
+}  // namespace
+
+/// \brief Compile "filename_base.cc" into "filename_base.so", using the
+/// compile cache if it is enabled
+///
+/// \param filename_base Base name for the source code file. For example,
+///     "/path/to/hello" looks for "/path/to/hello.cc", and compiles
+///     "/path/to/hello.o" and "/path/to/hello.so".
+/// \param compile_options Options used to compile the '.o' file
+/// \param so_options Options used to compile the '.so' file
+///
+/// If the compile cache directory (see `RuntimeLibrary::default_cache_dir`)
+/// is not empty, libraries are stored there keyed by a hash of the source
+/// code, the compile options, the compiler version, the CASM version, and the
+/// CASM headers included by the source code.
+/// Cache entries store the source code and options, and are only used if
+/// they match exactly. If there is a matching entry, the cached library is
+/// copied to "filename_base.so" and nothing is compiled. Otherwise, the
+/// library is compiled and then added to the cache. Cache entries are
+/// written atomically, so the cache may be shared by multiple projects and
+/// processes. Failure to read or write the cache is not an error.
+///
+/// To enable runtime symbol lookup use C-style functions, i.e use extern "C"
+/// for functions you want to use via get_function.  This means no member
+/// functions or overloaded functions.
+///
+/// This function may be called by multiple threads at once for different
+/// `filename_base`.
+///
+void RuntimeLibrary::compile(std::string filename_base,
+                             std::string compile_options,
+                             std::string so_options) {
+  fs::path cache_dir = default_cache_dir().first;
+  if (cache_dir.empty()) {
+    _compile_so(filename_base, compile_options, so_options);
+    return;
+  }
+
+  fs::path so_path = filename_base + ".so";
+  std::string source;
+  std::string key;
+  fs::path cached_cc;
+  fs::path cached_key;
+  fs::path cached_so;
+
+  // the source is written last, so if it exists the entry is complete
+  try {
+    source = _read_file(filename_base + ".cc");
+    key = _compile_cache_key(source, compile_options, so_options);
+    std::string hash = _hash_str(key + source);
+    cached_cc = cache_dir / (hash + ".cc");
+    cached_key = cache_dir / (hash + ".key");
+    cached_so = cache_dir / (hash + ".so");
+    if (fs::exists(cached_cc) && fs::exists(cached_so) &&
+        _read_file(cached_cc) == source && _read_file(cached_key) == key) {
+      _atomic_copy(cached_so, so_path);
+      return;
+    }
+  } catch (std::exception &e) {
+    // fall back to compiling
+  }
+
+  _compile_so(filename_base, compile_options, so_options);
+  if (cached_cc.empty()) {
+    return;
+  }
+
+  try {
+    fs::create_directories(cache_dir);
+    _atomic_copy(so_path, cached_so);
+    _atomic_write(key, cached_key);
+    _atomic_write(source, cached_cc);
+  } catch (std::exception &e) {
+    // the library was compiled; failing to cache it is not an error
   }
 }
 
@@ -166,6 +376,10 @@ std::vector<std::string> _soflags_env() {
   return std::vector<std::string>{"CASM_SOFLAGS"};
 }
 
+std::vector<std::string> _compile_jobs_env() {
+  return std::vector<std::string>{"CASM_COMPILE_JOBS"};
+}
+
 // std::vector<std::string> _casm_env() {
 //   return std::vector<std::string> {
 //     "CASM_PREFIX"
@@ -398,6 +612,62 @@ std::pair<fs::path, std::string> RuntimeLibrary::default_boost_libdir() {
   return std::make_pair(fs::path("/not/found"), "notfound");
 }
 
+/// \brief Return default compile cache directory
+///
+/// \returns In order of preference: $CASM_RUNTIME_LIB_CACHE_DIR, or
+///          $XDG_CACHE_HOME/casm/runtime_lib, or
+///          $HOME/.cache/casm/runtime_lib. If CASM_RUNTIME_LIB_CACHE_DIR is
+///          set to an empty string, or none of the variables are set, returns
+///          an empty path, which disables the compile cache.
+std::pair<fs::path, std::string> RuntimeLibrary::default_cache_dir() {
+  char *_env;
+
+  // if CASM_RUNTIME_LIB_CACHE_DIR exists
+  _env = std::getenv("CASM_RUNTIME_LIB_CACHE_DIR");
+  if (_env != nullptr) {
+    return std::make_pair(fs::path(_env), "CASM_RUNTIME_LIB_CACHE_DIR");
+  }
+
+  // if XDG_CACHE_HOME exists
+  _env = std::getenv("XDG_CACHE_HOME");
+  if (_env != nullptr && std::string(_env).size()) {
+    return std::make_pair(fs::path(_env) / "casm" / "runtime_lib",
+                          "XDG_CACHE_HOME");
+  }
+
+  // if HOME exists
+  _env = std::getenv("HOME");
+  if (_env != nullptr && std::string(_env).size()) {
+    return std::make_pair(fs::path(_env) / ".cache" / "casm" / "runtime_lib",
+                          "HOME");
+  }
+
+  // else
+  return std::make_pair(fs::path(), "disabled");
+}
+
+/// \brief Return default maximum number of parallel compile jobs
+///
+/// \returns "$CASM_COMPILE_JOBS" if environment variable CASM_COMPILE_JOBS
+///          exists, otherwise the number of hardware threads. Always at
+///          least 1.
+std::pair<Index, std::string> RuntimeLibrary::default_compile_jobs() {
+  auto res = _use_env(_compile_jobs_env());
+  if (res.second != "default") {
+    try {
+      return std::make_pair(std::max(Index(1), Index(std::stol(res.first))),
+                            res.second);
+    } catch (std::exception &e) {
+      throw std::runtime_error(
+          "Error in RuntimeLibrary::default_compile_jobs: could not convert "
+          "CASM_COMPILE_JOBS='" +
+          res.first + "' to an integer");
+    }
+  }
+  Index n = std::thread::hardware_concurrency();
+  return std::make_pair(std::max(Index(1), n), "default");
+}
+
 std::string include_path(const fs::path &dir) {
   if (!dir.empty()) {
     return "-I" + dir.string();
@@ -0,0 +1,224 @@
+#include "gtest/gtest.h"
+
+/// What is being tested:
+#include "casm/casm_io/json/jsonStream.hh"
+
+/// What is being used to test it:
+#include <sstream>
+
+#include "casm/misc/CASM_math.hh"
+
+using namespace CASM;
+
+namespace {
+
+std::string stream_json_str =
+    R"({
+// comments are allowed
+"int" : 34,
+"negative_int" : -9223372036854775808,
+"uint" : 18446744073709551615,
+"number" : 4.0023,
+"exponent" : -1.5e-7,
+"string" : "he\"llo\n\tA\/",
+"bool_true" : true,
+"bool_false" : false,
+"null" : null,
+"empty_object" : {},
+"empty_array" : [],
+/* nested values */
+"object" : {
+  "int" : 34,
+  "array" : [[1, 2], [3.5, 4]]
+},
+"mixed_array" : [
+  "hello",
+  34,
+  4.0023,
+  {"int" : 34, "number" : 4.0023},
+  []
+]
+})";
+
+jsonParser spirit_read(std::string const &str) {
+  jsonParser json;
+  json_spirit::read_string(str, (json_spirit::mValue &)json);
+  return json;
+}
+
+std::string spirit_write(json_spirit::mValue const &json, unsigned int indent,
+                         unsigned int prec, unsigned int options) {
+  std::stringstream ss;
+  json_spirit::write_stream(json, ss, indent, prec, options);
+  return ss.str();
+}
+
+std::string stream_write(json_spirit::mValue const &json, unsigned int indent,
+                         unsigned int prec, unsigned int options) {
+  std::stringstream ss;
+  jsonStreamWriter writer{ss, indent, prec, options};
+  writer.value(json);
+  writer.flush();
+  return ss.str();
+}
+
+/// Expect the same output as json_spirit::write_stream for several options
+void check_write(json_spirit::mValue const &json) {
+  for (unsigned int options :
+       {0u, unsigned(json_spirit::pretty_print),
+        unsigned(json_spirit::pretty_print | json_spirit::raw_utf8 |
+                 json_spirit::single_line_arrays),
+        unsigned(json_spirit::remove_trailing_zeros),
+        unsigned(json_spirit::always_escape_nonascii)}) {
+    for (unsigned int prec : {3u, 12u}) {
+      EXPECT_EQ(stream_write(json, 2, prec, options),
+                spirit_write(json, 2, prec, options))
+          << "options: " << options << " prec: " << prec;
+    }
+  }
+}
+
+}  // namespace
+
+TEST(jsonStreamTest, Read) {
+  jsonParser json;
+  std::stringstream ss{stream_json_str};
+  jsonBuilder builder{json};
+  parse_json(ss, builder);
+  EXPECT_TRUE(builder.complete());
+
+  EXPECT_EQ(json, spirit_read(stream_json_str));
+  EXPECT_EQ(json["int"].get<int>(), 34);
+  EXPECT_EQ(json["negative_int"].get<long>(),
+            std::numeric_limits<long>::min());
+  EXPECT_EQ(((json_spirit::mValue &)json["uint"]).get_uint64(),
+            std::numeric_limits<boost::uint64_t>::max());
+  EXPECT_TRUE(almost_equal(json["exponent"].get<double>(), -1.5e-7));
+  EXPECT_EQ(json["string"].get<std::string>(), "he\"llo\n\tA/");
+  EXPECT_TRUE(json["null"].is_null());
+  EXPECT_TRUE(json["empty_object"].is_obj());
+  EXPECT_EQ(json["empty_object"].size(), 0);
+  EXPECT_TRUE(json["empty_array"].is_array());
+  EXPECT_EQ(json["object"]["array"][1][0].get<double>(), 3.5);
+  EXPECT_EQ(json["mixed_array"].size(), 5);
+}
+
+TEST(jsonStreamTest, ReadScalarsAndRemainder) {
+  // only the first value is consumed
+  std::stringstream ss{"  3.25  [1, 2]"};
+  jsonParser json;
+  jsonBuilder builder{json};
+  parse_json(ss, builder);
+  EXPECT_EQ(json.get<double>(), 3.25);
+
+  jsonParser next;
+  EXPECT_TRUE(next.read(ss));
+  EXPECT_EQ(next.size(), 2);
+}
+
+TEST(jsonStreamTest, ReadErrors) {
+  for (std::string str : {"", "   ", "{\"a\" : 1", "{\"a\" 1}", "[1 2]",
+                          "[1,]", "{\"a\" : 1,}", "\"unterminated", "tru",
+                          "[nul]", "{1 : 2}"}) {
+    jsonParser json;
+    std::stringstream ss{str};
+    jsonBuilder builder{json};
+    EXPECT_THROW(parse_json(ss, builder), std::runtime_error) << str;
+
+    std::stringstream ss2{str};
+    EXPECT_FALSE(json.read(ss2)) << str;
+  }
+}
+
+TEST(jsonStreamTest, SelectiveReader) {
+  std::vector<std::string> found;
+  jsonSelectiveReader reader{
+      [](jsonSelectiveReader::Path const &path) {
+        // select members of "object", and elements of "mixed_array" after
+        // the first
+        return path.size() == 2 &&
+               (path[0] == "object" ||
+                (path[0] == "mixed_array" && path[1] != "0"));
+      },
+      [&](jsonSelectiveReader::Path const &path, jsonParser &json) {
+        found.push_back(path[0] + "/" + path[1]);
+        jsonParser expected = spirit_read(stream_json_str)[path[0]];
+        if (expected.is_array()) {
+          EXPECT_EQ(json, expected[std::stoi(path[1])]);
+        } else {
+          EXPECT_EQ(json, expected[path[1]]);
+        }
+      }};
+  std::stringstream ss{stream_json_str};
+  parse_json(ss, reader);
+
+  std::vector<std::string> expected{"object/int",    "object/array",
+                                    "mixed_array/1", "mixed_array/2",
+                                    "mixed_array/3", "mixed_array/4"};
+  EXPECT_EQ(found, expected);
+}
+
+TEST(jsonStreamTest, WriteValue) {
+  check_write(spirit_read(stream_json_str));
+  check_write(spirit_read("{}"));
+  check_write(spirit_read("[]"));
+  check_write(spirit_read("[[], {}, [[]], {\"a\" : {}}]"));
+  check_write(spirit_read("\"caf\xc3\xa9\""));
+  check_write(spirit_read("-1234.5678"));
+
+  // jsonParser::print uses jsonStreamWriter
+  jsonParser json = spirit_read(stream_json_str);
+  std::stringstream ss;
+  json.print(ss);
+  EXPECT_EQ(ss.str(), spirit_write(json, 2, 12,
+                                   json_spirit::pretty_print |
+                                       json_spirit::raw_utf8 |
+                                       json_spirit::single_line_arrays));
+}
+
+TEST(jsonStreamTest, WriteFlags) {
+  jsonParser json;
+  json["row"] = spirit_read("[[1, 2], [3, 4]]");
+  json["row"].set_force_row();
+  json["column"] = spirit_read("[1.5, 2.0]");
+  json["column"].set_force_column();
+  json["scientific"] = 1234.5678;
+  json["scientific"].set_scientific();
+  json["remove_trailing_zeros"] = 1234.5;
+  json["remove_trailing_zeros"].set_remove_trailing_zeros();
+  json["row_object"]["a"] = 1;
+  json["row_object"].set_force_row();
+  check_write(json);
+}
+
+TEST(jsonStreamTest, WriteIncremental) {
+  jsonParser json = spirit_read(stream_json_str);
+
+  // write the top-level object member by member
+  std::stringstream ss;
+  {
+    jsonStreamWriter writer{ss, 0, 12};
+    writer.begin_object();
+    for (auto it = json.begin(); it != json.end(); ++it) {
+      writer.key(it.name());
+      writer.value(*it);
+    }
+    writer.end_object();
+  }
+  EXPECT_EQ(ss.str(), spirit_write(json, 0, 12, 0));
+
+  // nested begin/end calls are written in column format
+  std::stringstream ss2;
+  {
+    jsonStreamWriter writer{ss2, 2, 12, json_spirit::pretty_print};
+    writer.begin_object();
+    writer.key("a");
+    writer.begin_array();
+    writer.value(jsonParser{1});
+    writer.begin_object();
+    writer.end_object();
+    writer.end_array();
+    writer.end_object();
+  }
+  EXPECT_EQ(ss2.str(), "{\n  \"a\" : [\n    1,\n    {\n    }\n  ]\n}");
+}
@@ -0,0 +1,145 @@
+#include "casm/clex/CanonicalOccupationGenerator.hh"
+
+#include "casm/app/ProjectBuilder.hh"
+#include "casm/app/ProjectSettings.hh"
+#include "casm/clex/ConfigEnumAllOccupations.hh"
+#include "casm/clex/PrimClex.hh"
+#include "casm/clex/ScelEnum.hh"
+#include "casm/crystallography/Structure.hh"
+#include "casm/database/ScelDatabaseTools_impl.hh"
+#include "casm/enumerator/ConfigEnumInput.hh"
+#include "casm/symmetry/PermuteIterator.hh"
+#include "crystallography/TestStructures.hh"
+#include "gtest/gtest.h"
+
+using namespace CASM;
+
+namespace {
+
+/// Enumerate occupations, as a sorted vector
+std::vector<Eigen::VectorXi> enumerate_occupations(
+    ConfigEnumAllOccupations &enumerator) {
+  std::vector<Eigen::VectorXi> result;
+  for (auto const &configuration : enumerator) {
+    result.push_back(configuration.occupation());
+  }
+  std::sort(result.begin(), result.end(),
+            [](Eigen::VectorXi const &A, Eigen::VectorXi const &B) {
+              return std::lexicographical_compare(A.data(), A.data() + A.size(),
+                                                  B.data(), B.data() + B.size());
+            });
+  return result;
+}
+
+}  // namespace
+
+class CanonicalOccupationGeneratorTest : public testing::Test {
+ protected:
+  std::shared_ptr<Structure const> shared_prim;
+  ProjectSettings project_settings;
+  PrimClex primclex;
+
+  CanonicalOccupationGeneratorTest(xtal::BasicStructure const &prim)
+      : shared_prim(std::make_shared<Structure const>(prim)),
+        project_settings(make_default_project_settings(
+            *shared_prim, shared_prim->structure().title())),
+        primclex(project_settings, shared_prim) {
+    xtal::ScelEnumProps scel_enum_props{1, 6};
+    ScelEnumByProps supercell_enumerator{shared_prim, scel_enum_props};
+    for (auto const &supercell : supercell_enumerator) {
+      supercell.set_primclex(&primclex);
+      make_canonical_and_insert(supercell_enumerator, supercell,
+                                primclex.db<Supercell>());
+    }
+  }
+
+  /// Check that orderly generation enumerates the same configurations as
+  /// checking every occupation
+  void check_same_configurations() {
+    for (auto const &supercell : primclex.db<Supercell>()) {
+      for (bool primitive_only : {true, false}) {
+        ConfigEnumInput input{supercell};
+        ConfigEnumAllOccupations expected_enumerator{input, primitive_only,
+                                                     true};
+        ConfigEnumAllOccupations orderly_enumerator{input, primitive_only,
+                                                    true, 1, true};
+        EXPECT_FALSE(expected_enumerator.is_orderly());
+        EXPECT_TRUE(orderly_enumerator.is_orderly());
+
+        auto expected = enumerate_occupations(expected_enumerator);
+        auto found = enumerate_occupations(orderly_enumerator);
+        EXPECT_GT(found.size(), 0);
+        EXPECT_EQ(found, expected) << supercell.name();
+      }
+    }
+  }
+};
+
+class CanonicalOccupationGeneratorZrOTest
+    : public CanonicalOccupationGeneratorTest {
+ protected:
+  CanonicalOccupationGeneratorZrOTest()
+      : CanonicalOccupationGeneratorTest(test::ZrO_prim()) {}
+};
+
+TEST_F(CanonicalOccupationGeneratorZrOTest, SameConfigurations) {
+  check_same_configurations();
+}
+
+TEST_F(CanonicalOccupationGeneratorZrOTest, SubsetOfSites) {
+  // enumerate on the first half of the sites of each supercell, with the
+  // remaining sites occupied by O
+  for (auto const &supercell : primclex.db<Supercell>()) {
+    Configuration configuration{supercell};
+    Eigen::VectorXi max_allowed = supercell.max_allowed_occupation();
+    std::set<Index> sites;
+    for (Index l = 0; l < configuration.size(); ++l) {
+      configuration.set_occ(l, max_allowed[l]);
+      if (l < configuration.size() / 2) {
+        sites.insert(l);
+      }
+    }
+    ConfigEnumInput input{configuration, sites};
+    ConfigEnumAllOccupations expected_enumerator{input, false, true};
+    ConfigEnumAllOccupations orderly_enumerator{input, false, true, 1, true};
+    EXPECT_TRUE(orderly_enumerator.is_orderly());
+    EXPECT_EQ(enumerate_occupations(orderly_enumerator),
+              enumerate_occupations(expected_enumerator))
+        << supercell.name();
+  }
+}
+
+TEST_F(CanonicalOccupationGeneratorZrOTest, Generator) {
+  // generated occupations are canonical, unique, and in lexicographic order
+  for (auto const &supercell : primclex.db<Supercell>()) {
+    Eigen::VectorXi max_allowed = supercell.max_allowed_occupation();
+    CanonicalOccupationGenerator generator{
+        Eigen::VectorXi::Zero(max_allowed.size()), max_allowed,
+        supercell.sym_info().permute_begin(),
+        supercell.sym_info().permute_end()};
+    std::vector<std::vector<int>> found;
+    while (generator.valid()) {
+      Configuration configuration{supercell};
+      for (Index l = 0; l < configuration.size(); ++l) {
+        configuration.set_occ(l, generator.occupation()[l]);
+      }
+      EXPECT_TRUE(configuration.is_canonical());
+      found.push_back(generator.occupation());
+      generator.next();
+    }
+    EXPECT_GT(found.size(), 0);
+    EXPECT_TRUE(std::is_sorted(found.begin(), found.end()));
+    EXPECT_TRUE(std::adjacent_find(found.begin(), found.end()) == found.end());
+  }
+}
+
+class CanonicalOccupationGeneratorFCCTernaryTest
+    : public CanonicalOccupationGeneratorTest {
+ protected:
+  CanonicalOccupationGeneratorFCCTernaryTest()
+      : CanonicalOccupationGeneratorTest(test::FCC_ternary_prim()) {}
+};
+
+TEST_F(CanonicalOccupationGeneratorFCCTernaryTest, SameConfigurations) {
+  check_same_configurations();
+}
@@ -228,6 +228,30 @@ TEST_F(ConfigEnumAllOccupationsTest, TestClusterSites2) {
   check(initial_state, expected_configurations_size, expected_occ_histogram);
 }
 
+TEST_F(ConfigEnumAllOccupationsTest, TestThreads) {
+  // checking candidates in parallel should not change the enumeration
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 2, 0, 0, 0, 2;
+  Supercell supercell{shared_prim, T};
+  ConfigEnumInput initial_state{supercell};
+
+  ConfigEnumAllOccupations serial_enumerator{initial_state, true, true};
+  std::vector<Configuration> expected{serial_enumerator.begin(),
+                                      serial_enumerator.end()};
+  EXPECT_EQ(expected.size(), 585);
+
+  ConfigEnumAllOccupations parallel_enumerator{initial_state, true, true, 4};
+  Index count = 0;
+  for (auto it = parallel_enumerator.begin(); it != parallel_enumerator.end();
+       ++it) {
+    ASSERT_LT(count, expected.size());
+    EXPECT_EQ(it.step(), count);
+    EXPECT_EQ(it->occupation(), expected[count].occupation());
+    ++count;
+  }
+  EXPECT_EQ(count, expected.size());
+}
+
 // // TODO: move to database/ConfigDatabase integration tests
 // TEST(ConfigEnumAllOccupationsTest, TestWithDatabase) {
 //
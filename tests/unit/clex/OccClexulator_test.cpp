@@ -162,6 +162,56 @@ TEST_F(OccClexulatorZrOTest, CorrelationsTest) {
                                   clexulator);
 }
 
+TEST_F(OccClexulatorZrOTest, BatchedDeltaCorrelationsTest) {
+  // Configuration w/ 1 O, 4x4x4 supercell
+  auto supercell = std::make_shared<CASM::Supercell>(
+      shared_prim, Eigen::Matrix3l::Identity() * 4);
+  supercell->set_primclex(primclex_ptr.get());
+  CASM::Configuration configuration{supercell};
+  Index l_O = 2 * 64;
+  Index l_Va = 3 * 64 + 21;
+  configuration.set_occ(l_O, 1);  // O
+
+  ConfigDoF &configdof = configuration.configdof();
+  SuperNeighborList const &nlist = supercell->nlist();
+  ASSERT_FALSE(nlist.overlaps());
+
+  Clexulator clexulator = primclex_ptr->clexulator(basis_set_name);
+  std::vector<unsigned int> corr_indices;
+  for (Index i = 0; i < clexulator.corr_size(); i++) {
+    corr_indices.push_back(i);
+  }
+
+  // swap O and Va
+  clexulator::OccDelta delta[2];
+  delta[0].nlist_begin = nlist.sites(nlist.unitcell_index(l_O)).data();
+  delta[0].neighbor_ind = nlist.neighbor_index(l_O);
+  delta[0].occ_i = 1;
+  delta[0].occ_f = 0;
+  delta[1].nlist_begin = nlist.sites(nlist.unitcell_index(l_Va)).data();
+  delta[1].neighbor_ind = nlist.neighbor_index(l_Va);
+  delta[1].occ_i = 0;
+  delta[1].occ_f = 1;
+
+  Eigen::VectorXd dcorr = Eigen::VectorXd::Zero(clexulator.corr_size());
+  clexulator.calc_restricted_delta_point_corr(
+      configdof, delta, delta + 2, dcorr.data(), end_ptr(dcorr),
+      corr_indices.data(), end_ptr(corr_indices));
+
+  // occupation is restored
+  EXPECT_EQ(configdof.occ(l_O), 1);
+  EXPECT_EQ(configdof.occ(l_Va), 0);
+
+  Eigen::VectorXd corr_before;
+  extensive_correlations(corr_before, configdof, nlist, clexulator);
+  configdof.occ(l_O) = 0;
+  configdof.occ(l_Va) = 1;
+  Eigen::VectorXd corr_after;
+  extensive_correlations(corr_after, configdof, nlist, clexulator);
+
+  EXPECT_TRUE(almost_equal(dcorr, Eigen::VectorXd(corr_after - corr_before)));
+}
+
 class LocalOccClexulatorZrOTest : public test::ProjectBaseTest {
  protected:
   static std::string clex_basis_specs_str();
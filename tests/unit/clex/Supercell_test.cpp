@@ -45,6 +45,48 @@ TEST(SupercellTest, ConstructorFail) {
   ASSERT_ANY_THROW(std::make_shared<Supercell const>(shared_prim, T));
 }
 
+TEST(SupercellTest, TranslationPermutations) {
+  // translation permutations are evaluated on the fly; check them against
+  // explicitly constructed permutations: perm[new_site] = old_site, where
+  // new_site = old_site + translation
+
+  auto shared_prim = std::make_shared<Structure const>(test::ZrO_prim());
+  Eigen::Matrix3l T;
+  T << 2, 1, 0, -1, 2, 1, 0, 0, 3;
+  Supercell scel(shared_prim, T);
+  SupercellSymInfo const &sym_info = scel.sym_info();
+  auto const &bijk_converter = sym_info.unitcellcoord_index_converter();
+  auto const &ijk_converter = sym_info.unitcell_index_converter();
+
+  Index n_translations = sym_info.translation_permutations_size();
+  Index n_sites = bijk_converter.total_sites();
+  EXPECT_EQ(n_translations, T.determinant());
+  EXPECT_EQ(n_sites, shared_prim->basis().size() * T.determinant());
+
+  std::vector<Permutation> translation_permutations =
+      sym_info.translation_permutations();
+  ASSERT_EQ(translation_permutations.size(), n_translations);
+  for (Index t = 0; t < n_translations; ++t) {
+    std::vector<Index> expected(n_sites, -1);
+    for (Index old_l = 0; old_l < n_sites; ++old_l) {
+      Index new_l = bijk_converter(bijk_converter(old_l) + ijk_converter(t));
+      expected[new_l] = old_l;
+    }
+    for (Index l = 0; l < n_sites; ++l) {
+      EXPECT_EQ(sym_info.translation_permute_ind(t, l), expected[l]);
+      EXPECT_EQ(translation_permutations[t][l], expected[l]);
+    }
+  }
+
+  // combined permutations are consistent with permute_ind
+  for (auto it = sym_info.permute_begin(); it != sym_info.permute_end(); ++it) {
+    Permutation combined = it.combined_permute();
+    for (Index l = 0; l < n_sites; ++l) {
+      EXPECT_EQ(combined[l], it.permute_ind(l));
+    }
+  }
+}
+
 TEST(SupercellTest, TestSupercellName) {
   ScopedNullLogging logging;
   test::FCCTernaryProj proj;
@@ -0,0 +1,388 @@
+#include "casm/clex/TableClexulator.hh"
+
+#include <chrono>
+#include <random>
+
+#include "ProjectBaseTest.hh"
+#include "casm/casm_io/Log.hh"
+#include "casm/clex/ClexBasisSpecs.hh"
+#include "casm/clex/Clexulator.hh"
+#include "casm/clex/ConfigCorrelations.hh"
+#include "casm/clex/Configuration.hh"
+#include "casm/clex/PrimClex_impl.hh"
+#include "casm/clex/Supercell.hh"
+#include "casm/misc/CASM_Eigen_math.hh"
+#include "casm/misc/parallel.hh"
+#include "crystallography/TestStructures.hh"
+#include "gtest/gtest.h"
+
+using namespace CASM;
+
+namespace {
+
+// Generated clexulator coefficients are written with limited precision
+double const corr_tol = 1e-5;
+
+/// Set random occupation values
+void set_random_occupation(Configuration &configuration, std::mt19937 &rng) {
+  auto const &basis = configuration.supercell().prim().basis();
+  for (Index l = 0; l < configuration.size(); ++l) {
+    int n_occupants = basis[configuration.sublat(l)].occupant_dof().size();
+    std::uniform_int_distribution<int> dist(0, n_occupants - 1);
+    configuration.set_occ(l, dist(rng));
+  }
+}
+
+/// Check that generated and table clexulators evaluate the same correlations
+void check_table_clexulator(Configuration &configuration,
+                            Clexulator const &generated,
+                            Clexulator const &table) {
+  ASSERT_EQ(table.corr_size(), generated.corr_size());
+  ASSERT_EQ(table.nlist_size(), generated.nlist_size());
+  ASSERT_EQ(table.n_point_corr(), generated.n_point_corr());
+  EXPECT_EQ(table.neighborhood(), generated.neighborhood());
+  for (Index i = 0; i < table.corr_size(); ++i) {
+    EXPECT_EQ(table.site_neighborhood(i), generated.site_neighborhood(i));
+  }
+
+  // correlations and point correlations
+  EXPECT_TRUE(almost_equal(correlations(configuration, table),
+                           correlations(configuration, generated), corr_tol));
+  EXPECT_TRUE(almost_equal(all_point_corr(configuration, table),
+                           all_point_corr(configuration, generated),
+                           corr_tol));
+
+  // delta correlations, for every site and occupant
+  ConfigDoF const &configdof = configuration.configdof();
+  SuperNeighborList const &nlist = configuration.supercell().nlist();
+  auto const &basis = configuration.supercell().prim().basis();
+  std::vector<unsigned int> corr_indices;
+  for (Index i = 0; i < table.corr_size(); i++) {
+    corr_indices.push_back(i);
+  }
+  Eigen::VectorXd table_dcorr;
+  Eigen::VectorXd generated_dcorr;
+  for (Index l = 0; l < configuration.size(); ++l) {
+    int n_occupants = basis[configuration.sublat(l)].occupant_dof().size();
+    for (int new_occ = 0; new_occ < n_occupants; ++new_occ) {
+      restricted_delta_corr(table_dcorr, l, new_occ, configdof, nlist, table,
+                            corr_indices.data(), end_ptr(corr_indices));
+      restricted_delta_corr(generated_dcorr, l, new_occ, configdof, nlist,
+                            generated, corr_indices.data(),
+                            end_ptr(corr_indices));
+      EXPECT_TRUE(almost_equal(table_dcorr, generated_dcorr, corr_tol));
+    }
+  }
+}
+
+}  // namespace
+
+class TableClexulatorZrOTest : public test::ProjectBaseTest {
+ protected:
+  static std::string clex_basis_specs_str();
+
+  TableClexulatorZrOTest()
+      : test::ProjectBaseTest(test::ZrO_prim(), "TableClexulatorZrOTest",
+                              jsonParser::parse(clex_basis_specs_str())),
+        shared_supercell(std::make_shared<CASM::Supercell>(
+            shared_prim, Eigen::Matrix3l::Identity() * 4)) {
+    this->write_basis_set_data();
+    this->make_clexulator();
+    shared_supercell->set_primclex(primclex_ptr.get());
+  }
+
+  Clexulator make_table() {
+    return make_table_clexulator(
+        "TableClexulatorZrOTest_table", shared_prim,
+        primclex_ptr->basis_set_specs(basis_set_name), primclex_ptr->nlist());
+  }
+
+  // 4x4x4 supercell
+  std::shared_ptr<CASM::Supercell> shared_supercell;
+};
+
+TEST_F(TableClexulatorZrOTest, CompareToGenerated) {
+  Clexulator generated = primclex_ptr->clexulator(basis_set_name);
+  Clexulator table = make_table();
+  EXPECT_TRUE(table.initialized());
+  EXPECT_EQ(table.name(), "TableClexulatorZrOTest_table");
+
+  std::mt19937 rng(0);
+  for (Index i = 0; i < 3; ++i) {
+    CASM::Configuration configuration{shared_supercell};
+    set_random_occupation(configuration, rng);
+    check_table_clexulator(configuration, generated, table);
+  }
+}
+
+TEST_F(TableClexulatorZrOTest, BatchedDeltaCorrelations) {
+  CASM::Configuration configuration{shared_supercell};
+  Index l_O = 2 * 64;
+  Index l_Va = 3 * 64 + 21;
+  configuration.set_occ(l_O, 1);  // O
+
+  ConfigDoF &configdof = configuration.configdof();
+  SuperNeighborList const &nlist = shared_supercell->nlist();
+  ASSERT_FALSE(nlist.overlaps());
+
+  Clexulator generated = primclex_ptr->clexulator(basis_set_name);
+  Clexulator table = make_table();
+  std::vector<unsigned int> corr_indices;
+  for (Index i = 0; i < table.corr_size(); i++) {
+    corr_indices.push_back(i);
+  }
+
+  // swap O and Va
+  clexulator::OccDelta delta[2];
+  delta[0].nlist_begin = nlist.sites(nlist.unitcell_index(l_O)).data();
+  delta[0].neighbor_ind = nlist.neighbor_index(l_O);
+  delta[0].occ_i = 1;
+  delta[0].occ_f = 0;
+  delta[1].nlist_begin = nlist.sites(nlist.unitcell_index(l_Va)).data();
+  delta[1].neighbor_ind = nlist.neighbor_index(l_Va);
+  delta[1].occ_i = 0;
+  delta[1].occ_f = 1;
+
+  Eigen::VectorXd table_dcorr = Eigen::VectorXd::Zero(table.corr_size());
+  table.calc_restricted_delta_point_corr(
+      configdof, delta, delta + 2, table_dcorr.data(), end_ptr(table_dcorr),
+      corr_indices.data(), end_ptr(corr_indices));
+
+  // occupation is restored
+  EXPECT_EQ(configdof.occ(l_O), 1);
+  EXPECT_EQ(configdof.occ(l_Va), 0);
+
+  Eigen::VectorXd generated_dcorr = Eigen::VectorXd::Zero(table.corr_size());
+  generated.calc_restricted_delta_point_corr(
+      configdof, delta, delta + 2, generated_dcorr.data(),
+      end_ptr(generated_dcorr), corr_indices.data(), end_ptr(corr_indices));
+  EXPECT_TRUE(almost_equal(table_dcorr, generated_dcorr, corr_tol));
+}
+
+TEST_F(TableClexulatorZrOTest, EvaluationContexts) {
+  // evaluate correlations of several configurations, each in its own thread,
+  // with one loaded clexulator
+  Clexulator generated = primclex_ptr->clexulator(basis_set_name);
+  Clexulator table = make_table();
+  SuperNeighborList const &nlist = shared_supercell->nlist();
+  Index n_threads = 4;
+
+  std::mt19937 rng(0);
+  std::vector<Configuration> configurations;
+  for (Index i = 0; i < 8; ++i) {
+    configurations.emplace_back(shared_supercell);
+    set_random_occupation(configurations.back(), rng);
+  }
+
+  for (Clexulator const *clex : {&generated, &table}) {
+    std::vector<clexulator::EvaluationContext> contexts(n_threads,
+                                                        clex->make_context());
+    std::vector<Eigen::VectorXd> corr(configurations.size());
+    parallel_for_each_thread(
+        configurations.size(), n_threads, [&](Index i, Index thread_index) {
+          ConfigDoF const &configdof = configurations[i].configdof();
+          Eigen::VectorXd tcorr(clex->corr_size());
+          corr[i] = Eigen::VectorXd::Zero(clex->corr_size());
+          for (Index l = 0; l < nlist.n_unitcells(); ++l) {
+            clex->calc_global_corr_contribution(
+                contexts[thread_index], configdof, nlist.sites(l).data(),
+                end_ptr(nlist.sites(l)), tcorr.data(), end_ptr(tcorr));
+            corr[i] += tcorr;
+          }
+          corr[i] /= (double)nlist.n_unitcells();
+        });
+
+    for (Index i = 0; i < configurations.size(); ++i) {
+      EXPECT_TRUE(
+          almost_equal(corr[i], correlations(configurations[i], *clex)));
+    }
+  }
+
+  // a context may only be used with the clexulator it was constructed for
+  clexulator::EvaluationContext context = generated.make_context();
+  Eigen::VectorXd tcorr(table.corr_size());
+  EXPECT_THROW(table.calc_global_corr_contribution(
+                   context, configurations[0].configdof(),
+                   nlist.sites(0).data(), end_ptr(nlist.sites(0)),
+                   tcorr.data(), end_ptr(tcorr)),
+               std::runtime_error);
+}
+
+TEST_F(TableClexulatorZrOTest, ParallelCorrelations) {
+  // 11x11x11 supercell, which is evaluated in more than one block of unit
+  // cells
+  auto large_supercell = std::make_shared<CASM::Supercell>(
+      shared_prim, Eigen::Matrix3l::Identity() * 11);
+  large_supercell->set_primclex(primclex_ptr.get());
+  CASM::Configuration configuration{large_supercell};
+  std::mt19937 rng(0);
+  set_random_occupation(configuration, rng);
+
+  Clexulator table = make_table();
+  ConfigDoF const &configdof = configuration.configdof();
+  SuperNeighborList const &nlist = large_supercell->nlist();
+  std::vector<unsigned int> corr_indices{0, 2, 5};
+
+  Eigen::VectorXd corr = correlations(configuration, table);
+  Eigen::VectorXd restricted_corr;
+  restricted_correlations(restricted_corr, configdof, nlist, table,
+                          corr_indices.data(), end_ptr(corr_indices));
+  Eigen::MatrixXd contributions = all_corr_contribution(configuration, table);
+  Eigen::MatrixXd point_correlations = all_point_corr(configuration, table);
+  EXPECT_TRUE(
+      almost_equal(Eigen::VectorXd(contributions.colwise().mean()), corr));
+  for (Index l = 0; l < nlist.n_unitcells(); l += 97) {
+    EXPECT_TRUE(almost_equal(Eigen::VectorXd(point_correlations.row(l)),
+                             point_corr(l, 0, configuration, table)));
+  }
+
+  // results do not depend on the number of threads
+  for (Index n_threads : {2, 4}) {
+    EXPECT_EQ(correlations(configuration, table, n_threads), corr);
+    Eigen::VectorXd _restricted_corr;
+    restricted_correlations(_restricted_corr, configdof, nlist, table,
+                            corr_indices.data(), end_ptr(corr_indices),
+                            n_threads);
+    for (unsigned int i : corr_indices) {
+      EXPECT_EQ(_restricted_corr(i), restricted_corr(i));
+      EXPECT_TRUE(almost_equal(_restricted_corr(i), corr(i)));
+    }
+    EXPECT_EQ(all_corr_contribution(configuration, table, n_threads),
+              contributions);
+    EXPECT_EQ(all_point_corr(configuration, table, n_threads),
+              point_correlations);
+  }
+}
+
+/// Compare the time to evaluate delta correlations, as in Monte Carlo, using
+/// the generated and table clexulators
+TEST_F(TableClexulatorZrOTest, Benchmark) {
+  Clexulator generated = primclex_ptr->clexulator(basis_set_name);
+  Clexulator table = make_table();
+
+  CASM::Configuration configuration{shared_supercell};
+  std::mt19937 rng(0);
+  set_random_occupation(configuration, rng);
+  ConfigDoF const &configdof = configuration.configdof();
+  SuperNeighborList const &nlist = shared_supercell->nlist();
+  auto const &basis = shared_prim->basis();
+
+  std::vector<unsigned int> corr_indices;
+  for (Index i = 0; i < table.corr_size(); i++) {
+    corr_indices.push_back(i);
+  }
+
+  // choose the same proposed events for both
+  Index n_events = 20000;
+  std::vector<std::pair<Index, int> > events;
+  std::uniform_int_distribution<Index> site_dist(0, configuration.size() - 1);
+  for (Index i = 0; i < n_events; ++i) {
+    Index l = site_dist(rng);
+    int n_occupants = basis[configuration.sublat(l)].occupant_dof().size();
+    std::uniform_int_distribution<int> occ_dist(0, n_occupants - 1);
+    events.emplace_back(l, occ_dist(rng));
+  }
+
+  auto time_delta_corr = [&](Clexulator const &clexulator, double &sum) {
+    Eigen::VectorXd dcorr;
+    sum = 0.0;
+    auto start = std::chrono::steady_clock::now();
+    for (auto const &event : events) {
+      restricted_delta_corr(dcorr, event.first, event.second, configdof, nlist,
+                            clexulator, corr_indices.data(),
+                            end_ptr(corr_indices));
+      sum += dcorr.sum();
+    }
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+  };
+
+  double generated_sum, table_sum;
+  double generated_time = time_delta_corr(generated, generated_sum);
+  double table_time = time_delta_corr(table, table_sum);
+
+  EXPECT_TRUE(almost_equal(table_sum, generated_sum, corr_tol * n_events));
+
+  log() << "TableClexulator benchmark (" << n_events
+        << " delta correlation evaluations, " << table.corr_size()
+        << " correlations):" << std::endl;
+  log() << "  generated: " << generated_time << " s" << std::endl;
+  log() << "  table:     " << table_time << " s" << std::endl;
+}
+
+class TableClexulatorFCCTest : public test::ProjectBaseTest {
+ protected:
+  static std::string clex_basis_specs_str();
+
+  TableClexulatorFCCTest()
+      : test::ProjectBaseTest(test::FCC_ternary_prim(),
+                              "TableClexulatorFCCTest",
+                              jsonParser::parse(clex_basis_specs_str())),
+        shared_supercell(std::make_shared<CASM::Supercell>(
+            shared_prim, Eigen::Matrix3l::Identity() * 3)) {
+    this->write_basis_set_data();
+    this->make_clexulator();
+    shared_supercell->set_primclex(primclex_ptr.get());
+  }
+
+  // 3x3x3 supercell
+  std::shared_ptr<CASM::Supercell> shared_supercell;
+};
+
+TEST_F(TableClexulatorFCCTest, CompareToGenerated) {
+  Clexulator generated = primclex_ptr->clexulator(basis_set_name);
+  Clexulator table = make_table_clexulator(
+      "TableClexulatorFCCTest_table", shared_prim,
+      primclex_ptr->basis_set_specs(basis_set_name), primclex_ptr->nlist());
+
+  std::mt19937 rng(0);
+  for (Index i = 0; i < 3; ++i) {
+    CASM::Configuration configuration{shared_supercell};
+    set_random_occupation(configuration, rng);
+    check_table_clexulator(configuration, generated, table);
+  }
+}
+
+std::string TableClexulatorZrOTest::clex_basis_specs_str() {
+  return R"({
+"basis_function_specs" : {
+"dof_specs": {
+  "occ": {
+    "site_basis_functions" : "occupation"
+  }
+}
+},
+"cluster_specs": {
+"method": "periodic_max_length",
+"params": {
+  "orbit_branch_specs" : {
+    "2" : {"max_length" : 6.01},
+    "3" : {"max_length" : 4.14},
+    "4" : {"max_length" : 4.14}
+  }
+}
+}
+})";
+}
+
+std::string TableClexulatorFCCTest::clex_basis_specs_str() {
+  return R"({
+"basis_function_specs" : {
+"dof_specs": {
+  "occ": {
+    "site_basis_functions" : "chebychev"
+  }
+}
+},
+"cluster_specs": {
+"method": "periodic_max_length",
+"params": {
+  "orbit_branch_specs" : {
+    "2" : {"max_length" : 4.01},
+    "3" : {"max_length" : 3.01}
+  }
+}
+}
+})";
+}
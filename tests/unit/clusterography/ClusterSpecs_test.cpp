@@ -70,6 +70,33 @@ TEST_F(ClusterSpecsTest, PeriodicTest) {
   EXPECT_EQ(orbits[2].size(), 6);
 }
 
+TEST_F(ClusterSpecsTest, PeriodicParallelTest) {
+  // orbits generated using multiple threads are identical to serial
+
+  // a = primitive FCC unit cell lattice vector length
+  double a = shared_prim->lattice()[0].norm();
+
+  std::vector<double> max_length{0, 0, 2 * a + TOL, a * sqrt(2.) + TOL,
+                                 a + TOL};
+
+  PeriodicMaxLengthClusterSpecs cluster_specs{
+      shared_prim, shared_prim->factor_group(), alloy_sites_filter, max_length};
+  auto orbits = cluster_specs.make_periodic_orbits(null_log());
+  EXPECT_EQ(orbits.back().prototype().size(), 4);
+
+  for (Index n_threads : {2, 4}) {
+    cluster_specs.n_threads = n_threads;
+    auto parallel_orbits = cluster_specs.make_periodic_orbits(null_log());
+    ASSERT_EQ(parallel_orbits.size(), orbits.size());
+    for (Index i = 0; i < orbits.size(); ++i) {
+      EXPECT_TRUE(parallel_orbits[i].prototype().elements() ==
+                  orbits[i].prototype().elements())
+          << "n_threads: " << n_threads << " orbit: " << i;
+      EXPECT_EQ(parallel_orbits[i].size(), orbits[i].size());
+    }
+  }
+}
+
 TEST_F(ClusterSpecsTest, ScelPeriodicTest) {
   // Make "scel_periodic" orbit generators from "prim_periodic" orbits
 
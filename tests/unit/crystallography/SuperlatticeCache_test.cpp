@@ -0,0 +1,109 @@
+#include "Common.hh"
+#include "gtest/gtest.h"
+
+/// What is being tested:
+#include "casm/crystallography/SuperlatticeCache.hh"
+#include "casm/crystallography/io/SuperlatticeCacheIO.hh"
+
+/// What is being used to test it:
+#include <thread>
+
+#include "casm/casm_io/json/jsonParser.hh"
+#include "casm/crystallography/CanonicalForm.hh"
+#include "casm/crystallography/SuperlatticeEnumerator.hh"
+#include "casm/crystallography/SymTools.hh"
+#include "casm/misc/CASM_Eigen_math.hh"
+
+using namespace CASM;
+using xtal::Lattice;
+using xtal::SuperlatticeCache;
+
+namespace {
+
+// check that lattices are the same, in the same order
+void check_equal(std::vector<Lattice> const &A, std::vector<Lattice> const &B) {
+  ASSERT_EQ(A.size(), B.size());
+  for (Index i = 0; i < Index(A.size()); ++i) {
+    EXPECT_TRUE(almost_equal(A[i].lat_column_mat(), B[i].lat_column_mat()));
+  }
+}
+
+}  // namespace
+
+TEST(SuperlatticeCacheTest, Test1) {
+  Lattice lat = Lattice::fcc();
+  auto pg = xtal::make_point_group(lat);
+  SuperlatticeCache cache(lat, pg);
+  EXPECT_FALSE(cache.modified());
+
+  // same number of superlattices as enumerated directly, all canonical
+  // superlattices of the parent
+  xtal::SuperlatticeEnumerator enumerator(pg.begin(), pg.end(), lat,
+                                          xtal::ScelEnumProps(4, 5));
+  Index count = std::distance(enumerator.begin(), enumerator.end());
+  std::vector<Lattice> lattices = cache.lattices_of_vol(4);
+  EXPECT_EQ(lattices.size(), count);
+  for (Lattice const &superlat : lattices) {
+    EXPECT_TRUE(xtal::is_superlattice(superlat, lat, TOL).first);
+    EXPECT_EQ(std::round(superlat.volume() / lat.volume()), 4);
+  }
+  EXPECT_TRUE(cache.modified());
+
+  // same result when used from multiple threads
+  std::vector<std::vector<Lattice> > thread_lattices(4);
+  std::vector<std::thread> threads;
+  for (Index i = 0; i < Index(thread_lattices.size()); ++i) {
+    threads.emplace_back(
+        [&, i]() { thread_lattices[i] = cache.lattices_of_vol(4 + i % 2); });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  check_equal(thread_lattices[0], lattices);
+  check_equal(thread_lattices[2], lattices);
+  check_equal(thread_lattices[1], thread_lattices[3]);
+  EXPECT_EQ(cache.transformation_matrices().size(), 2);
+
+  // the key depends on the parent lattice and point group
+  EXPECT_EQ(SuperlatticeCache(lat, pg).key(), cache.key());
+  EXPECT_NE(SuperlatticeCache(Lattice::bcc(), pg).key(), cache.key());
+  EXPECT_NE(SuperlatticeCache(lat, {xtal::SymOp::identity()}).key(),
+            cache.key());
+}
+
+TEST(SuperlatticeCacheTest, IOTest) {
+  test::TmpDir tmp_dir;
+  fs::path cache_path = tmp_dir.path() / "superlattice_cache.json";
+
+  Lattice lat = Lattice::fcc();
+  auto pg = xtal::make_point_group(lat);
+  SuperlatticeCache cache(lat, pg);
+  std::vector<Lattice> lattices = cache.lattices_of_vol(6);
+
+  // JSON round trip
+  jsonParser json;
+  to_json(cache, json);
+  SuperlatticeCache cache_b(lat, pg);
+  from_json(cache_b, json);
+  EXPECT_FALSE(cache_b.modified());
+  EXPECT_EQ(cache_b.transformation_matrices(), cache.transformation_matrices());
+  check_equal(cache_b.lattices_of_vol(6), lattices);
+  EXPECT_FALSE(cache_b.modified());
+
+  // File round trip; a cache for another parent lattice is kept
+  SuperlatticeCache other_cache(Lattice::bcc(), pg);
+  other_cache.lattices_of_vol(2);
+  EXPECT_FALSE(read_superlattice_cache(cache_b, cache_path));
+  write_superlattice_cache(cache, cache_path);
+  EXPECT_FALSE(cache.modified());
+  write_superlattice_cache(other_cache, cache_path);
+
+  SuperlatticeCache cache_c(lat, pg);
+  EXPECT_TRUE(read_superlattice_cache(cache_c, cache_path));
+  check_equal(cache_c.lattices_of_vol(6), lattices);
+  EXPECT_FALSE(cache_c.modified());
+
+  SuperlatticeCache other_cache_c(Lattice::bcc(), pg);
+  EXPECT_TRUE(read_superlattice_cache(other_cache_c, cache_path));
+  EXPECT_EQ(other_cache_c.transformation_matrices().size(), 1);
+}
@@ -244,3 +244,25 @@ TEST(SuperlatticeEnumeratorTest, RestrictedEnumeration) {
   trans_enum_test();
   restricted_test();
 }
+
+TEST(SuperlatticeEnumeratorTest, ParallelMatrices) {
+  std::vector<Lattice> all_test_lats;
+  all_test_lats.push_back(Lattice::fcc());
+  all_test_lats.push_back(Lattice::hexagonal());
+
+  for (Index t = 0; t < all_test_lats.size(); t++) {
+    Lattice testlat = all_test_lats[t];
+    std::vector<xtal::SymOp> pg = xtal::make_point_group(testlat);
+
+    ScelEnumProps enum_props(2, 8 + 1);
+    SuperlatticeEnumerator enumerator(testlat, pg, enum_props);
+
+    std::vector<Eigen::Matrix3i> serial;
+    for (auto it = enumerator.begin(); it != enumerator.end(); ++it) {
+      serial.push_back(it.matrix());
+    }
+
+    EXPECT_EQ(enumerator.matrices(), serial);
+    EXPECT_EQ(enumerator.matrices(4), serial);
+  }
+}
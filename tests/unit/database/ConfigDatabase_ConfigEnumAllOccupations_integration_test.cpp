@@ -49,3 +49,54 @@ TEST(ConfigDatabase_ConfigEnumAllOccupations_IntegrationTest, Test1) {
   EXPECT_EQ(number_enumerated.size(), number_expected.size());
   EXPECT_EQ(number_enumerated, number_expected);
 }
+
+TEST(ConfigDatabase_ConfigEnumAllOccupations_IntegrationTest, TestThreads) {
+  // batched insertion, using threads, gives the same database as inserting
+  // one configuration at a time
+
+  auto shared_prim = std::make_shared<Structure const>(test::ZrO_prim());
+  auto title = shared_prim->structure().title();
+  auto project_settings = make_default_project_settings(*shared_prim, title);
+  PrimClex serial_primclex{project_settings, shared_prim};
+  PrimClex parallel_primclex{project_settings, shared_prim};
+
+  xtal::ScelEnumProps scel_enum_props{1, 4};
+  ScelEnumByProps supercell_enumerator{shared_prim, scel_enum_props};
+  for (auto const &supercell : supercell_enumerator) {
+    supercell.set_primclex(&serial_primclex);
+    make_canonical_and_insert(supercell_enumerator, supercell,
+                              serial_primclex.db<Supercell>());
+  }
+
+  for (bool primitive_only : {true, false}) {
+    for (auto const &supercell : serial_primclex.db<Supercell>()) {
+      // include non-primitive and non-canonical configurations
+      ConfigEnumAllOccupations enumerator{supercell, false, false};
+      std::vector<Configuration> batch;
+      for (auto const &configuration : enumerator) {
+        make_canonical_and_insert(configuration,
+                                  serial_primclex.db<Supercell>(),
+                                  serial_primclex.db<Configuration>(),
+                                  primitive_only);
+        batch.push_back(configuration);
+      }
+      auto results = make_canonical_and_insert(
+          batch, parallel_primclex.db<Supercell>(),
+          parallel_primclex.db<Configuration>(), primitive_only, 4);
+      EXPECT_EQ(results.size(), batch.size());
+    }
+  }
+
+  std::vector<std::string> expected;
+  for (auto const &configuration : serial_primclex.db<Configuration>()) {
+    expected.push_back(configuration.name());
+  }
+  std::vector<std::string> found;
+  for (auto const &configuration : parallel_primclex.db<Configuration>()) {
+    found.push_back(configuration.name());
+  }
+  EXPECT_GT(expected.size(), 0);
+  EXPECT_EQ(found, expected);
+  EXPECT_EQ(parallel_primclex.db<Supercell>().size(),
+            serial_primclex.db<Supercell>().size());
+}
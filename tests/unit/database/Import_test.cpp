@@ -263,3 +263,49 @@ TEST_F(ImportTest, Test3) {
   // should import properties for original size configurations only
   EXPECT_EQ(primclex->db_props<Configuration>("default").size(), 1);
 }
+
+/// This test includes:
+/// - "n_threads": 2, with the same settings and results as Test2
+TEST_F(ImportTest, ParallelTest) {
+  // ## setup
+  title = "ImportTest_parallel";
+  data_dir = test::data_dir("database") / "import_test2";
+  data_files = std::vector<fs::path>(
+      {"AB_Ordering_large_supercell.json", "import_list.txt", "import.json",
+       "prim.json", "pure_A_large_supercell.json"});
+  build();
+
+  // ## run import
+  std::string cli_str =
+      "casm import --batch " + (tmp_dir.path() / "import_list.txt").string();
+  jsonParser json_options{tmp_dir.path() / "import.json"};
+  json_options["n_threads"] = 2;
+  import(cli_str, json_options);
+
+  // ## post-condition tests
+
+  fs::path report_dir = tmp_dir.path() / "reports" / "import_report.0";
+  fs::path map_fail_report = report_dir / "map_fail.json";
+  fs::path map_success_report = report_dir / "map_success.json";
+
+  EXPECT_TRUE(fs::exists(map_success_report));
+  EXPECT_FALSE(fs::exists(map_fail_report));
+
+  // configurations are inserted in input order, so names do not depend on the
+  // number of threads
+  jsonParser map_success_json{map_success_report};
+  EXPECT_EQ(map_success_json.size(), 3);
+
+  auto it = test::find_mapped(map_success_json, "SCEL54_6_3_3_0_3_3/0");
+  EXPECT_TRUE(it != map_success_json.end());
+
+  it = test::find_mapped(map_success_json, "SCEL54_6_3_3_0_3_3/1");
+  EXPECT_TRUE(it != map_success_json.end());
+
+  it = test::find_mapped(map_success_json, "SCEL1_1_1_1_0_0_0/0");
+  EXPECT_TRUE(it != map_success_json.end());
+
+  EXPECT_EQ(primclex->db<Supercell>().size(), 2);
+  EXPECT_EQ(primclex->db<Configuration>().size(), 3);
+  EXPECT_EQ(primclex->db_props<Configuration>("default").size(), 2);
+}
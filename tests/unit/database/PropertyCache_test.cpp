@@ -0,0 +1,125 @@
+#include "gtest/gtest.h"
+
+/// What is being tested:
+#include "casm/database/PropertyCache.hh"
+
+/// What is being used to test it:
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+#include "casm/clexulator/ConfigDoFValues.hh"
+
+using namespace CASM;
+
+namespace {
+
+fs::path make_cache_dir() {
+  fs::path dir = fs::temp_directory_path() /
+                 fs::unique_path("PropertyCache_test_%%%%-%%%%-%%%%");
+  fs::create_directories(dir);
+  return dir;
+}
+
+}  // namespace
+
+TEST(PropertyCacheTest, InsertFindCommit) {
+  fs::path dir = make_cache_dir();
+  fs::path path = dir / "corr.bset.bin";
+  std::vector<double> a{1.0, 2.0, 3.0};
+  std::vector<double> b{4.0, 5.0, 6.0};
+
+  {
+    DB::PropertyCache cache{path, "key", 3};
+    EXPECT_EQ(cache.n_configurations(), 0);
+    EXPECT_EQ(cache.find("SCEL1_1_1_1_0_0_0/0", 1), nullptr);
+
+    cache.insert("SCEL1_1_1_1_0_0_0/0", 1, a.data());
+    cache.insert("SCEL2_2_1_1_0_0_0/0", 2, b.data());
+    EXPECT_TRUE(cache.modified());
+    ASSERT_NE(cache.find("SCEL1_1_1_1_0_0_0/0", 1), nullptr);
+    EXPECT_EQ(cache.find("SCEL1_1_1_1_0_0_0/0", 1)[2], 3.0);
+
+    // DoF hash must match
+    EXPECT_EQ(cache.find("SCEL1_1_1_1_0_0_0/0", 2), nullptr);
+
+    // replace values
+    cache.insert("SCEL1_1_1_1_0_0_0/0", 3, b.data());
+    EXPECT_EQ(cache.n_configurations(), 2);
+    EXPECT_EQ(cache.find("SCEL1_1_1_1_0_0_0/0", 1), nullptr);
+    EXPECT_EQ(cache.find("SCEL1_1_1_1_0_0_0/0", 3)[0], 4.0);
+  }
+  // written on destruction
+  EXPECT_TRUE(fs::exists(path));
+
+  {
+    DB::PropertyCache cache{path, "key", 3};
+    EXPECT_FALSE(cache.modified());
+    EXPECT_EQ(cache.n_configurations(), 2);
+    ASSERT_NE(cache.find("SCEL2_2_1_1_0_0_0/0", 2), nullptr);
+    EXPECT_EQ(std::vector<double>(cache.find("SCEL2_2_1_1_0_0_0/0", 2),
+                                  cache.find("SCEL2_2_1_1_0_0_0/0", 2) + 3),
+              b);
+  }
+
+  // a different key or size invalidates the cache
+  {
+    DB::PropertyCache cache{path, "other_key", 3};
+    EXPECT_EQ(cache.n_configurations(), 0);
+  }
+  {
+    DB::PropertyCache cache{path, "key", 2};
+    EXPECT_EQ(cache.n_configurations(), 0);
+  }
+  {
+    DB::PropertyCache cache{path, "key", 3};
+    EXPECT_EQ(cache.n_configurations(), 2);
+  }
+
+  fs::remove_all(dir);
+}
+
+TEST(PropertyCacheTest, OpenShared) {
+  fs::path dir = make_cache_dir();
+  fs::path path = dir / "clex.formation_energy.bin";
+  double value = -0.5;
+  {
+    auto cache = DB::open_property_cache(path, "key", 1);
+    auto same_cache = DB::open_property_cache(path, "key", 1);
+    EXPECT_EQ(cache, same_cache);
+    cache->insert("SCEL1_1_1_1_0_0_0/0", 1, &value);
+    EXPECT_EQ(*same_cache->find("SCEL1_1_1_1_0_0_0/0", 1), value);
+
+    auto other_cache = DB::open_property_cache(path, "other_key", 1);
+    EXPECT_NE(cache, other_cache);
+  }
+  auto cache = DB::open_property_cache(path, "key", 1);
+  EXPECT_EQ(cache->n_configurations(), 1);
+
+  fs::remove_all(dir);
+}
+
+TEST(PropertyCacheTest, Keys) {
+  clexulator::ConfigDoFValues dof_values;
+  dof_values.occupation = Eigen::VectorXi::Zero(4);
+  std::uint64_t hash = DB::dof_hash(dof_values);
+  dof_values.occupation(2) = 1;
+  EXPECT_NE(DB::dof_hash(dof_values), hash);
+  dof_values.occupation(2) = 0;
+  EXPECT_EQ(DB::dof_hash(dof_values), hash);
+  dof_values.global_dof_values["GLstrain"] = Eigen::VectorXd::Zero(6);
+  EXPECT_NE(DB::dof_hash(dof_values), hash);
+
+  fs::path dir = make_cache_dir();
+  fs::path bset = dir / "clexulator.cc";
+  fs::path eci = dir / "eci.json";
+  EXPECT_EQ(DB::make_property_cache_key({bset}), "");
+  fs::ofstream(bset) << "basis functions";
+  fs::ofstream(eci) << "eci";
+  std::string key = DB::make_property_cache_key({bset, eci});
+  EXPECT_FALSE(key.empty());
+  EXPECT_NE(key, DB::make_property_cache_key({bset}));
+  fs::ofstream(eci) << "new eci";
+  EXPECT_NE(key, DB::make_property_cache_key({bset, eci}));
+
+  fs::remove_all(dir);
+}
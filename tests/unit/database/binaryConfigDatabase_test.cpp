@@ -0,0 +1,321 @@
+#include "gtest/gtest.h"
+
+/// What is being tested:
+#include "casm/database/ConfigDatabase.hh"
+#include "casm/database/binary/binaryDatabase.hh"
+
+/// What is being used to test it:
+#include <sstream>
+
+#include "Common.hh"
+#include "FCCTernaryProj.hh"
+#include "casm/app/ProjectSettings.hh"
+#include "casm/clex/ConfigEnumAllOccupations.hh"
+#include "casm/crystallography/Structure.hh"
+#include "casm/database/ScelDatabase.hh"
+#include "casm/enumerator/ConfigEnumInput.hh"
+
+using namespace CASM;
+
+namespace {
+
+// binaryDB is ordered by supercell name, then by id
+void check_sorted(DB::Database<Configuration> const &db_config) {
+  DB::ConfigNameCompare compare;
+  auto next = db_config.begin();
+  auto it = next++;
+  auto end = db_config.end();
+  for (; next != end; ++it, ++next) {
+    EXPECT_EQ(compare(it.name(), next.name()), true);
+  }
+}
+
+}  // namespace
+
+TEST(binaryConfigDatabase_Test, Test1) {
+  // Create testing project, using binaryDB
+  test::FCCTernaryProj proj;
+  proj.check_init();
+  {
+    PrimClex primclex(proj.dir);
+    primclex.settings().set_default_database_name("binaryDB");
+    commit(primclex.settings());
+  }
+
+  ScopedNullLogging logging;
+  PrimClex primclex(proj.dir);
+  const Structure &prim(primclex.prim());
+  primclex.settings().set_crystallography_tol(1e-5);
+  EXPECT_EQ(primclex.settings().default_database_name(), "binaryDB");
+
+  // Make a Configuration database
+  DB::binaryDatabase<Configuration> db_config(primclex);
+
+  // Open database
+  db_config.open();
+  EXPECT_EQ(db_config.size(), 0);
+
+  // Create a Configuration to test
+  Eigen::Vector3d a, b, c;
+  std::tie(a, b, c) = prim.lattice().vectors();
+  Supercell tscel(&primclex, Lattice(2. * a, 2. * b, c));
+  const Supercell &scel = *tscel.insert().first;
+
+  Configuration config{scel};
+
+  // Insert a Configuration
+  auto res = db_config.insert(config);
+  EXPECT_EQ(db_config.size(), 1);
+  EXPECT_EQ(db_config.begin()->id(), "0");
+
+  // Erase a config
+  db_config.erase(res.first);
+  EXPECT_EQ(db_config.size(), 0);
+
+  // Enumerate and insert Configs
+  ConfigEnumAllOccupations enum_config(scel);
+  for (const auto &config : enum_config) {
+    if (!config.supercell().has_primclex()) {
+      config.supercell().set_primclex(&primclex);
+    }
+    db_config.insert(config);
+  }
+  primclex.db<Supercell>().commit();
+  db_config.commit();
+  EXPECT_EQ(db_config.size(), 12);
+
+  // Check that indices are not re-used
+  EXPECT_EQ(db_config.begin()->id(), "1");
+
+  // Check cached properties
+  for (const auto &config : db_config) {
+    EXPECT_EQ(config.cache().contains("multiplicity"), false);
+    EXPECT_EQ(config.multiplicity() != 0, true);
+    EXPECT_EQ(config.cache().contains("multiplicity"), true);
+  }
+  db_config.commit();
+  check_sorted(db_config);
+
+  // Close database
+  db_config.close();
+  EXPECT_EQ(db_config.size(), 0);
+
+  // Re-open database: size is available from the index
+  db_config.open();
+  EXPECT_EQ(db_config.size(), 12);
+  EXPECT_EQ(db_config.begin()->id(), "1");
+
+  // Check cached properties
+  for (const auto &config : db_config) {
+    EXPECT_EQ(config.cache().contains("multiplicity"), true);
+  }
+  check_sorted(db_config);
+
+  // Erase most configs, so that the log is compacted on commit
+  DB::binaryDB::DirectoryStructure dir(primclex.dir().root_dir());
+  auto log_size = fs::file_size(dir.obj_log<Configuration>());
+  std::string name = std::next(db_config.begin(), 5)->name();
+  Configuration erased_config = *db_config.begin();
+  while (db_config.size() > 2) {
+    auto it = db_config.begin();
+    if (it->name() == name) {
+      ++it;
+    }
+    db_config.erase(it);
+  }
+  db_config.commit();
+  EXPECT_LT(fs::file_size(dir.obj_log<Configuration>()), log_size);
+  Eigen::VectorXi occupation = db_config.find(name)->occupation();
+  db_config.close();
+
+  // Re-open database without the index, which is rebuilt from the log
+  fs::remove(dir.obj_index<Configuration>());
+  db_config.open();
+  EXPECT_EQ(db_config.size(), 2);
+  ASSERT_TRUE(db_config.find(name) != db_config.end());
+  EXPECT_EQ(db_config.find(name)->occupation(), occupation);
+  check_sorted(db_config);
+
+  // Check that indices are not re-used after rebuilding the index
+  auto reinsert_res = db_config.insert(erased_config);
+  EXPECT_EQ(reinsert_res.second, true);
+  EXPECT_EQ(reinsert_res.first->id(), "13");
+}
+
+TEST(binaryConfigDatabase_Test, CacheTest) {
+  // Create testing project, using binaryDB
+  test::FCCTernaryProj proj;
+  proj.check_init();
+  {
+    PrimClex primclex(proj.dir);
+    primclex.settings().set_default_database_name("binaryDB");
+    primclex.settings().set_database_cache_size(3);
+    commit(primclex.settings());
+  }
+
+  ScopedNullLogging logging;
+  PrimClex primclex(proj.dir);
+  const Structure &prim(primclex.prim());
+  EXPECT_EQ(primclex.settings().database_cache_size(), 3);
+
+  Eigen::Vector3d a, b, c;
+  std::tie(a, b, c) = prim.lattice().vectors();
+  Supercell tscel(&primclex, Lattice(2. * a, 2. * b, c));
+  const Supercell &scel = *tscel.insert().first;
+
+  // Enumerate and insert Configs: new Configuration stay in memory until
+  // commit
+  auto &db_config = static_cast<DB::binaryDatabase<Configuration> &>(
+      primclex.db<Configuration>());
+  EXPECT_EQ(db_config.cache_capacity(), 3);
+  ConfigEnumAllOccupations enum_config(scel);
+  std::vector<std::pair<std::string, Eigen::VectorXi> > expected;
+  for (const auto &config : enum_config) {
+    if (!config.supercell().has_primclex()) {
+      config.supercell().set_primclex(&primclex);
+    }
+    auto it = db_config.insert(config).first;
+    expected.emplace_back(it.name(), it->occupation());
+  }
+  EXPECT_EQ(db_config.size(), 12);
+  EXPECT_EQ(db_config.cache_stats().size, 12);
+
+  // After commit, only 'capacity' Configuration stay in memory
+  primclex.db<Supercell>().commit();
+  db_config.commit();
+  EXPECT_EQ(db_config.cache_stats().size, 3);
+  EXPECT_EQ(db_config.cache_stats().evictions, 9);
+
+  // Configuration read on demand; cache updates are kept until commit
+  Index misses = db_config.cache_stats().misses;
+  for (const auto &config : db_config) {
+    EXPECT_EQ(config.multiplicity() != 0, true);
+  }
+  EXPECT_EQ(db_config.cache_stats().misses, misses + 12);
+  EXPECT_EQ(db_config.cache_stats().size, 12);
+  db_config.commit();
+  EXPECT_EQ(db_config.cache_stats().size, 3);
+
+  // Repeated access to the same Configuration hits the cache
+  Index hits = db_config.cache_stats().hits;
+  for (Index i = 0; i < 5; ++i) {
+    EXPECT_EQ(db_config.find(expected[0].first)->occupation(),
+              expected[0].second);
+  }
+  EXPECT_GE(db_config.cache_stats().hits, hits + 4);
+
+  // A dereferenced iterator keeps its Configuration valid
+  auto first = db_config.find(expected[0].first);
+  const Configuration &first_config = *first;
+  for (auto const &value : expected) {
+    EXPECT_EQ(db_config.find(value.first)->occupation(), value.second);
+  }
+  EXPECT_EQ(first_config.occupation(), expected[0].second);
+
+  // Reading does not exceed capacity
+  EXPECT_EQ(db_config.cache_stats().size, 3);
+  db_config.set_cache_capacity(1);
+  EXPECT_EQ(db_config.cache_stats().size, 1);
+
+  // Search reads only candidates with matching supercell and occupation
+  for (auto const &value : expected) {
+    Configuration config{scel};
+    config.set_occupation(value.second);
+    auto it = db_config.search(config);
+    ASSERT_TRUE(it != db_config.end());
+    EXPECT_EQ(it.name(), value.first);
+  }
+
+  // Re-open, the saved cache is read
+  db_config.close();
+  db_config.open();
+  EXPECT_EQ(db_config.size(), 12);
+  EXPECT_EQ(db_config.cache_stats().size, 0);
+  for (const auto &config : db_config) {
+    EXPECT_EQ(config.cache().contains("multiplicity"), true);
+  }
+  check_sorted(db_config);
+}
+
+TEST(binaryConfigDatabase_Test, PartialRecord) {
+  // Create testing project, using binaryDB
+  test::FCCTernaryProj proj;
+  proj.check_init();
+  {
+    PrimClex primclex(proj.dir);
+    primclex.settings().set_default_database_name("binaryDB");
+    commit(primclex.settings());
+  }
+
+  ScopedNullLogging logging;
+  PrimClex primclex(proj.dir);
+  const Structure &prim(primclex.prim());
+
+  Eigen::Vector3d a, b, c;
+  std::tie(a, b, c) = prim.lattice().vectors();
+  Supercell tscel(&primclex, Lattice(2. * a, 2. * b, c));
+  const Supercell &scel = *tscel.insert().first;
+
+  auto &db_config = primclex.db<Configuration>();
+  ConfigEnumAllOccupations enum_config(scel);
+  for (const auto &config : enum_config) {
+    if (!config.supercell().has_primclex()) {
+      config.supercell().set_primclex(&primclex);
+    }
+    db_config.insert(config);
+  }
+  primclex.db<Supercell>().commit();
+  db_config.commit();
+  EXPECT_EQ(db_config.size(), 12);
+  db_config.close();
+
+  DB::binaryDB::DirectoryStructure dir(primclex.dir().root_dir());
+  fs::path log_path = dir.obj_log<Configuration>();
+  auto log_size = fs::file_size(log_path);
+
+  // Append a put record whose payload was not completely written, then a
+  // record whose header was not completely written, as by a crash while
+  // appending
+  std::string name = scel.name() + "/12";
+  std::vector<std::string> partial_records;
+  {
+    std::stringstream ss;
+    ss.put(1);
+    uint32_t name_size = name.size();
+    ss.write(reinterpret_cast<char const *>(&name_size), sizeof(name_size));
+    ss << name;
+    uint64_t key = 0;
+    uint64_t payload_size = 1000;
+    ss.write(reinterpret_cast<char const *>(&key), sizeof(key));
+    ss.write(reinterpret_cast<char const *>(&payload_size),
+             sizeof(payload_size));
+    ss << std::string(10, 'x');
+    partial_records.push_back(ss.str());
+    partial_records.push_back(ss.str().substr(0, 3));
+  }
+
+  for (std::string const &partial_record : partial_records) {
+    {
+      fs::ofstream sout(log_path, std::ios::binary | std::ios::app);
+      sout << partial_record;
+    }
+    EXPECT_EQ(fs::file_size(log_path), log_size + partial_record.size());
+
+    // The partial record is ignored and removed from the log
+    db_config.open();
+    EXPECT_EQ(db_config.size(), 12);
+    EXPECT_TRUE(db_config.find(name) == db_config.end());
+    EXPECT_EQ(fs::file_size(log_path), log_size);
+    check_sorted(db_config);
+    db_config.close();
+  }
+
+  // New records are appended after the last complete record
+  db_config.open();
+  db_config.erase(db_config.begin());
+  db_config.commit();
+  db_config.close();
+  fs::remove(dir.obj_index<Configuration>());
+  db_config.open();
+  EXPECT_EQ(db_config.size(), 11);
+}
@@ -0,0 +1,139 @@
+#include "gtest/gtest.h"
+
+/// What is being tested:
+#include "casm/hull/Hull.hh"
+
+/// What is being used to test it:
+#include "Common.hh"
+#include "FCCTernaryProj.hh"
+#include "casm/clex/ConfigEnumAllOccupations.hh"
+#include "casm/clex/PrimClex.hh"
+#include "casm/clex/ScelEnum.hh"
+#include "casm/crystallography/Structure.hh"
+#include "casm/database/ConfigDatabase.hh"
+#include "casm/database/ConfigDatabaseTools_impl.hh"
+#include "casm/database/ScelDatabase.hh"
+#include "casm/database/ScelDatabaseTools_impl.hh"
+#include "casm/enumerator/ConfigEnumInput.hh"
+#include "casm/external/qhull/libqhullcpp/QhullFacetList.h"
+
+using namespace CASM;
+
+namespace {
+
+/// Check all bottom facets, as a reference for Hull::dist_to_hull
+double scan_dist_to_hull(const Hull &hull, Eigen::VectorXd reduced_point) {
+  int dim = hull.data().dimension();
+  orgQhull::QhullPoint qpoint(dim, reduced_point.data());
+  double result = std::numeric_limits<double>::max();
+  for (const auto &facet : hull.data().facetList()) {
+    double b = -facet.hyperplane()[dim - 1];
+    if (b > 1e-14) {
+      result = std::min(result, -facet.distance(qpoint) / b);
+    }
+  }
+  return result;
+}
+
+/// A made up formation energy, with some configurations on the hull and some
+/// above it
+double pseudo_energy(const Configuration &config) {
+  Eigen::VectorXd x = species_frac(config);
+  double mix = -0.2 * (x(0) * x(1) + x(1) * x(2) + 0.5 * x(0) * x(2));
+  double noise = (std::hash<std::string>()(config.name()) % 1000) / 1000.0;
+  return mix + 0.05 * noise;
+}
+
+}  // namespace
+
+class HullTest : public testing::Test {
+ protected:
+  test::FCCTernaryProj proj;
+  std::unique_ptr<PrimClex> primclex_ptr;
+
+  HullTest() {
+    proj.check_init();
+    primclex_ptr = notstd::make_unique<PrimClex>(proj.dir);
+    PrimClex &primclex = *primclex_ptr;
+    auto &supercell_db = primclex.db<Supercell>();
+    auto &configuration_db = primclex.db<Configuration>();
+
+    ScelEnumByProps supercell_enumerator{primclex.shared_prim(),
+                                         xtal::ScelEnumProps(1, 5)};
+    for (auto const &supercell : supercell_enumerator) {
+      supercell.set_primclex(&primclex);
+      auto result = make_canonical_and_insert(supercell_enumerator, supercell,
+                                              supercell_db);
+      ConfigEnumAllOccupations configuration_enumerator{*result.first};
+      for (auto const &configuration : configuration_enumerator) {
+        make_canonical_and_insert(configuration_enumerator, configuration,
+                                  supercell_db, configuration_db, true);
+      }
+    }
+  }
+
+  std::unique_ptr<Hull> make_hull(DB::Selection<Configuration> &selection) {
+    ConfigIO::SpeciesFrac comp;
+    ConfigIO::GenericConfigFormatter<double> energy(
+        "pseudo_energy", "", pseudo_energy);
+    comp.init(*selection.selected().begin());
+    return notstd::make_unique<Hull>(selection, comp, energy);
+  }
+};
+
+TEST_F(HullTest, DistToHull) {
+  DB::Selection<Configuration> selection(*primclex_ptr, "ALL");
+  EXPECT_EQ(selection.selected_size(), 126);
+  auto hull_ptr = make_hull(selection);
+  const Hull &hull = *hull_ptr;
+  EXPECT_EQ(hull.data().dimension(), 3);
+
+  std::vector<double> batch = hull.dist_to_hull(selection);
+  EXPECT_EQ(batch.size(), selection.selected_size());
+
+  Index i = 0;
+  Index n_on_hull = 0;
+  for (const auto &config : selection.selected()) {
+    Eigen::VectorXd reduced_point = hull.reduced_point(config);
+    double expected = scan_dist_to_hull(hull, reduced_point);
+    double found = hull.dist_to_hull(config);
+    EXPECT_NEAR(found, expected, 1e-12) << config.name();
+    EXPECT_NEAR(batch[i], expected, 1e-12) << config.name();
+    EXPECT_GT(found, -1e-12) << config.name();
+    if (std::abs(found) < 1e-12) {
+      ++n_on_hull;
+    }
+    ++i;
+  }
+  EXPECT_GE(n_on_hull, 3);
+  EXPECT_LT(n_on_hull, selection.selected_size());
+}
+
+TEST_F(HullTest, DistToHullOutsideCompositionRange) {
+  // the hull is built from binary configurations only, then checked at
+  // compositions outside the range it spans
+  DB::Selection<Configuration> selection(*primclex_ptr, "NONE");
+  for (auto it = selection.all().begin(); it != selection.all().end(); ++it) {
+    Eigen::VectorXd x = species_frac(*it);
+    if (x(2) < 1e-8) {
+      it.is_selected() = true;
+    }
+  }
+  auto hull_ptr = make_hull(selection);
+  const Hull &hull = *hull_ptr;
+
+  DB::Selection<Configuration> all(*primclex_ptr, "ALL");
+  for (const auto &config : all.selected()) {
+    Eigen::VectorXd reduced_point = hull.reduced_point(config);
+    EXPECT_NEAR(hull.dist_to_hull(reduced_point),
+                scan_dist_to_hull(hull, reduced_point), 1e-12)
+        << config.name();
+  }
+
+  Eigen::MatrixXd points = Eigen::MatrixXd::Random(hull.data().dimension(), 50);
+  points *= 3.0;
+  Eigen::VectorXd batch = hull.dist_to_hull_batch(points);
+  for (Index i = 0; i < points.cols(); ++i) {
+    EXPECT_NEAR(batch(i), scan_dist_to_hull(hull, points.col(i)), 1e-10);
+  }
+}
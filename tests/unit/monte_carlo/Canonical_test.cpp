@@ -0,0 +1,247 @@
+#include "gtest/gtest.h"
+
+/// What is being tested:
+#include "casm/monte_carlo/canonical/Canonical.hh"
+
+/// What is being used to test it:
+#include <numeric>
+
+#include "ProjectBaseTest.hh"
+#include "casm/app/DirectoryStructure.hh"
+#include "casm/clex/Supercell.hh"
+#include "casm/monte_carlo/MonteDriver_impl.hh"
+#include "casm/monte_carlo/canonical/CanonicalSettings.hh"
+#include "crystallography/TestStructures.hh"
+#include "monte_carlo/ZrOMonteCarloTest.hh"
+
+using namespace CASM;
+
+namespace {
+
+/// Averages over passes of a canonical calculation
+struct CanonicalAverages {
+  double formation_energy = 0.0;
+
+  /// Absolute difference of the O fractions of the two O sublattices
+  double sublat_imbalance = 0.0;
+};
+
+class CanonicalTest : public test::ZrOMonteCarloTest {
+ protected:
+  /// Run `n_equil_passes` and then `n_passes` passes at "a" = 0.5, and
+  /// average over the last `n_passes` passes
+  CanonicalAverages run_averages(bool checkerboard, Index n_equil_passes,
+                                 Index n_passes) {
+    jsonParser conditions = jsonParser::parse(std::string(R"([
+      {"comp" : {"a" : 0.5}, "temperature" : 3000.0, "tolerance" : 0.001}
+    ])"));
+    jsonParser json = settings_json("canonical", conditions);
+    json["driver"]["checkerboard"] = checkerboard;
+    fs::path settings_path = write_settings(
+        json, checkerboard ? "mc_checkerboard" : "mc_metropolis");
+
+    Monte::CanonicalSettings settings(primclex, settings_path);
+    Monte::Canonical mc(primclex, settings, null_log());
+    mc.set_state(settings.custom_conditions(mc)[0], settings);
+    EXPECT_EQ(mc.checkerboard(), checkerboard);
+
+    CanonicalAverages result;
+    for (Index pass = 0; pass < n_equil_passes + n_passes; ++pass) {
+      Index step = 0;
+      while (step < mc.steps_per_pass()) {
+        step += Monte::monte_carlo_steps(mc, mc.steps_per_pass() - step);
+      }
+      if (pass < n_equil_passes) {
+        continue;
+      }
+      result.formation_energy += mc.formation_energy() / n_passes;
+      result.sublat_imbalance += sublat_imbalance(mc) / n_passes;
+    }
+    return result;
+  }
+
+  /// Absolute difference of the O fractions of the two O sublattices (b=2 and
+  /// b=3, where O is occupant 1)
+  static double sublat_imbalance(Monte::Canonical const &mc) {
+    Eigen::Vector2d n_O = Eigen::Vector2d::Zero();
+    for (Index l = 0; l < mc.supercell().num_sites(); ++l) {
+      Index b = mc.supercell().sublat(l);
+      if (b >= 2 && mc.configdof().occ(l) == 1) {
+        n_O(b - 2) += 1.0;
+      }
+    }
+    return std::abs(n_O(0) - n_O(1)) / mc.supercell().volume();
+  }
+};
+
+/// FCC binary project with a nearest neighbor pair ECI, so that the sites of
+/// the prim's single sublattice have several checkerboard colors
+class CanonicalFCCTest : public test::ProjectBaseTest {
+ protected:
+  CanonicalFCCTest()
+      : test::ProjectBaseTest(test::FCC_binary_prim(), "CanonicalFCCTest",
+                              jsonParser::parse(bspecs_str())) {
+    this->write_basis_set_data();
+    this->make_clexulator();
+
+    // orbit 2 is the nearest neighbor pair
+    DirectoryStructure const &dir = project_settings_ptr->dir();
+    jsonParser eci_json(dir.basis(basis_set_name));
+    for (Index o = 0; o < eci_json["orbits"].size(); ++o) {
+      jsonParser &functions = eci_json["orbits"][o]["cluster_functions"];
+      for (Index i = 0; i < functions.size(); ++i) {
+        functions[i]["eci"] = (o == 2 ? 0.1 : 0.0);
+      }
+    }
+    fs::path eci_path =
+        dir.eci("formation_energy", "default", "default", "default", "default");
+    fs::create_directories(eci_path.parent_path());
+    eci_json.write(eci_path);
+
+    // composition axes "0", so that "a" is the fraction of B
+    for (std::string command :
+         {"casm composition --calc", "casm composition --select 0"}) {
+      CommandArgs args(command, primclex_ptr.get(),
+                       project_settings_ptr->root_dir());
+      EXPECT_EQ(casm_api(args), 0);
+    }
+    primclex_ptr = std::make_unique<PrimClex>(project_settings_ptr->root_dir());
+  }
+
+  static std::string bspecs_str() {
+    return R"({
+"basis_function_specs" : {
+  "dof_specs": {
+    "occ": {
+      "site_basis_functions" : "occupation"
+    }
+  }
+},
+"cluster_specs": {
+  "method": "periodic_max_length",
+  "params": {
+    "orbit_branch_specs" : {
+      "2" : {"max_length" : 3.01}
+    }
+  }
+}
+})";
+  }
+
+  /// Write canonical checkerboard settings for "a" = 0.5 in a 4x4x4
+  /// supercell, and return the settings file path
+  fs::path write_settings() const {
+    jsonParser json = jsonParser::parse(std::string(R"({
+  "ensemble" : "canonical",
+  "method" : "metropolis",
+  "model" : {
+    "formation_energy" : "formation_energy"
+  },
+  "supercell" : [
+    [4, 0, 0],
+    [0, 4, 0],
+    [0, 0, 4]
+  ],
+  "data" : {
+    "sample_by" : "pass",
+    "sample_period" : 1,
+    "N_pass" : 20,
+    "measurements" : [
+      {"quantity" : "formation_energy"}
+    ],
+    "storage" : {
+      "write_observations" : false,
+      "write_trajectory" : false,
+      "output_format" : ["json"]
+    }
+  },
+  "driver" : {
+    "mode" : "custom",
+    "dependent_runs" : false,
+    "checkerboard" : true,
+    "motif" : {
+      "configname" : "default"
+    },
+    "custom_conditions" : [
+      {"comp" : {"a" : 0.5}, "temperature" : 2000.0, "tolerance" : 0.001}
+    ]
+  }
+})"));
+    fs::path mc_dir = project_settings_ptr->root_dir() / "mc_checkerboard";
+    fs::create_directories(mc_dir);
+    fs::path settings_path = mc_dir / "settings.json";
+    json.write(settings_path);
+    return settings_path;
+  }
+
+  /// Number of B (occupant 1) on the sites of each color
+  static std::vector<Index> color_n_B(Monte::Canonical const &mc) {
+    Monte::Checkerboard const &colors = *mc.checkerboard_colors();
+    std::vector<Index> result(colors.n_colors(), 0);
+    for (Index c = 0; c < colors.n_colors(); ++c) {
+      for (Index l : colors.sites(c)) {
+        if (mc.configdof().occ(l) == 1) {
+          ++result[c];
+        }
+      }
+    }
+    return result;
+  }
+
+  ScopedNullLogging logging;
+};
+
+}  // namespace
+
+/// Checkerboard steps only exchange occupants of sites on the same
+/// sublattice, so they must also make serial proposals to sample exchanges
+/// between the O sublattices and agree with Metropolis Monte Carlo
+TEST_F(CanonicalTest, CheckerboardMatchesMetropolis) {
+  CanonicalAverages metropolis = run_averages(false, 50, 200);
+  CanonicalAverages checkerboard = run_averages(true, 50, 200);
+
+  EXPECT_NEAR(checkerboard.formation_energy, metropolis.formation_energy,
+              0.01);
+  EXPECT_NEAR(checkerboard.sublat_imbalance, metropolis.sublat_imbalance,
+              0.05);
+}
+
+/// With a single sublattice, exchanges between sites of one color never
+/// change the composition of each color, so checkerboard steps must also
+/// make exchanges between sites of different colors to be ergodic
+TEST_F(CanonicalFCCTest, CheckerboardChangesColorComposition) {
+  fs::path settings_path = write_settings();
+  Monte::CanonicalSettings settings(*primclex_ptr, settings_path);
+  Monte::Canonical mc(*primclex_ptr, settings, null_log());
+  mc.seed(42);
+  mc.set_state(settings.custom_conditions(mc)[0], settings);
+  ASSERT_TRUE(mc.checkerboard());
+  ASSERT_GT(mc.checkerboard_colors()->n_colors(), 1);
+
+  std::vector<Index> initial_n_B = color_n_B(mc);
+  for (Index pass = 0; pass < 20; ++pass) {
+    Index step = 0;
+    while (step < mc.steps_per_pass()) {
+      step += Monte::monte_carlo_steps(mc, mc.steps_per_pass() - step);
+    }
+  }
+  std::vector<Index> final_n_B = color_n_B(mc);
+
+  EXPECT_EQ(std::accumulate(final_n_B.begin(), final_n_B.end(), Index(0)),
+            std::accumulate(initial_n_B.begin(), initial_n_B.end(), Index(0)));
+  EXPECT_NE(final_n_B, initial_n_B);
+}
+
+/// Rejection-free steps are only supported for grand canonical calculations
+TEST_F(CanonicalTest, RejectionFreeNotSupported) {
+  jsonParser conditions = jsonParser::parse(std::string(R"([
+    {"comp" : {"a" : 0.5}, "temperature" : 1000.0, "tolerance" : 0.001}
+  ])"));
+  jsonParser json = settings_json("canonical", conditions);
+  json["driver"]["rejection_free"] = true;
+  fs::path settings_path = write_settings(json, "mc_rejection_free");
+
+  Monte::CanonicalSettings settings(primclex, settings_path);
+  EXPECT_THROW(Monte::Canonical(primclex, settings, null_log()),
+               std::runtime_error);
+}
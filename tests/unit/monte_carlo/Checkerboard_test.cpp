@@ -0,0 +1,108 @@
+#include "gtest/gtest.h"
+
+/// What is being tested:
+#include "casm/monte_carlo/Checkerboard.hh"
+
+/// What is being used to test it:
+#include "Common.hh"
+#include "FCCTernaryProj.hh"
+#include "casm/clex/PrimClex.hh"
+#include "casm/clex/Supercell.hh"
+#include "casm/crystallography/UnitCellCoord.hh"
+#include "casm/monte_carlo/Conversions.hh"
+
+using namespace CASM;
+
+namespace {
+
+/// Sites within `extent` unit cells along each prim lattice vector
+std::set<xtal::UnitCellCoord> make_site_neighborhood(Index extent) {
+  std::set<xtal::UnitCellCoord> result;
+  for (Index i = -extent; i <= extent; ++i) {
+    for (Index j = -extent; j <= extent; ++j) {
+      for (Index k = -extent; k <= extent; ++k) {
+        result.emplace(0, i, j, k);
+      }
+    }
+  }
+  return result;
+}
+
+class CheckerboardTest : public testing::Test {
+ protected:
+  CheckerboardTest() : primclex(_init(proj).dir) {}
+
+  static test::FCCTernaryProj &_init(test::FCCTernaryProj &proj) {
+    proj.check_init();
+    proj.check_composition();
+    return proj;
+  }
+
+  /// Check that every site has one color, and that no site in the
+  /// neighborhood of a site has the same color
+  void check_coloring(Monte::Conversions const &convert,
+                      Monte::Checkerboard const &checkerboard,
+                      std::set<xtal::UnitCellCoord> const &site_neighborhood) {
+    Index n_sites = convert.mc_scel().num_sites();
+    std::vector<Index> count(n_sites, 0);
+    for (Index c = 0; c < checkerboard.n_colors(); ++c) {
+      for (Index l : checkerboard.sites(c)) {
+        EXPECT_EQ(checkerboard.color(l), c);
+        ++count[l];
+      }
+    }
+    for (Index l = 0; l < n_sites; ++l) {
+      EXPECT_EQ(count[l], 1);
+      xtal::UnitCell ijk = convert.l_to_ijk(l);
+      for (xtal::UnitCellCoord const &bijk : site_neighborhood) {
+        Index l_nbor = convert.bijk_to_l(
+            xtal::UnitCellCoord(bijk.sublattice(), ijk + bijk.unitcell()));
+        if (l_nbor != l) {
+          EXPECT_NE(checkerboard.color(l_nbor), checkerboard.color(l));
+        }
+      }
+    }
+  }
+
+  test::FCCTernaryProj proj;
+  ScopedNullLogging logging;
+  PrimClex primclex;
+};
+
+}  // namespace
+
+TEST_F(CheckerboardTest, Diagonal) {
+  Eigen::Matrix3l T;
+  T << 4, 0, 0, 0, 4, 0, 0, 0, 6;
+  Supercell scel(&primclex, T);
+  Monte::Conversions convert(scel);
+  auto site_neighborhood = make_site_neighborhood(1);
+
+  Monte::Checkerboard checkerboard(convert, site_neighborhood);
+  EXPECT_EQ(checkerboard.period(), Eigen::Vector3l(2, 2, 2));
+  EXPECT_EQ(checkerboard.n_colors(), 8);
+  check_coloring(convert, checkerboard, site_neighborhood);
+}
+
+TEST_F(CheckerboardTest, NonDiagonal) {
+  Eigen::Matrix3l T;
+  T << 3, 3, 0, 0, 6, 0, 0, 0, 4;
+  Supercell scel(&primclex, T);
+  Monte::Conversions convert(scel);
+  auto site_neighborhood = make_site_neighborhood(2);
+
+  Monte::Checkerboard checkerboard(convert, site_neighborhood);
+  EXPECT_EQ(checkerboard.period(), Eigen::Vector3l(3, 3, 4));
+  EXPECT_EQ(checkerboard.n_colors(), 36);
+  check_coloring(convert, checkerboard, site_neighborhood);
+}
+
+TEST_F(CheckerboardTest, TooSmall) {
+  Eigen::Matrix3l T;
+  T << 4, 0, 0, 0, 4, 0, 0, 0, 2;
+  Supercell scel(&primclex, T);
+  Monte::Conversions convert(scel);
+
+  EXPECT_THROW(Monte::Checkerboard(convert, make_site_neighborhood(2)),
+               std::runtime_error);
+}
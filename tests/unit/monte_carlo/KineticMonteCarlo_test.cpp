@@ -0,0 +1,215 @@
+#include "gtest/gtest.h"
+
+/// What is being tested:
+#include "casm/monte_carlo/kinetic/KineticMonteCarlo.hh"
+
+/// What is being used to test it:
+#include <cmath>
+#include <functional>
+
+#include "ProjectBaseTest.hh"
+#include "casm/app/ClexDescription.hh"
+#include "casm/app/DirectoryStructure.hh"
+#include "casm/app/ProjectSettings.hh"
+#include "casm/clex/PrimClex.hh"
+#include "casm/clex/Supercell.hh"
+#include "casm/crystallography/Structure.hh"
+#include "crystallography/TestStructures.hh"
+
+using namespace CASM;
+
+namespace {
+
+/// ZrO project with a periodic "default" basis set for the formation energy,
+/// and a local "kra" basis set about the O-O hop along c, so that O and
+/// vacancies hop along chains of O sites parallel to c
+class KineticMonteCarloTest : public test::ProjectBaseTest {
+ protected:
+  KineticMonteCarloTest()
+      : test::ProjectBaseTest(test::ZrO_prim(), "KineticMonteCarloTest",
+                              jsonParser::parse(periodic_specs_str())),
+        formation_energy_desc("formation_energy", "formation_energy",
+                              "default", "default", "default", "default"),
+        kra_desc("kra", "kra", "default", "default", "kra", "default") {
+    this->write_basis_set_data();
+    this->make_clexulator();
+
+    basis_set_name = "kra";
+    basis_set_specs_json = jsonParser::parse(local_specs_str());
+    fs::create_directories(
+        project_settings_ptr->dir().bspecs(basis_set_name).parent_path());
+    this->write_bspecs_json();
+    this->write_basis_set_data();
+    this->make_clexulator();
+
+    shared_supercell = std::make_shared<Supercell>(
+        shared_prim, Eigen::Matrix3l::Identity() * 4);
+    shared_supercell->set_primclex(primclex_ptr.get());
+  }
+
+  static std::string periodic_specs_str() {
+    return R"({
+"basis_function_specs" : {
+  "dof_specs": {
+    "occ": {
+      "site_basis_functions" : "occupation"
+    }
+  }
+},
+"cluster_specs": {
+  "method": "periodic_max_length",
+  "params": {
+    "orbit_branch_specs" : {
+      "2" : {"max_length" : 4.01}
+    }
+  }
+}
+})";
+  }
+
+  static std::string local_specs_str() {
+    return R"({
+"basis_function_specs" : {
+  "dof_specs": {
+    "occ": {
+      "site_basis_functions" : "occupation"
+    }
+  }
+},
+"cluster_specs": {
+  "method": "local_max_length",
+  "params": {
+    "generating_group" : [ 0, 3, 4, 9, 10, 11, 12, 13, 14, 15, 21, 22 ],
+    "phenomenal" : {
+      "coordinate_mode" : "Integral",
+      "sites" : [
+        [ 2, 0, 0, 0 ],
+        [ 3, 0, 0, 0 ]
+      ]
+    },
+    "orbit_branch_specs" : {
+      "1" : {"cutoff_radius": 4.01}
+    }
+  }
+}
+})";
+  }
+
+  /// Write the basis set's "basis.json", with ECI f(orbit_index,
+  /// function_index) for every cluster function, as the ECI of `desc`
+  void write_eci(ClexDescription const &desc,
+                 std::function<double(Index, Index)> f) {
+    DirectoryStructure const &dir = project_settings_ptr->dir();
+    jsonParser json(dir.basis(desc.bset));
+    for (Index o = 0; o < json["orbits"].size(); ++o) {
+      jsonParser &functions = json["orbits"][o]["cluster_functions"];
+      for (Index i = 0; i < functions.size(); ++i) {
+        functions[i]["eci"] = f(o, i);
+      }
+    }
+    fs::path eci_path = dir.eci(desc.property, desc.calctype, desc.ref,
+                                desc.bset, desc.eci);
+    fs::create_directories(eci_path.parent_path());
+    json.write(eci_path);
+  }
+
+  /// Configuration with O on every O site except `vacancies`
+  ///
+  /// O sites are sublattices 2 and 3, with occupants {Va, O}, so they are
+  /// the linear site indices [2 * volume, 4 * volume)
+  Configuration make_config(std::vector<Index> const &vacancies) const {
+    Configuration config(shared_supercell);
+    Index volume = shared_supercell->volume();
+    for (Index l = 2 * volume; l < 4 * volume; ++l) {
+      config.configdof().occ(l) = 1;
+    }
+    for (Index l : vacancies) {
+      config.configdof().occ(l) = 0;
+    }
+    return config;
+  }
+
+  ClexDescription formation_energy_desc;
+  ClexDescription kra_desc;
+  std::shared_ptr<Supercell> shared_supercell;
+};
+
+}  // namespace
+
+/// After steps, the incrementally updated rates of all events, found by
+/// m_site_to_event, must equal rates calculated from scratch
+TEST_F(KineticMonteCarloTest, IncrementalRates) {
+  write_eci(formation_energy_desc,
+            [](Index o, Index i) { return 0.02 * (Index(o % 5) - 2); });
+  write_eci(kra_desc, [](Index o, Index i) {
+    return o == 0 ? 0.5 : 0.05 * (Index((o + i) % 3) - 1);
+  });
+
+  Index volume = shared_supercell->volume();
+  std::vector<Index> vacancies;
+  for (Index k = 0; k < 10; ++k) {
+    vacancies.push_back(2 * volume + 13 * k);
+  }
+  Monte::KineticMonteCarlo kmc(*primclex_ptr, make_config(vacancies),
+                               formation_energy_desc, kra_desc, 1000.0, 1.0);
+  kmc.mtrand().seed(42);
+
+  for (Index n = 0; n < 5; ++n) {
+    kmc.run(40);
+    double total_rate = 0.0;
+    for (Index e = 0; e < kmc.events().size(); ++e) {
+      double expected = kmc.calc_rate(e);
+      EXPECT_NEAR(kmc.rate(e), expected, 1e-10 * std::max(1.0, expected))
+          << "event: " << e << "  steps: " << kmc.n_steps();
+      total_rate += expected;
+    }
+    EXPECT_NEAR(kmc.total_rate(), total_rate, 1e-8 * total_rate);
+  }
+}
+
+/// With zero ECI every allowed hop has rate equal to the attempt frequency,
+/// so a single vacancy makes an uncorrelated random walk along c, with two
+/// hops of length c/2 available from every site:
+///   D_Va = 2 * nu * (c/2)^2 / 6,  f_Va = 1
+TEST_F(KineticMonteCarloTest, VacancyRandomWalk) {
+  write_eci(formation_energy_desc, [](Index o, Index i) { return 0.0; });
+  write_eci(kra_desc, [](Index o, Index i) { return 0.0; });
+
+  double nu = 2.0;
+  Index volume = shared_supercell->volume();
+  Monte::KineticMonteCarlo kmc(*primclex_ptr, make_config({2 * volume}),
+                               formation_energy_desc, kra_desc, 1000.0, nu);
+  kmc.mtrand().seed(42);
+  EXPECT_NEAR(kmc.total_rate(), 2.0 * nu, 1e-10);
+
+  double c = primclex_ptr->prim().lattice()[2].norm();
+  double hop_sq = (c / 2.0) * (c / 2.0);
+
+  // independent segments of the walk, to average the displacement
+  Index n_segments = 2000;
+  Index n_steps = 20;
+  double sum_R_sq = 0.0;
+  double sum_time = 0.0;
+  Index sum_hops = 0;
+  for (Index s = 0; s < n_segments; ++s) {
+    kmc.reset_statistics();
+    kmc.run(n_steps);
+    for (auto const &d : kmc.diffusion()) {
+      if (d.species_name == "Va") {
+        EXPECT_EQ(d.count, 1);
+        sum_R_sq += d.tracer_diffusion_coefficient * 6.0 * kmc.time();
+        sum_hops += d.n_hops;
+      }
+    }
+    sum_time += kmc.time();
+  }
+
+  // the vacancy takes part in every hop
+  EXPECT_EQ(sum_hops, n_segments * n_steps);
+
+  double expected_D = 2.0 * nu * hop_sq / 6.0;
+  double D = sum_R_sq / (6.0 * sum_time);
+  double f = sum_R_sq / (sum_hops * hop_sq);
+  EXPECT_NEAR(D / expected_D, 1.0, 0.15);
+  EXPECT_NEAR(f, 1.0, 0.15);
+}
@@ -0,0 +1,141 @@
+#include "gtest/gtest.h"
+
+/// What is being tested:
+#include "casm/monte_carlo/MCData.hh"
+
+/// What is being used to test it:
+#include <boost/math/special_functions/erf.hpp>
+
+#include "casm/external/MersenneTwister/MersenneTwister.h"
+
+using namespace CASM;
+using namespace CASM::Monte;
+
+namespace {
+
+/// Correlated observations: x(i) = a*x(i-1) + noise, with an initial transient
+Eigen::VectorXd make_observations(Index N, double a) {
+  MTRand mtrand(1234);
+  Eigen::VectorXd x(N);
+  double value = 10.0;
+  for (Index i = 0; i < N; ++i) {
+    value = a * value + (1.0 - a) * 2.0 + 0.1 * (mtrand.rand53() - 0.5);
+    x(i) = value;
+  }
+  return x;
+}
+
+/// Direct calculation of the lag covariance sum
+double direct_lag_covariance_sum(const Eigen::VectorXd &x, Index begin,
+                                 Index end, Index lag, double mean) {
+  double sum = 0.0;
+  for (Index j = begin; j < end - lag; ++j) {
+    sum += (x(j) - mean) * (x(j + lag) - mean);
+  }
+  return sum;
+}
+
+/// Direct calculation of the calculated precision, scanning all observations
+/// for each lag
+double direct_calculated_precision(const Eigen::VectorXd &x, double conf) {
+  Index N = x.size();
+  double mean = x.mean();
+  double CoVar0 = direct_lag_covariance_sum(x, 0, N, 0, mean) / N;
+  for (Index i = 1; i < N; ++i) {
+    double cov = direct_lag_covariance_sum(x, 0, N, i, mean) / (N - i);
+    if (std::abs(cov / CoVar0) <= 0.5) {
+      double rho = pow(2.0, (-1.0 / i));
+      double var_of_mean = (CoVar0 / N) * (1.0 + rho) / (1.0 - rho);
+      return sqrt(2.0) * boost::math::erf_inv(conf) * sqrt(var_of_mean);
+    }
+  }
+  return 1.0 / 0.0;
+}
+
+}  // namespace
+
+TEST(MCDataTest, LagCovarianceSum) {
+  Eigen::VectorXd x = make_observations(3000, 0.9);
+  MCData data;
+  for (Index i = 0; i < 1000; ++i) {
+    data.push_back(x(i));
+  }
+
+  auto check = [&](Index begin, Index end, Index lag) {
+    double mean = data.sum(begin, end) / (end - begin);
+    EXPECT_NEAR(data.lag_covariance_sum(begin, end, lag, mean),
+                direct_lag_covariance_sum(x, begin, end, lag, mean), 1e-8);
+  };
+
+  // begins tracking lags
+  check(0, 1000, 0);
+  check(0, 1000, 3);
+  check(17, 1000, 5);
+
+  // tracked lags are updated as observations are added
+  for (Index i = 1000; i < x.size(); ++i) {
+    data.push_back(x(i));
+  }
+  for (Index lag : {0, 1, 3, 5, 8, 300}) {
+    check(0, 3000, lag);
+    check(511, 3000, lag);
+    check(512, 2999, lag);
+  }
+  EXPECT_NEAR(data.sum(0, 3000), x.sum(), 1e-8);
+  EXPECT_NEAR(data.squared_norm(100, 3000), x.tail(2900).squaredNorm(), 1e-6);
+
+  data.clear();
+  EXPECT_EQ(data.size(), 0);
+  data.push_back(x(0));
+  data.push_back(x(1));
+  data.push_back(x(2));
+  check(0, 3, 1);
+}
+
+TEST(MCDataTest, Convergence) {
+  Eigen::VectorXd x = make_observations(5000, 0.95);
+  MCData data;
+  for (Index i = 0; i < x.size(); ++i) {
+    data.push_back(x(i));
+  }
+
+  double conf = 0.95;
+  for (Index begin : {0, 100, 1234}) {
+    Eigen::VectorXd segment = x.tail(x.size() - begin);
+    MCDataConvergence convergence(data, begin, conf);
+    EXPECT_NEAR(convergence.mean(), segment.mean(), 1e-10);
+    EXPECT_NEAR(convergence.squared_norm(), segment.squaredNorm(), 1e-6);
+    EXPECT_NEAR(convergence.calculated_precision(),
+                direct_calculated_precision(segment, conf), 1e-10);
+
+    MCDataConvergence from_observations(segment, conf);
+    EXPECT_NEAR(from_observations.calculated_precision(),
+                convergence.calculated_precision(), 1e-10);
+  }
+}
+
+TEST(MCDataTest, Equilibration) {
+  Eigen::VectorXd x = make_observations(5000, 0.95);
+  MCData data;
+  for (Index i = 0; i < x.size(); ++i) {
+    data.push_back(x(i));
+  }
+
+  MCDataEquilibration equilibration(data, 0.001);
+  EXPECT_TRUE(equilibration.is_equilibrated());
+  EXPECT_GT(equilibration.equilibration_samples(), 0);
+
+  MCDataEquilibration from_observations(x, 0.001);
+  EXPECT_EQ(from_observations.is_equilibrated(),
+            equilibration.is_equilibrated());
+  EXPECT_EQ(from_observations.equilibration_samples(),
+            equilibration.equilibration_samples());
+
+  MCData same;
+  for (Index i = 0; i < 10; ++i) {
+    same.push_back(1.0);
+  }
+  MCDataEquilibration same_equilibration(same, 0.001);
+  EXPECT_TRUE(same_equilibration.is_equilibrated());
+  EXPECT_EQ(same_equilibration.equilibration_samples(), 0);
+}
@@ -0,0 +1,222 @@
+#include "gtest/gtest.h"
+
+/// What is being tested:
+#include "casm/monte_carlo/MonteDriver.hh"
+
+/// What is being used to test it:
+#include <sstream>
+
+#include "casm/app/ClexDescription.hh"
+#include "casm/app/DirectoryStructure.hh"
+#include "casm/monte_carlo/MonteDriver_impl.hh"
+#include "casm/monte_carlo/grand_canonical/GrandCanonical.hh"
+#include "casm/monte_carlo/grand_canonical/GrandCanonicalSettings.hh"
+#include "monte_carlo/ZrOMonteCarloTest.hh"
+
+using namespace CASM;
+
+namespace {
+
+class MonteDriverTest : public test::ZrOMonteCarloTest {
+ protected:
+  /// Run "casm monte" for the settings, and return "results.json"
+  jsonParser run(jsonParser const &settings_json, std::string name) {
+    fs::path settings_path = write_settings(settings_json, name);
+    CommandArgs args("casm monte -s " + settings_path.string(), &primclex,
+                     primclex.dir().root_dir());
+    EXPECT_EQ(casm_api(args), 0);
+    return jsonParser(settings_path.parent_path() / "results.json");
+  }
+
+  /// Add a "kra" cluster expansion, with a local basis set about the O-O hop
+  /// along c and zero ECI, so that every hop has the same rate
+  void add_kra_clex() {
+    ClexDescription kra_desc("kra", "kra", "default", "default", "kra",
+                             "default");
+    fs::create_directories(primclex.dir().bspecs("kra").parent_path());
+    jsonParser::parse(std::string(R"({
+"basis_function_specs" : {
+  "dof_specs": {
+    "occ": {
+      "site_basis_functions" : "occupation"
+    }
+  }
+},
+"cluster_specs": {
+  "method": "local_max_length",
+  "params": {
+    "generating_group" : [ 0, 3, 4, 9, 10, 11, 12, 13, 14, 15, 21, 22 ],
+    "phenomenal" : {
+      "coordinate_mode" : "Integral",
+      "sites" : [
+        [ 2, 0, 0, 0 ],
+        [ 3, 0, 0, 0 ]
+      ]
+    },
+    "orbit_branch_specs" : {
+      "1" : {"cutoff_radius": 4.01}
+    }
+  }
+}
+})"))
+        .write(primclex.dir().bspecs("kra"));
+    primclex.settings().insert_clex(kra_desc);
+    commit(primclex.settings());
+
+    CommandArgs args("casm bset -u --clex kra", &primclex,
+                     primclex.dir().root_dir());
+    EXPECT_EQ(casm_api(args), 0);
+
+    jsonParser eci_json(primclex.dir().basis("kra"));
+    for (Index o = 0; o < eci_json["orbits"].size(); ++o) {
+      jsonParser &functions = eci_json["orbits"][o]["cluster_functions"];
+      for (Index i = 0; i < functions.size(); ++i) {
+        functions[i]["eci"] = 0.0;
+      }
+    }
+    fs::path eci_path = primclex.dir().eci(kra_desc.property,
+                                           kra_desc.calctype, kra_desc.ref,
+                                           kra_desc.bset, kra_desc.eci);
+    fs::create_directories(eci_path.parent_path());
+    eci_json.write(eci_path);
+  }
+
+  /// Check that every condition took "N_sample" samples
+  void check_n_samples(jsonParser const &settings_json,
+                       jsonParser const &results) {
+    Index n_sample = settings_json["data"]["N_sample"].get<Index>();
+    Index n_conditions = settings_json["driver"]["custom_conditions"].size();
+    ASSERT_EQ(results["N_avg_samples"].size(), n_conditions);
+    for (Index i = 0; i < n_conditions; ++i) {
+      EXPECT_EQ(results["N_equil_samples"][i].get<Index>() +
+                    results["N_avg_samples"][i].get<Index>(),
+                n_sample);
+    }
+  }
+
+  /// Run a MonteDriver for the grand canonical settings, and return
+  /// "results.json" and the log
+  std::pair<jsonParser, std::string> run_grand_canonical(
+      jsonParser const &settings_json, std::string name) {
+    fs::path settings_path = write_settings(settings_json, name);
+    Monte::GrandCanonicalSettings settings(primclex, settings_path);
+    OStringStreamLog log;
+    Monte::MonteDriver<Monte::GrandCanonical> driver(primclex, settings, log,
+                                                     null_log());
+    driver.run();
+    return std::make_pair(
+        jsonParser(settings_path.parent_path() / "results.json"),
+        log.ss().str());
+  }
+
+  /// The order in which each condition's section begins in the log
+  /// ("begin i"), and results are written to "results.json" ("results")
+  static std::vector<std::string> log_order(std::string const &log) {
+    std::vector<std::string> result;
+    std::istringstream stream(log);
+    std::string line;
+    std::string begin = "-- Begin: Conditions ";
+    while (std::getline(stream, line)) {
+      auto pos = line.find(begin);
+      if (pos != std::string::npos) {
+        std::istringstream index(line.substr(pos + begin.size()));
+        Index i;
+        index >> i;
+        result.push_back("begin " + std::to_string(i));
+      } else if (line.find("write: ") != std::string::npos &&
+                 line.find("results.json") != std::string::npos) {
+        result.push_back("results");
+      }
+    }
+    return result;
+  }
+};
+
+}  // namespace
+
+/// Checkerboard steps make many proposals, but must not skip samples taken
+/// every "sample_period" steps
+TEST_F(MonteDriverTest, CanonicalCheckerboardSampleByStep) {
+  jsonParser conditions = jsonParser::parse(std::string(R"([
+    {"comp" : {"a" : 0.25}, "temperature" : 1000.0, "tolerance" : 0.001},
+    {"comp" : {"a" : 0.5}, "temperature" : 1000.0, "tolerance" : 0.001}
+  ])"));
+  jsonParser json = settings_json("canonical", conditions);
+  json["driver"]["checkerboard"] = true;
+
+  check_n_samples(json, run(json, "mc_canonical_checkerboard"));
+}
+
+TEST_F(MonteDriverTest, GrandCanonicalCheckerboardSampleByStep) {
+  jsonParser conditions = jsonParser::parse(std::string(R"([
+    {"param_chem_pot" : {"a" : -1.0}, "temperature" : 1000.0, "tolerance" : 0.001},
+    {"param_chem_pot" : {"a" : 1.0}, "temperature" : 1000.0, "tolerance" : 0.001}
+  ])"));
+  jsonParser json = settings_json("grand_canonical", conditions);
+  json["driver"]["checkerboard"] = true;
+
+  check_n_samples(json, run(json, "mc_grand_canonical_checkerboard"));
+}
+
+/// With "seed", independent conditions run on several threads give the same
+/// results, and are logged in the same order, as when run sequentially
+TEST_F(MonteDriverTest, ParallelConditionsMatchSequential) {
+  jsonParser conditions = jsonParser::parse(std::string(R"([
+    {"param_chem_pot" : {"a" : -1.0}, "temperature" : 1000.0, "tolerance" : 0.001},
+    {"param_chem_pot" : {"a" : 0.0}, "temperature" : 1000.0, "tolerance" : 0.001},
+    {"param_chem_pot" : {"a" : 1.0}, "temperature" : 1000.0, "tolerance" : 0.001},
+    {"param_chem_pot" : {"a" : 0.0}, "temperature" : 2000.0, "tolerance" : 0.001}
+  ])"));
+  jsonParser json = settings_json("grand_canonical", conditions);
+  json["driver"]["seed"] = 7;
+
+  json["driver"]["n_threads"] = 1;
+  auto sequential = run_grand_canonical(json, "mc_sequential");
+
+  json["driver"]["n_threads"] = 3;
+  auto parallel = run_grand_canonical(json, "mc_parallel");
+
+  ASSERT_EQ(sequential.first["N_avg_samples"].size(), 4);
+  EXPECT_TRUE(parallel.first == sequential.first)
+      << "sequential:\n"
+      << sequential.first << "\nparallel:\n"
+      << parallel.first;
+
+  std::vector<std::string> expected_order;
+  for (Index i = 0; i < 4; ++i) {
+    expected_order.push_back("begin " + std::to_string(i));
+    expected_order.push_back("results");
+  }
+  EXPECT_EQ(log_order(sequential.second), expected_order);
+  EXPECT_EQ(log_order(parallel.second), expected_order);
+  EXPECT_NE(parallel.second.find("Begin: Parallel conditions"),
+            std::string::npos);
+}
+
+/// "method": "kinetic" runs kinetic Monte Carlo for each condition, and writes
+/// the diffusion coefficients and correlation factors of each species
+TEST_F(MonteDriverTest, KineticDiffusionResults) {
+  add_kra_clex();
+
+  jsonParser conditions = jsonParser::parse(std::string(R"([
+    {"comp" : {"a" : 0.1}, "temperature" : 1000.0, "tolerance" : 0.001},
+    {"comp" : {"a" : 0.2}, "temperature" : 1000.0, "tolerance" : 0.001}
+  ])"));
+  jsonParser json = settings_json("canonical", conditions);
+  json["method"] = "kinetic";
+  json["model"]["kra"] = "kra";
+  json["driver"]["seed"] = 7;
+  json["kinetic"]["equilibration_steps"] = 100;
+  json["kinetic"]["steps"] = 1000;
+
+  jsonParser results = run(json, "mc_kinetic");
+  ASSERT_EQ(results["N_step"].size(), 2);
+  for (Index i = 0; i < 2; ++i) {
+    EXPECT_EQ(results["N_step"][i].get<Index>(), 1000);
+    EXPECT_GT(results["time"][i].get<double>(), 0.0);
+    EXPECT_GT(results["n_hops(Va)"][i].get<Index>(), 0);
+    EXPECT_GT(results["D_tracer(Va)"][i].get<double>(), 0.0);
+    EXPECT_TRUE(results.contains("D_collective(Va)"));
+    EXPECT_TRUE(results.contains("correlation_factor(O)"));
+  }
+}
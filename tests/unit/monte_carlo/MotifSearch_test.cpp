@@ -0,0 +1,66 @@
+#include "gtest/gtest.h"
+
+/// What is being tested:
+#include "casm/monte_carlo/MotifSearch.hh"
+
+using namespace CASM;
+
+namespace {
+
+/// Binary with end members A, B and an ordered AB configuration
+Monte::MotifSearch make_binary_search() {
+  std::vector<std::string> configname{"A", "AB", "B", "AB_degenerate"};
+  Eigen::MatrixXd corr(4, 2);
+  corr << 1.0, 1.0,  //
+      1.0, -1.0,     //
+      1.0, 1.0,      //
+      1.0, -1.0;
+  Eigen::MatrixXd comp_x(4, 1);
+  comp_x << 0.0, 0.5, 1.0, 0.5;
+  Eigen::VectorXd eci(2);
+  eci << 0.0, 0.1;
+  return Monte::MotifSearch(configname, corr, comp_x, eci);
+}
+
+}  // namespace
+
+TEST(MotifSearchTest, PotentialEnergy) {
+  Monte::MotifSearch search = make_binary_search();
+  EXPECT_EQ(search.size(), 4);
+  EXPECT_TRUE(search.formation_energy().isApprox(
+      Eigen::Vector4d(0.1, -0.1, 0.1, -0.1)));
+
+  Eigen::MatrixXd param_chem_pot(1, 2);
+  param_chem_pot << 0.0, 1.0;
+  Eigen::MatrixXd Epot = search.potential_energy(param_chem_pot);
+  ASSERT_EQ(Epot.rows(), 4);
+  ASSERT_EQ(Epot.cols(), 2);
+  for (Index i = 0; i < search.size(); ++i) {
+    for (Index j = 0; j < 2; ++j) {
+      EXPECT_NEAR(Epot(i, j),
+                  search.formation_energy()(i) -
+                      param_chem_pot(0, j) * search.comp_x()(i, 0),
+                  1e-12);
+    }
+  }
+}
+
+TEST(MotifSearchTest, GroundStates) {
+  Monte::MotifSearch search = make_binary_search();
+
+  Eigen::MatrixXd param_chem_pot(1, 3);
+  param_chem_pot << -1.0, 0.0, 1.0;
+  auto result = search.ground_states(param_chem_pot, 1e-6);
+  ASSERT_EQ(result.size(), 3);
+  EXPECT_EQ(result[0], std::vector<Index>({0}));
+  EXPECT_EQ(result[1], std::vector<Index>({1, 3}));
+  EXPECT_EQ(result[2], std::vector<Index>({2}));
+
+  std::vector<bool> allowed{true, false, true, false};
+  auto restricted = search.ground_states(param_chem_pot, 1e-6, allowed);
+  EXPECT_EQ(restricted[1], std::vector<Index>({0, 2}));
+
+  auto none =
+      search.ground_states(param_chem_pot, 1e-6, std::vector<bool>(4, false));
+  EXPECT_TRUE(none[1].empty());
+}
@@ -0,0 +1,122 @@
+#include "gtest/gtest.h"
+
+/// What is being tested:
+#include "casm/monte_carlo/NFoldWay.hh"
+
+/// What is being used to test it:
+#include <cmath>
+
+#include "Common.hh"
+#include "FCCTernaryProj.hh"
+#include "casm/clex/ConfigDoF.hh"
+#include "casm/clex/Configuration.hh"
+#include "casm/clex/PrimClex.hh"
+#include "casm/clex/Supercell.hh"
+#include "casm/external/MersenneTwister/MersenneTwister.h"
+#include "casm/monte_carlo/Conversions.hh"
+
+using namespace CASM;
+
+namespace {
+
+/// Energy of occupant index `occ` on site `l`, so that dEpot only depends on
+/// the changed sites
+double site_energy(Index l, int occ) { return 0.05 * occ * (1 + l % 3); }
+
+double acceptance(double dEpot, double beta) {
+  return dEpot < 0.0 ? 1.0 : std::exp(-beta * dEpot);
+}
+
+class NFoldWayTest : public testing::Test {
+ protected:
+  NFoldWayTest()
+      : mtrand(1234),
+        primclex(_init(proj).dir),
+        scel(&primclex, _transf_mat()),
+        convert(scel),
+        config(scel),
+        beta(20.0) {
+    config.init_occupation();
+    for (Index l = 0; l < config.size(); ++l) {
+      config.set_occ(l, mtrand.randInt(convert.occ_size(convert.l_to_asym(l)) -
+                                       1));
+    }
+  }
+
+  static test::FCCTernaryProj &_init(test::FCCTernaryProj &proj) {
+    proj.check_init();
+    proj.check_composition();
+    return proj;
+  }
+
+  static Eigen::Matrix3l _transf_mat() {
+    Eigen::Matrix3l T;
+    T << 3, 0, 0, 0, 3, 0, 0, 0, 3;
+    return T;
+  }
+
+  Monte::NFoldWay::SiteChangeFunction site_change_f() {
+    return [this](Index l, int new_occ) {
+      return site_energy(l, new_occ) - site_energy(l, config.occ(l));
+    };
+  }
+
+  /// Apply selected events, and check incremental updates against
+  /// recalculating all event probabilities
+  void check_updates(Monte::NFoldWay &nfold, Monte::NFoldWay &reference) {
+    std::vector<Index> linear_site_index;
+    std::vector<int> new_occ;
+    for (Index i = 0; i < 20; ++i) {
+      nfold.select(mtrand, linear_site_index, new_occ);
+      for (Index j = 0; j < linear_site_index.size(); ++j) {
+        EXPECT_NE(config.occ(linear_site_index[j]), new_occ[j]);
+        config.set_occ(linear_site_index[j], new_occ[j]);
+      }
+      nfold.update(config.configdof(), linear_site_index, mtrand);
+      reference.initialize(config.configdof(), beta, mtrand);
+      EXPECT_NEAR(nfold.escape_probability(), reference.escape_probability(),
+                  1e-10);
+    }
+  }
+
+  test::FCCTernaryProj proj;
+  ScopedNullLogging logging;
+  MTRand mtrand;
+  PrimClex primclex;
+  Supercell scel;
+  Monte::Conversions convert;
+  Configuration config;
+  double beta;
+};
+
+}  // namespace
+
+TEST_F(NFoldWayTest, SiteChange) {
+  Monte::NFoldWay nfold(convert, scel.nlist(), site_change_f());
+  nfold.initialize(config.configdof(), beta, mtrand);
+  EXPECT_TRUE(nfold.is_initialized());
+
+  // each site is proposed with probability 1/N, then each other occupant with
+  // probability 1/(n_occ-1)
+  double expected = 0.0;
+  for (Index l = 0; l < config.size(); ++l) {
+    Index n_occ = convert.occ_size(convert.l_to_asym(l));
+    for (int occ = 0; occ < n_occ; ++occ) {
+      if (occ != config.occ(l)) {
+        expected +=
+            acceptance(site_energy(l, occ) - site_energy(l, config.occ(l)),
+                       beta) /
+            (n_occ - 1);
+      }
+    }
+  }
+  expected /= config.size();
+  EXPECT_NEAR(nfold.escape_probability(), expected, 1e-12);
+
+  Index residence_steps = nfold.residence_steps();
+  nfold.skip(residence_steps);
+  EXPECT_EQ(nfold.residence_steps(), 0);
+
+  Monte::NFoldWay reference(convert, scel.nlist(), site_change_f());
+  check_updates(nfold, reference);
+}
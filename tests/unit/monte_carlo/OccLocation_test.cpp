@@ -156,3 +156,65 @@ TEST(OccLocationTest, FCCTernary_DiluteConfig) {
   test::FCCTernaryProj proj;
   run_case(proj, dilute_config, mtrand);
 }
+
+TEST(OccLocationTest, FCCTernary_SpeciesExchange) {
+  MTRand mtrand(1234);
+  test::FCCTernaryProj proj;
+  proj.check_init();
+  proj.check_composition();
+
+  ScopedNullLogging logging;
+  PrimClex primclex(proj.dir);
+
+  Eigen::Matrix3l T;
+  T << 4, 0, 0, 0, 4, 0, 0, 0, 4;
+  Supercell scel(&primclex, T);
+  Monte::Conversions convert(scel);
+
+  Configuration config(scel);
+  random_config(config, convert, mtrand);
+
+  Monte::OccCandidateList cand_list(convert);
+  Monte::OccLocation occ_loc(convert, cand_list, true);
+  occ_loc.initialize(config);
+  check_occ_init(config, occ_loc, convert, cand_list);
+
+  // one tracked species per site, each initially at its own site
+  ASSERT_EQ(occ_loc.species_size(), occ_loc.size());
+  std::vector<Index> species_site(occ_loc.species_size());
+  for (Index mol_id = 0; mol_id < occ_loc.size(); ++mol_id) {
+    auto const &mol = occ_loc.mol(mol_id);
+    ASSERT_EQ(mol.component.size(), 1);
+    species_site[mol.component[0]] = mol.l;
+  }
+
+  Monte::OccEvent e;
+  ConfigDoF &configdof = config.configdof();
+  for (Index count = 0; count < 10000; ++count) {
+    Index l_a = occ_loc.mol(mtrand.randInt(occ_loc.size() - 1)).l;
+    Index l_b = occ_loc.mol(mtrand.randInt(occ_loc.size() - 1)).l;
+    if (l_a == l_b) {
+      continue;
+    }
+    Index species_a = occ_loc.mol(occ_loc.l_to_mol_id(l_a)).component[0];
+    Index species_b = occ_loc.mol(occ_loc.l_to_mol_id(l_b)).component[0];
+
+    occ_loc.make_exchange(e, l_a, l_b);
+    ASSERT_EQ(e.species_traj.size(), 2);
+    check_occ(config, e, occ_loc, convert, cand_list);
+    occ_loc.apply(e, configdof);
+    check_occ(config, e, occ_loc, convert, cand_list);
+
+    // species moved with their occupants
+    species_site[species_a] = l_b;
+    species_site[species_b] = l_a;
+    ASSERT_EQ(occ_loc.mol(occ_loc.l_to_mol_id(l_b)).component[0], species_a);
+    ASSERT_EQ(occ_loc.mol(occ_loc.l_to_mol_id(l_a)).component[0], species_b);
+  }
+
+  for (Index id = 0; id < occ_loc.species_size(); ++id) {
+    auto const &mol = occ_loc.mol(occ_loc.l_to_mol_id(species_site[id]));
+    EXPECT_EQ(mol.component[0], id);
+    EXPECT_EQ(mol.species_index, occ_loc.species(id).species_index);
+  }
+}
@@ -0,0 +1,73 @@
+#include "gtest/gtest.h"
+
+/// What is being tested:
+#include "casm/monte_carlo/OccTrajectory.hh"
+
+/// What is being used to test it:
+#include <boost/filesystem.hpp>
+
+#include "Common.hh"
+#include "casm/external/MersenneTwister/MersenneTwister.h"
+
+using namespace CASM;
+using namespace CASM::Monte;
+
+TEST(OccTrajectoryTest, WriteAndRead) {
+  test::TmpDir tmp_dir;
+  fs::path file_path = tmp_dir.path() / "trajectory.occ.gz";
+
+  // random occupations, changing a few sites per frame
+  MTRand mtrand(5);
+  Index n_sites = 1000;
+  Index n_frames = 250;
+  std::vector<Eigen::VectorXi> expected;
+  Eigen::VectorXi occupation = Eigen::VectorXi::Zero(n_sites);
+  for (Index l = 0; l < n_sites; ++l) {
+    occupation(l) = mtrand.randInt(2);
+  }
+
+  {
+    OccTrajectoryWriter writer(file_path, n_sites, 10);
+    for (Index i = 0; i < n_frames; ++i) {
+      for (Index n = 0; n < 5; ++n) {
+        occupation(mtrand.randInt(n_sites - 1)) = mtrand.randInt(2);
+      }
+      writer.write(i, 2 * i, occupation);
+      expected.push_back(occupation);
+    }
+    EXPECT_EQ(writer.size(), n_frames);
+  }
+
+  // sequential reading
+  OccTrajectoryReader reader(file_path);
+  EXPECT_EQ(reader.n_sites(), n_sites);
+  EXPECT_EQ(reader.frame_index(), -1);
+  Index count = 0;
+  while (reader.next()) {
+    EXPECT_EQ(reader.frame_index(), count);
+    EXPECT_EQ(reader.pass(), count);
+    EXPECT_EQ(reader.step(), 2 * count);
+    EXPECT_EQ(reader.occupation(), expected[count]);
+    ++count;
+  }
+  EXPECT_EQ(count, n_frames);
+
+  // reading frames on demand, including before the current frame
+  EXPECT_EQ(reader.frame(17), expected[17]);
+  EXPECT_EQ(reader.frame(200), expected[200]);
+  EXPECT_EQ(reader.frame(3), expected[3]);
+  EXPECT_EQ(reader.frame(0), expected[0]);
+  EXPECT_THROW(reader.frame(n_frames), std::runtime_error);
+}
+
+TEST(OccTrajectoryTest, NotATrajectory) {
+  test::TmpDir tmp_dir;
+  fs::path file_path = tmp_dir.path() / "not_a_trajectory.gz";
+  {
+    gz::ogzstream sout(file_path.string().c_str());
+    sout << "{}";
+  }
+  EXPECT_THROW(OccTrajectoryReader reader(file_path), std::runtime_error);
+  EXPECT_THROW(OccTrajectoryReader reader(tmp_dir.path() / "missing.gz"),
+               std::runtime_error);
+}
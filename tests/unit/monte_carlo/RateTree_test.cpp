@@ -0,0 +1,80 @@
+#include "gtest/gtest.h"
+
+/// What is being tested:
+#include "casm/monte_carlo/RateTree.hh"
+
+/// What is being used to test it:
+#include <numeric>
+
+#include "casm/external/MersenneTwister/MersenneTwister.h"
+
+using namespace CASM;
+using namespace CASM::Monte;
+
+namespace {
+
+/// Direct search for the event selected by `value`
+Index direct_find(std::vector<double> const &rate, double value) {
+  double sum = 0.0;
+  for (Index i = 0; i < rate.size(); ++i) {
+    sum += rate[i];
+    if (value < sum) {
+      return i;
+    }
+  }
+  return rate.size();
+}
+
+}  // namespace
+
+TEST(RateTreeTest, FindAndUpdate) {
+  MTRand mtrand(1234);
+  std::vector<double> rate(37);
+  for (auto &value : rate) {
+    value = mtrand.randInt(3) == 0 ? 0.0 : mtrand.rand53();
+  }
+  RateTree tree{rate};
+
+  for (Index step = 0; step < 500; ++step) {
+    ASSERT_NEAR(tree.total_rate(),
+                std::accumulate(rate.begin(), rate.end(), 0.0), 1e-10);
+    for (Index i = 0; i <= rate.size(); ++i) {
+      ASSERT_NEAR(tree.partial_sum(i),
+                  std::accumulate(rate.begin(), rate.begin() + i, 0.0),
+                  1e-10);
+    }
+
+    double value = mtrand.randExc(tree.total_rate());
+    Index found = tree.find(value);
+    EXPECT_EQ(found, direct_find(rate, value));
+    EXPECT_GT(tree.rate(found), 0.0);
+
+    // change a rate
+    Index i = mtrand.randInt(rate.size() - 1);
+    rate[i] = mtrand.randInt(3) == 0 ? 0.0 : mtrand.rand53();
+    tree.set_rate(i, rate[i]);
+    EXPECT_EQ(tree.rate(i), rate[i]);
+  }
+}
+
+TEST(RateTreeTest, Edges) {
+  RateTree tree{std::vector<double>{0.0, 2.0, 0.0, 1.0, 0.0}};
+  EXPECT_EQ(tree.size(), 5);
+  EXPECT_EQ(tree.total_rate(), 3.0);
+  EXPECT_EQ(tree.find(0.0), 1);
+  EXPECT_EQ(tree.find(1.999), 1);
+  EXPECT_EQ(tree.find(2.0), 3);
+
+  // values past the end select the last event with non-zero rate
+  EXPECT_EQ(tree.find(3.0), 3);
+
+  tree.set_rate(1, 0.0);
+  tree.set_rate(3, 0.0);
+  EXPECT_EQ(tree.total_rate(), 0.0);
+  EXPECT_THROW(tree.find(0.0), std::runtime_error);
+
+  RateTree empty;
+  EXPECT_EQ(empty.size(), 0);
+  EXPECT_EQ(empty.total_rate(), 0.0);
+  EXPECT_THROW(empty.find(0.0), std::runtime_error);
+}
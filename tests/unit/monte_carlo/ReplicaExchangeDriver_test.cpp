@@ -0,0 +1,105 @@
+#include "gtest/gtest.h"
+
+/// What is being tested:
+#include "casm/monte_carlo/ReplicaExchangeDriver.hh"
+
+/// What is being used to test it:
+#include <cmath>
+
+#include "casm/casm_io/container/json_io.hh"
+#include "casm/monte_carlo/grand_canonical/GrandCanonical.hh"
+#include "casm/monte_carlo/grand_canonical/GrandCanonicalSettings.hh"
+#include "monte_carlo/ZrOMonteCarloTest.hh"
+
+using namespace CASM;
+
+TEST(ReplicaExchangeProbabilityTest, TemperatureLadder) {
+  // same potential at both conditions: p = min(1, exp((beta_a - beta_b) *
+  // (E(x_a) - E(x_b))))
+  double beta_a = 2.0;
+  double beta_b = 1.0;
+  double E_xa = 1.0;
+  double E_xb = 3.0;
+  EXPECT_NEAR(Monte::replica_exchange_probability(beta_a, beta_b, E_xa, E_xb,
+                                                  E_xa, E_xb),
+              std::exp(-2.0), 1e-12);
+
+  // the lower energy DoF moving to the lower temperature is always accepted
+  EXPECT_EQ(Monte::replica_exchange_probability(beta_a, beta_b, E_xb, E_xa,
+                                                E_xb, E_xa),
+            1.0);
+
+  // identical conditions are always accepted
+  EXPECT_EQ(Monte::replica_exchange_probability(beta_a, beta_a, E_xa, E_xb,
+                                                E_xa, E_xb),
+            1.0);
+}
+
+TEST(ReplicaExchangeProbabilityTest, DifferentPotentials) {
+  // delta = 0.5 * (4.0 - 1.0) + 0.25 * (2.0 - 6.0) = 0.5
+  EXPECT_NEAR(
+      Monte::replica_exchange_probability(0.5, 0.25, 1.0, 4.0, 2.0, 6.0),
+      std::exp(-0.5), 1e-12);
+
+  // delta = 0.5 * (1.0 - 4.0) + 0.25 * (6.0 - 2.0) = -0.5
+  EXPECT_EQ(Monte::replica_exchange_probability(0.5, 0.25, 4.0, 1.0, 6.0, 2.0),
+            1.0);
+}
+
+namespace {
+
+class ReplicaExchangeDriverTest : public test::ZrOMonteCarloTest {};
+
+}  // namespace
+
+/// Replicas at identical conditions always exchange, so walkers move through
+/// a fixed cycle of 6 exchange attempts, alternating between pairs (0, 1) and
+/// (1, 2), and after the first round trip every round trip takes 6 passes
+TEST_F(ReplicaExchangeDriverTest, IdenticalConditionsBookkeeping) {
+  jsonParser conditions = jsonParser::parse(std::string(R"([
+    {"param_chem_pot" : {"a" : 0.0}, "temperature" : 1000.0, "tolerance" : 0.001},
+    {"param_chem_pot" : {"a" : 0.0}, "temperature" : 1000.0, "tolerance" : 0.001},
+    {"param_chem_pot" : {"a" : 0.0}, "temperature" : 1000.0, "tolerance" : 0.001}
+  ])"));
+  jsonParser json = settings_json("grand_canonical", conditions);
+  json["data"]["sample_by"] = "pass";
+  json["data"]["sample_period"] = 1;
+  json["data"].erase("N_sample");
+  json["data"]["N_pass"] = 20;
+  json["driver"]["replica_exchange"]["swap_period"] = 1;
+  fs::path settings_path = write_settings(json, "mc_replica_exchange");
+
+  Monte::GrandCanonicalSettings settings(primclex, settings_path);
+  Monte::ReplicaExchangeDriver<Monte::GrandCanonical> driver(
+      primclex, settings, null_log(), null_log());
+  driver.run();
+
+  jsonParser results(settings_path.parent_path() / "replica_exchange.json");
+  Index n_passes = results["passes"].get<Index>();
+  ASSERT_GE(n_passes, 20);
+
+  // exchange attempts alternate, starting with (0, 1), one per pass
+  EXPECT_EQ(driver.swap_attempts(0), (n_passes + 1) / 2);
+  EXPECT_EQ(driver.swap_attempts(1), n_passes / 2);
+  for (Index i = 0; i < 2; ++i) {
+    EXPECT_EQ(driver.swap_accepts(i), driver.swap_attempts(i));
+    EXPECT_EQ(results["swap_acceptance"][i].get<double>(), 1.0);
+  }
+
+  // walker w first returns to replica 0 after visiting replica 2 at pass
+  // 5, 7, 9, for w = 0, 1, 2, and again every 6 passes
+  std::vector<Index> first_return = {5, 7, 9};
+  for (Index w = 0; w < 3; ++w) {
+    std::vector<Index> expected;
+    for (Index pass = first_return[w]; pass <= n_passes; pass += 6) {
+      expected.push_back(w == 0 && pass == 5 ? 5 : 6);
+    }
+    EXPECT_EQ(driver.round_trips(w), expected) << "walker: " << w;
+  }
+
+  // walker at each replica, by number of passes modulo 6
+  std::vector<std::vector<Index>> walker_cycle = {
+      {0, 1, 2}, {1, 0, 2}, {1, 2, 0}, {2, 1, 0}, {2, 0, 1}, {0, 2, 1}};
+  EXPECT_EQ(results["walker"].get<std::vector<Index>>(),
+            walker_cycle[n_passes % 6]);
+}
@@ -0,0 +1,127 @@
+#ifndef CASMtest_ZrOMonteCarloTest
+#define CASMtest_ZrOMonteCarloTest
+
+#include <boost/filesystem.hpp>
+#include <string>
+#include <vector>
+
+#include "Common.hh"
+#include "ZrOProj.hh"
+#include "casm/app/ProjectSettings.hh"
+#include "casm/app/casm_functions.hh"
+#include "casm/casm_io/Log.hh"
+#include "casm/casm_io/json/jsonParser.hh"
+#include "casm/clex/PrimClex.hh"
+#include "gtest/gtest.h"
+
+namespace test {
+
+/// \brief ZrO project with a compiled cluster expansion, for running Monte
+/// Carlo calculations
+///
+/// - Basis set: "monte_carlo/data/bspecs_0.json"
+/// - ECI: the point and two shortest pair cluster functions only, with the
+///   values of "monte_carlo/data/eci_0.json", so that checkerboard steps can
+///   be used in small supercells
+/// - Composition axes: "0", so that "a" is the fraction of vacant O sites
+class ZrOMonteCarloTest : public testing::Test {
+ protected:
+  ZrOMonteCarloTest() : primclex(_init(proj).dir) {
+    fs::path bspecs_src = test::data_file("monte_carlo", "bspecs_0.json");
+    fs::copy_file(bspecs_src, primclex.dir().bspecs("default"),
+                  fs::copy_option::overwrite_if_exists);
+
+    // for autotools
+    primclex.settings().set_casm_libdir(fs::current_path() / ".libs");
+    commit(primclex.settings());
+
+    CommandArgs args("casm bset -u", &primclex, primclex.dir().root_dir());
+    EXPECT_EQ(casm_api(args), 0);
+
+    // orbits are sorted by cluster size and length: orbit 1 is the O point
+    // cluster, and orbits 2 and 3 are the shortest pairs
+    jsonParser eci_json(primclex.dir().basis("default"));
+    std::vector<double> eci = {-1.484351045075109, 0.7994658426977046,
+                               0.7490094368817293};
+    for (Index i = 0; i < eci.size(); ++i) {
+      eci_json["orbits"][i + 1]["cluster_functions"][0]["eci"] = eci[i];
+    }
+    fs::path eci_path = primclex.dir().eci("formation_energy", "default",
+                                           "default", "default", "default");
+    fs::create_directories(eci_path.parent_path());
+    eci_json.write(eci_path);
+  }
+
+  static test::ZrOProj &_init(test::ZrOProj &proj) {
+    proj.check_init();
+    proj.check_composition();
+    return proj;
+  }
+
+  /// \brief Settings for a short Monte Carlo calculation
+  ///
+  /// \param ensemble "canonical" or "grand_canonical"
+  /// \param conditions The "driver"/"custom_conditions" array
+  ///
+  /// - 6x6x6 supercell, starting from the "default" motif for each condition
+  /// - 20 samples of "formation_energy", "potential_energy", and "comp", taken
+  ///   every 7 steps, without equilibration or convergence checks
+  jsonParser settings_json(std::string ensemble,
+                           jsonParser const &conditions) const {
+    jsonParser json = jsonParser::parse(std::string(R"({
+  "method" : "metropolis",
+  "model" : {
+    "formation_energy" : "formation_energy"
+  },
+  "supercell" : [
+    [6, 0, 0],
+    [0, 6, 0],
+    [0, 0, 6]
+  ],
+  "data" : {
+    "sample_by" : "step",
+    "sample_period" : 7,
+    "N_sample" : 20,
+    "measurements" : [
+      {"quantity" : "formation_energy"},
+      {"quantity" : "potential_energy"},
+      {"quantity" : "comp"}
+    ],
+    "storage" : {
+      "write_observations" : false,
+      "write_trajectory" : false,
+      "output_format" : ["json"]
+    }
+  },
+  "driver" : {
+    "mode" : "custom",
+    "dependent_runs" : false,
+    "motif" : {
+      "configname" : "default"
+    }
+  }
+})"));
+    json["ensemble"] = ensemble;
+    json["driver"]["custom_conditions"] = conditions;
+    return json;
+  }
+
+  /// \brief Write settings to "<project root>/<name>/settings.json", removing
+  /// any previous results, and return the settings file path
+  fs::path write_settings(jsonParser const &json, std::string name) const {
+    fs::path mc_dir = primclex.dir().root_dir() / name;
+    fs::remove_all(mc_dir);
+    fs::create_directories(mc_dir);
+    fs::path settings_path = mc_dir / "settings.json";
+    json.write(settings_path);
+    return settings_path;
+  }
+
+  test::ZrOProj proj;
+  ScopedNullLogging logging;
+  PrimClex primclex;
+};
+
+}  // namespace test
+
+#endif
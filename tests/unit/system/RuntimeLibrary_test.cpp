@@ -76,3 +76,69 @@ TEST(RuntimeLibraryTest, FunctionTest) {
     throw;
   }
 }
+
+TEST(RuntimeLibraryTest, CompileCacheTest) {
+  test::TmpDir tmpdir;
+  fs::path cache_dir = tmpdir.path() / "cache";
+  setenv("CASM_RUNTIME_LIB_CACHE_DIR", cache_dir.string().c_str(), 1);
+  EXPECT_EQ(RuntimeLibrary::default_cache_dir().first, cache_dir);
+
+  std::string source =
+      "extern \"C\" int forty_two() {\n"
+      "   return 42;\n"
+      "}\n";
+  std::string compile_opt =
+      RuntimeLibrary::default_cxx().first + " -O3 -Wall -fPIC --std=c++17 ";
+  std::string so_opt = RuntimeLibrary::default_cxx().first + " -shared ";
+
+  // write the same source in two "projects"
+  std::vector<std::string> filename_base;
+  for (std::string proj : {"proj_a", "proj_b"}) {
+    fs::create_directories(tmpdir.path() / proj);
+    filename_base.push_back((tmpdir.path() / proj / "runtime_lib").string());
+    fs::ofstream file(fs::path(filename_base.back() + ".cc"));
+    file << source;
+  }
+
+  try {
+    // first is compiled and added to the cache
+    {
+      RuntimeLibrary lib(filename_base[0], compile_opt, so_opt);
+      EXPECT_EQ(42, lib.get_function<int()>("forty_two")());
+    }
+    EXPECT_TRUE(fs::exists(filename_base[0] + ".o"));
+    EXPECT_EQ(std::distance(fs::directory_iterator(cache_dir),
+                            fs::directory_iterator()),
+              3);
+
+    // second is copied from the cache, without compiling an object file
+    {
+      RuntimeLibrary lib(filename_base[1], compile_opt, so_opt);
+      EXPECT_EQ(42, lib.get_function<int()>("forty_two")());
+    }
+    EXPECT_TRUE(fs::exists(filename_base[1] + ".so"));
+    EXPECT_FALSE(fs::exists(filename_base[1] + ".o"));
+    EXPECT_EQ(std::distance(fs::directory_iterator(cache_dir),
+                            fs::directory_iterator()),
+              3);
+
+    // different options do not use the cache entry
+    fs::remove(filename_base[1] + ".so");
+    RuntimeLibrary::compile(filename_base[1], compile_opt + " -DOTHER",
+                            so_opt);
+    EXPECT_TRUE(fs::exists(filename_base[1] + ".o"));
+    EXPECT_EQ(std::distance(fs::directory_iterator(cache_dir),
+                            fs::directory_iterator()),
+              6);
+
+  } catch (runtime_lib_compile_error &e) {
+    e.print(std::cout);
+    unsetenv("CASM_RUNTIME_LIB_CACHE_DIR");
+    throw;
+  } catch (runtime_lib_shared_error &e) {
+    e.print(std::cout);
+    unsetenv("CASM_RUNTIME_LIB_CACHE_DIR");
+    throw;
+  }
+  unsetenv("CASM_RUNTIME_LIB_CACHE_DIR");
+}